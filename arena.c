@@ -0,0 +1,356 @@
+/** !
+ * Geometry arena allocator
+ *
+ * @file arena.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <geometry/arena.h>
+
+// Function definitions
+int geometry_arena_create ( geometry_arena **pp_arena, size_t block_size )
+{
+
+    // Argument check
+    if ( pp_arena == (void *) 0 ) goto no_arena;
+
+    // Initialized data
+    geometry_arena *p_arena = GEOMETRY_REALLOC(0, sizeof(geometry_arena));
+
+    // Error check
+    if ( p_arena == (void *) 0 ) goto no_mem;
+
+    // Store the arena. Blocks are allocated on first use.
+    *p_arena = (geometry_arena)
+    {
+        .block_size = ( block_size ) ? block_size : GEOMETRY_ARENA_BLOCK_SIZE,
+        .p_head     = (void *) 0,
+        .p_current  = (void *) 0,
+        .statistics = { 0 }
+    };
+
+    // Return a pointer to the caller
+    *pp_arena = p_arena;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_arena:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_arena\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_arena_statistics_get ( geometry_arena *p_arena, geometry_arena_statistics *p_statistics )
+{
+
+    // Argument check
+    if ( p_arena      == (void *) 0 ) goto no_arena;
+    if ( p_statistics == (void *) 0 ) goto no_statistics;
+
+    // Return the statistics to the caller
+    *p_statistics = p_arena->statistics;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_arena:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_arena\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_statistics:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_statistics\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_arena_allocate ( geometry_arena *p_arena, size_t size, void **pp_memory )
+{
+
+    // Argument check
+    if ( p_arena   == (void *) 0 ) goto no_arena;
+    if ( pp_memory == (void *) 0 ) goto no_memory;
+    if ( size > SIZE_MAX - sizeof(geometry_arena_block) - GEOMETRY_ARENA_ALIGNMENT ) goto size_too_large;
+
+    // Initialized data
+    geometry_arena_block *p_block = p_arena->p_current;
+    size_t                offset  = 0;
+
+    // Walk forward through blocks retained by earlier resets
+    while ( p_block )
+    {
+
+        // Initialized data
+        uintptr_t base    = (uintptr_t) p_block->data,
+                  aligned = ( base + p_block->used + GEOMETRY_ARENA_ALIGNMENT - 1 ) & ~(uintptr_t)( GEOMETRY_ARENA_ALIGNMENT - 1 );
+
+        // Compute the offset of the allocation
+        offset = (size_t) ( aligned - base );
+
+        // Would the end of the allocation overflow?
+        if ( size > SIZE_MAX - offset - GEOMETRY_ARENA_ALIGNMENT ) goto size_too_large;
+
+        // Does the allocation fit?
+        if ( offset + size <= p_block->size ) goto found_block;
+
+        // Stop at the last block, or at a block too small for the allocation
+        if ( p_block->p_next == (void *) 0 || p_block->p_next->size < size + GEOMETRY_ARENA_ALIGNMENT ) break;
+
+        // Advance, and mark the next block empty. This is deferred from
+        // reset, so that reset does not have to visit every block.
+        p_block         = p_block->p_next;
+        p_block->used   = 0;
+        p_arena->p_current = p_block;
+    }
+
+    // Allocate a new block
+    {
+
+        // Initialized data
+        size_t                block_size  = ( size + GEOMETRY_ARENA_ALIGNMENT > p_arena->block_size ) ? size + GEOMETRY_ARENA_ALIGNMENT : p_arena->block_size;
+        geometry_arena_block *p_new_block = GEOMETRY_REALLOC(0, sizeof(geometry_arena_block) + block_size);
+
+        // Error check
+        if ( p_new_block == (void *) 0 ) goto no_mem;
+
+        // Populate the block
+        *p_new_block = (geometry_arena_block)
+        {
+            .p_next = (void *) 0,
+            .size   = block_size,
+            .used   = 0
+        };
+
+        // Link the block after the current block
+        if ( p_block )
+            p_new_block->p_next = p_block->p_next,
+            p_block->p_next     = p_new_block;
+
+        // First block
+        else
+            p_arena->p_head = p_new_block;
+
+        // Update the statistics
+        p_arena->statistics.bytes_reserved += block_size,
+        p_arena->statistics.blocks++;
+
+        // Compute the offset of the allocation
+        offset = (size_t) ( ( ( (uintptr_t) p_new_block->data + GEOMETRY_ARENA_ALIGNMENT - 1 ) & ~(uintptr_t)( GEOMETRY_ARENA_ALIGNMENT - 1 ) ) - (uintptr_t) p_new_block->data );
+
+        // Use the new block
+        p_block            = p_new_block;
+        p_arena->p_current = p_new_block;
+    }
+
+    found_block:
+    {
+
+        // Update the statistics
+        p_arena->statistics.allocations++,
+        p_arena->statistics.bytes_requested += size,
+        p_arena->statistics.bytes_used      += ( offset + size ) - p_block->used;
+
+        // Update the high water mark
+        if ( p_arena->statistics.bytes_used > p_arena->statistics.high_water )
+            p_arena->statistics.high_water = p_arena->statistics.bytes_used;
+
+        // Bump the block
+        p_block->used = offset + size;
+
+        // Return a pointer to the caller
+        *pp_memory = &p_block->data[offset];
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_arena:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_arena\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_memory:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_memory\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            size_too_large:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"size\" is too large in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_arena_reset ( geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_arena == (void *) 0 ) goto no_arena;
+
+    // Rewind to the first block
+    p_arena->p_current = p_arena->p_head;
+
+    // Empty the first block
+    if ( p_arena->p_head ) p_arena->p_head->used = 0;
+
+    // Update the statistics
+    p_arena->statistics.allocations     = 0,
+    p_arena->statistics.bytes_requested = 0,
+    p_arena->statistics.bytes_used      = 0,
+    p_arena->statistics.resets++;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_arena:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_arena\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void *geometry_allocate ( geometry_arena *p_arena, size_t size )
+{
+
+    // Initialized data
+    void *p_memory = (void *) 0;
+
+    // Heap
+    if ( p_arena == (void *) 0 ) return GEOMETRY_REALLOC(0, size);
+
+    // Arena
+    if ( geometry_arena_allocate(p_arena, size, &p_memory) == 0 ) return (void *) 0;
+
+    // Success
+    return p_memory;
+}
+
+int geometry_arena_destroy ( geometry_arena **pp_arena )
+{
+
+    // Argument check
+    if ( pp_arena  == (void *) 0 ) goto no_arena;
+    if ( *pp_arena == (void *) 0 ) goto pointer_to_null_pointer;
+
+    // Initialized data
+    geometry_arena       *p_arena = *pp_arena;
+    geometry_arena_block *p_block = p_arena->p_head;
+
+    // No more pointer for caller
+    *pp_arena = (void *) 0;
+
+    // Release each block
+    while ( p_block )
+    {
+
+        // Initialized data
+        geometry_arena_block *p_next = p_block->p_next;
+
+        // Release the block
+        p_block = GEOMETRY_REALLOC(p_block, 0);
+
+        // Next
+        p_block = p_next;
+    }
+
+    // Release the arena
+    p_arena = GEOMETRY_REALLOC(p_arena, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_arena:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_arena\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            pointer_to_null_pointer:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"pp_arena\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,739 @@
+/** !
+ * Batched geometry kernels
+ *
+ * @file batch.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <geometry/batch.h>
+#include <geometry/arena.h>
+
+// Instruction set extensions
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+#endif
+
+// Function definitions
+int geometry_point_list_soa_construct ( geometry_point_list_soa *p_soa, geometry_point_list *p_point_list, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_soa        == (void *) 0 ) goto no_soa;
+    if ( p_point_list == (void *) 0 ) goto no_point_list;
+
+    // Initialized data
+    size_t  quantity = p_point_list->quantity;
+    double *p_x      = (void *) 0;
+
+    // Allocate memory for both coordinate arrays
+    if ( quantity )
+    {
+
+        // Allocate x and y in one block
+        p_x = geometry_allocate(p_arena, sizeof(double) * quantity * 2);
+
+        // Error check
+        if ( p_x == (void *) 0 ) goto no_mem;
+    }
+
+    // Store the point list
+    *p_soa = (geometry_point_list_soa)
+    {
+        .quantity = quantity,
+        .p_x      = p_x,
+        .p_y      = ( p_x ) ? p_x + quantity : (void *) 0
+    };
+
+    // Deinterleave the coordinates
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Store x and y
+        p_soa->p_x[i] = p_point_list->p_points[i].x,
+        p_soa->p_y[i] = p_point_list->p_points[i].y;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_soa:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_soa\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_point_list:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_list_soa_distances ( geometry_point_list_soa *p_soa, geometry_point *p_point, double *p_results )
+{
+
+    // Argument check
+    if ( p_soa     == (void *) 0 ) goto no_soa;
+    if ( p_point   == (void *) 0 ) goto no_point;
+    if ( p_results == (void *) 0 ) goto no_results;
+
+    // Initialized data
+    const double *p_x = p_soa->p_x,
+                 *p_y = p_soa->p_y;
+    size_t        n   = p_soa->quantity,
+                  i   = 0;
+
+    #if defined(__AVX2__)
+    {
+
+        // Initialized data
+        __m256d px = _mm256_set1_pd(p_point->x),
+                py = _mm256_set1_pd(p_point->y);
+
+        // Four points at a time
+        for (; i + 4 <= n; i += 4)
+        {
+
+            // Initialized data
+            __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(&p_x[i]), px),
+                    dy = _mm256_sub_pd(_mm256_loadu_pd(&p_y[i]), py);
+
+            // Store the distances
+            _mm256_storeu_pd(&p_results[i], _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy))));
+        }
+    }
+    #elif defined(__SSE2__) || defined(_M_X64)
+    {
+
+        // Initialized data
+        __m128d px = _mm_set1_pd(p_point->x),
+                py = _mm_set1_pd(p_point->y);
+
+        // Two points at a time
+        for (; i + 2 <= n; i += 2)
+        {
+
+            // Initialized data
+            __m128d dx = _mm_sub_pd(_mm_loadu_pd(&p_x[i]), px),
+                    dy = _mm_sub_pd(_mm_loadu_pd(&p_y[i]), py);
+
+            // Store the distances
+            _mm_storeu_pd(&p_results[i], _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy))));
+        }
+    }
+    #endif
+
+    // Remaining points
+    for (; i < n; i++)
+    {
+
+        // Initialized data
+        double dx = p_x[i] - p_point->x,
+               dy = p_y[i] - p_point->y;
+
+        // Store the distance
+        p_results[i] = sqrt(dx * dx + dy * dy);
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_soa:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_soa\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_list_soa_nearest ( geometry_point_list_soa *p_soa, geometry_point *p_point, size_t *p_index, double *p_distance )
+{
+
+    // Argument check
+    if ( p_soa           == (void *) 0 ) goto no_soa;
+    if ( p_point         == (void *) 0 ) goto no_point;
+    if ( p_index         == (void *) 0 ) goto no_index;
+    if ( p_soa->quantity ==          0 ) goto empty_point_list;
+
+    // Initialized data
+    const double *p_x        = p_soa->p_x,
+                 *p_y        = p_soa->p_y;
+    size_t        n          = p_soa->quantity,
+                  i          = 0,
+                  best_index = 0;
+    double        best       = INFINITY;
+
+    // The vector paths compare squared distances, and track the index of
+    // the best point in each lane as a double, which is exact below 2^53
+    #if defined(__AVX2__)
+    if ( n >= 4 )
+    {
+
+        // Initialized data
+        __m256d px     = _mm256_set1_pd(p_point->x),
+                py     = _mm256_set1_pd(p_point->y),
+                lanes  = _mm256_set_pd(3.0, 2.0, 1.0, 0.0),
+                step   = _mm256_set1_pd(4.0),
+                best_d = _mm256_set1_pd(INFINITY),
+                best_i = _mm256_setzero_pd();
+        double  d[4], idx[4];
+
+        // Four points at a time
+        for (; i + 4 <= n; i += 4)
+        {
+
+            // Initialized data
+            __m256d dx   = _mm256_sub_pd(_mm256_loadu_pd(&p_x[i]), px),
+                    dy   = _mm256_sub_pd(_mm256_loadu_pd(&p_y[i]), py),
+                    d2   = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)),
+                    mask = _mm256_cmp_pd(d2, best_d, _CMP_LT_OQ);
+
+            // Keep the nearer point in each lane
+            best_d = _mm256_blendv_pd(best_d, d2, mask);
+            best_i = _mm256_blendv_pd(best_i, lanes, mask);
+            lanes  = _mm256_add_pd(lanes, step);
+        }
+
+        // Reduce the lanes
+        _mm256_storeu_pd(d, best_d);
+        _mm256_storeu_pd(idx, best_i);
+        for (size_t j = 0; j < 4; j++)
+            if ( d[j] < best || ( d[j] == best && (size_t) idx[j] < best_index ) )
+                best = d[j],
+                best_index = (size_t) idx[j];
+    }
+    #elif defined(__SSE2__) || defined(_M_X64)
+    if ( n >= 2 )
+    {
+
+        // Initialized data
+        __m128d px     = _mm_set1_pd(p_point->x),
+                py     = _mm_set1_pd(p_point->y),
+                lanes  = _mm_set_pd(1.0, 0.0),
+                step   = _mm_set1_pd(2.0),
+                best_d = _mm_set1_pd(INFINITY),
+                best_i = _mm_setzero_pd();
+        double  d[2], idx[2];
+
+        // Two points at a time
+        for (; i + 2 <= n; i += 2)
+        {
+
+            // Initialized data
+            __m128d dx   = _mm_sub_pd(_mm_loadu_pd(&p_x[i]), px),
+                    dy   = _mm_sub_pd(_mm_loadu_pd(&p_y[i]), py),
+                    d2   = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)),
+                    mask = _mm_cmplt_pd(d2, best_d);
+
+            // Keep the nearer point in each lane
+            best_d = _mm_or_pd(_mm_and_pd(mask, d2), _mm_andnot_pd(mask, best_d));
+            best_i = _mm_or_pd(_mm_and_pd(mask, lanes), _mm_andnot_pd(mask, best_i));
+            lanes  = _mm_add_pd(lanes, step);
+        }
+
+        // Reduce the lanes
+        _mm_storeu_pd(d, best_d);
+        _mm_storeu_pd(idx, best_i);
+        for (size_t j = 0; j < 2; j++)
+            if ( d[j] < best || ( d[j] == best && (size_t) idx[j] < best_index ) )
+                best = d[j],
+                best_index = (size_t) idx[j];
+    }
+    #endif
+
+    // Remaining points
+    for (; i < n; i++)
+    {
+
+        // Initialized data
+        double dx = p_x[i] - p_point->x,
+               dy = p_y[i] - p_point->y,
+               d2 = dx * dx + dy * dy;
+
+        // Keep the nearer point
+        if ( d2 < best )
+            best = d2,
+            best_index = i;
+    }
+
+    // Return the nearest point to the caller
+    *p_index = best_index;
+
+    // Return the distance to the caller
+    if ( p_distance ) *p_distance = sqrt(best);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_soa:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_soa\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_index:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_index\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            empty_point_list:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_soa\" must have at least one point in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_list_soa_line_distances ( geometry_point_list_soa *p_soa, geometry_line *p_line, double *p_results )
+{
+
+    // Argument check
+    if ( p_soa     == (void *) 0 ) goto no_soa;
+    if ( p_line    == (void *) 0 ) goto no_line;
+    if ( p_results == (void *) 0 ) goto no_results;
+
+    // Initialized data
+    const double *p_x     = p_soa->p_x,
+                 *p_y     = p_soa->p_y;
+    size_t        n       = p_soa->quantity,
+                  i       = 0;
+    double        x0      = p_line->x0,
+                  y0      = p_line->y0,
+                  e       = p_line->x1 - p_line->x0,
+                  f       = p_line->y1 - p_line->y0,
+                  len_sq  = e * e + f * f,
+                  inv_len = ( len_sq != 0 ) ? 1.0 / len_sq : 0.0;
+
+    // Each point is projected onto the line, and the projection is clamped
+    // to the segment. A degenerate line projects everything onto (x0, y0).
+    #if defined(__AVX2__)
+    {
+
+        // Initialized data
+        __m256d vx0  = _mm256_set1_pd(x0),
+                vy0  = _mm256_set1_pd(y0),
+                ve   = _mm256_set1_pd(e),
+                vf   = _mm256_set1_pd(f),
+                vinv = _mm256_set1_pd(inv_len),
+                zero = _mm256_setzero_pd(),
+                one  = _mm256_set1_pd(1.0);
+
+        // Four points at a time
+        for (; i + 4 <= n; i += 4)
+        {
+
+            // Initialized data
+            __m256d c  = _mm256_sub_pd(_mm256_loadu_pd(&p_x[i]), vx0),
+                    d  = _mm256_sub_pd(_mm256_loadu_pd(&p_y[i]), vy0),
+                    t  = _mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(c, ve), _mm256_mul_pd(d, vf)), vinv),
+                    dx, dy;
+
+            // Clamp the projection to the segment
+            t  = _mm256_min_pd(_mm256_max_pd(t, zero), one);
+            dx = _mm256_sub_pd(c, _mm256_mul_pd(t, ve));
+            dy = _mm256_sub_pd(d, _mm256_mul_pd(t, vf));
+
+            // Store the distances
+            _mm256_storeu_pd(&p_results[i], _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy))));
+        }
+    }
+    #elif defined(__SSE2__) || defined(_M_X64)
+    {
+
+        // Initialized data
+        __m128d vx0  = _mm_set1_pd(x0),
+                vy0  = _mm_set1_pd(y0),
+                ve   = _mm_set1_pd(e),
+                vf   = _mm_set1_pd(f),
+                vinv = _mm_set1_pd(inv_len),
+                zero = _mm_setzero_pd(),
+                one  = _mm_set1_pd(1.0);
+
+        // Two points at a time
+        for (; i + 2 <= n; i += 2)
+        {
+
+            // Initialized data
+            __m128d c  = _mm_sub_pd(_mm_loadu_pd(&p_x[i]), vx0),
+                    d  = _mm_sub_pd(_mm_loadu_pd(&p_y[i]), vy0),
+                    t  = _mm_mul_pd(_mm_add_pd(_mm_mul_pd(c, ve), _mm_mul_pd(d, vf)), vinv),
+                    dx, dy;
+
+            // Clamp the projection to the segment
+            t  = _mm_min_pd(_mm_max_pd(t, zero), one);
+            dx = _mm_sub_pd(c, _mm_mul_pd(t, ve));
+            dy = _mm_sub_pd(d, _mm_mul_pd(t, vf));
+
+            // Store the distances
+            _mm_storeu_pd(&p_results[i], _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy))));
+        }
+    }
+    #endif
+
+    // Remaining points
+    for (; i < n; i++)
+    {
+
+        // Initialized data
+        double c  = p_x[i] - x0,
+               d  = p_y[i] - y0,
+               t  = (c * e + d * f) * inv_len,
+               dx = 0,
+               dy = 0;
+
+        // Clamp the projection to the segment
+        t  = ( t < 0 ) ? 0 : ( t > 1 ) ? 1 : t;
+        dx = c - t * e;
+        dy = d - t * f;
+
+        // Store the distance
+        p_results[i] = sqrt(dx * dx + dy * dy);
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_soa:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_soa\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_line:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_line\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_list_soa_in_polygon ( geometry_point_list_soa *p_soa, geometry_polygon *p_polygon, bool *p_results )
+{
+
+    // Argument check
+    if ( p_soa     == (void *) 0 ) goto no_soa;
+    if ( p_polygon == (void *) 0 ) goto no_polygon;
+    if ( p_results == (void *) 0 ) goto no_results;
+
+    // Initialized data
+    const double         *p_x         = p_soa->p_x,
+                         *p_y         = p_soa->p_y;
+    const geometry_point *p_verticies = p_polygon->p_verticies;
+    size_t                n           = p_soa->quantity,
+                          m           = p_polygon->quantity,
+                          i           = 0;
+
+    // A polygon without verticies contains nothing
+    if ( m == 0 )
+    {
+
+        // Every point is outside
+        for (; i < n; i++) p_results[i] = false;
+
+        // Success
+        return 1;
+    }
+
+    // Each point casts a ray toward +x, and counts the edges it crosses.
+    // Vector lanes compute the crossing with the same operations in the
+    // same order as the scalar loop, and an edge that does not straddle a
+    // lane's ray is masked off, so the division by a horizontal edge's
+    // zero height never reaches a result.
+    #if defined(__AVX2__)
+    {
+
+        // Eight points at a time
+        for (; i + 8 <= n; i += 8)
+        {
+
+            // Initialized data
+            __m256d px0     = _mm256_loadu_pd(&p_x[i]),
+                    px1     = _mm256_loadu_pd(&p_x[i + 4]),
+                    py0     = _mm256_loadu_pd(&p_y[i]),
+                    py1     = _mm256_loadu_pd(&p_y[i + 4]),
+                    inside0 = _mm256_setzero_pd(),
+                    inside1 = _mm256_setzero_pd();
+            unsigned mask0  = 0,
+                     mask1  = 0;
+
+            // Test each edge
+            for (size_t e = 0, j = m - 1; e < m; j = e++)
+            {
+
+                // Initialized data
+                __m256d ax = _mm256_set1_pd(p_verticies[j].x),
+                        ay = _mm256_set1_pd(p_verticies[j].y),
+                        by = _mm256_set1_pd(p_verticies[e].y),
+                        dx = _mm256_set1_pd(p_verticies[e].x - p_verticies[j].x),
+                        dy = _mm256_set1_pd(p_verticies[e].y - p_verticies[j].y),
+                        s0 = _mm256_xor_pd(_mm256_cmp_pd(ay, py0, _CMP_GT_OQ), _mm256_cmp_pd(by, py0, _CMP_GT_OQ)),
+                        s1 = _mm256_xor_pd(_mm256_cmp_pd(ay, py1, _CMP_GT_OQ), _mm256_cmp_pd(by, py1, _CMP_GT_OQ)),
+                        x0, x1;
+
+                // Most edges straddle none of the rays, so skip the division
+                if ( _mm256_movemask_pd(_mm256_or_pd(s0, s1)) == 0 ) continue;
+
+                // Compute where the rays meet the edge
+                x0 = _mm256_add_pd(ax, _mm256_div_pd(_mm256_mul_pd(_mm256_sub_pd(py0, ay), dx), dy)),
+                x1 = _mm256_add_pd(ax, _mm256_div_pd(_mm256_mul_pd(_mm256_sub_pd(py1, ay), dx), dy));
+
+                // Flip the lanes whose rays cross the edge
+                inside0 = _mm256_xor_pd(inside0, _mm256_and_pd(s0, _mm256_cmp_pd(px0, x0, _CMP_LT_OQ))),
+                inside1 = _mm256_xor_pd(inside1, _mm256_and_pd(s1, _mm256_cmp_pd(px1, x1, _CMP_LT_OQ)));
+            }
+
+            // Extract the lanes
+            mask0 = (unsigned) _mm256_movemask_pd(inside0),
+            mask1 = (unsigned) _mm256_movemask_pd(inside1);
+
+            // Store the results
+            for (unsigned k = 0; k < 4; k++)
+                p_results[i + k]     = ( mask0 >> k ) & 1,
+                p_results[i + k + 4] = ( mask1 >> k ) & 1;
+        }
+    }
+    #elif defined(__SSE2__) || defined(_M_X64)
+    {
+
+        // Four points at a time
+        for (; i + 4 <= n; i += 4)
+        {
+
+            // Initialized data
+            __m128d px0     = _mm_loadu_pd(&p_x[i]),
+                    px1     = _mm_loadu_pd(&p_x[i + 2]),
+                    py0     = _mm_loadu_pd(&p_y[i]),
+                    py1     = _mm_loadu_pd(&p_y[i + 2]),
+                    inside0 = _mm_setzero_pd(),
+                    inside1 = _mm_setzero_pd();
+            unsigned mask0  = 0,
+                     mask1  = 0;
+
+            // Test each edge
+            for (size_t e = 0, j = m - 1; e < m; j = e++)
+            {
+
+                // Initialized data
+                __m128d ax = _mm_set1_pd(p_verticies[j].x),
+                        ay = _mm_set1_pd(p_verticies[j].y),
+                        by = _mm_set1_pd(p_verticies[e].y),
+                        dx = _mm_set1_pd(p_verticies[e].x - p_verticies[j].x),
+                        dy = _mm_set1_pd(p_verticies[e].y - p_verticies[j].y),
+                        s0 = _mm_xor_pd(_mm_cmpgt_pd(ay, py0), _mm_cmpgt_pd(by, py0)),
+                        s1 = _mm_xor_pd(_mm_cmpgt_pd(ay, py1), _mm_cmpgt_pd(by, py1)),
+                        x0, x1;
+
+                // Most edges straddle none of the rays, so skip the division
+                if ( _mm_movemask_pd(_mm_or_pd(s0, s1)) == 0 ) continue;
+
+                // Compute where the rays meet the edge
+                x0 = _mm_add_pd(ax, _mm_div_pd(_mm_mul_pd(_mm_sub_pd(py0, ay), dx), dy)),
+                x1 = _mm_add_pd(ax, _mm_div_pd(_mm_mul_pd(_mm_sub_pd(py1, ay), dx), dy));
+
+                // Flip the lanes whose rays cross the edge
+                inside0 = _mm_xor_pd(inside0, _mm_and_pd(s0, _mm_cmplt_pd(px0, x0))),
+                inside1 = _mm_xor_pd(inside1, _mm_and_pd(s1, _mm_cmplt_pd(px1, x1)));
+            }
+
+            // Extract the lanes
+            mask0 = (unsigned) _mm_movemask_pd(inside0),
+            mask1 = (unsigned) _mm_movemask_pd(inside1);
+
+            // Store the results
+            for (unsigned k = 0; k < 2; k++)
+                p_results[i + k]     = ( mask0 >> k ) & 1,
+                p_results[i + k + 2] = ( mask1 >> k ) & 1;
+        }
+    }
+    #endif
+
+    // Remaining points
+    for (; i < n; i++)
+    {
+
+        // Initialized data
+        bool   inside = false;
+        double px     = p_x[i],
+               py     = p_y[i];
+
+        // Test each edge
+        for (size_t e = 0, j = m - 1; e < m; j = e++)
+        {
+
+            // Initialized data
+            geometry_point a = p_verticies[j],
+                           b = p_verticies[e];
+
+            // Does the edge straddle the ray?
+            if ( ( a.y > py ) != ( b.y > py ) )
+            {
+
+                // Initialized data
+                double x = a.x + ( py - a.y ) * ( b.x - a.x ) / ( b.y - a.y );
+
+                // Crossing
+                if ( px < x ) inside = !inside;
+            }
+        }
+
+        // Store the result
+        p_results[i] = inside;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_soa:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_soa\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_list_soa_destroy ( geometry_point_list_soa *p_soa )
+{
+
+    // Argument check
+    if ( p_soa == (void *) 0 ) goto no_soa;
+
+    // Free the coordinates. The y array lives in the same block as x.
+    if ( p_soa->p_x ) p_soa->p_x = GEOMETRY_REALLOC(p_soa->p_x, 0);
+
+    // Clear the point list
+    *p_soa = (geometry_point_list_soa) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_soa:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_soa\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,1349 @@
+/** !
+ * Polygon boolean operations
+ *
+ * @file boolean.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <math.h>
+#include <string.h>
+
+// Header
+#include <geometry/boolean.h>
+#include <geometry/arena.h>
+#include <geometry/prepared.h>
+#include <geometry/sweep.h>
+
+// Structure declarations
+struct geometry_boolean_operand_s;
+struct geometry_boolean_cut_s;
+struct geometry_boolean_segment_s;
+
+// Type definitions
+typedef struct geometry_boolean_operand_s geometry_boolean_operand;
+typedef struct geometry_boolean_cut_s     geometry_boolean_cut;
+typedef struct geometry_boolean_segment_s geometry_boolean_segment;
+
+// Structure definitions
+// An operand is a list of rings. Each ring has an envelope and a prepared
+// polygon, so that points are located in the operand quickly. The edges
+// of every ring are stored with the inside of the operand on their left.
+struct geometry_boolean_operand_s
+{
+    size_t                      quantity;
+    geometry_polygon           *p_rings;
+    geometry_envelope          *p_envelopes;
+    geometry_prepared_polygon **pp_prepared;
+    geometry_line_list          edges;
+    geometry_envelope           envelope;
+};
+
+// A point where an edge is cut. The position orders the cuts of an edge
+// from its start to its end.
+struct geometry_boolean_cut_s
+{
+    size_t         edge;
+    double         position;
+    geometry_point point;
+};
+
+// A piece of an edge, stored from its lesser point to its greater point.
+// Forward is true if the piece runs the same way as its edge.
+struct geometry_boolean_segment_s
+{
+    geometry_point a,
+                   b;
+    size_t         operand;
+    bool           forward;
+};
+
+// Data
+// A whole turn, in radians
+static const double geometry_boolean_tau = 6.283185307179586;
+
+// Forward declarations
+/** !
+ * Order two points by x, then by y
+ *
+ * @param p_a a point
+ * @param p_b another point
+ *
+ * @return < 0 if a is before b, > 0 if b is before a, else 0
+ */
+static int geometry_boolean_point_compare ( const geometry_point *p_a, const geometry_point *p_b );
+
+/** !
+ * Order two cuts by edge, then by position
+ *
+ * @param p_a a cut
+ * @param p_b another cut
+ *
+ * @return < 0 if a is before b, > 0 if b is before a, else 0
+ */
+static int geometry_boolean_cut_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * Order two segments by their points, then by operand
+ *
+ * @param p_a a segment
+ * @param p_b another segment
+ *
+ * @return < 0 if a is before b, > 0 if b is before a, else 0
+ */
+static int geometry_boolean_segment_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * Order two lines by their first point
+ *
+ * @param p_a a line
+ * @param p_b another line
+ *
+ * @return < 0 if a is before b, > 0 if b is before a, else 0
+ */
+static int geometry_boolean_line_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * Decide if a point is in the result of an operation
+ *
+ * @param operation the operation
+ * @param a         true if the point is inside of the first operand
+ * @param b         true if the point is inside of the second operand
+ *
+ * @return true if the point is inside of the result, else false
+ */
+static bool geometry_boolean_in ( enum geometry_boolean_e operation, bool a, bool b );
+
+/** !
+ * Construct an operand from a polygon or a polygon list
+ *
+ * @param p_operand  return
+ * @param p_geometry the polygon or polygon list
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_boolean_operand_construct ( geometry_boolean_operand *p_operand, geometry *p_geometry );
+
+/** !
+ * Test if a point is inside of an operand, by the even odd rule
+ *
+ * @param p_operand the operand
+ * @param p_point   the point
+ *
+ * @return true if the point is inside, else false
+ */
+static bool geometry_boolean_operand_contains ( geometry_boolean_operand *p_operand, geometry_point *p_point );
+
+/** !
+ * Destroy an operand
+ *
+ * @param p_operand the operand
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_boolean_operand_destroy ( geometry_boolean_operand *p_operand );
+
+/** !
+ * Test if a ring is strictly convex
+ *
+ * @param p_ring the ring
+ *
+ * @return true if the ring is strictly convex, else false
+ */
+static bool geometry_boolean_convex_ring ( geometry_polygon *p_ring );
+
+/** !
+ * Intersect two strictly convex rings by walking their boundaries
+ * together (O'Rourke, Chien, Olson and Naddor). Rings that touch, or
+ * that have colinear edges, are left to the overlay.
+ *
+ * @param p_p          a ring
+ * @param p_q          another ring
+ * @param p_result     return room for 4 * ( n + m ) verticies
+ * @param p_quantity   return the quantity of verticies
+ * @param p_degenerate return true if the rings touch
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_boolean_convex ( geometry_polygon *p_p, geometry_polygon *p_q, geometry_point *p_result, size_t *p_quantity, bool *p_degenerate );
+
+/** !
+ * Cut the edges of two operands where they meet
+ *
+ * @param p_operands    the operands
+ * @param pp_splits     return the cuts, sorted by edge and position
+ * @param p_quantity    return the quantity of cuts
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_boolean_split ( geometry_boolean_operand *p_operands, geometry_boolean_cut **pp_splits, size_t *p_quantity );
+
+/** !
+ * Link directed edges into rings. The inside of each ring is on its left,
+ * and rings that meet at a vertex are kept apart.
+ *
+ * @param p_edges    the edges
+ * @param quantity   the quantity of edges
+ * @param p_result   return
+ * @param p_arena    the arena, or null for the heap
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_boolean_link ( geometry_line *p_edges, size_t quantity, geometry *p_result, geometry_arena *p_arena );
+
+/** !
+ * Overlay two operands
+ *
+ * @param p_operands the operands
+ * @param operation  the operation
+ * @param p_result   return
+ * @param p_arena    the arena, or null for the heap
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_boolean_overlay ( geometry_boolean_operand *p_operands, enum geometry_boolean_e operation, geometry *p_result, geometry_arena *p_arena );
+
+// Function definitions
+int geometry_boolean ( geometry *p_a, geometry *p_b, enum geometry_boolean_e operation, geometry *p_result, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_a       == (void *) 0                ) goto no_a;
+    if ( p_b       == (void *) 0                ) goto no_b;
+    if ( p_result  == (void *) 0                ) goto no_result;
+    if ( operation >= GEOMETRY_BOOLEAN_QUANTITY ) goto invalid_operation;
+
+    // Initialized data
+    geometry_boolean_operand _operands[2] = { 0 };
+    geometry_point          *p_verticies  = (void *) 0;
+
+    // Construct the operands
+    if ( geometry_boolean_operand_construct(&_operands[0], p_a) == 0 ) goto failed_to_construct_operand;
+    if ( geometry_boolean_operand_construct(&_operands[1], p_b) == 0 ) goto failed_to_construct_operand;
+
+    // Strategy
+    if ( operation == GEOMETRY_BOOLEAN_INTERSECTION )
+    {
+
+        // Operands with disjoint envelopes have no intersection
+        if ( _operands[0].envelope.x_max < _operands[1].envelope.x_min || _operands[1].envelope.x_max < _operands[0].envelope.x_min ||
+             _operands[0].envelope.y_max < _operands[1].envelope.y_min || _operands[1].envelope.y_max < _operands[0].envelope.y_min )
+        {
+
+            // Store an empty polygon list
+            if ( geometry_polygon_list_construct(p_result, (void *) 0, 0, p_arena) == 0 ) goto failed_to_construct_result;
+
+            // Done
+            goto done;
+        }
+
+        // Convex rings are intersected in linear time
+        if ( _operands[0].quantity == 1 && geometry_boolean_convex_ring(&_operands[0].p_rings[0]) &&
+             _operands[1].quantity == 1 && geometry_boolean_convex_ring(&_operands[1].p_rings[0]) )
+        {
+
+            // Initialized data
+            size_t           quantity   = 0;
+            bool             degenerate = false;
+            geometry_polygon _polygon   = { 0 };
+
+            // Allocate memory for the verticies
+            p_verticies = GEOMETRY_REALLOC(0, sizeof(geometry_point) * 4 * ( _operands[0].p_rings[0].quantity + _operands[1].p_rings[0].quantity ));
+
+            // Error check
+            if ( p_verticies == (void *) 0 ) goto no_mem;
+
+            // Intersect the rings
+            if ( geometry_boolean_convex(&_operands[0].p_rings[0], &_operands[1].p_rings[0], p_verticies, &quantity, &degenerate) == 0 ) goto failed_to_overlay;
+
+            // Store the result
+            if ( degenerate == false )
+            {
+
+                // Populate the polygon
+                _polygon = (geometry_polygon) { .quantity = quantity, .p_verticies = p_verticies };
+
+                // Construct the result
+                if ( geometry_polygon_list_construct(p_result, &_polygon, ( quantity ) ? 1 : 0, p_arena) == 0 ) goto failed_to_construct_result;
+
+                // Done
+                goto done;
+            }
+        }
+    }
+
+    // Overlay the operands
+    if ( geometry_boolean_overlay(_operands, operation, p_result, p_arena) == 0 ) goto failed_to_overlay;
+
+    done:
+
+    // Clean up
+    if ( p_verticies ) p_verticies = GEOMETRY_REALLOC(p_verticies, 0);
+    geometry_boolean_operand_destroy(&_operands[0]);
+    geometry_boolean_operand_destroy(&_operands[1]);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            invalid_operation:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"operation\" must be less than GEOMETRY_BOOLEAN_QUANTITY in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_construct_operand:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to construct operand in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_boolean_operand_destroy(&_operands[0]);
+                geometry_boolean_operand_destroy(&_operands[1]);
+
+                // Error
+                return 0;
+
+            failed_to_overlay:
+            failed_to_construct_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to compute boolean operation in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( p_verticies ) p_verticies = GEOMETRY_REALLOC(p_verticies, 0);
+                geometry_boolean_operand_destroy(&_operands[0]);
+                geometry_boolean_operand_destroy(&_operands[1]);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_boolean_operand_destroy(&_operands[0]);
+                geometry_boolean_operand_destroy(&_operands[1]);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_boolean_point_compare ( const geometry_point *p_a, const geometry_point *p_b )
+{
+
+    // By x
+    if ( p_a->x != p_b->x ) return ( p_a->x > p_b->x ) ? 1 : -1;
+
+    // By y
+    return ( p_a->y > p_b->y ) - ( p_a->y < p_b->y );
+}
+
+static int geometry_boolean_cut_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_boolean_cut *p_cut_a = p_a,
+                               *p_cut_b = p_b;
+
+    // By edge
+    if ( p_cut_a->edge != p_cut_b->edge ) return ( p_cut_a->edge > p_cut_b->edge ) ? 1 : -1;
+
+    // By position
+    return ( p_cut_a->position > p_cut_b->position ) - ( p_cut_a->position < p_cut_b->position );
+}
+
+static int geometry_boolean_segment_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_boolean_segment *p_segment_a = p_a,
+                                   *p_segment_b = p_b;
+    int                             ret         = 0;
+
+    // By points
+    if ( ( ret = geometry_boolean_point_compare(&p_segment_a->a, &p_segment_b->a) ) ) return ret;
+    if ( ( ret = geometry_boolean_point_compare(&p_segment_a->b, &p_segment_b->b) ) ) return ret;
+
+    // By operand
+    return ( p_segment_a->operand > p_segment_b->operand ) - ( p_segment_a->operand < p_segment_b->operand );
+}
+
+static int geometry_boolean_line_compare ( const void *p_a, const void *p_b )
+{
+
+    // Done
+    return geometry_boolean_point_compare(&(geometry_point) { ((const geometry_line *) p_a)->x0, ((const geometry_line *) p_a)->y0 },
+                                          &(geometry_point) { ((const geometry_line *) p_b)->x0, ((const geometry_line *) p_b)->y0 });
+}
+
+static bool geometry_boolean_in ( enum geometry_boolean_e operation, bool a, bool b )
+{
+
+    // Strategy
+    switch ( operation )
+    {
+        case GEOMETRY_BOOLEAN_INTERSECTION:         return a && b;
+        case GEOMETRY_BOOLEAN_UNION:                return a || b;
+        case GEOMETRY_BOOLEAN_DIFFERENCE:           return a && !b;
+        case GEOMETRY_BOOLEAN_SYMMETRIC_DIFFERENCE: return a != b;
+        default:                                    return false;
+    }
+}
+
+static int geometry_boolean_operand_construct ( geometry_boolean_operand *p_operand, geometry *p_geometry )
+{
+
+    // Initialized data
+    size_t ring_quantity = 0,
+           edge_quantity = 0;
+
+    // Clear the operand
+    *p_operand = (geometry_boolean_operand)
+    {
+        .envelope = { INFINITY, INFINITY, -INFINITY, -INFINITY }
+    };
+
+    // Count the rings
+    switch ( p_geometry->type )
+    {
+        case GEOMETRY_POLYGON:
+            ring_quantity = 1;
+            break;
+
+        case GEOMETRY_POLYGON_LIST:
+            ring_quantity = p_geometry->polygon_list.quantity;
+            break;
+
+        default:
+            goto unsupported_type;
+    }
+
+    // Allocate the rings, the envelopes and the prepared polygons in one block
+    p_operand->p_rings = GEOMETRY_REALLOC(0, ( sizeof(geometry_polygon) + sizeof(geometry_envelope) + sizeof(geometry_prepared_polygon *) ) * ( ring_quantity + 1 ));
+
+    // Error check
+    if ( p_operand->p_rings == (void *) 0 ) goto no_mem;
+
+    // Carve the block
+    p_operand->p_envelopes = (geometry_envelope *) ( p_operand->p_rings + ring_quantity + 1 );
+    p_operand->pp_prepared = (geometry_prepared_polygon **) ( p_operand->p_envelopes + ring_quantity + 1 );
+
+    // Store each ring with at least three verticies
+    for (size_t i = 0; i < ring_quantity; i++)
+    {
+
+        // Initialized data
+        geometry_polygon _ring = { 0 };
+
+        // Get the ring
+        if ( p_geometry->type == GEOMETRY_POLYGON ) _ring = p_geometry->polygon;
+        else geometry_polygon_list_polygon(&p_geometry->polygon_list, i, &_ring);
+
+        // Skip rings with no area
+        if ( _ring.quantity < 3 ) continue;
+
+        // Store the ring
+        p_operand->p_rings[p_operand->quantity]     = _ring,
+        p_operand->p_envelopes[p_operand->quantity] = (geometry_envelope) { INFINITY, INFINITY, -INFINITY, -INFINITY },
+        p_operand->pp_prepared[p_operand->quantity] = (void *) 0;
+
+        // Compute the envelope of the ring
+        for (size_t j = 0; j < _ring.quantity; j++)
+            p_operand->p_envelopes[p_operand->quantity].x_min = fmin(p_operand->p_envelopes[p_operand->quantity].x_min, _ring.p_verticies[j].x),
+            p_operand->p_envelopes[p_operand->quantity].y_min = fmin(p_operand->p_envelopes[p_operand->quantity].y_min, _ring.p_verticies[j].y),
+            p_operand->p_envelopes[p_operand->quantity].x_max = fmax(p_operand->p_envelopes[p_operand->quantity].x_max, _ring.p_verticies[j].x),
+            p_operand->p_envelopes[p_operand->quantity].y_max = fmax(p_operand->p_envelopes[p_operand->quantity].y_max, _ring.p_verticies[j].y);
+
+        // Grow the envelope of the operand
+        p_operand->envelope.x_min = fmin(p_operand->envelope.x_min, p_operand->p_envelopes[p_operand->quantity].x_min),
+        p_operand->envelope.y_min = fmin(p_operand->envelope.y_min, p_operand->p_envelopes[p_operand->quantity].y_min),
+        p_operand->envelope.x_max = fmax(p_operand->envelope.x_max, p_operand->p_envelopes[p_operand->quantity].x_max),
+        p_operand->envelope.y_max = fmax(p_operand->envelope.y_max, p_operand->p_envelopes[p_operand->quantity].y_max);
+
+        // Count the edges
+        edge_quantity += _ring.quantity;
+
+        // Prepare the ring
+        if ( geometry_prepared_polygon_construct(&p_operand->pp_prepared[p_operand->quantity++], &_ring) == 0 ) goto failed_to_prepare_ring;
+    }
+
+    // Allocate memory for the edges
+    p_operand->edges.p_lines = GEOMETRY_REALLOC(0, sizeof(geometry_line) * ( edge_quantity + 1 ));
+
+    // Error check
+    if ( p_operand->edges.p_lines == (void *) 0 ) goto no_mem;
+
+    // Store the edges of each ring with the inside of the operand on
+    // their left. A ring inside of an odd quantity of other rings is a
+    // hole, and turns the other way.
+    for (size_t i = 0; i < p_operand->quantity; i++)
+    {
+
+        // Initialized data
+        geometry_polygon *p_ring  = &p_operand->p_rings[i];
+        geometry_point   *p_first = &p_ring->p_verticies[0];
+        double            area    = 0;
+        bool              hole    = false;
+
+        // Compute twice the signed area
+        for (size_t j = 0, k = p_ring->quantity - 1; j < p_ring->quantity; k = j++)
+            area += ( p_ring->p_verticies[k].x * p_ring->p_verticies[j].y ) - ( p_ring->p_verticies[j].x * p_ring->p_verticies[k].y );
+
+        // Count the rings around this ring
+        for (size_t j = 0; j < p_operand->quantity; j++)
+        {
+
+            // Initialized data
+            bool inside = false;
+
+            // Skip this ring, and rings whose envelope misses it
+            if ( j == i ) continue;
+            if ( p_first->x < p_operand->p_envelopes[j].x_min || p_first->x > p_operand->p_envelopes[j].x_max ) continue;
+            if ( p_first->y < p_operand->p_envelopes[j].y_min || p_first->y > p_operand->p_envelopes[j].y_max ) continue;
+
+            // Test the ring
+            geometry_prepared_polygon_contains(p_operand->pp_prepared[j], p_first, &inside);
+
+            // Count the ring
+            if ( inside ) hole = !hole;
+        }
+
+        // Store the edges
+        for (size_t j = 0; j < p_ring->quantity; j++)
+        {
+
+            // Initialized data
+            geometry_point *p_a = &p_ring->p_verticies[j],
+                           *p_b = &p_ring->p_verticies[( j + 1 ) % p_ring->quantity];
+
+            // Skip edges with no length
+            if ( p_a->x == p_b->x && p_a->y == p_b->y ) continue;
+
+            // Turn the edge
+            if ( ( area < 0 ) != hole )
+            {
+                geometry_point *p_t = p_a;
+                p_a = p_b, p_b = p_t;
+            }
+
+            // Store the edge
+            p_operand->edges.p_lines[p_operand->edges.quantity++] = (geometry_line) { p_a->x, p_a->y, p_b->x, p_b->y };
+        }
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            unsupported_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Operands must be polygons or polygon lists in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_prepare_ring:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to prepare ring in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static bool geometry_boolean_operand_contains ( geometry_boolean_operand *p_operand, geometry_point *p_point )
+{
+
+    // Initialized data
+    bool ret = false;
+
+    // Count the rings around the point
+    for (size_t i = 0; i < p_operand->quantity; i++)
+    {
+
+        // Initialized data
+        bool inside = false;
+
+        // Skip rings whose envelope misses the point
+        if ( p_point->x < p_operand->p_envelopes[i].x_min || p_point->x > p_operand->p_envelopes[i].x_max ) continue;
+        if ( p_point->y < p_operand->p_envelopes[i].y_min || p_point->y > p_operand->p_envelopes[i].y_max ) continue;
+
+        // Test the ring
+        geometry_prepared_polygon_contains(p_operand->pp_prepared[i], p_point, &inside);
+
+        // Count the ring
+        if ( inside ) ret = !ret;
+    }
+
+    // Done
+    return ret;
+}
+
+static int geometry_boolean_operand_destroy ( geometry_boolean_operand *p_operand )
+{
+
+    // Release the prepared polygons
+    for (size_t i = 0; i < p_operand->quantity; i++)
+        if ( p_operand->pp_prepared[i] ) geometry_prepared_polygon_destroy(&p_operand->pp_prepared[i]);
+
+    // Release the rings, the envelopes and the prepared polygons
+    if ( p_operand->p_rings ) p_operand->p_rings = GEOMETRY_REALLOC(p_operand->p_rings, 0);
+
+    // Release the edges
+    if ( p_operand->edges.p_lines ) p_operand->edges.p_lines = GEOMETRY_REALLOC(p_operand->edges.p_lines, 0);
+
+    // Clear the operand
+    *p_operand = (geometry_boolean_operand) { 0 };
+
+    // Success
+    return 1;
+}
+
+static bool geometry_boolean_convex_ring ( geometry_polygon *p_ring )
+{
+
+    // Initialized data
+    size_t quantity = p_ring->quantity,
+           changes  = 0;
+    int    turn     = 0,
+           heading  = 0;
+
+    // Every turn must be the same way, and the ring must wind once, so x
+    // changes direction no more than twice
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        geometry_point *p_a = &p_ring->p_verticies[i],
+                       *p_b = &p_ring->p_verticies[( i + 1 ) % quantity],
+                       *p_c = &p_ring->p_verticies[( i + 2 ) % quantity];
+        int             t   = geometry_point_ccw(p_a, p_b, p_c),
+                        h   = ( p_b->x > p_a->x ) - ( p_b->x < p_a->x );
+
+        // Colinear verticies, and turns the other way
+        if ( t == 0 || ( turn && t != turn ) ) return false;
+
+        // Store the turn
+        turn = t;
+
+        // Count changes of direction
+        if ( h )
+        {
+            if ( heading && h != heading ) changes++;
+            heading = h;
+        }
+    }
+
+    // Done
+    return changes <= 2;
+}
+
+static int geometry_boolean_convex ( geometry_polygon *p_p, geometry_polygon *p_q, geometry_point *p_result, size_t *p_quantity, bool *p_degenerate )
+{
+
+    // Initialized data
+    size_t          n          = p_p->quantity,
+                    m          = p_q->quantity,
+                    a          = 0,
+                    b          = 0,
+                    aa         = 0,
+                    ba         = 0,
+                    quantity   = 0;
+    geometry_point *p_points   = GEOMETRY_REALLOC(0, sizeof(geometry_point) * ( n + m )),
+                   *P          = p_points,
+                   *Q          = p_points + n;
+    double          area_p     = 0,
+                    area_q     = 0;
+    int             inside     = 0;
+    bool            first      = true,
+                    disjoint   = false;
+
+    // Error check
+    if ( p_points == (void *) 0 ) goto no_mem;
+
+    // Compute twice the signed area of each ring
+    for (size_t i = 0, j = n - 1; i < n; j = i++) area_p += ( p_p->p_verticies[j].x * p_p->p_verticies[i].y ) - ( p_p->p_verticies[i].x * p_p->p_verticies[j].y );
+    for (size_t i = 0, j = m - 1; i < m; j = i++) area_q += ( p_q->p_verticies[j].x * p_q->p_verticies[i].y ) - ( p_q->p_verticies[i].x * p_q->p_verticies[j].y );
+
+    // Copy each ring counterclockwise
+    for (size_t i = 0; i < n; i++) P[i] = p_p->p_verticies[( area_p < 0 ) ? n - 1 - i : i];
+    for (size_t i = 0; i < m; i++) Q[i] = p_q->p_verticies[( area_q < 0 ) ? m - 1 - i : i];
+
+    // Assume the rings cross
+    *p_degenerate = false;
+
+    // Advance along whichever edge aims at the other, storing the verticies
+    // of the ring that is inside, and the points where the rings cross
+    do
+    {
+
+        // Initialized data
+        size_t         a1    = ( a + n - 1 ) % n,
+                       b1    = ( b + m - 1 ) % m;
+        geometry_point A     = { P[a].x - P[a1].x, P[a].y - P[a1].y },
+                       B     = { Q[b].x - Q[b1].x, Q[b].y - Q[b1].y };
+        double         c     = ( A.x * B.y ) - ( A.y * B.x );
+        int            cross = ( c > 0 ) - ( c < 0 ),
+                       aHB   = geometry_point_ccw(&Q[b1], &Q[b], &P[a]),
+                       bHA   = geometry_point_ccw(&P[a1], &P[a], &Q[b]),
+                       o1    = geometry_point_ccw(&P[a1], &P[a], &Q[b1]),
+                       o3    = geometry_point_ccw(&Q[b1], &Q[b], &P[a1]);
+
+        // A vertex on the other edge is left to the overlay
+        if ( ( o1  == 0 && fmin(P[a1].x, P[a].x) <= Q[b1].x && Q[b1].x <= fmax(P[a1].x, P[a].x) && fmin(P[a1].y, P[a].y) <= Q[b1].y && Q[b1].y <= fmax(P[a1].y, P[a].y) ) ||
+             ( bHA == 0 && fmin(P[a1].x, P[a].x) <= Q[b].x  && Q[b].x  <= fmax(P[a1].x, P[a].x) && fmin(P[a1].y, P[a].y) <= Q[b].y  && Q[b].y  <= fmax(P[a1].y, P[a].y) ) ||
+             ( o3  == 0 && fmin(Q[b1].x, Q[b].x) <= P[a1].x && P[a1].x <= fmax(Q[b1].x, Q[b].x) && fmin(Q[b1].y, Q[b].y) <= P[a1].y && P[a1].y <= fmax(Q[b1].y, Q[b].y) ) ||
+             ( aHB == 0 && fmin(Q[b1].x, Q[b].x) <= P[a].x  && P[a].x  <= fmax(Q[b1].x, Q[b].x) && fmin(Q[b1].y, Q[b].y) <= P[a].y  && P[a].y  <= fmax(Q[b1].y, Q[b].y) ) ) goto degenerate;
+
+        // The edges cross
+        if ( o1 * bHA < 0 && o3 * aHB < 0 )
+        {
+
+            // Initialized data
+            double s = ( ( Q[b1].x - P[a1].x ) * B.y - ( Q[b1].y - P[a1].y ) * B.x ) / c;
+
+            // Start over from the first crossing
+            if ( first ) aa = ba = 0, first = false;
+
+            // Store the crossing
+            p_result[quantity++] = (geometry_point) { P[a1].x + s * A.x, P[a1].y + s * A.y };
+
+            // Which ring is inside past the crossing
+            if      ( aHB > 0 ) inside = 1;
+            else if ( bHA > 0 ) inside = 2;
+        }
+
+        // Parallel edges that face apart separate the rings
+        if ( cross == 0 && aHB < 0 && bHA < 0 ) { disjoint = true; break; }
+
+        // Colinear edges are left to the overlay
+        if ( cross == 0 && aHB == 0 && bHA == 0 ) goto degenerate;
+
+        // Advance P
+        if ( ( cross >= 0 ) ? ( bHA > 0 ) : ( aHB <= 0 ) )
+        {
+            if ( inside == 1 ) p_result[quantity++] = P[a];
+            aa++, a = ( a + 1 ) % n;
+        }
+
+        // Advance Q
+        else
+        {
+            if ( inside == 2 ) p_result[quantity++] = Q[b];
+            ba++, b = ( b + 1 ) % m;
+        }
+
+    } while ( ( aa < n || ba < m ) && aa < 2 * n && ba < 2 * m );
+
+    // The boundaries never crossed, so one ring holds the other, or they
+    // are apart
+    if ( first && disjoint == false )
+    {
+
+        // Initialized data
+        int p_in_q = 1,
+            q_in_p = 1;
+
+        // Test the first vertex of each ring against the other ring
+        for (size_t i = 0; i < m; i++)
+        {
+            int t = geometry_point_ccw(&Q[i], &Q[( i + 1 ) % m], &P[0]);
+            if ( t == 0 ) goto degenerate;
+            if ( t < 0 ) p_in_q = 0;
+        }
+        for (size_t i = 0; i < n; i++)
+        {
+            int t = geometry_point_ccw(&P[i], &P[( i + 1 ) % n], &Q[0]);
+            if ( t == 0 ) goto degenerate;
+            if ( t < 0 ) q_in_p = 0;
+        }
+
+        // Store the inner ring
+        quantity = 0;
+        if      ( p_in_q ) for (size_t i = 0; i < n; i++) p_result[quantity++] = P[i];
+        else if ( q_in_p ) for (size_t i = 0; i < m; i++) p_result[quantity++] = Q[i];
+    }
+
+    // Parallel edges that face apart
+    if ( disjoint ) quantity = 0;
+
+    // Drop repeated verticies
+    {
+
+        // Initialized data
+        size_t k = 0;
+
+        // Drop each vertex equal to the one before it
+        for (size_t i = 0; i < quantity; i++)
+            if ( k == 0 || p_result[i].x != p_result[k - 1].x || p_result[i].y != p_result[k - 1].y )
+                p_result[k++] = p_result[i];
+
+        // Drop the last vertex if it closes the ring
+        while ( k > 1 && p_result[k - 1].x == p_result[0].x && p_result[k - 1].y == p_result[0].y ) k--;
+
+        // A ring needs three verticies
+        quantity = ( k < 3 ) ? 0 : k;
+    }
+
+    // Return the quantity of verticies to the caller
+    *p_quantity = quantity;
+
+    // Clean up
+    p_points = GEOMETRY_REALLOC(p_points, 0);
+
+    // Success
+    return 1;
+
+    // The rings touch
+    degenerate:
+
+        // Clean up
+        p_points = GEOMETRY_REALLOC(p_points, 0);
+
+        // Leave it to the overlay
+        *p_degenerate = true,
+        *p_quantity   = 0;
+
+        // Success
+        return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_boolean_split ( geometry_boolean_operand *p_operands, geometry_boolean_cut **pp_splits, size_t *p_quantity )
+{
+
+    // Initialized data
+    geometry_line_intersection *p_intersections = (void *) 0;
+    geometry_boolean_cut       *p_splits        = (void *) 0;
+    size_t                      capacity        = p_operands[0].edges.quantity + p_operands[1].edges.quantity + 1,
+                                quantity        = 0,
+                                split_quantity  = 0,
+                                offset          = p_operands[0].edges.quantity;
+
+    // Find where the edges of the operands meet
+    for (;;)
+    {
+
+        // Allocate memory for the intersections
+        p_intersections = GEOMETRY_REALLOC(p_intersections, sizeof(geometry_line_intersection) * capacity);
+
+        // Error check
+        if ( p_intersections == (void *) 0 ) goto no_mem;
+
+        // Find the intersections
+        if ( geometry_line_list_intersections(&p_operands[0].edges, &p_operands[1].edges, p_intersections, capacity, &quantity) == 0 ) goto failed_to_intersect;
+
+        // Done
+        if ( quantity <= capacity ) break;
+
+        // Grow
+        capacity = quantity;
+    }
+
+    // Each intersection cuts the edges at most four times
+    p_splits = GEOMETRY_REALLOC(0, sizeof(geometry_boolean_cut) * ( 4 * quantity + 1 ));
+
+    // Error check
+    if ( p_splits == (void *) 0 ) goto no_mem;
+
+    // Cut the edges
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        geometry_line  *p_lines[2] = { &p_operands[0].edges.p_lines[p_intersections[i].a], &p_operands[1].edges.p_lines[p_intersections[i].b] };
+        size_t          edges[2]   = { p_intersections[i].a, offset + p_intersections[i].b };
+
+        // A crossing cuts both edges at the same point
+        if ( p_intersections[i].proper )
+        {
+            for (size_t j = 0; j < 2; j++)
+                p_splits[split_quantity++] = (geometry_boolean_cut)
+                {
+                    .edge     = edges[j],
+                    .position = ( p_intersections[i].point.x - p_lines[j]->x0 ) * ( p_lines[j]->x1 - p_lines[j]->x0 ) + ( p_intersections[i].point.y - p_lines[j]->y0 ) * ( p_lines[j]->y1 - p_lines[j]->y0 ),
+                    .point    = p_intersections[i].point
+                };
+
+            // Done
+            continue;
+        }
+
+        // Any other contact cuts an edge at each endpoint of the other edge
+        // inside of it
+        for (size_t j = 0; j < 2; j++)
+        {
+
+            // Initialized data
+            geometry_line  *p_line  = p_lines[j],
+                           *p_other = p_lines[1 - j];
+            geometry_point  _a      = { p_line->x0, p_line->y0 },
+                            _b      = { p_line->x1, p_line->y1 },
+                            _ends[2] = { { p_other->x0, p_other->y0 }, { p_other->x1, p_other->y1 } };
+
+            // Test each endpoint
+            for (size_t k = 0; k < 2; k++)
+            {
+
+                // Skip the endpoints of this edge
+                if ( geometry_boolean_point_compare(&_ends[k], &_a) == 0 || geometry_boolean_point_compare(&_ends[k], &_b) == 0 ) continue;
+
+                // Skip points off of this edge
+                if ( geometry_point_ccw(&_a, &_b, &_ends[k]) != 0 ) continue;
+                if ( _ends[k].x < fmin(_a.x, _b.x) || _ends[k].x > fmax(_a.x, _b.x) ) continue;
+                if ( _ends[k].y < fmin(_a.y, _b.y) || _ends[k].y > fmax(_a.y, _b.y) ) continue;
+
+                // Store the cut
+                p_splits[split_quantity++] = (geometry_boolean_cut)
+                {
+                    .edge     = edges[j],
+                    .position = ( _ends[k].x - _a.x ) * ( _b.x - _a.x ) + ( _ends[k].y - _a.y ) * ( _b.y - _a.y ),
+                    .point    = _ends[k]
+                };
+            }
+        }
+    }
+
+    // Sort the cuts along each edge
+    qsort(p_splits, split_quantity, sizeof(geometry_boolean_cut), geometry_boolean_cut_compare);
+
+    // Return the cuts to the caller
+    *pp_splits  = p_splits,
+    *p_quantity = split_quantity;
+
+    // Clean up
+    p_intersections = GEOMETRY_REALLOC(p_intersections, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_intersect:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to intersect edges in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                p_intersections = GEOMETRY_REALLOC(p_intersections, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( p_intersections ) p_intersections = GEOMETRY_REALLOC(p_intersections, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_boolean_link ( geometry_line *p_edges, size_t quantity, geometry *p_result, geometry_arena *p_arena )
+{
+
+    // Initialized data
+    geometry_point   *p_verticies     = GEOMETRY_REALLOC(0, sizeof(geometry_point) * ( quantity + 1 ));
+    geometry_polygon *p_rings         = GEOMETRY_REALLOC(0, sizeof(geometry_polygon) * ( quantity / 3 + 1 ));
+    bool             *p_used          = GEOMETRY_REALLOC(0, sizeof(bool) * ( quantity + 1 ));
+    size_t            vertex_quantity = 0,
+                      ring_quantity   = 0;
+
+    // Error check
+    if ( p_verticies == (void *) 0 || p_rings == (void *) 0 || p_used == (void *) 0 ) goto no_mem;
+
+    // Sort the edges by their first point
+    qsort(p_edges, quantity, sizeof(geometry_line), geometry_boolean_line_compare);
+
+    // Clear the marks
+    memset(p_used, 0, sizeof(bool) * quantity);
+
+    // Follow the edges from each edge that is not in a ring yet
+    for (size_t s = 0; s < quantity; s++)
+    {
+
+        // Initialized data
+        size_t start  = vertex_quantity,
+               edge   = s;
+        bool   closed = false;
+
+        // Skip linked edges
+        if ( p_used[s] ) continue;
+
+        // Follow the ring
+        for (;;)
+        {
+
+            // Initialized data
+            geometry_point _end  = { p_edges[edge].x1, p_edges[edge].y1 };
+            size_t         lo    = 0,
+                           hi    = quantity,
+                           next  = quantity;
+            double         best  = INFINITY,
+                           back  = atan2(p_edges[edge].y0 - p_edges[edge].y1, p_edges[edge].x0 - p_edges[edge].x1);
+
+            // Store the vertex
+            p_used[edge]                   = true;
+            p_verticies[vertex_quantity++] = (geometry_point) { p_edges[edge].x0, p_edges[edge].y0 };
+
+            // Find the first edge that leaves the end
+            while ( lo < hi )
+            {
+                size_t middle = lo + ( hi - lo ) / 2;
+                if ( geometry_boolean_point_compare(&(geometry_point) { p_edges[middle].x0, p_edges[middle].y0 }, &_end) < 0 ) lo = middle + 1;
+                else hi = middle;
+            }
+
+            // Take the edge that leaves the end just clockwise of the way back
+            for (size_t i = lo; i < quantity && p_edges[i].x0 == _end.x && p_edges[i].y0 == _end.y; i++)
+            {
+
+                // Initialized data
+                double turn = back - atan2(p_edges[i].y1 - p_edges[i].y0, p_edges[i].x1 - p_edges[i].x0);
+
+                // Measure the turn in ( 0, 2 pi ]
+                while ( turn <= 0 ) turn += geometry_boolean_tau;
+
+                // Keep the tightest turn
+                if ( turn < best ) best = turn, next = i;
+            }
+
+            // The ring is closed
+            if ( next == s ) { closed = true; break; }
+
+            // The ring is broken
+            if ( next == quantity || p_used[next] ) break;
+
+            // Follow the edge
+            edge = next;
+        }
+
+        // Keep closed rings of three verticies or more
+        if ( closed && vertex_quantity - start >= 3 )
+            p_rings[ring_quantity++] = (geometry_polygon) { .quantity = vertex_quantity - start, .p_verticies = &p_verticies[start] };
+        else
+            vertex_quantity = start;
+    }
+
+    // Construct the result
+    if ( geometry_polygon_list_construct(p_result, p_rings, ring_quantity, p_arena) == 0 ) goto failed_to_construct_result;
+
+    // Clean up
+    p_verticies = GEOMETRY_REALLOC(p_verticies, 0);
+    p_rings     = GEOMETRY_REALLOC(p_rings, 0);
+    p_used      = GEOMETRY_REALLOC(p_used, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_construct_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to construct polygon list in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                p_verticies = GEOMETRY_REALLOC(p_verticies, 0);
+                p_rings     = GEOMETRY_REALLOC(p_rings, 0);
+                p_used      = GEOMETRY_REALLOC(p_used, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( p_verticies ) p_verticies = GEOMETRY_REALLOC(p_verticies, 0);
+                if ( p_rings     ) p_rings     = GEOMETRY_REALLOC(p_rings, 0);
+                if ( p_used      ) p_used      = GEOMETRY_REALLOC(p_used, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_boolean_overlay ( geometry_boolean_operand *p_operands, enum geometry_boolean_e operation, geometry *p_result, geometry_arena *p_arena )
+{
+
+    // Initialized data
+    geometry_boolean_cut   *p_splits         = (void *) 0;
+    geometry_boolean_segment *p_segments       = (void *) 0;
+    geometry_line            *p_edges          = (void *) 0;
+    size_t                    split_quantity   = 0,
+                              segment_quantity = 0,
+                              edge_quantity    = 0,
+                              offset           = p_operands[0].edges.quantity;
+
+    // Cut the edges where they meet
+    if ( geometry_boolean_split(p_operands, &p_splits, &split_quantity) == 0 ) goto failed_to_split;
+
+    // Allocate memory for the pieces, and for the edges of the result
+    p_segments = GEOMETRY_REALLOC(0, sizeof(geometry_boolean_segment) * ( offset + p_operands[1].edges.quantity + split_quantity + 1 ));
+    p_edges    = GEOMETRY_REALLOC(0, sizeof(geometry_line)            * ( offset + p_operands[1].edges.quantity + split_quantity + 1 ));
+
+    // Error check
+    if ( p_segments == (void *) 0 || p_edges == (void *) 0 ) goto no_mem;
+
+    // Cut each edge into pieces
+    for (size_t e = 0, s = 0; e < offset + p_operands[1].edges.quantity; e++)
+    {
+
+        // Initialized data
+        size_t          operand = ( e < offset ) ? 0 : 1;
+        geometry_line  *p_line  = &p_operands[operand].edges.p_lines[e - operand * offset];
+        geometry_point  _start  = { p_line->x0, p_line->y0 },
+                        _end    = { p_line->x1, p_line->y1 };
+
+        // Walk the cuts of the edge, then the end of the edge
+        for (;;)
+        {
+
+            // Initialized data
+            bool           last = ( s == split_quantity || p_splits[s].edge != e );
+            geometry_point _cut = ( last ) ? _end : p_splits[s].point;
+
+            // Skip cuts at the start of the piece, or at the end of the edge
+            if ( geometry_boolean_point_compare(&_cut, &_start) && ( last || geometry_boolean_point_compare(&_cut, &_end) ) )
+            {
+
+                // Initialized data
+                bool forward = ( geometry_boolean_point_compare(&_start, &_cut) < 0 );
+
+                // Store the piece from its lesser point
+                p_segments[segment_quantity++] = (geometry_boolean_segment)
+                {
+                    .a       = ( forward ) ? _start : _cut,
+                    .b       = ( forward ) ? _cut   : _start,
+                    .operand = operand,
+                    .forward = forward
+                };
+
+                // The next piece starts here
+                _start = _cut;
+            }
+
+            // Done
+            if ( last ) break;
+
+            // Next cut
+            s++;
+        }
+    }
+
+    // Gather the pieces that overlap
+    qsort(p_segments, segment_quantity, sizeof(geometry_boolean_segment), geometry_boolean_segment_compare);
+
+    // Label each group of overlapping pieces with the inside of each
+    // operand on its left and on its right, and keep the pieces with the
+    // result inside on exactly one side
+    for (size_t i = 0, j = 0; i < segment_quantity; i = j)
+    {
+
+        // Initialized data
+        geometry_boolean_segment *p_segment = &p_segments[i];
+        geometry_point            _middle   = { ( p_segment->a.x + p_segment->b.x ) / 2, ( p_segment->a.y + p_segment->b.y ) / 2 };
+        bool                      left[2]   = { false, false },
+                                  right[2]  = { false, false },
+                                  in_left   = false,
+                                  in_right  = false;
+
+        // Find the end of the group
+        for (j = i + 1; j < segment_quantity; j++)
+            if ( geometry_boolean_point_compare(&p_segments[j].a, &p_segment->a) || geometry_boolean_point_compare(&p_segments[j].b, &p_segment->b) ) break;
+
+        // Label the group
+        for (size_t k = 0; k < 2; k++)
+        {
+
+            // Initialized data
+            size_t count   = 0;
+            bool   forward = false;
+
+            // Count the pieces of this operand
+            for (size_t g = i; g < j; g++)
+                if ( p_segments[g].operand == k )
+                    forward = ( count++ ) ? forward : p_segments[g].forward;
+
+            // An edge of the operand has its inside on the left
+            if ( count % 2 ) left[k] = forward, right[k] = !forward;
+
+            // Pieces that cancel out are located just beside the group
+            else if ( count )
+            {
+
+                // Initialized data
+                geometry_point _beside =
+                {
+                    _middle.x - ( p_segment->b.y - p_segment->a.y ) * 0x1p-20,
+                    _middle.y + ( p_segment->b.x - p_segment->a.x ) * 0x1p-20
+                };
+
+                // Locate the point beside the group
+                left[k] = right[k] = geometry_boolean_operand_contains(&p_operands[k], &_beside);
+            }
+
+            // Pieces off of the operand are wholly inside, or wholly outside
+            else left[k] = right[k] = geometry_boolean_operand_contains(&p_operands[k], &_middle);
+        }
+
+        // Apply the operation to each side
+        in_left  = geometry_boolean_in(operation, left[0], left[1]),
+        in_right = geometry_boolean_in(operation, right[0], right[1]);
+
+        // Keep the piece with the inside of the result on its left
+        if ( in_left != in_right )
+            p_edges[edge_quantity++] = ( in_left ) ? (geometry_line) { p_segment->a.x, p_segment->a.y, p_segment->b.x, p_segment->b.y }
+                                                   : (geometry_line) { p_segment->b.x, p_segment->b.y, p_segment->a.x, p_segment->a.y };
+    }
+
+    // Link the edges into rings
+    if ( geometry_boolean_link(p_edges, edge_quantity, p_result, p_arena) == 0 ) goto failed_to_link;
+
+    // Clean up
+    if ( p_splits ) p_splits = GEOMETRY_REALLOC(p_splits, 0);
+    p_segments = GEOMETRY_REALLOC(p_segments, 0);
+    p_edges    = GEOMETRY_REALLOC(p_edges, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_split:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to cut edges in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_link:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to link rings in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( p_splits ) p_splits = GEOMETRY_REALLOC(p_splits, 0);
+                p_segments = GEOMETRY_REALLOC(p_segments, 0);
+                p_edges    = GEOMETRY_REALLOC(p_edges, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( p_splits   ) p_splits   = GEOMETRY_REALLOC(p_splits, 0);
+                if ( p_segments ) p_segments = GEOMETRY_REALLOC(p_segments, 0);
+                if ( p_edges    ) p_edges    = GEOMETRY_REALLOC(p_edges, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
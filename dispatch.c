@@ -0,0 +1,971 @@
+/** !
+ * Dispatch
+ *
+ * @file dispatch.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <stdatomic.h>
+
+// Header
+#include <geometry/dispatch.h>
+#include <geometry/relate.h>
+#include <geometry/boolean.h>
+#include <geometry/predicates.h>
+
+// Platform dependent includes
+#ifdef _WIN64
+    #include <windows.h>
+#else
+    #include <sched.h>
+#endif
+
+// Enumeration definitions
+// The state of the table. The kernels of the library are registered by
+// the first thread to use the table, and the others wait for it.
+enum geometry_dispatch_state_e
+{
+    GEOMETRY_DISPATCH_EMPTY        = 0,
+    GEOMETRY_DISPATCH_REGISTERING  = 1,
+    GEOMETRY_DISPATCH_READY        = 2
+};
+
+// Structure declarations
+struct geometry_dispatch_entry_s;
+
+// Type definitions
+typedef struct geometry_dispatch_entry_s geometry_dispatch_entry;
+
+// Structure definitions
+// The kernel of a pair of types. The kernel takes the geometry in
+// argument order if swap is 0, and in reverse order if swap is 1.
+struct geometry_dispatch_entry_s
+{
+    geometry_kernel kernel;
+    size_t          swap;
+};
+
+// Data
+// The kernel of each operation, for each pair of types
+static geometry_dispatch_entry geometry_dispatch_table[GEOMETRY_OPERATION_QUANTITY][GEOMETRY_TYPE_QUANTITY][GEOMETRY_TYPE_QUANTITY];
+
+// The state of the table
+static atomic_int geometry_dispatch_state = GEOMETRY_DISPATCH_EMPTY;
+
+// Operations whose kernel for (a, b) also serves (b, a)
+static const bool geometry_dispatch_symmetric[GEOMETRY_OPERATION_QUANTITY] =
+{
+    [GEOMETRY_OPERATION_DISTANCE]     = true,
+    [GEOMETRY_OPERATION_EQUALS]       = true,
+    [GEOMETRY_OPERATION_DISJOINT]     = true,
+    [GEOMETRY_OPERATION_INTERSECTS]   = true,
+    [GEOMETRY_OPERATION_TOUCHES]      = true,
+    [GEOMETRY_OPERATION_CROSSES]      = true,
+    [GEOMETRY_OPERATION_OVERLAPS]     = true,
+    [GEOMETRY_OPERATION_CONTAINS]     = false,
+    [GEOMETRY_OPERATION_INTERSECTION] = true
+};
+
+// Types with an area, whose interior may hold another geometry
+static const bool geometry_dispatch_area[GEOMETRY_TYPE_QUANTITY] =
+{
+    [GEOMETRY_TRIANGLE]     = true,
+    [GEOMETRY_POLYGON]      = true,
+    [GEOMETRY_POLYGON_LIST] = true
+};
+
+// The name of each operation, for errors
+static const char *const geometry_dispatch_names[GEOMETRY_OPERATION_QUANTITY] =
+{
+    [GEOMETRY_OPERATION_DISTANCE]     = "distance",
+    [GEOMETRY_OPERATION_EQUALS]       = "equals",
+    [GEOMETRY_OPERATION_DISJOINT]     = "disjoint",
+    [GEOMETRY_OPERATION_INTERSECTS]   = "intersects",
+    [GEOMETRY_OPERATION_TOUCHES]      = "touches",
+    [GEOMETRY_OPERATION_CROSSES]      = "crosses",
+    [GEOMETRY_OPERATION_OVERLAPS]     = "overlaps",
+    [GEOMETRY_OPERATION_CONTAINS]     = "contains",
+    [GEOMETRY_OPERATION_INTERSECTION] = "intersection"
+};
+
+// Forward declarations
+/** !
+ * Register the kernels of the library, once. The first caller registers
+ * them, and concurrent callers wait until it is done.
+ *
+ * @param void
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_dispatch_ensure ( void );
+
+/** !
+ * Register the kernels of the library into the table
+ *
+ * @param void
+ *
+ * @return void
+ */
+static void geometry_dispatch_defaults ( void );
+
+/** !
+ * Store the kernel of an operation for a pair of types, and for the
+ * reverse pair if the operation is symmetric
+ *
+ * @param operation the operation
+ * @param a         the type of the first geometry
+ * @param b         the type of the second geometry
+ * @param kernel    the kernel
+ *
+ * @return void
+ */
+static void geometry_dispatch_store ( enum geometry_operation_e operation, enum geometry_type_e a, enum geometry_type_e b, geometry_kernel kernel );
+
+/** !
+ * Find the kernel of an operation for a pair of geometry, and order the
+ * geometry for it
+ *
+ * @param operation the operation
+ * @param p_a       the first geometry
+ * @param p_b       the second geometry
+ * @param p_result  the result of the operation
+ * @param pp_args   return the geometry, in the order the kernel takes them
+ *
+ * @return the entry of the kernel on success, null on error
+ */
+static const geometry_dispatch_entry *geometry_dispatch_lookup ( enum geometry_operation_e operation, geometry *p_a, geometry *p_b, void *p_result, geometry **pp_args );
+
+/** !
+ * Distance kernels of a point and each type
+ *
+ * @param p_a      a point
+ * @param p_b      a geometry of the type
+ * @param p_result return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_dispatch_point_point_distance        ( geometry *p_a, geometry *p_b, double *p_result );
+static int geometry_dispatch_point_point_list_distance   ( geometry *p_a, geometry *p_b, double *p_result );
+static int geometry_dispatch_point_line_distance         ( geometry *p_a, geometry *p_b, double *p_result );
+static int geometry_dispatch_point_line_list_distance    ( geometry *p_a, geometry *p_b, double *p_result );
+static int geometry_dispatch_point_triangle_distance     ( geometry *p_a, geometry *p_b, double *p_result );
+static int geometry_dispatch_point_polygon_distance      ( geometry *p_a, geometry *p_b, double *p_result );
+static int geometry_dispatch_point_polygon_list_distance ( geometry *p_a, geometry *p_b, double *p_result );
+
+/** !
+ * Distance kernel of any two types but points. The boundaries are
+ * measured segment to segment. If they do not meet, either geometry may
+ * still be inside of the area of the other, which is tested with a
+ * vertex of each segment.
+ *
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_dispatch_segment_distance ( geometry *p_a, geometry *p_b, double *p_result );
+
+/** !
+ * Get the quantity of segments of a geometry. Each point of a point list
+ * is a segment of no length, and each ring of a polygon or polygon list
+ * has a segment for each vertex.
+ *
+ * @param p_geometry the geometry
+ *
+ * @return the quantity of segments
+ */
+static size_t geometry_dispatch_segment_quantity ( geometry *p_geometry );
+
+/** !
+ * Get a segment of a geometry
+ *
+ * @param p_geometry the geometry
+ * @param index      the index of the segment
+ * @param p_segment  return
+ *
+ * @sa geometry_dispatch_segment_quantity
+ *
+ * @return void
+ */
+static void geometry_dispatch_segment ( geometry *p_geometry, size_t index, geometry_line *p_segment );
+
+/** !
+ * Compute the distance between two segments
+ *
+ * @param p_a a segment
+ * @param p_b another segment
+ *
+ * @return the distance
+ */
+static double geometry_dispatch_segment_segment_distance ( geometry_line *p_a, geometry_line *p_b );
+
+/** !
+ * Test if each segment of a geometry is outside of the area of another
+ * geometry, by measuring the first vertex of the segment to it. Only
+ * called when the boundaries do not meet, so a segment is either wholly
+ * inside or wholly outside.
+ *
+ * @param p_a      the geometry of the segments
+ * @param p_b      a triangle, polygon or polygon list
+ * @param p_result return true if a segment is inside of the area
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_dispatch_segment_inside ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Predicate kernels of a point and a polygon, which locate the point
+ * instead of relating the pair
+ *
+ * @param p_a      a point
+ * @param p_b      a polygon
+ * @param p_result return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_dispatch_point_polygon_intersects ( geometry *p_a, geometry *p_b, bool *p_result );
+static int geometry_dispatch_point_polygon_disjoint   ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if a polygon contains a point, by locating the point
+ *
+ * @param p_a      a polygon
+ * @param p_b      a point
+ * @param p_result return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_dispatch_polygon_point_contains ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Compute the intersection of two polygons or polygon lists
+ *
+ * @param p_a      a polygon or polygon list
+ * @param p_b      another polygon or polygon list
+ * @param p_result return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_dispatch_boolean_intersection ( geometry *p_a, geometry *p_b, geometry *p_result );
+
+// Function definitions
+int geometry_dispatch_init ( void )
+{
+
+    // Done
+    return geometry_dispatch_ensure();
+}
+
+static int geometry_dispatch_ensure ( void )
+{
+
+    // Initialized data
+    int expected = GEOMETRY_DISPATCH_EMPTY;
+
+    // Fast path
+    if ( atomic_load_explicit(&geometry_dispatch_state, memory_order_acquire) == GEOMETRY_DISPATCH_READY ) return 1;
+
+    // Register the kernels, if no other thread is
+    if ( atomic_compare_exchange_strong(&geometry_dispatch_state, &expected, GEOMETRY_DISPATCH_REGISTERING) )
+    {
+
+        // Register the kernels
+        geometry_dispatch_defaults();
+
+        // Publish the table
+        atomic_store_explicit(&geometry_dispatch_state, GEOMETRY_DISPATCH_READY, memory_order_release);
+
+        // Success
+        return 1;
+    }
+
+    // Wait for the thread that is registering the kernels
+    while ( atomic_load_explicit(&geometry_dispatch_state, memory_order_acquire) != GEOMETRY_DISPATCH_READY )
+    {
+        #ifdef _WIN64
+            SwitchToThread();
+        #else
+            sched_yield();
+        #endif
+    }
+
+    // Success
+    return 1;
+}
+
+static void geometry_dispatch_defaults ( void )
+{
+
+    // Initialized data
+    static const enum geometry_type_e types[] =
+    {
+        GEOMETRY_POINT,
+        GEOMETRY_POINT_LIST,
+        GEOMETRY_LINE,
+        GEOMETRY_LINE_LIST,
+        GEOMETRY_TRIANGLE,
+        GEOMETRY_POLYGON,
+        GEOMETRY_POLYGON_LIST
+    };
+    static const fn_geometry_contains relate[GEOMETRY_OPERATION_QUANTITY] =
+    {
+        [GEOMETRY_OPERATION_EQUALS]     = geometry_relate_equals,
+        [GEOMETRY_OPERATION_DISJOINT]   = geometry_relate_disjoint,
+        [GEOMETRY_OPERATION_INTERSECTS] = geometry_relate_intersects,
+        [GEOMETRY_OPERATION_TOUCHES]    = geometry_relate_touches,
+        [GEOMETRY_OPERATION_CROSSES]    = geometry_relate_crosses,
+        [GEOMETRY_OPERATION_OVERLAPS]   = geometry_relate_overlaps,
+        [GEOMETRY_OPERATION_CONTAINS]   = geometry_relate_contains
+    };
+    size_t type_quantity = sizeof(types) / sizeof(types[0]);
+
+    // The distance from a point to each type
+    geometry_dispatch_store(GEOMETRY_OPERATION_DISTANCE, GEOMETRY_POINT, GEOMETRY_POINT       , (geometry_kernel) { .pfn_distance = geometry_dispatch_point_point_distance });
+    geometry_dispatch_store(GEOMETRY_OPERATION_DISTANCE, GEOMETRY_POINT, GEOMETRY_POINT_LIST  , (geometry_kernel) { .pfn_distance = geometry_dispatch_point_point_list_distance });
+    geometry_dispatch_store(GEOMETRY_OPERATION_DISTANCE, GEOMETRY_POINT, GEOMETRY_LINE        , (geometry_kernel) { .pfn_distance = geometry_dispatch_point_line_distance });
+    geometry_dispatch_store(GEOMETRY_OPERATION_DISTANCE, GEOMETRY_POINT, GEOMETRY_LINE_LIST   , (geometry_kernel) { .pfn_distance = geometry_dispatch_point_line_list_distance });
+    geometry_dispatch_store(GEOMETRY_OPERATION_DISTANCE, GEOMETRY_POINT, GEOMETRY_TRIANGLE    , (geometry_kernel) { .pfn_distance = geometry_dispatch_point_triangle_distance });
+    geometry_dispatch_store(GEOMETRY_OPERATION_DISTANCE, GEOMETRY_POINT, GEOMETRY_POLYGON     , (geometry_kernel) { .pfn_distance = geometry_dispatch_point_polygon_distance });
+    geometry_dispatch_store(GEOMETRY_OPERATION_DISTANCE, GEOMETRY_POINT, GEOMETRY_POLYGON_LIST, (geometry_kernel) { .pfn_distance = geometry_dispatch_point_polygon_list_distance });
+
+    // The distance between each other pair of types, by their segments
+    for (size_t i = 1; i < type_quantity; i++)
+        for (size_t j = i; j < type_quantity; j++)
+            geometry_dispatch_store(GEOMETRY_OPERATION_DISTANCE, types[i], types[j], (geometry_kernel) { .pfn_distance = geometry_dispatch_segment_distance });
+
+    // The relate engine serves each predicate for each pair of types
+    for (size_t operation = GEOMETRY_OPERATION_EQUALS; operation <= GEOMETRY_OPERATION_CONTAINS; operation++)
+        for (size_t i = 0; i < type_quantity; i++)
+            for (size_t j = 0; j < type_quantity; j++)
+                geometry_dispatch_store((enum geometry_operation_e) operation, types[i], types[j], (geometry_kernel) { .pfn_predicate = relate[operation] });
+
+    // A point and a polygon only need the point located
+    geometry_dispatch_store(GEOMETRY_OPERATION_INTERSECTS, GEOMETRY_POINT  , GEOMETRY_POLYGON, (geometry_kernel) { .pfn_predicate = geometry_dispatch_point_polygon_intersects });
+    geometry_dispatch_store(GEOMETRY_OPERATION_DISJOINT  , GEOMETRY_POINT  , GEOMETRY_POLYGON, (geometry_kernel) { .pfn_predicate = geometry_dispatch_point_polygon_disjoint });
+    geometry_dispatch_store(GEOMETRY_OPERATION_CONTAINS  , GEOMETRY_POLYGON, GEOMETRY_POINT  , (geometry_kernel) { .pfn_predicate = geometry_dispatch_polygon_point_contains });
+
+    // The intersection of polygons and polygon lists
+    geometry_dispatch_store(GEOMETRY_OPERATION_INTERSECTION, GEOMETRY_POLYGON     , GEOMETRY_POLYGON     , (geometry_kernel) { .pfn_intersection = geometry_dispatch_boolean_intersection });
+    geometry_dispatch_store(GEOMETRY_OPERATION_INTERSECTION, GEOMETRY_POLYGON     , GEOMETRY_POLYGON_LIST, (geometry_kernel) { .pfn_intersection = geometry_dispatch_boolean_intersection });
+    geometry_dispatch_store(GEOMETRY_OPERATION_INTERSECTION, GEOMETRY_POLYGON_LIST, GEOMETRY_POLYGON     , (geometry_kernel) { .pfn_intersection = geometry_dispatch_boolean_intersection });
+    geometry_dispatch_store(GEOMETRY_OPERATION_INTERSECTION, GEOMETRY_POLYGON_LIST, GEOMETRY_POLYGON_LIST, (geometry_kernel) { .pfn_intersection = geometry_dispatch_boolean_intersection });
+
+    // Done
+    return;
+}
+
+int geometry_dispatch_register ( enum geometry_operation_e operation, enum geometry_type_e a, enum geometry_type_e b, geometry_kernel kernel )
+{
+
+    // Argument check
+    if ( (size_t) operation    >= GEOMETRY_OPERATION_QUANTITY ) goto invalid_operation;
+    if ( (size_t) a            >= GEOMETRY_TYPE_QUANTITY      ) goto invalid_type;
+    if ( (size_t) b            >= GEOMETRY_TYPE_QUANTITY      ) goto invalid_type;
+    if ( kernel.pfn_distance   == (void *) 0                  ) goto no_kernel;
+
+    // Register the kernels of the library first, so they do not replace this one
+    if ( geometry_dispatch_ensure() == 0 ) return 0;
+
+    // Store the kernel
+    geometry_dispatch_store(operation, a, b, kernel);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            invalid_operation:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"operation\" is invalid in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            invalid_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"a\" or \"b\" is not a geometry type in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_kernel:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"kernel\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static void geometry_dispatch_store ( enum geometry_operation_e operation, enum geometry_type_e a, enum geometry_type_e b, geometry_kernel kernel )
+{
+
+    // Store the kernel
+    geometry_dispatch_table[operation][a][b] = (geometry_dispatch_entry) { .kernel = kernel, .swap = 0 };
+
+    // The kernel also serves the reverse pair, with the geometry swapped
+    if ( geometry_dispatch_symmetric[operation] && a != b )
+        geometry_dispatch_table[operation][b][a] = (geometry_dispatch_entry) { .kernel = kernel, .swap = 1 };
+
+    // Done
+    return;
+}
+
+int geometry_distance ( geometry *p_a, geometry *p_b, double *p_result )
+{
+
+    // Initialized data
+    geometry                      *p_args[2] = { 0 };
+    const geometry_dispatch_entry *p_entry   = geometry_dispatch_lookup(GEOMETRY_OPERATION_DISTANCE, p_a, p_b, p_result, p_args);
+
+    // Error check
+    if ( p_entry == (void *) 0 ) return 0;
+
+    // Done
+    return p_entry->kernel.pfn_distance(p_args[0], p_args[1], p_result);
+}
+
+int geometry_equals ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Initialized data
+    geometry                      *p_args[2] = { 0 };
+    const geometry_dispatch_entry *p_entry   = geometry_dispatch_lookup(GEOMETRY_OPERATION_EQUALS, p_a, p_b, p_result, p_args);
+
+    // Error check
+    if ( p_entry == (void *) 0 ) return 0;
+
+    // Done
+    return p_entry->kernel.pfn_predicate(p_args[0], p_args[1], p_result);
+}
+
+int geometry_disjoint ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Initialized data
+    geometry                      *p_args[2] = { 0 };
+    const geometry_dispatch_entry *p_entry   = geometry_dispatch_lookup(GEOMETRY_OPERATION_DISJOINT, p_a, p_b, p_result, p_args);
+
+    // Error check
+    if ( p_entry == (void *) 0 ) return 0;
+
+    // Done
+    return p_entry->kernel.pfn_predicate(p_args[0], p_args[1], p_result);
+}
+
+int geometry_intersects ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Initialized data
+    geometry                      *p_args[2] = { 0 };
+    const geometry_dispatch_entry *p_entry   = geometry_dispatch_lookup(GEOMETRY_OPERATION_INTERSECTS, p_a, p_b, p_result, p_args);
+
+    // Error check
+    if ( p_entry == (void *) 0 ) return 0;
+
+    // Done
+    return p_entry->kernel.pfn_predicate(p_args[0], p_args[1], p_result);
+}
+
+int geometry_touches ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Initialized data
+    geometry                      *p_args[2] = { 0 };
+    const geometry_dispatch_entry *p_entry   = geometry_dispatch_lookup(GEOMETRY_OPERATION_TOUCHES, p_a, p_b, p_result, p_args);
+
+    // Error check
+    if ( p_entry == (void *) 0 ) return 0;
+
+    // Done
+    return p_entry->kernel.pfn_predicate(p_args[0], p_args[1], p_result);
+}
+
+int geometry_crosses ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Initialized data
+    geometry                      *p_args[2] = { 0 };
+    const geometry_dispatch_entry *p_entry   = geometry_dispatch_lookup(GEOMETRY_OPERATION_CROSSES, p_a, p_b, p_result, p_args);
+
+    // Error check
+    if ( p_entry == (void *) 0 ) return 0;
+
+    // Done
+    return p_entry->kernel.pfn_predicate(p_args[0], p_args[1], p_result);
+}
+
+int geometry_overlaps ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Initialized data
+    geometry                      *p_args[2] = { 0 };
+    const geometry_dispatch_entry *p_entry   = geometry_dispatch_lookup(GEOMETRY_OPERATION_OVERLAPS, p_a, p_b, p_result, p_args);
+
+    // Error check
+    if ( p_entry == (void *) 0 ) return 0;
+
+    // Done
+    return p_entry->kernel.pfn_predicate(p_args[0], p_args[1], p_result);
+}
+
+int geometry_contains ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Initialized data
+    geometry                      *p_args[2] = { 0 };
+    const geometry_dispatch_entry *p_entry   = geometry_dispatch_lookup(GEOMETRY_OPERATION_CONTAINS, p_a, p_b, p_result, p_args);
+
+    // Error check
+    if ( p_entry == (void *) 0 ) return 0;
+
+    // Done
+    return p_entry->kernel.pfn_predicate(p_args[0], p_args[1], p_result);
+}
+
+int geometry_intersection ( geometry *p_a, geometry *p_b, geometry *p_result )
+{
+
+    // Initialized data
+    geometry                      *p_args[2] = { 0 };
+    const geometry_dispatch_entry *p_entry   = geometry_dispatch_lookup(GEOMETRY_OPERATION_INTERSECTION, p_a, p_b, p_result, p_args);
+
+    // Error check
+    if ( p_entry == (void *) 0 ) return 0;
+
+    // Done
+    return p_entry->kernel.pfn_intersection(p_args[0], p_args[1], p_result);
+}
+
+static const geometry_dispatch_entry *geometry_dispatch_lookup ( enum geometry_operation_e operation, geometry *p_a, geometry *p_b, void *p_result, geometry **pp_args )
+{
+
+    // Argument check
+    if ( p_a                     == (void *) 0             ) goto no_a;
+    if ( p_b                     == (void *) 0             ) goto no_b;
+    if ( p_result                == (void *) 0             ) goto no_result;
+    if ( (size_t) p_a->type      >= GEOMETRY_TYPE_QUANTITY ) goto invalid_type;
+    if ( (size_t) p_b->type      >= GEOMETRY_TYPE_QUANTITY ) goto invalid_type;
+
+    // Register the kernels of the library, the first time the table is used
+    if ( geometry_dispatch_ensure() == 0 ) return (void *) 0;
+
+    // Initialized data
+    const geometry_dispatch_entry *p_entry   = &geometry_dispatch_table[operation][p_a->type][p_b->type];
+    geometry                      *p_pair[2] = { p_a, p_b };
+
+    // No kernel
+    if ( p_entry->kernel.pfn_distance == (void *) 0 ) goto unsupported_types;
+
+    // Order the geometry for the kernel
+    pp_args[0] = p_pair[p_entry->swap],
+    pp_args[1] = p_pair[1 - p_entry->swap];
+
+    // Success
+    return p_entry;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return (void *) 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return (void *) 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return (void *) 0;
+        }
+
+        // Geometry errors
+        {
+            invalid_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Geometry has an invalid type in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return (void *) 0;
+
+            unsupported_types:
+                #ifndef NDEBUG
+                    log_error("[geometry] Operation \"%s\" between geometry of type %d and %d is not supported in call to function \"%s\"\n", geometry_dispatch_names[operation], p_a->type, p_b->type, __FUNCTION__);
+                #endif
+
+                // Error
+                return (void *) 0;
+        }
+    }
+}
+
+static int geometry_dispatch_point_point_distance ( geometry *p_a, geometry *p_b, double *p_result )
+{
+
+    // Done
+    return geometry_point_point_distance(&p_a->point, &p_b->point, p_result);
+}
+
+static int geometry_dispatch_point_point_list_distance ( geometry *p_a, geometry *p_b, double *p_result )
+{
+
+    // Done
+    return geometry_point_point_list_distance(&p_a->point, &p_b->point_list, p_result);
+}
+
+static int geometry_dispatch_point_line_distance ( geometry *p_a, geometry *p_b, double *p_result )
+{
+
+    // Done
+    return geometry_point_line_distance(&p_a->point, &p_b->line, p_result);
+}
+
+static int geometry_dispatch_point_line_list_distance ( geometry *p_a, geometry *p_b, double *p_result )
+{
+
+    // Done
+    return geometry_point_line_list_distance(&p_a->point, &p_b->line_list, p_result);
+}
+
+static int geometry_dispatch_point_triangle_distance ( geometry *p_a, geometry *p_b, double *p_result )
+{
+
+    // Done
+    return geometry_point_triangle_distance(&p_a->point, &p_b->triangle, p_result);
+}
+
+static int geometry_dispatch_point_polygon_distance ( geometry *p_a, geometry *p_b, double *p_result )
+{
+
+    // Done
+    return geometry_point_polygon_distance(&p_a->point, &p_b->polygon, p_result);
+}
+
+static int geometry_dispatch_point_polygon_list_distance ( geometry *p_a, geometry *p_b, double *p_result )
+{
+
+    // Done
+    return geometry_point_polygon_list_distance(&p_a->point, &p_b->polygon_list, p_result);
+}
+
+static int geometry_dispatch_segment_distance ( geometry *p_a, geometry *p_b, double *p_result )
+{
+
+    // Initialized data
+    size_t        a_quantity = geometry_dispatch_segment_quantity(p_a),
+                  b_quantity = geometry_dispatch_segment_quantity(p_b);
+    geometry_line _a         = { 0 },
+                  _b         = { 0 };
+    double        nearest    = INFINITY,
+                  distance   = 0;
+    bool          inside     = false;
+
+    // Error check
+    if ( a_quantity == 0 ) goto empty_geometry;
+    if ( b_quantity == 0 ) goto empty_geometry;
+
+    // The least distance between a segment of each, until they meet
+    for (size_t i = 0; i < a_quantity && nearest > 0; i++)
+    {
+
+        // Get the segment of the first geometry
+        geometry_dispatch_segment(p_a, i, &_a);
+
+        // Measure it to each segment of the second geometry
+        for (size_t j = 0; j < b_quantity && nearest > 0; j++)
+        {
+
+            // Get the segment of the second geometry
+            geometry_dispatch_segment(p_b, j, &_b);
+
+            // Measure
+            distance = geometry_dispatch_segment_segment_distance(&_a, &_b);
+
+            // Keep the least distance
+            if ( distance < nearest ) nearest = distance;
+        }
+    }
+
+    // Boundaries that do not meet may still be nested
+    if ( nearest > 0 && geometry_dispatch_area[p_b->type] )
+        if ( geometry_dispatch_segment_inside(p_a, p_b, &inside) == 0 ) return 0;
+
+    if ( nearest > 0 && inside == false && geometry_dispatch_area[p_a->type] )
+        if ( geometry_dispatch_segment_inside(p_b, p_a, &inside) == 0 ) return 0;
+
+    // Return the distance to the caller
+    *p_result = ( inside ) ? 0 : nearest;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Geometry errors
+        {
+            empty_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Geometry has no segments in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static size_t geometry_dispatch_segment_quantity ( geometry *p_geometry )
+{
+
+    // Strategy
+    switch ( p_geometry->type )
+    {
+        case GEOMETRY_POINT_LIST:   return p_geometry->point_list.quantity;
+        case GEOMETRY_LINE:         return 1;
+        case GEOMETRY_LINE_LIST:    return p_geometry->line_list.quantity;
+        case GEOMETRY_TRIANGLE:     return 3;
+        case GEOMETRY_POLYGON:      return p_geometry->polygon.quantity;
+        case GEOMETRY_POLYGON_LIST: return p_geometry->polygon_list.vertex_quantity;
+        default:                    return 0;
+    }
+}
+
+static void geometry_dispatch_segment ( geometry *p_geometry, size_t index, geometry_line *p_segment )
+{
+
+    // Initialized data
+    geometry_point _start = { 0 },
+                   _end   = { 0 };
+
+    // Strategy
+    switch ( p_geometry->type )
+    {
+        case GEOMETRY_POINT_LIST:
+
+            // A point is a segment of no length
+            _start = _end = p_geometry->point_list.p_points[index];
+
+            // Done
+            break;
+
+        case GEOMETRY_LINE:
+
+            // Store the line
+            *p_segment = p_geometry->line;
+
+            // Done
+            return;
+
+        case GEOMETRY_LINE_LIST:
+
+            // Store the line
+            *p_segment = p_geometry->line_list.p_lines[index];
+
+            // Done
+            return;
+
+        case GEOMETRY_TRIANGLE:
+        {
+
+            // Initialized data
+            geometry_point _verticies[3] = { p_geometry->triangle.a, p_geometry->triangle.b, p_geometry->triangle.c };
+
+            // The edge from this vertex to the next
+            _start = _verticies[index],
+            _end   = _verticies[( index + 1 ) % 3];
+
+            // Done
+            break;
+        }
+
+        case GEOMETRY_POLYGON:
+
+            // The edge from this vertex to the next
+            _start = p_geometry->polygon.p_verticies[index],
+            _end   = p_geometry->polygon.p_verticies[( index + 1 ) % p_geometry->polygon.quantity];
+
+            // Done
+            break;
+
+        case GEOMETRY_POLYGON_LIST:
+        {
+
+            // Initialized data
+            const size_t *p_offsets = p_geometry->polygon_list.p_offsets;
+            size_t        lo        = 0,
+                          hi        = p_geometry->polygon_list.quantity;
+
+            // Find the ring of the vertex
+            while ( hi - lo > 1 )
+            {
+
+                // Initialized data
+                size_t mid = lo + ( hi - lo ) / 2;
+
+                // Narrow the search
+                if ( p_offsets[mid] <= index ) lo = mid;
+                else                           hi = mid;
+            }
+
+            // The edge from this vertex to the next, closing the ring
+            _start = p_geometry->polygon_list.p_verticies[index],
+            _end   = p_geometry->polygon_list.p_verticies[( index + 1 == p_offsets[lo + 1] ) ? p_offsets[lo] : index + 1];
+
+            // Done
+            break;
+        }
+
+        default:
+
+            // Done
+            return;
+    }
+
+    // Store the segment
+    *p_segment = (geometry_line) { .x0 = _start.x, .y0 = _start.y, .x1 = _end.x, .y1 = _end.y };
+
+    // Done
+    return;
+}
+
+static double geometry_dispatch_segment_segment_distance ( geometry_line *p_a, geometry_line *p_b )
+{
+
+    // Initialized data
+    geometry_point a0       = { p_a->x0, p_a->y0 },
+                   a1       = { p_a->x1, p_a->y1 },
+                   b0       = { p_b->x0, p_b->y0 },
+                   b1       = { p_b->x1, p_b->y1 };
+    double         o0       = geometry_orient2d(&a0, &a1, &b0),
+                   o1       = geometry_orient2d(&a0, &a1, &b1),
+                   o2       = geometry_orient2d(&b0, &b1, &a0),
+                   o3       = geometry_orient2d(&b0, &b1, &a1),
+                   nearest  = INFINITY,
+                   distance = 0;
+
+    // Segments that cross are no distance apart. The signs are exact.
+    if ( ( ( o0 < 0 && o1 > 0 ) || ( o0 > 0 && o1 < 0 ) ) && ( ( o2 < 0 && o3 > 0 ) || ( o2 > 0 && o3 < 0 ) ) ) return 0;
+
+    // Otherwise the nearest points include an endpoint of one segment
+    geometry_point_line_distance(&a0, p_b, &distance), nearest = fmin(nearest, distance);
+    geometry_point_line_distance(&a1, p_b, &distance), nearest = fmin(nearest, distance);
+    geometry_point_line_distance(&b0, p_a, &distance), nearest = fmin(nearest, distance);
+    geometry_point_line_distance(&b1, p_a, &distance), nearest = fmin(nearest, distance);
+
+    // Done
+    return nearest;
+}
+
+static int geometry_dispatch_segment_inside ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Initialized data
+    size_t        quantity = geometry_dispatch_segment_quantity(p_a);
+    geometry_line _segment = { 0 };
+    geometry      _vertex  = { .type = GEOMETRY_POINT };
+    double        distance = 0;
+    bool          inside   = false;
+
+    // Measure the first vertex of each segment to the area
+    for (size_t i = 0; i < quantity && inside == false; i++)
+    {
+
+        // Get the first vertex of the segment
+        geometry_dispatch_segment(p_a, i, &_segment);
+        _vertex.point = (geometry_point) { _segment.x0, _segment.y0 };
+
+        // Measure it. A vertex inside of the area is no distance from it.
+        if ( geometry_distance(&_vertex, p_b, &distance) == 0 ) return 0;
+
+        // Store the result
+        inside = ( distance <= 0 );
+    }
+
+    // Return the result to the caller
+    *p_result = inside;
+
+    // Success
+    return 1;
+}
+
+static int geometry_dispatch_point_polygon_intersects ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Initialized data
+    enum geometry_location_e location = GEOMETRY_LOCATION_EXTERIOR;
+
+    // Locate the point
+    if ( geometry_point_polygon_locate(&p_a->point, &p_b->polygon, &location) == 0 ) return 0;
+
+    // Return the result to the caller
+    *p_result = ( location != GEOMETRY_LOCATION_EXTERIOR );
+
+    // Success
+    return 1;
+}
+
+static int geometry_dispatch_point_polygon_disjoint ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Initialized data
+    enum geometry_location_e location = GEOMETRY_LOCATION_EXTERIOR;
+
+    // Locate the point
+    if ( geometry_point_polygon_locate(&p_a->point, &p_b->polygon, &location) == 0 ) return 0;
+
+    // Return the result to the caller
+    *p_result = ( location == GEOMETRY_LOCATION_EXTERIOR );
+
+    // Success
+    return 1;
+}
+
+static int geometry_dispatch_polygon_point_contains ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Initialized data
+    enum geometry_location_e location = GEOMETRY_LOCATION_EXTERIOR;
+
+    // Locate the point
+    if ( geometry_point_polygon_locate(&p_b->point, &p_a->polygon, &location) == 0 ) return 0;
+
+    // Return the result to the caller
+    *p_result = ( location == GEOMETRY_LOCATION_INTERIOR );
+
+    // Success
+    return 1;
+}
+
+static int geometry_dispatch_boolean_intersection ( geometry *p_a, geometry *p_b, geometry *p_result )
+{
+
+    // Done
+    return geometry_boolean(p_a, p_b, GEOMETRY_BOOLEAN_INTERSECTION, p_result, (void *) 0);
+}
@@ -0,0 +1,1092 @@
+/** !
+ * Point list distance
+ *
+ * @file distance.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <string.h>
+
+// Header
+#include <geometry/distance.h>
+#include <geometry/batch.h>
+#include <geometry/parallel.h>
+
+// Instruction set extensions
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+#endif
+
+// Structure declarations
+struct geometry_distance_buffer_s;
+struct geometry_distance_s;
+struct geometry_closest_point_s;
+struct geometry_closest_s;
+
+// Type definitions
+typedef struct geometry_distance_buffer_s geometry_distance_buffer;
+typedef struct geometry_distance_s        geometry_distance_state;
+typedef struct geometry_closest_point_s   geometry_closest_point;
+typedef struct geometry_closest_s         geometry_closest_state;
+
+// Structure definitions
+// The pairs one thread found
+struct geometry_distance_buffer_s
+{
+    geometry_distance_pair *p_pairs;
+    size_t                  quantity,
+                            capacity;
+};
+
+// Column tile i of the second point list is its points from
+// i * GEOMETRY_DISTANCE_TILE_COLUMNS, and p_tiles[i] is their envelope
+struct geometry_distance_s
+{
+    geometry_point_list      *p_a;
+    geometry_point_list_soa   _b;
+    geometry_envelope        *p_tiles;
+    double                   *p_results,
+                              distance;
+    geometry_distance_buffer  buffers[GEOMETRY_PARALLEL_THREADS_MAX];
+};
+
+// A point, and its index in the point list
+struct geometry_closest_point_s
+{
+    double x,
+           y;
+    size_t index;
+};
+
+// Run i of the sorted points is p_sorted[offsets[i]] to
+// p_sorted[offsets[i+1]]. The distance of each pair is squared until
+// the result is returned.
+struct geometry_closest_s
+{
+    geometry_closest_point *p_sorted,
+                           *p_work,
+                           *p_scratch;
+    size_t                  quantity,
+                            runs,
+                            offsets[GEOMETRY_PARALLEL_THREADS_MAX + 1];
+    geometry_distance_pair  pairs[GEOMETRY_PARALLEL_THREADS_MAX];
+};
+
+// Forward declarations
+/** !
+ * Compute the rows of a distance matrix for a range of the first point
+ * list
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first row of the chunk
+ * @param last        one past the last row of the chunk
+ * @param p_parameter the distance state
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_distance_matrix_rows ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Find the pairs within the distance for a range of the first point list
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first row of the chunk
+ * @param last        one past the last row of the chunk
+ * @param p_parameter the distance state
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_distance_pairs_rows ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Find the points of a column tile within a distance of a point
+ *
+ * @param p_buffer  the buffer
+ * @param p_tile    the column tile
+ * @param p_point   the point
+ * @param distance2 the square of the distance
+ * @param a         the index of the point
+ * @param b         the index of the first point of the tile
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_distance_tile_pairs ( geometry_distance_buffer *p_buffer, geometry_point_list_soa *p_tile, geometry_point *p_point, double distance2, size_t a, size_t b );
+
+/** !
+ * Store a pair in a buffer
+ *
+ * @param p_buffer the buffer
+ * @param a        the index of the point of the first point list
+ * @param b        the index of the point of the second point list
+ * @param d2       the square of the distance between the points
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_distance_push ( geometry_distance_buffer *p_buffer, size_t a, size_t b, double d2 );
+
+/** !
+ * Release the memory held by a distance state
+ *
+ * @param p_distance the distance state
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_distance_destroy ( geometry_distance_state *p_distance );
+
+/** !
+ * Sort a chunk of the points by x
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first point of the chunk
+ * @param last        one past the last point of the chunk
+ * @param p_parameter the closest pair state
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_closest_pair_sort ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Merge a range of pairs of sorted runs from the sorted points into the
+ * work points
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first pair of runs of the chunk
+ * @param last        one past the last pair of runs of the chunk
+ * @param p_parameter the closest pair state
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_closest_pair_merge ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Find the closest pair of a chunk of the sorted points
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first point of the chunk
+ * @param last        one past the last point of the chunk
+ * @param p_parameter the closest pair state
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_closest_pair_chunk ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Find the closest pair of points sorted by x, leaving them sorted by y
+ *
+ * @param p_points  the points
+ * @param quantity  the quantity of points
+ * @param p_scratch room for quantity points
+ * @param p_best    the closest pair so far, and return
+ *
+ * @return void
+ */
+static void geometry_closest_pair_recurse ( geometry_closest_point *p_points, size_t quantity, geometry_closest_point *p_scratch, geometry_distance_pair *p_best );
+
+/** !
+ * Find any pair of a strip of points sorted by y closer than the closest
+ * pair so far
+ *
+ * @param p_strip  the points
+ * @param quantity the quantity of points
+ * @param p_best   the closest pair so far, and return
+ *
+ * @return void
+ */
+static void geometry_closest_pair_strip ( geometry_closest_point *p_strip, size_t quantity, geometry_distance_pair *p_best );
+
+/** !
+ * Compare two points by x, and then by y
+ *
+ * @return < 0 if A is first, > 0 if B is first, else 0
+ */
+static int geometry_closest_point_compare_x ( const void *p_a, const void *p_b );
+
+/** !
+ * Compare two points by y
+ *
+ * @return < 0 if A is first, > 0 if B is first, else 0
+ */
+static int geometry_closest_point_compare_y ( const void *p_a, const void *p_b );
+
+/** !
+ * @return < 0 if A is first, > 0 if B is first, else 0
+ */
+static int geometry_distance_pair_compare ( const void *p_a, const void *p_b );
+
+// Function definitions
+int geometry_point_list_distance_matrix ( geometry_point_list *p_a, geometry_point_list *p_b, double *p_results )
+{
+
+    // Argument check
+    if ( p_a       == (void *) 0 ) goto no_a;
+    if ( p_b       == (void *) 0 ) goto no_b;
+    if ( p_results == (void *) 0 ) goto no_results;
+
+    // Initialized data
+    geometry_distance_state _distance = { .p_a = p_a, .p_results = p_results };
+
+    // Empty matrix
+    if ( p_a->quantity == 0 || p_b->quantity == 0 ) return 1;
+
+    // Lay out the columns for the vector kernels
+    if ( geometry_point_list_soa_construct(&_distance._b, p_b, (void *) 0) == 0 ) goto failed_to_construct_soa;
+
+    // Compute the rows
+    if ( geometry_parallel_for(p_a->quantity, GEOMETRY_DISTANCE_GRAIN / p_b->quantity + 1, geometry_distance_matrix_rows, &_distance) == 0 ) goto failed_to_run_tasks;
+
+    // Clean up
+    geometry_distance_destroy(&_distance);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_construct_soa:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to construct structure of arrays point list in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_run_tasks:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to run parallel tasks in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_distance_destroy(&_distance);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_list_distance_pairs ( geometry_point_list *p_a, geometry_point_list *p_b, double distance, geometry_distance_pair **pp_pairs, size_t *p_quantity )
+{
+
+    // Argument check
+    if ( p_a        == (void *) 0 ) goto no_a;
+    if ( p_b        == (void *) 0 ) goto no_b;
+    if ( !( distance >= 0 )       ) goto invalid_distance;
+    if ( pp_pairs   == (void *) 0 ) goto no_pairs;
+    if ( p_quantity == (void *) 0 ) goto no_quantity;
+
+    // Initialized data
+    geometry_distance_state  _distance = { .p_a = p_a, .distance = distance };
+    geometry_distance_pair  *p_pairs   = (void *) 0;
+    size_t                   tiles     = ( p_b->quantity + GEOMETRY_DISTANCE_TILE_COLUMNS - 1 ) / GEOMETRY_DISTANCE_TILE_COLUMNS,
+                             quantity  = 0;
+
+    // No pairs
+    if ( p_a->quantity == 0 || p_b->quantity == 0 ) goto done;
+
+    // Lay out the columns for the vector kernels
+    if ( geometry_point_list_soa_construct(&_distance._b, p_b, (void *) 0) == 0 ) goto failed_to_construct_soa;
+
+    // Allocate memory for the envelopes of the column tiles
+    _distance.p_tiles = GEOMETRY_REALLOC(0, sizeof(geometry_envelope) * tiles);
+
+    // Error check
+    if ( _distance.p_tiles == (void *) 0 ) goto no_mem;
+
+    // Compute the envelope of each column tile
+    for (size_t t = 0; t < tiles; t++)
+    {
+
+        // Initialized data
+        geometry_envelope *p_tile = &_distance.p_tiles[t];
+        size_t             last   = ( t + 1 ) * GEOMETRY_DISTANCE_TILE_COLUMNS;
+
+        // Clamp
+        if ( last > p_b->quantity ) last = p_b->quantity;
+
+        // Start empty
+        *p_tile = (geometry_envelope) { INFINITY, INFINITY, -INFINITY, -INFINITY };
+
+        // Grow the envelope
+        for (size_t j = t * GEOMETRY_DISTANCE_TILE_COLUMNS; j < last; j++)
+            p_tile->x_min = fmin(p_tile->x_min, _distance._b.p_x[j]),
+            p_tile->y_min = fmin(p_tile->y_min, _distance._b.p_y[j]),
+            p_tile->x_max = fmax(p_tile->x_max, _distance._b.p_x[j]),
+            p_tile->y_max = fmax(p_tile->y_max, _distance._b.p_y[j]);
+    }
+
+    // Find the pairs of each range of rows
+    if ( geometry_parallel_for(p_a->quantity, GEOMETRY_DISTANCE_GRAIN / p_b->quantity + 1, geometry_distance_pairs_rows, &_distance) == 0 ) goto failed_to_run_tasks;
+
+    // Count the pairs
+    for (size_t i = 0; i < GEOMETRY_PARALLEL_THREADS_MAX; i++)
+        quantity += _distance.buffers[i].quantity;
+
+    // Gather the pairs. The chunks are ranges of rows in order, and each
+    // buffer is sorted, so the pairs are sorted.
+    if ( quantity )
+    {
+
+        // Initialized data
+        size_t k = 0;
+
+        // Allocate memory for the pairs
+        p_pairs = GEOMETRY_REALLOC(0, sizeof(geometry_distance_pair) * quantity);
+
+        // Error check
+        if ( p_pairs == (void *) 0 ) goto no_mem;
+
+        // Copy each buffer
+        for (size_t i = 0; i < GEOMETRY_PARALLEL_THREADS_MAX; i++)
+        {
+            if ( _distance.buffers[i].quantity )
+                memcpy(&p_pairs[k], _distance.buffers[i].p_pairs, sizeof(geometry_distance_pair) * _distance.buffers[i].quantity);
+
+            // Accumulate
+            k += _distance.buffers[i].quantity;
+        }
+    }
+
+    done:
+
+    // Clean up
+    geometry_distance_destroy(&_distance);
+
+    // Return the pairs to the caller
+    *pp_pairs   = p_pairs,
+    *p_quantity = quantity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            invalid_distance:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"distance\" must not be negative in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_pairs:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_pairs\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_quantity:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_construct_soa:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to construct structure of arrays point list in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_run_tasks:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to run parallel tasks in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_distance_destroy(&_distance);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_distance_destroy(&_distance);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_list_closest_pair ( geometry_point_list *p_point_list, geometry_distance_pair *p_result )
+{
+
+    // Argument check
+    if ( p_point_list           == (void *) 0 ) goto no_point_list;
+    if ( p_result               == (void *) 0 ) goto no_result;
+    if ( p_point_list->quantity  <          2 ) goto too_few_points;
+
+    // Initialized data
+    geometry_closest_state *p_closest = (void *) 0;
+    geometry_distance_pair  best      = { .distance = INFINITY };
+    size_t                  quantity  = p_point_list->quantity,
+                            chunks    = geometry_parallel_chunks(quantity, GEOMETRY_CLOSEST_PAIR_GRAIN);
+
+    // Allocate the state. The sorted, work and scratch points follow it.
+    p_closest = GEOMETRY_REALLOC(0, sizeof(geometry_closest_state) + sizeof(geometry_closest_point) * quantity * 3);
+
+    // Error check
+    if ( p_closest == (void *) 0 ) goto no_mem;
+
+    // Store the buffers
+    p_closest->p_sorted  = (geometry_closest_point *) ( p_closest + 1 ),
+    p_closest->p_work    = p_closest->p_sorted + quantity,
+    p_closest->p_scratch = p_closest->p_work + quantity,
+    p_closest->quantity  = quantity,
+    p_closest->runs      = chunks;
+
+    // Copy the points
+    for (size_t i = 0; i < quantity; i++)
+        p_closest->p_sorted[i] = (geometry_closest_point) { .x = p_point_list->p_points[i].x, .y = p_point_list->p_points[i].y, .index = i };
+
+    // The runs are the chunks
+    for (size_t c = 0; c <= chunks; c++)
+        p_closest->offsets[c] = quantity / chunks * c + ( ( c < quantity % chunks ) ? c : quantity % chunks );
+
+    // Sort each chunk by x
+    if ( geometry_parallel_for(quantity, GEOMETRY_CLOSEST_PAIR_GRAIN, geometry_closest_pair_sort, p_closest) == 0 ) goto failed_to_run_tasks;
+
+    // Merge the runs in pairs, until one run is left
+    while ( p_closest->runs > 1 )
+    {
+
+        // Initialized data
+        size_t                  runs     = ( p_closest->runs + 1 ) / 2;
+        geometry_closest_point *p_merged = p_closest->p_work;
+
+        // Merge each pair of runs
+        if ( geometry_parallel_for(runs, 1, geometry_closest_pair_merge, p_closest) == 0 ) goto failed_to_run_tasks;
+
+        // The merged runs start where each pair of runs started
+        for (size_t i = 0; i < runs; i++)
+            p_closest->offsets[i] = p_closest->offsets[2 * i];
+
+        // Store the merged runs
+        p_closest->offsets[runs] = quantity,
+        p_closest->runs          = runs,
+        p_closest->p_work        = p_closest->p_sorted,
+        p_closest->p_sorted      = p_merged;
+    }
+
+    // Find the closest pair of each chunk
+    if ( geometry_parallel_for(quantity, GEOMETRY_CLOSEST_PAIR_GRAIN, geometry_closest_pair_chunk, p_closest) == 0 ) goto failed_to_run_tasks;
+
+    // Keep the closest of the chunks
+    for (size_t c = 0; c < chunks; c++)
+        if ( p_closest->pairs[c].distance < best.distance ) best = p_closest->pairs[c];
+
+    // Find the pairs that straddle each boundary between chunks. Both
+    // points of such a pair are closer to the first point right of the
+    // boundary than the closest pair, along x.
+    for (size_t c = 1; c < chunks; c++)
+    {
+
+        // Initialized data
+        size_t                  boundary = quantity / chunks * c + ( ( c < quantity % chunks ) ? c : quantity % chunks ),
+                                left     = boundary,
+                                right    = boundary;
+        geometry_closest_point *p_sorted = p_closest->p_sorted;
+        double                  x        = p_sorted[boundary].x;
+
+        // Widen the strip
+        while ( left  > 0        && ( x - p_sorted[left - 1].x ) * ( x - p_sorted[left - 1].x ) < best.distance ) left--;
+        while ( right < quantity && ( p_sorted[right].x - x    ) * ( p_sorted[right].x - x    ) < best.distance ) right++;
+
+        // Copy the strip
+        memcpy(p_closest->p_scratch, &p_sorted[left], sizeof(geometry_closest_point) * ( right - left ));
+
+        // Sort the strip by y
+        qsort(p_closest->p_scratch, right - left, sizeof(geometry_closest_point), geometry_closest_point_compare_y);
+
+        // Search the strip
+        geometry_closest_pair_strip(p_closest->p_scratch, right - left, &best);
+    }
+
+    // Return the closest pair to the caller
+    *p_result = (geometry_distance_pair)
+    {
+        .a        = ( best.a < best.b ) ? best.a : best.b,
+        .b        = ( best.a < best.b ) ? best.b : best.a,
+        .distance = sqrt(best.distance)
+    };
+
+    // Clean up
+    p_closest = GEOMETRY_REALLOC(p_closest, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_point_list:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            too_few_points:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_point_list\" has fewer than two points in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_run_tasks:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to run parallel tasks in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                p_closest = GEOMETRY_REALLOC(p_closest, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_distance_matrix_rows ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_distance_state *p_distance = p_parameter;
+    size_t                   columns    = p_distance->_b.quantity;
+
+    // Unused
+    (void) chunk;
+
+    // Each tile of rows
+    for (size_t r = first; r < last; r += GEOMETRY_DISTANCE_TILE_ROWS)
+    {
+
+        // Initialized data
+        size_t rows = ( last - r < GEOMETRY_DISTANCE_TILE_ROWS ) ? last - r : GEOMETRY_DISTANCE_TILE_ROWS;
+
+        // Each tile of columns
+        for (size_t c = 0; c < columns; c += GEOMETRY_DISTANCE_TILE_COLUMNS)
+        {
+
+            // Initialized data
+            geometry_point_list_soa _tile =
+            {
+                .quantity = ( columns - c < GEOMETRY_DISTANCE_TILE_COLUMNS ) ? columns - c : GEOMETRY_DISTANCE_TILE_COLUMNS,
+                .p_x      = p_distance->_b.p_x + c,
+                .p_y      = p_distance->_b.p_y + c
+            };
+
+            // Compare each row of the tile to its columns
+            for (size_t i = r; i < r + rows; i++)
+                if ( geometry_point_list_soa_distances(&_tile, &p_distance->p_a->p_points[i], &p_distance->p_results[i * columns + c]) == 0 ) return 0;
+        }
+    }
+
+    // Success
+    return 1;
+}
+
+static int geometry_distance_pairs_rows ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_distance_state  *p_distance = p_parameter;
+    geometry_distance_buffer *p_buffer   = &p_distance->buffers[chunk];
+    geometry_point           *p_points   = p_distance->p_a->p_points;
+    size_t                    columns    = p_distance->_b.quantity;
+    double                    distance   = p_distance->distance,
+                              distance2  = distance * distance;
+
+    // Each tile of rows
+    for (size_t r = first; r < last; r += GEOMETRY_DISTANCE_TILE_ROWS)
+    {
+
+        // Initialized data
+        size_t            rows      = ( last - r < GEOMETRY_DISTANCE_TILE_ROWS ) ? last - r : GEOMETRY_DISTANCE_TILE_ROWS;
+        geometry_envelope _envelope = { INFINITY, INFINITY, -INFINITY, -INFINITY };
+
+        // Compute the envelope of the rows
+        for (size_t i = r; i < r + rows; i++)
+            _envelope.x_min = fmin(_envelope.x_min, p_points[i].x),
+            _envelope.y_min = fmin(_envelope.y_min, p_points[i].y),
+            _envelope.x_max = fmax(_envelope.x_max, p_points[i].x),
+            _envelope.y_max = fmax(_envelope.y_max, p_points[i].y);
+
+        // Each tile of columns
+        for (size_t c = 0, t = 0; c < columns; c += GEOMETRY_DISTANCE_TILE_COLUMNS, t++)
+        {
+
+            // Initialized data
+            geometry_envelope       *p_tile = &p_distance->p_tiles[t];
+            geometry_point_list_soa  _tile  =
+            {
+                .quantity = ( columns - c < GEOMETRY_DISTANCE_TILE_COLUMNS ) ? columns - c : GEOMETRY_DISTANCE_TILE_COLUMNS,
+                .p_x      = p_distance->_b.p_x + c,
+                .p_y      = p_distance->_b.p_y + c
+            };
+            double                   dx     = fmax(0, fmax(_envelope.x_min - p_tile->x_max, p_tile->x_min - _envelope.x_max)),
+                                     dy     = fmax(0, fmax(_envelope.y_min - p_tile->y_max, p_tile->y_min - _envelope.y_max));
+
+            // Skip tiles further apart than the distance
+            if ( dx > distance || dy > distance || dx * dx + dy * dy > distance2 ) continue;
+
+            // Compare each row of the tile to its columns
+            for (size_t i = r; i < r + rows; i++)
+                if ( geometry_distance_tile_pairs(p_buffer, &_tile, &p_points[i], distance2, i, c) == 0 ) return 0;
+        }
+    }
+
+    // The tiles of columns interleave the rows of a tile of rows
+    if ( p_buffer->quantity ) qsort(p_buffer->p_pairs, p_buffer->quantity, sizeof(geometry_distance_pair), geometry_distance_pair_compare);
+
+    // Success
+    return 1;
+}
+
+static int geometry_distance_tile_pairs ( geometry_distance_buffer *p_buffer, geometry_point_list_soa *p_tile, geometry_point *p_point, double distance2, size_t a, size_t b )
+{
+
+    // Initialized data
+    const double *p_x = p_tile->p_x,
+                 *p_y = p_tile->p_y;
+    size_t        n   = p_tile->quantity,
+                  i   = 0;
+
+    // The vector paths only store the lanes whose mask is set
+    #if defined(__AVX2__)
+    {
+
+        // Initialized data
+        __m256d px = _mm256_set1_pd(p_point->x),
+                py = _mm256_set1_pd(p_point->y),
+                r2 = _mm256_set1_pd(distance2);
+        double  d[4];
+
+        // Four points at a time
+        for (; i + 4 <= n; i += 4)
+        {
+
+            // Initialized data
+            __m256d dx   = _mm256_sub_pd(_mm256_loadu_pd(&p_x[i]), px),
+                    dy   = _mm256_sub_pd(_mm256_loadu_pd(&p_y[i]), py),
+                    d2   = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+            int     mask = _mm256_movemask_pd(_mm256_cmp_pd(d2, r2, _CMP_LE_OQ));
+
+            // No point of the lanes is close enough
+            if ( mask == 0 ) continue;
+
+            // Store the close points
+            _mm256_storeu_pd(d, d2);
+            for (size_t j = 0; j < 4; j++)
+                if ( mask & ( 1 << j ) && geometry_distance_push(p_buffer, a, b + i + j, d[j]) == 0 ) return 0;
+        }
+    }
+    #elif defined(__SSE2__) || defined(_M_X64)
+    {
+
+        // Initialized data
+        __m128d px = _mm_set1_pd(p_point->x),
+                py = _mm_set1_pd(p_point->y),
+                r2 = _mm_set1_pd(distance2);
+        double  d[2];
+
+        // Two points at a time
+        for (; i + 2 <= n; i += 2)
+        {
+
+            // Initialized data
+            __m128d dx   = _mm_sub_pd(_mm_loadu_pd(&p_x[i]), px),
+                    dy   = _mm_sub_pd(_mm_loadu_pd(&p_y[i]), py),
+                    d2   = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+            int     mask = _mm_movemask_pd(_mm_cmple_pd(d2, r2));
+
+            // No point of the lanes is close enough
+            if ( mask == 0 ) continue;
+
+            // Store the close points
+            _mm_storeu_pd(d, d2);
+            for (size_t j = 0; j < 2; j++)
+                if ( mask & ( 1 << j ) && geometry_distance_push(p_buffer, a, b + i + j, d[j]) == 0 ) return 0;
+        }
+    }
+    #endif
+
+    // Remaining points
+    for (; i < n; i++)
+    {
+
+        // Initialized data
+        double dx = p_x[i] - p_point->x,
+               dy = p_y[i] - p_point->y,
+               d2 = dx * dx + dy * dy;
+
+        // Store the close point
+        if ( d2 <= distance2 && geometry_distance_push(p_buffer, a, b + i, d2) == 0 ) return 0;
+    }
+
+    // Success
+    return 1;
+}
+
+static int geometry_distance_push ( geometry_distance_buffer *p_buffer, size_t a, size_t b, double d2 )
+{
+
+    // Grow
+    if ( p_buffer->quantity == p_buffer->capacity )
+    {
+
+        // Initialized data
+        size_t                  capacity = ( p_buffer->capacity ) ? 2 * p_buffer->capacity : 64;
+        geometry_distance_pair *p_pairs  = GEOMETRY_REALLOC(p_buffer->p_pairs, sizeof(geometry_distance_pair) * capacity);
+
+        // Error check
+        if ( p_pairs == (void *) 0 ) goto no_mem;
+
+        // Store the pairs
+        p_buffer->p_pairs  = p_pairs,
+        p_buffer->capacity = capacity;
+    }
+
+    // Store the pair
+    p_buffer->p_pairs[p_buffer->quantity++] = (geometry_distance_pair) { .a = a, .b = b, .distance = sqrt(d2) };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_distance_destroy ( geometry_distance_state *p_distance )
+{
+
+    // Release the buffers
+    for (size_t i = 0; i < GEOMETRY_PARALLEL_THREADS_MAX; i++)
+        if ( p_distance->buffers[i].p_pairs ) p_distance->buffers[i].p_pairs = GEOMETRY_REALLOC(p_distance->buffers[i].p_pairs, 0);
+
+    // Release the envelopes of the column tiles
+    if ( p_distance->p_tiles ) p_distance->p_tiles = GEOMETRY_REALLOC(p_distance->p_tiles, 0);
+
+    // Release the columns
+    if ( p_distance->_b.p_x ) geometry_point_list_soa_destroy(&p_distance->_b);
+
+    // Success
+    return 1;
+}
+
+static int geometry_closest_pair_sort ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_closest_state *p_closest = p_parameter;
+
+    // Unused
+    (void) chunk;
+
+    // Sort the chunk
+    qsort(&p_closest->p_sorted[first], last - first, sizeof(geometry_closest_point), geometry_closest_point_compare_x);
+
+    // Success
+    return 1;
+}
+
+static int geometry_closest_pair_merge ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_closest_state *p_closest = p_parameter;
+    geometry_closest_point *p_from    = p_closest->p_sorted,
+                           *p_to      = p_closest->p_work;
+
+    // Unused
+    (void) chunk;
+
+    // Merge each pair of runs
+    for (size_t k = first; k < last; k++)
+    {
+
+        // Initialized data
+        size_t i   = p_closest->offsets[2 * k],
+               mid = ( 2 * k + 1 < p_closest->runs ) ? p_closest->offsets[2 * k + 1] : p_closest->quantity,
+               end = ( 2 * k + 1 < p_closest->runs ) ? p_closest->offsets[2 * k + 2] : p_closest->quantity,
+               j   = mid,
+               o   = i;
+
+        // Take the lesser head of the runs. A run with no pair is copied.
+        while ( i < mid && j < end )
+            p_to[o++] = ( geometry_closest_point_compare_x(&p_from[j], &p_from[i]) < 0 ) ? p_from[j++] : p_from[i++];
+
+        // Copy the rest
+        while ( i < mid ) p_to[o++] = p_from[i++];
+        while ( j < end ) p_to[o++] = p_from[j++];
+    }
+
+    // Success
+    return 1;
+}
+
+static int geometry_closest_pair_chunk ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_closest_state *p_closest = p_parameter;
+
+    // The recursion reorders the points by y, so it works on a copy
+    memcpy(&p_closest->p_work[first], &p_closest->p_sorted[first], sizeof(geometry_closest_point) * ( last - first ));
+
+    // Start with no pair
+    p_closest->pairs[chunk] = (geometry_distance_pair) { .distance = INFINITY };
+
+    // Find the closest pair of the chunk
+    geometry_closest_pair_recurse(&p_closest->p_work[first], last - first, &p_closest->p_scratch[first], &p_closest->pairs[chunk]);
+
+    // Success
+    return 1;
+}
+
+static void geometry_closest_pair_recurse ( geometry_closest_point *p_points, size_t quantity, geometry_closest_point *p_scratch, geometry_distance_pair *p_best )
+{
+
+    // Initialized data
+    size_t mid    = quantity / 2,
+           strip  = 0,
+           i      = 0,
+           j      = mid,
+           o      = 0;
+    double x      = 0;
+
+    // Compare each pair of a few points
+    if ( quantity <= 3 )
+    {
+
+        // Each pair
+        for (size_t a = 0; a < quantity; a++)
+            for (size_t b = a + 1; b < quantity; b++)
+            {
+
+                // Initialized data
+                double dx = p_points[a].x - p_points[b].x,
+                       dy = p_points[a].y - p_points[b].y,
+                       d2 = dx * dx + dy * dy;
+
+                // Closer
+                if ( d2 < p_best->distance ) *p_best = (geometry_distance_pair) { .a = p_points[a].index, .b = p_points[b].index, .distance = d2 };
+            }
+
+        // Sort by y
+        for (size_t a = 1; a < quantity; a++)
+            for (size_t b = a; b > 0 && p_points[b].y < p_points[b - 1].y; b--)
+            {
+
+                // Initialized data
+                geometry_closest_point _swap = p_points[b];
+
+                // Swap
+                p_points[b] = p_points[b - 1],
+                p_points[b - 1] = _swap;
+            }
+
+        // Done
+        return;
+    }
+
+    // The line between the halves
+    x = p_points[mid].x;
+
+    // Each half
+    geometry_closest_pair_recurse(p_points, mid, p_scratch, p_best);
+    geometry_closest_pair_recurse(&p_points[mid], quantity - mid, p_scratch, p_best);
+
+    // Merge the halves by y
+    while ( i < mid && j < quantity ) p_scratch[o++] = ( p_points[j].y < p_points[i].y ) ? p_points[j++] : p_points[i++];
+    while ( i < mid      ) p_scratch[o++] = p_points[i++];
+    while ( j < quantity ) p_scratch[o++] = p_points[j++];
+    memcpy(p_points, p_scratch, sizeof(geometry_closest_point) * quantity);
+
+    // Gather the points closer to the line than the closest pair
+    for (size_t k = 0; k < quantity; k++)
+    {
+
+        // Initialized data
+        double dx = p_points[k].x - x;
+
+        // Close to the line
+        if ( dx * dx < p_best->distance ) p_scratch[strip++] = p_points[k];
+    }
+
+    // Search the strip
+    geometry_closest_pair_strip(p_scratch, strip, p_best);
+
+    // Done
+    return;
+}
+
+static void geometry_closest_pair_strip ( geometry_closest_point *p_strip, size_t quantity, geometry_distance_pair *p_best )
+{
+
+    // Compare each point to the points above it, closer along y than the
+    // closest pair. There are only a few of them.
+    for (size_t a = 0; a < quantity; a++)
+        for (size_t b = a + 1; b < quantity; b++)
+        {
+
+            // Initialized data
+            double dy = p_strip[b].y - p_strip[a].y,
+                   dx = p_strip[b].x - p_strip[a].x,
+                   d2 = dx * dx + dy * dy;
+
+            // Too far along y
+            if ( dy * dy >= p_best->distance ) break;
+
+            // Closer
+            if ( d2 < p_best->distance ) *p_best = (geometry_distance_pair) { .a = p_strip[a].index, .b = p_strip[b].index, .distance = d2 };
+        }
+
+    // Done
+    return;
+}
+
+static int geometry_closest_point_compare_x ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_closest_point *p_x = p_a,
+                                 *p_y = p_b;
+
+    // Compare x
+    if ( p_x->x != p_y->x ) return ( p_x->x > p_y->x ) ? 1 : -1;
+
+    // Compare y
+    return ( p_x->y > p_y->y ) - ( p_x->y < p_y->y );
+}
+
+static int geometry_closest_point_compare_y ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_closest_point *p_x = p_a,
+                                 *p_y = p_b;
+
+    // Compare y
+    return ( p_x->y > p_y->y ) - ( p_x->y < p_y->y );
+}
+
+static int geometry_distance_pair_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_distance_pair *p_pair_a = p_a,
+                                 *p_pair_b = p_b;
+
+    // By a
+    if ( p_pair_a->a != p_pair_b->a ) return ( p_pair_a->a > p_pair_b->a ) ? 1 : -1;
+
+    // By b
+    return ( p_pair_a->b > p_pair_b->b ) - ( p_pair_a->b < p_pair_b->b );
+}
@@ -1,7 +1,59 @@
+// Standard library
+#include <string.h>
+
+// geometry
 #include <geometry/geometry.h>
+#include <geometry/arena.h>
+#include <geometry/predicates.h>
+#include <geometry/measure.h>
+#include <geometry/dispatch.h>
+#include <geometry/parallel.h>
 
 // Forward declarations
-int geometry_point_distance ( geometry *p_a, geometry *p_b, double *p_result );
+/** !
+ * Test if a point is inside a ring, using the crossing number rule
+ * 
+ * @param p_point     the point
+ * @param p_verticies the verticies of the ring
+ * @param quantity    the quantity of verticies
+ * 
+ * @return true if the point is inside the ring, else false
+ */
+static bool geometry_ring_contains ( const geometry_point *p_point, const geometry_point *p_verticies, size_t quantity );
+
+/** !
+ * Compute the squared distance from a point to the nearest edge of a
+ * ring, and test if the point is inside of the ring, in one pass
+ * 
+ * @param p_point     the point
+ * @param p_verticies the verticies of the ring
+ * @param quantity    the quantity of verticies
+ * @param p_inside    return; true if the point is inside the ring, with the crossing number rule
+ * 
+ * @return the squared distance
+ */
+static double geometry_ring_distance_squared ( const geometry_point *p_point, const geometry_point *p_verticies, size_t quantity, bool *p_inside );
+
+/** !
+ * Test if a ring of a polygon list is a hole. A ring inside of an odd
+ * quantity of other rings is a hole.
+ * 
+ * @param p_polygon_list the polygon list
+ * @param index          the index of the ring
+ * 
+ * @return true if the ring is a hole, else false
+ */
+static bool geometry_polygon_list_ring_is_hole ( const geometry_polygon_list *p_polygon_list, size_t index );
+
+/** !
+ * Compute the squared distance from a point to a line
+ * 
+ * @param p_point the point
+ * @param p_line  the line
+ * 
+ * @return the squared distance
+ */
+static double geometry_line_distance_squared ( const geometry_point *p_point, const geometry_line *p_line );
 
 // Function definitions
 int geometry_init ( void )
@@ -10,6 +62,12 @@ int geometry_init ( void )
     // Initialize the log library
     log_init();
 
+    // Register the kernels of the binary operations
+    if ( geometry_dispatch_init() == 0 ) return 0;
+
+    // Start the executor
+    if ( geometry_parallel_init(0, false) == 0 ) return 0;
+
     // Success
     return 1;
 }
@@ -37,6 +95,14 @@ int geometry_area ( geometry *p_geometry, double *p_result )
             
             // Done
             break;
+
+        case GEOMETRY_TRIANGLE:
+
+            // Store the area
+            if ( geometry_polygon_area(&(geometry_polygon) { .quantity = 3, .p_verticies = &p_geometry->triangle.a }, &ret) == 0 ) goto failed_to_calculate_polygon_area;
+
+            // Done
+            break;
             
         case GEOMETRY_POLYGON:
 
@@ -50,17 +116,21 @@ int geometry_area ( geometry *p_geometry, double *p_result )
         {
 
             // Initialized data
-            double temp = 0.0;
+            const size_t   *p_offsets   = p_geometry->polygon_list.p_offsets;
+            geometry_point *p_verticies = p_geometry->polygon_list.p_verticies;
 
-            // Iterate through each polygon
+            // Stream through the packed verticies, one ring at a time
             for (size_t i = 0; i < p_geometry->polygon_list.quantity; i++)
             {
 
-                // Compute the area
-                geometry_polygon_area(&p_geometry->polygon_list.p_polygons[i], &temp);
+                // Initialized data
+                geometry_measure _measure = { 0 };
+
+                // Measure the ring
+                if ( geometry_polygon_measure(&(geometry_polygon) { .quantity = p_offsets[i + 1] - p_offsets[i], .p_verticies = &p_verticies[p_offsets[i]] }, &_measure) == 0 ) goto failed_to_calculate_polygon_area;
 
-                // Accumulate the area
-                ret += temp;
+                // Accumulate the area, and subtract the area of holes
+                ret += ( geometry_polygon_list_ring_is_hole(&p_geometry->polygon_list, i) ) ? -fabs(_measure.area) : fabs(_measure.area);
             }
 
             // Done
@@ -124,11 +194,12 @@ int geometry_area ( geometry *p_geometry, double *p_result )
     }
 }
 
-double geometry_length ( geometry *p_geometry )
+int geometry_length ( geometry *p_geometry, double *p_result )
 {
     
     // Argument check
     if ( p_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_result   == (void *) 0 ) goto no_result;
 
     // Initialized data
     double ret = 0.0;
@@ -139,51 +210,99 @@ double geometry_length ( geometry *p_geometry )
         case GEOMETRY_POINT:
         case GEOMETRY_POINT_LIST:
 
+            // These types of geometry have no length
+            ret = 0.0;
+
             // Done
             break;
 
         case GEOMETRY_LINE:
+        {
+
+            // Initialized data
+            double dx = p_geometry->line.x1 - p_geometry->line.x0,
+                   dy = p_geometry->line.y1 - p_geometry->line.y0;
 
             // Store the length of the line
-            ret = sqrt(pow((p_geometry->line.x1, p_geometry->line.x0), 2) + pow((p_geometry->line.y1, p_geometry->line.y0), 2));
+            ret = sqrt(dx * dx + dy * dy);
 
             // Done
             break;
+        }
 
         case GEOMETRY_LINE_LIST:
 
-            // TODO
+            // Accumulate the length of each line
+            for (size_t i = 0; i < p_geometry->line_list.quantity; i++)
+            {
+
+                // Initialized data
+                const geometry_line *p_line = &p_geometry->line_list.p_lines[i];
+                double               dx     = p_line->x1 - p_line->x0,
+                                     dy     = p_line->y1 - p_line->y0;
+
+                // Accumulate
+                ret += sqrt(dx * dx + dy * dy);
+            }
 
             // Done
             break;
 
+        case GEOMETRY_TRIANGLE:
         case GEOMETRY_POLYGON:
+        {
+
+            // Initialized data
+            geometry_polygon _ring    = ( p_geometry->type == GEOMETRY_TRIANGLE ) ? (geometry_polygon) { .quantity = 3, .p_verticies = &p_geometry->triangle.a } : p_geometry->polygon;
+            geometry_measure _measure = { 0 };
+
+            // Measure the ring
+            if ( geometry_polygon_measure(&_ring, &_measure) == 0 ) goto failed_to_measure_polygon;
+
+            // Store the perimeter
+            ret = _measure.perimeter;
+
+            // Done
+            break;
+        }
+
+        case GEOMETRY_POLYGON_LIST:
+        {
 
-            // TODO
-            //
+            // Initialized data
+            const size_t   *p_offsets   = p_geometry->polygon_list.p_offsets;
+            geometry_point *p_verticies = p_geometry->polygon_list.p_verticies;
 
-            /*
-                result = 0.0, point O(0.0, 0.0) 
+            // Stream through the packed verticies, one ring at a time
+            for (size_t i = 0; i < p_geometry->polygon_list.quantity; i++)
+            {
 
-                for (i = 0; i < P.size()-1; ++i)
+                // Initialized data
+                geometry_measure _measure = { 0 };
 
-                result += cross(toVec(O,P[i]),toVec(O,P[i+1]))/2
+                // Measure the ring
+                if ( geometry_polygon_measure(&(geometry_polygon) { .quantity = p_offsets[i + 1] - p_offsets[i], .p_verticies = &p_verticies[p_offsets[i]] }, &_measure) == 0 ) goto failed_to_measure_polygon;
 
-                return fabs(result)
-            */
+                // Accumulate the perimeter
+                ret += _measure.perimeter;
+            }
 
             // Done
             break;
+        }
 
+        case GEOMETRY_INVALID:
         default:
 
-            // TODO: Error
-            // Done
-            break;
+            // Error
+            goto invalid_geometry_type;
     }
 
+    // Store the return value
+    *p_result = ret;
+
     // Success
-    return ret;
+    return 1;
 
     // Error handling
     {
@@ -195,50 +314,204 @@ double geometry_length ( geometry *p_geometry )
                     log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
                 
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            failed_to_measure_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to measure polygon in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            invalid_geometry_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_geometry\" is of invalid type in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
                 // Error
                 return 0;
         }
     }
 }
 
-int geometry_distance ( geometry *p_a, geometry *p_b, double *p_result )
+int geometry_centroid ( geometry *p_geometry, geometry *p_result )
 {
-    
-    // Argument check
-    if ( p_a      == (void *) 0 ) goto no_a;
-    if ( p_b      == (void *) 0 ) goto no_b;
-    if ( p_result == (void *) 0 ) goto no_result;
-
-    // Check the precedence of the input geometry
-    if ( p_a->type > p_b->type )
-    {
 
-        // Initialized data
-        geometry *p_temp = p_a;
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_result   == (void *) 0 ) goto no_result;
 
-        // Swap
-        p_a = p_b;
-        p_b = p_temp;
-    }
+    // Initialized data
+    geometry_point ret = { NAN, NAN };
 
     // Strategy
-    switch (p_a->type)
+    switch ( p_geometry->type )
     {
-
-        // Point to geometry
         case GEOMETRY_POINT:
 
-            // Compute the distance from point a to geometry b
-            if ( geometry_point_distance(p_a, p_b, p_result) == 0 ) goto failed_to_compute_distance_from_point;
-        
+            // The centroid of a point is the point
+            ret = p_geometry->point;
+
+            // Done
+            break;
+
         case GEOMETRY_POINT_LIST:
+        {
+
+            // Initialized data
+            double sx = 0,
+                   sy = 0;
+
+            // Empty point list
+            if ( p_geometry->point_list.quantity == 0 ) break;
+
+            // Accumulate each point
+            for (size_t i = 0; i < p_geometry->point_list.quantity; i++)
+                sx += p_geometry->point_list.p_points[i].x,
+                sy += p_geometry->point_list.p_points[i].y;
+
+            // Store the mean of the points
+            ret = (geometry_point) { .x = sx / (double) p_geometry->point_list.quantity, .y = sy / (double) p_geometry->point_list.quantity };
+
+            // Done
+            break;
+        }
+
         case GEOMETRY_LINE:
+
+            // Store the midpoint of the line
+            ret = (geometry_point) { .x = ( p_geometry->line.x0 + p_geometry->line.x1 ) * 0.5, .y = ( p_geometry->line.y0 + p_geometry->line.y1 ) * 0.5 };
+
+            // Done
+            break;
+
         case GEOMETRY_LINE_LIST:
+        {
+
+            // Initialized data
+            double sx     = 0,
+                   sy     = 0,
+                   mx     = 0,
+                   my     = 0,
+                   length = 0;
+            size_t n      = p_geometry->line_list.quantity;
+
+            // Empty line list
+            if ( n == 0 ) break;
+
+            // Accumulate the midpoint of each line, weighted by its length
+            for (size_t i = 0; i < n; i++)
+            {
+
+                // Initialized data
+                const geometry_line *p_line = &p_geometry->line_list.p_lines[i];
+                double               dx     = p_line->x1 - p_line->x0,
+                                     dy     = p_line->y1 - p_line->y0,
+                                     l      = sqrt(dx * dx + dy * dy);
+
+                // Accumulate
+                sx     += l * ( p_line->x0 + p_line->x1 ) * 0.5,
+                sy     += l * ( p_line->y0 + p_line->y1 ) * 0.5,
+                mx     += ( p_line->x0 + p_line->x1 ) * 0.5,
+                my     += ( p_line->y0 + p_line->y1 ) * 0.5,
+                length += l;
+            }
+
+            // Store the centroid, or the mean of the midpoints if every line is a point
+            ret = ( length > 0 ) ? (geometry_point) { .x = sx / length, .y = sy / length } : (geometry_point) { .x = mx / (double) n, .y = my / (double) n };
+
+            // Done
+            break;
+        }
+
+        case GEOMETRY_TRIANGLE:
         case GEOMETRY_POLYGON:
-        default:
+        {
+
+            // Initialized data
+            geometry_polygon _ring    = ( p_geometry->type == GEOMETRY_TRIANGLE ) ? (geometry_polygon) { .quantity = 3, .p_verticies = &p_geometry->triangle.a } : p_geometry->polygon;
+            geometry_measure _measure = { 0 };
+
+            // Measure the ring
+            if ( geometry_polygon_measure(&_ring, &_measure) == 0 ) goto failed_to_measure_polygon;
+
+            // Store the centroid
+            ret = _measure.centroid;
+
+            // Done
+            break;
+        }
+
+        case GEOMETRY_POLYGON_LIST:
+        {
+
+            // Initialized data
+            const size_t   *p_offsets   = p_geometry->polygon_list.p_offsets;
+            geometry_point *p_verticies = p_geometry->polygon_list.p_verticies;
+            double          ax          = 0,
+                            ay          = 0,
+                            area        = 0,
+                            px          = 0,
+                            py          = 0,
+                            perimeter   = 0;
+
+            // Stream through the packed verticies, one ring at a time
+            for (size_t i = 0; i < p_geometry->polygon_list.quantity; i++)
+            {
+
+                // Initialized data
+                geometry_measure _measure = { 0 };
+                double           a        = 0;
+
+                // Measure the ring
+                if ( geometry_polygon_measure(&(geometry_polygon) { .quantity = p_offsets[i + 1] - p_offsets[i], .p_verticies = &p_verticies[p_offsets[i]] }, &_measure) == 0 ) goto failed_to_measure_polygon;
+
+                // Skip empty rings
+                if ( p_offsets[i + 1] == p_offsets[i] ) continue;
+
+                // Accumulate the centroid, weighted by area and by perimeter. Holes
+                // weigh against the centroid.
+                a          = ( geometry_polygon_list_ring_is_hole(&p_geometry->polygon_list, i) ) ? -fabs(_measure.area) : fabs(_measure.area),
+                ax        += a * _measure.centroid.x,
+                ay        += a * _measure.centroid.y,
+                area      += a,
+                px        += _measure.perimeter * _measure.centroid.x,
+                py        += _measure.perimeter * _measure.centroid.y,
+                perimeter += _measure.perimeter;
+            }
+
+            // Store the centroid of the area, or of the edges if there is no area
+            if      ( fabs(area) > 0 ) ret = (geometry_point) { .x = ax / area, .y = ay / area };
+            else if ( perimeter  > 0 ) ret = (geometry_point) { .x = px / perimeter, .y = py / perimeter };
+            else if ( p_geometry->polygon_list.vertex_quantity ) ret = p_verticies[0];
+
+            // Done
             break;
+        }
+
+        case GEOMETRY_INVALID:
+        default:
+
+            // Error
+            goto invalid_geometry_type;
     }
 
+    // Store the return value
+    *p_result = (geometry) { .type = GEOMETRY_POINT, .point = ret };
+
     // Success
     return 1;
 
@@ -247,36 +520,36 @@ int geometry_distance ( geometry *p_a, geometry *p_b, double *p_result )
 
         // Argument errors
         {
-            no_a:
+            no_geometry:
                 #ifndef NDEBUG
-                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
 
-            no_b:
+            no_result:
                 #ifndef NDEBUG
-                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
+        }
 
-            no_result:
+        // Geometry errors
+        {
+            failed_to_measure_polygon:
                 #ifndef NDEBUG
-                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Failed to measure polygon in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-        }
 
-        // Geometry errors
-        {
-            failed_to_compute_distance_from_point:
+            invalid_geometry_type:
                 #ifndef NDEBUG
-                    log_error("[geometry] Failed to compute distance to from point in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Parameter \"p_geometry\" is of invalid type in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -285,7 +558,7 @@ int geometry_distance ( geometry *p_a, geometry *p_b, double *p_result )
     }
 }
 
-int geometry_point_distance ( geometry *p_a, geometry *p_b, double *p_result )
+int geometry_point_point_distance ( geometry_point *p_a, geometry_point *p_b, double *p_result )
 {
 
     // Argument check
@@ -293,73 +566,11 @@ int geometry_point_distance ( geometry *p_a, geometry *p_b, double *p_result )
     if ( p_b      == (void *) 0 ) goto no_b;
     if ( p_result == (void *) 0 ) goto no_result;
 
-    // Initialized data
-    double ret = 0.0;
-    geometry_point a = p_a->point;
-
-    // Strategy
-    switch (p_b->type)
-    {
-        case GEOMETRY_POINT:
-        {
-            
-            // Initialized data
-            geometry_point b = p_b->point;
-
-            // Compute the distance from point a to point b
-            ret = sqrt(
-                pow((a.x - b.x), 2) + pow((a.y - b.y), 2)
-            );
-        }
-        
-        case GEOMETRY_LINE:
-        {
-            // Initialized data
-            geometry_line b = p_b->line;
-            double c  = a.x - b.x0,
-                   d  = a.y - b.y0,
-                   e  = b.x1 - b.x0,
-                   f  = b.y1 - b.y0,
-                   xx = 0,
-                   yy = 0,
-                   dx = 0,
-                   dy = 0;
-            double dot_product = c * e + d * f,
-                   len_squared = e * e + f * f,
-                   p = ( len_squared != 0 ) ? dot_product / len_squared : -1;
-
-            // Line length is 0
-            if ( p < 0 )
-                xx = b.x0,
-                yy = b.y0;
-            
-            // Line length is greater than 1
-            else if ( p > 1 )
-                xx = b.x1,
-                yy = b.y1;
-
-            // Line length is (0, 1)
-            else
-                xx = b.x0 + p * e,
-                yy = b.y0 + p * f;
-
-            // Store deltas
-            dx = a.x - xx,
-            dy = a.y - yy;
-
-            // Compute the distance from point a to line b
-            ret = sqrt(dx * dx + dy * dy);
-        }
-
-        default:
-            
-            // TODO: Error!
-            break;
-    }
+    // Return the distance to the caller
+    *p_result = sqrt(
+        (p_a->x - p_b->x) * (p_a->x - p_b->x) + (p_a->y - p_b->y) * (p_a->y - p_b->y)
+    );
 
-    // Return a value to the caller
-    *p_result = ret;
-    
     // Success
     return 1;
 
@@ -395,49 +606,31 @@ int geometry_point_distance ( geometry *p_a, geometry *p_b, double *p_result )
     }
 }
 
-bool geometry_point_in_polygon ( geometry *p_geometry )
+int geometry_point_point_list_distance ( geometry_point *p_point, geometry_point_list *p_point_list, double *p_result )
 {
 
-    // TODO
-
     // Argument check
-    //
+    if ( p_point      == (void *) 0 ) goto no_point;
+    if ( p_point_list == (void *) 0 ) goto no_point_list;
+    if ( p_result     == (void *) 0 ) goto no_result;
 
     // Initialized data
-    bool ret = false;
-    
-    /*
-        for (i = 0; i < P.size()-1; ++i)
+    double best = INFINITY;
 
-        if ccw(p, P[i], P[i+1])
-
-            sum += angle(P[i], p, P[i+1])
-
-        else sum -= angle(P[i], p, P[i+1])
-
-        return fabs(sum) > PI ? 1 : -1; // 1/-1 = in/out   
-    */
-
-   // Success
-   return ret;
-}
+    // Find the nearest point
+    for (size_t i = 0; i < p_point_list->quantity; i++)
+    {
 
-int geometry_point_construct ( geometry *p_geometry, double x, double y )
-{
+        // Initialized data
+        double dx = p_point->x - p_point_list->p_points[i].x,
+               dy = p_point->y - p_point_list->p_points[i].y;
 
-    // Argument check
-    if ( p_geometry == (void *) 0 ) goto no_geometry;
+        // Keep the nearest
+        if ( dx * dx + dy * dy < best ) best = dx * dx + dy * dy;
+    }
 
-    // Store the point
-    *p_geometry = (geometry)
-    {
-        .type = GEOMETRY_POINT,
-        .point = 
-        {
-            .x = x,
-            .y = y
-        }
-    };
+    // Return the distance to the caller
+    *p_result = sqrt(best);
 
     // Success
     return 1;
@@ -447,9 +640,25 @@ int geometry_point_construct ( geometry *p_geometry, double x, double y )
 
         // Argument errors
         {
-            no_geometry:
+            no_point:
                 #ifndef NDEBUG
-                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_point_list:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -458,114 +667,934 @@ int geometry_point_construct ( geometry *p_geometry, double x, double y )
     }
 }
 
-int geometry_point_load_as_json ( geometry *p_geometry, json_value *p_value )
+int geometry_point_line_distance ( geometry_point *p_point, geometry_line *p_line, double *p_result )
 {
 
     // Argument check
-    if ( p_geometry == (void *) 0 ) goto no_geometry;
-    if ( p_value    == (void *) 0 ) goto no_value;
+    if ( p_point  == (void *) 0 ) goto no_point;
+    if ( p_line   == (void *) 0 ) goto no_line;
+    if ( p_result == (void *) 0 ) goto no_result;
 
-    // Initialized data
-    double x = 0.0,
-           y = 0.0;
-    json_value *p_x = 0,
-               *p_y = 0;
-    
-    // Strategy
-    switch (p_value->type)
-    {
-        case JSON_VALUE_ARRAY:
-        {
+    // Return the distance to the caller
+    *p_result = sqrt(geometry_line_distance_squared(p_point, p_line));
 
-            // Initialized data
-            array *p_array = p_value->list;
-                
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_line:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_line\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_line_list_distance ( geometry_point *p_point, geometry_line_list *p_line_list, double *p_result )
+{
+
+    // Argument check
+    if ( p_point     == (void *) 0 ) goto no_point;
+    if ( p_line_list == (void *) 0 ) goto no_line_list;
+    if ( p_result    == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    double best = INFINITY;
+
+    // Find the nearest line
+    for (size_t i = 0; i < p_line_list->quantity; i++)
+    {
+
+        // Initialized data
+        double d = geometry_line_distance_squared(p_point, &p_line_list->p_lines[i]);
+
+        // Keep the nearest
+        if ( d < best ) best = d;
+    }
+
+    // Return the distance to the caller
+    *p_result = sqrt(best);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_line_list:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_line_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_triangle_distance ( geometry_point *p_point, geometry_triangle *p_triangle, double *p_result )
+{
+
+    // Argument check
+    if ( p_point    == (void *) 0 ) goto no_point;
+    if ( p_triangle == (void *) 0 ) goto no_triangle;
+    if ( p_result   == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    bool   inside = false;
+    double best   = geometry_ring_distance_squared(p_point, &p_triangle->a, 3, &inside);
+
+    // Return the distance to the caller
+    *p_result = ( inside ) ? 0.0 : sqrt(best);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_triangle:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_triangle\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_polygon_distance ( geometry_point *p_point, geometry_polygon *p_polygon, double *p_result )
+{
+
+    // Argument check
+    if ( p_point   == (void *) 0 ) goto no_point;
+    if ( p_polygon == (void *) 0 ) goto no_polygon;
+    if ( p_result  == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    bool   inside = false;
+    double best   = geometry_ring_distance_squared(p_point, p_polygon->p_verticies, p_polygon->quantity, &inside);
+
+    // Return the distance to the caller
+    *p_result = ( inside ) ? 0.0 : sqrt(best);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_polygon_list_distance ( geometry_point *p_point, geometry_polygon_list *p_polygon_list, double *p_result )
+{
+
+    // Argument check
+    if ( p_point        == (void *) 0 ) goto no_point;
+    if ( p_polygon_list == (void *) 0 ) goto no_polygon_list;
+    if ( p_result       == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    const size_t         *p_offsets   = p_polygon_list->p_offsets;
+    const geometry_point *p_verticies = p_polygon_list->p_verticies;
+    double                best        = INFINITY;
+    bool                  inside      = false;
+
+    // Stream through the packed verticies, one ring at a time
+    for (size_t i = 0; i < p_polygon_list->quantity; i++)
+    {
+
+        // Initialized data
+        bool   in_ring = false;
+        double d       = geometry_ring_distance_squared(p_point, &p_verticies[p_offsets[i]], p_offsets[i + 1] - p_offsets[i], &in_ring);
+
+        // A point inside of an odd quantity of rings is inside of the
+        // polygon list. A point inside of a hole is not.
+        if ( in_ring ) inside = !inside;
+
+        // Keep the nearest edge
+        if ( d < best ) best = d;
+    }
+
+    // Return the distance to the caller
+    *p_result = ( inside ) ? 0.0 : sqrt(best);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygon_list:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_in_polygon ( geometry_point *p_point, geometry_polygon *p_polygon, bool *p_result )
+{
+
+    // Argument check
+    if ( p_point   == (void *) 0 ) goto no_point;
+    if ( p_polygon == (void *) 0 ) goto no_polygon;
+    if ( p_result  == (void *) 0 ) goto no_result;
+
+    // Return the result to the caller
+    *p_result = ( p_polygon->quantity ) ? geometry_ring_contains(p_point, p_polygon->p_verticies, p_polygon->quantity) : false;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_construct ( geometry *p_geometry, double x, double y )
+{
+
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+
+    // Store the point
+    *p_geometry = (geometry)
+    {
+        .type = GEOMETRY_POINT,
+        .point = 
+        {
+            .x = x,
+            .y = y
+        }
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_load_as_json ( geometry *p_geometry, json_value *p_value )
+{
+
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_value    == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    double x = 0.0,
+           y = 0.0;
+    json_value *p_x = 0,
+               *p_y = 0;
+    
+    // Strategy
+    switch (p_value->type)
+    {
+        case JSON_VALUE_ARRAY:
+        {
+
+            // Initialized data
+            array *p_array = p_value->list;
+                
             // Error check
             if ( array_size(p_array) == 0 ) goto empty_container;
 
-            // Get x
-            array_index(p_array, 0, &p_x);
-            
-            // Get y
-            array_index(p_array, 0, &p_y);
+            // Get x
+            array_index(p_array, 0, &p_x);
+            
+            // Get y
+            array_index(p_array, 1, &p_y);
+
+            // Done
+            break;
+        }
+    
+        case JSON_VALUE_OBJECT:
+        {
+
+            // Initialized data
+            dict *p_dict = p_value->object;
+                
+            // Error check
+            if ( dict_keys(p_dict, 0) == 0 ) goto empty_container;
+
+            // Get x
+            p_x = dict_get(p_dict, "x");
+            
+            // Get y
+            p_y = dict_get(p_dict, "y");
+
+            // Done
+            break;
+        }
+        
+        default:
+
+            // Wrong type
+            goto wrong_type;
+    }
+
+    done:
+    
+    // Error check
+    if ( p_x == 0 ) goto missing_x;
+    if ( p_y == 0 ) goto missing_y;
+    
+    // Process x
+    if ( p_x->type == JSON_VALUE_NUMBER )
+
+        // Store x
+        x = p_x->number;
+    
+    else if ( p_x->type == JSON_VALUE_INTEGER )
+
+        // Store x
+        x = p_x->integer;
+        
+    // Default
+    else goto wrong_x_type;
+
+    // Process y
+    if ( p_y->type == JSON_VALUE_NUMBER )
+
+        // Store y
+        y = p_y->number;
+    
+    else if ( p_y->type == JSON_VALUE_INTEGER )
+
+        // Store y
+        y = p_y->integer;
+        
+    // Default
+    else goto wrong_y_type;
+
+    // Store the point
+    *p_geometry = (geometry)
+    {
+        .type = GEOMETRY_POINT,
+        .point = 
+        {
+            .x = x,
+            .y = y
+        }
+    };
+
+    // Success
+    return 1;
+    
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+            
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // JSON errors
+        {
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_value\" must be of type [ array | object ] in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+                
+            missing_x:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_value\" must contain property \"x\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            missing_y:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_value\" must contain property \"y\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_x_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Property \"x\" of parameter \"p_value\" must be of type [ integer | number ] in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_y_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Property \"y\" of parameter \"p_value\" must be of type [ integer | number ] in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+        }
+
+        // Geometry errors
+        {
+            empty_container:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_value\" must have at least one element in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_line_construct ( geometry *p_geometry, double x0, double y0, double x1, double y1 )
+{
+
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
 
-            // Done
-            break;
+    // Store the point
+    *p_geometry = (geometry)
+    {
+        .type = GEOMETRY_LINE,
+        .line = 
+        {
+            .x0 = x0,
+            .y0 = y0,
+            .x1 = x1,
+            .y1 = y1
+        }
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
         }
+    }
+}
+
+int geometry_polygon_load_as_json ( geometry *p_geometry, json_value *p_value )
+{
+
+    // Load the polygon onto the heap
+    return geometry_polygon_load_as_json_arena(p_geometry, p_value, (void *) 0);
+}
+
+int geometry_polygon_load_as_json_arena ( geometry *p_geometry, json_value *p_value, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_value    == (void *) 0 ) goto no_value;
+
+    // Type check
+    if ( p_value->type != JSON_VALUE_ARRAY ) goto wrong_type;
     
-        case JSON_VALUE_OBJECT:
+    // Initialized data
+    array  *p_array =  p_value->list;
+    size_t  vertex_quantity = array_size(p_array);
+    geometry_point *p_verticies = (void *) 0;
+
+    // Error check
+    if ( vertex_quantity < 3 ) goto not_a_polygon;
+    
+    // Allocate memory for verticies
+    p_verticies = geometry_allocate(p_arena, sizeof(geometry_point) * vertex_quantity);
+
+    // Error check
+    if ( p_verticies == (void *) 0 ) goto no_mem;
+
+    // Iterate through the array
+    for (size_t i = 0; i < vertex_quantity; i++)
+    {
+        
+        // Initialized data
+        json_value *i_value   = 0;
+        geometry    _geometry = { 0 };
+
+        // Store the json value at index i
+        if ( array_index(p_array, i, &i_value) == 0 ) goto failed_to_index_array;
+
+        // Construct a geometry from the json value
+        if ( geometry_point_load_as_json(&_geometry, i_value) == 0 ) goto failed_to_load_point;
+
+        // Store the point 
+        p_verticies[i] = _geometry.point;
+    }
+    
+    // Store the polygon
+    *p_geometry = (geometry)
+    {
+        .type    = GEOMETRY_POLYGON,
+        .polygon = 
+        {
+            .quantity    = vertex_quantity,
+            .p_verticies = p_verticies
+        }
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+            
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Array errors
+        {
+            failed_to_index_array:
+                #ifndef NDEBUG
+                    log_error("[geometry] Call to function \"array_index\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the verticies
+                if ( p_arena == (void *) 0 ) p_verticies = GEOMETRY_REALLOC(p_verticies, 0);
+
+                // Error
+                return 0;
+        }
+
+        // JSON errors
+        {
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_value\" must be of type [ array ] in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            empty_container:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_value\" must have at least one element in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+                
+            failed_to_load_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to construct point in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the verticies
+                if ( p_arena == (void *) 0 ) p_verticies = GEOMETRY_REALLOC(p_verticies, 0);
+
+                // Error
+                return 0;
+            
+            not_a_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Polygon must have at least 3 points in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {          
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;    
+        }
+    }
+}
+
+int geometry_polygon_list_construct ( geometry *p_geometry, geometry_polygon *p_polygons, size_t quantity, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_polygons == (void *) 0 && quantity ) goto no_polygons;
+
+    // Initialized data
+    size_t          vertex_quantity = 0;
+    size_t         *p_offsets       = (void *) 0;
+    geometry_point *p_verticies     = (void *) 0;
+
+    // Count the verticies
+    for (size_t i = 0; i < quantity; i++)
+        vertex_quantity += p_polygons[i].quantity;
+
+    // Allocate the offsets and the verticies in one block
+    p_offsets = geometry_allocate(p_arena, sizeof(size_t) * ( quantity + 1 ) + sizeof(geometry_point) * vertex_quantity);
+
+    // Error check
+    if ( p_offsets == (void *) 0 ) goto no_mem;
+
+    // The verticies follow the offsets
+    p_verticies = (geometry_point *) &p_offsets[quantity + 1];
+
+    // Pack each polygon
+    p_offsets[0] = 0;
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Copy the verticies
+        memcpy(&p_verticies[p_offsets[i]], p_polygons[i].p_verticies, sizeof(geometry_point) * p_polygons[i].quantity);
+
+        // Store the end of the ring
+        p_offsets[i + 1] = p_offsets[i] + p_polygons[i].quantity;
+    }
+
+    // Store the polygon list
+    *p_geometry = (geometry)
+    {
+        .type         = GEOMETRY_POLYGON_LIST,
+        .polygon_list =
+        {
+            .quantity        = quantity,
+            .vertex_quantity = vertex_quantity,
+            .p_offsets       = p_offsets,
+            .p_verticies     = p_verticies
+        }
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygons:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygons\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
         {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_polygon_list_load_as_json ( geometry *p_geometry, json_value *p_value )
+{
+
+    // Load the polygon list onto the heap
+    return geometry_polygon_list_load_as_json_arena(p_geometry, p_value, (void *) 0);
+}
+
+int geometry_polygon_list_load_as_json_arena ( geometry *p_geometry, json_value *p_value, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_value    == (void *) 0 ) goto no_value;
+
+    // Type check
+    if ( p_value->type != JSON_VALUE_ARRAY ) goto wrong_type;
 
-            // Initialized data
-            dict *p_dict = p_value->object;
-                
-            // Error check
-            if ( dict_keys(p_dict, 0) == 0 ) goto empty_container;
+    // Initialized data
+    array          *p_array         = p_value->list;
+    size_t          quantity        = array_size(p_array),
+                    vertex_quantity = 0;
+    size_t         *p_offsets       = (void *) 0;
+    geometry_point *p_verticies     = (void *) 0;
+
+    // Count the verticies, so they can be packed into one buffer
+    for (size_t i = 0; i < quantity; i++)
+    {
 
-            // Get x
-            p_x = dict_get(p_dict, "x");
-            
-            // Get y
-            p_y = dict_get(p_dict, "y");
+        // Initialized data
+        json_value *i_value = 0;
 
-            // Done
-            break;
-        }
-        
-        default:
+        // Store the json value at index i
+        if ( array_index(p_array, i, &i_value) == 0 ) goto failed_to_index_array;
 
-            // Wrong type
-            goto wrong_type;
+        // Type check
+        if ( i_value->type != JSON_VALUE_ARRAY ) goto wrong_polygon_type;
+
+        // Error check
+        if ( array_size(i_value->list) < 3 ) goto not_a_polygon;
+
+        // Accumulate
+        vertex_quantity += array_size(i_value->list);
     }
 
-    done:
-    
+    // Allocate the offsets and the verticies in one block
+    p_offsets = geometry_allocate(p_arena, sizeof(size_t) * ( quantity + 1 ) + sizeof(geometry_point) * vertex_quantity);
+
     // Error check
-    if ( p_x == 0 ) goto missing_x;
-    if ( p_y == 0 ) goto missing_y;
-    
-    // Process x
-    if ( p_x->type == JSON_VALUE_NUMBER )
+    if ( p_offsets == (void *) 0 ) goto no_mem;
 
-        // Store x
-        x = p_x->number;
-    
-    else if ( p_x->type == JSON_VALUE_INTEGER )
+    // The verticies follow the offsets
+    p_verticies = (geometry_point *) &p_offsets[quantity + 1];
 
-        // Store x
-        x = p_x->integer;
-        
-    // Default
-    else goto wrong_x_type;
+    // Load each polygon
+    p_offsets[0] = 0;
+    for (size_t i = 0; i < quantity; i++)
+    {
 
-    // Process y
-    if ( p_y->type == JSON_VALUE_NUMBER )
+        // Initialized data
+        json_value *i_value  = 0;
+        size_t      i_length = 0;
 
-        // Store y
-        y = p_y->number;
-    
-    else if ( p_y->type == JSON_VALUE_INTEGER )
+        // Store the json value at index i
+        if ( array_index(p_array, i, &i_value) == 0 ) goto failed_to_index_array;
 
-        // Store y
-        y = p_y->integer;
-        
-    // Default
-    else goto wrong_y_type;
+        // Store the quantity of verticies
+        i_length = array_size(i_value->list);
 
-    // Store the point
+        // Load each vertex
+        for (size_t j = 0; j < i_length; j++)
+        {
+
+            // Initialized data
+            json_value *j_value   = 0;
+            geometry    _geometry = { 0 };
+
+            // Store the json value at index j
+            if ( array_index(i_value->list, j, &j_value) == 0 ) goto failed_to_index_array;
+
+            // Construct a geometry from the json value
+            if ( geometry_point_load_as_json(&_geometry, j_value) == 0 ) goto failed_to_load_point;
+
+            // Store the point
+            p_verticies[p_offsets[i] + j] = _geometry.point;
+        }
+
+        // Store the end of the ring
+        p_offsets[i + 1] = p_offsets[i] + i_length;
+    }
+
+    // Store the polygon list
     *p_geometry = (geometry)
     {
-        .type = GEOMETRY_POINT,
-        .point = 
+        .type         = GEOMETRY_POLYGON_LIST,
+        .polygon_list =
         {
-            .x = x,
-            .y = y
+            .quantity        = quantity,
+            .vertex_quantity = vertex_quantity,
+            .p_offsets       = p_offsets,
+            .p_verticies     = p_verticies
         }
     };
 
     // Success
     return 1;
-    
+
     // Error handling
     {
 
@@ -578,7 +1607,7 @@ int geometry_point_load_as_json ( geometry *p_geometry, json_value *p_value )
 
                 // Error
                 return 0;
-            
+
             no_value:
                 #ifndef NDEBUG
                     log_error("[geometry] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
@@ -588,55 +1617,66 @@ int geometry_point_load_as_json ( geometry *p_geometry, json_value *p_value )
                 return 0;
         }
 
-        // JSON errors
+        // Array errors
         {
-            wrong_type:
+            failed_to_index_array:
                 #ifndef NDEBUG
-                    log_error("[geometry] Parameter \"p_value\" must be of type [ array | object ] in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Call to function \"array_index\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Release the polygon list
+                if ( p_arena == (void *) 0 ) p_offsets = GEOMETRY_REALLOC(p_offsets, 0);
+
                 // Error
                 return 0;
-                
-            missing_x:
+        }
+
+        // JSON errors
+        {
+            wrong_type:
                 #ifndef NDEBUG
-                    log_error("[geometry] Parameter \"p_value\" must contain property \"x\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Parameter \"p_value\" must be of type [ array ] in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
 
-            missing_y:
+            wrong_polygon_type:
                 #ifndef NDEBUG
-                    log_error("[geometry] Parameter \"p_value\" must contain property \"y\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Each element of parameter \"p_value\" must be of type [ array ] in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
+        }
 
-            wrong_x_type:
+        // Geometry errors
+        {
+            failed_to_load_point:
                 #ifndef NDEBUG
-                    log_error("[geometry] Property \"x\" of parameter \"p_value\" must be of type [ integer | number ] in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Failed to construct point in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Release the polygon list
+                if ( p_arena == (void *) 0 ) p_offsets = GEOMETRY_REALLOC(p_offsets, 0);
+
                 // Error
                 return 0;
 
-            wrong_y_type:
+            not_a_polygon:
                 #ifndef NDEBUG
-                    log_error("[geometry] Property \"y\" of parameter \"p_value\" must be of type [ integer | number ] in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Polygon must have at least 3 points in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-
         }
 
-        // Geometry errors
+        // Standard library errors
         {
-            empty_container:
+            no_mem:
                 #ifndef NDEBUG
-                    log_error("[geometry] Parameter \"p_value\" must have at least one element in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -645,24 +1685,71 @@ int geometry_point_load_as_json ( geometry *p_geometry, json_value *p_value )
     }
 }
 
-int geometry_line_construct ( geometry *p_geometry, double x0, double y0, double x1, double y1 )
+int geometry_polygon_list_polygon ( geometry_polygon_list *p_polygon_list, size_t index, geometry_polygon *p_polygon )
 {
 
     // Argument check
-    if ( p_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_polygon_list ==                (void *) 0 ) goto no_polygon_list;
+    if ( p_polygon      ==                (void *) 0 ) goto no_polygon;
+    if ( index          >= p_polygon_list->quantity ) goto out_of_bounds;
 
-    // Store the point
-    *p_geometry = (geometry)
+    // Store a view of the polygon
+    *p_polygon = (geometry_polygon)
     {
-        .type = GEOMETRY_LINE,
-        .line = 
+        .quantity    = p_polygon_list->p_offsets[index + 1] - p_polygon_list->p_offsets[index],
+        .p_verticies = &p_polygon_list->p_verticies[p_polygon_list->p_offsets[index]]
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
         {
-            .x0 = x0,
-            .y0 = y0,
-            .x1 = x1,
-            .y1 = y1
+            no_polygon_list:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            out_of_bounds:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"index\" is out of bounds in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
         }
-    };
+    }
+}
+
+int geometry_polygon_area ( geometry_polygon *p_polygon, double *p_result )
+{
+
+    // Argument check
+    if ( p_polygon == (void *) 0 ) goto no_polygon;
+    if ( p_result  == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    geometry_measure _measure = { 0 };
+
+    // Measure the polygon
+    if ( geometry_polygon_measure(p_polygon, &_measure) == 0 ) goto failed_to_measure_polygon;
+
+    // Return the absolute value of the signed area to the caller
+    *p_result = fabs(_measure.area);
 
     // Success
     return 1;
@@ -672,9 +1759,27 @@ int geometry_line_construct ( geometry *p_geometry, double x0, double y0, double
 
         // Argument errors
         {
-            no_geometry:
+            no_polygon:
                 #ifndef NDEBUG
-                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_measure_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to measure polygon in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
@@ -683,58 +1788,122 @@ int geometry_line_construct ( geometry *p_geometry, double x0, double y0, double
     }
 }
 
-int geometry_polygon_load_as_json ( geometry *p_geometry, json_value *p_value )
+int geometry_envelope_compute ( geometry *p_geometry, geometry_envelope *p_envelope )
 {
 
     // Argument check
     if ( p_geometry == (void *) 0 ) goto no_geometry;
-    if ( p_value    == (void *) 0 ) goto no_value;
+    if ( p_envelope == (void *) 0 ) goto no_envelope;
 
-    // Type check
-    if ( p_value->type != JSON_VALUE_ARRAY ) goto wrong_type;
-    
     // Initialized data
-    array  *p_array =  p_value->list;
-    size_t  vertex_quantity = array_size(p_array);
-    geometry_point *p_verticies = (void *) 0;
+    const geometry_point *p_points = (void *) 0;
+    size_t                quantity = 0;
+    geometry_envelope     _result  = { INFINITY, INFINITY, -INFINITY, -INFINITY };
 
-    // Error check
-    if ( vertex_quantity < 3 ) goto not_a_polygon;
-    
-    // Allocate memory for verticies
-    p_verticies = GEOMETRY_REALLOC(0, sizeof(geometry_point) * vertex_quantity);
+    // Strategy
+    switch ( p_geometry->type )
+    {
+        case GEOMETRY_POINT:
+            p_points = &p_geometry->point, quantity = 1;
+            break;
+
+        case GEOMETRY_POINT_LIST:
+            p_points = p_geometry->point_list.p_points, quantity = p_geometry->point_list.quantity;
+            break;
+
+        // Lines are pairs of points
+        case GEOMETRY_LINE:
+            p_points = (const geometry_point *) &p_geometry->line, quantity = 2;
+            break;
+
+        case GEOMETRY_LINE_LIST:
+            p_points = (const geometry_point *) p_geometry->line_list.p_lines, quantity = p_geometry->line_list.quantity * 2;
+            break;
+
+        case GEOMETRY_TRIANGLE:
+            p_points = &p_geometry->triangle.a, quantity = 3;
+            break;
+
+        case GEOMETRY_POLYGON:
+            p_points = p_geometry->polygon.p_verticies, quantity = p_geometry->polygon.quantity;
+            break;
+
+        case GEOMETRY_POLYGON_LIST:
+            p_points = p_geometry->polygon_list.p_verticies, quantity = p_geometry->polygon_list.vertex_quantity;
+            break;
+
+        default:
+            goto unsupported_type;
+    }
+
+    // Grow the envelope around each point
+    for (size_t i = 0; i < quantity; i++)
+        _result.x_min = fmin(_result.x_min, p_points[i].x),
+        _result.y_min = fmin(_result.y_min, p_points[i].y),
+        _result.x_max = fmax(_result.x_max, p_points[i].x),
+        _result.y_max = fmax(_result.y_max, p_points[i].y);
+
+    // Return the result to the caller
+    *p_envelope = _result;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_envelope:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_envelope\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            unsupported_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Geometry of type %d has no envelope in call to function \"%s\"\n", p_geometry->type, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
 
-    // Error check
-    if ( p_verticies == (void *) 0 ) goto no_mem;
+int geometry_envelope_get ( geometry *p_geometry, geometry_envelope *p_envelope )
+{
 
-    // Iterate through the array
-    for (size_t i = 0; i < vertex_quantity; i++)
-    {
-        
-        // Initialized data
-        json_value *i_value   = 0;
-        geometry    _geometry = { 0 };
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_envelope == (void *) 0 ) goto no_envelope;
 
-        // Store the json value at index i
-        if ( array_index(p_array, i, &i_value) == 0 ) goto failed_to_index_array;
+    // Compute the envelope
+    if ( p_geometry->envelope_valid == false )
+    {
 
-        // Construct a geometry from the json value
-        if ( geometry_point_load_as_json(&_geometry, i_value) == 0 ) goto failed_to_load_point;
+        // Compute
+        if ( geometry_envelope_compute(p_geometry, &p_geometry->envelope) == 0 ) goto failed_to_compute_envelope;
 
-        // Store the point 
-        p_verticies[i] = _geometry.point;
+        // Cache
+        p_geometry->envelope_valid = true;
     }
-    
-    // Store the polygon
-    *p_geometry = (geometry)
-    {
-        .type    = GEOMETRY_POLYGON,
-        .polygon = 
-        {
-            .quantity    = vertex_quantity,
-            .p_verticies = p_verticies
-        }
-    };
+
+    // Return the envelope to the caller
+    *p_envelope = p_geometry->envelope;
 
     // Success
     return 1;
@@ -751,114 +1920,162 @@ int geometry_polygon_load_as_json ( geometry *p_geometry, json_value *p_value )
 
                 // Error
                 return 0;
-            
-            no_value:
+
+            no_envelope:
                 #ifndef NDEBUG
-                    log_error("[geometry] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Null pointer provided for parameter \"p_envelope\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
         }
 
-        // Array errors
+        // Geometry errors
         {
-            failed_to_index_array:
+            failed_to_compute_envelope:
                 #ifndef NDEBUG
-                    log_error("[geometry] Call to function \"array_index\" returned an erroneous value in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Failed to compute envelope in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
         }
+    }
+}
 
-        // JSON errors
+int geometry_envelope_invalidate ( geometry *p_geometry )
+{
+
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+
+    // Discard the cached envelope
+    p_geometry->envelope_valid = false;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
         {
-            wrong_type:
+            no_geometry:
                 #ifndef NDEBUG
-                    log_error("[geometry] Parameter \"p_value\" must be of type [ array ] in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
         }
+    }
+}
 
-        // Geometry errors
+int geometry_envelope_intersects ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Argument check
+    if ( p_a      == (void *) 0 ) goto no_a;
+    if ( p_b      == (void *) 0 ) goto no_b;
+    if ( p_result == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    geometry_envelope a = { 0 },
+                      b = { 0 };
+
+    // Get the envelopes
+    if ( geometry_envelope_get(p_a, &a) == 0 ) goto failed_to_get_envelope;
+    if ( geometry_envelope_get(p_b, &b) == 0 ) goto failed_to_get_envelope;
+
+    // Return the result to the caller
+    *p_result = a.x_min <= b.x_max && b.x_min <= a.x_max &&
+                a.y_min <= b.y_max && b.y_min <= a.y_max;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
         {
-            empty_container:
+            no_a:
                 #ifndef NDEBUG
-                    log_error("[geometry] Parameter \"p_value\" must have at least one element in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-                
-            failed_to_load_point:
+
+            no_b:
                 #ifndef NDEBUG
-                    log_error("[geometry] Failed to construct point in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
-            
-            not_a_polygon:
+
+            no_result:
                 #ifndef NDEBUG
-                    log_error("[geometry] Polygon must have at least 3 points in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
         }
 
-        // Standard library errors
-        {          
-            no_mem:
+        // Geometry errors
+        {
+            failed_to_get_envelope:
                 #ifndef NDEBUG
-                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Failed to get envelope in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
-                return 0;    
+                return 0;
         }
     }
 }
 
-int geometry_polygon_area ( geometry_polygon *p_polygon, double *p_result )
+int geometry_distance_within ( geometry *p_a, geometry *p_b, double distance, bool *p_result )
 {
 
     // Argument check
-    if ( p_polygon == (void *) 0 ) goto no_polygon;
-    if ( p_result  == (void *) 0 ) goto no_result;
+    if ( p_a      == (void *) 0 ) goto no_a;
+    if ( p_b      == (void *) 0 ) goto no_b;
+    if ( p_result == (void *) 0 ) goto no_result;
 
     // Initialized data
-    double result = 0.0,
-           red    = 0.0,
-           blue   = 0.0;
-    geometry_point _first_point = p_polygon->p_verticies[0],
-                   _last_point  = p_polygon->p_verticies[p_polygon->quantity - 1];
-
-    // Iterate over each point in the polygon
-    for ( size_t i = 0; i < p_polygon->quantity - 1; i++ )
+    geometry_envelope a     = { 0 },
+                      b     = { 0 };
+    double            dx    = 0,
+                      dy    = 0,
+                      exact = 0;
+
+    // Get the envelopes
+    if ( geometry_envelope_get(p_a, &a) == 0 ) goto failed_to_get_envelope;
+    if ( geometry_envelope_get(p_b, &b) == 0 ) goto failed_to_get_envelope;
+
+    // Compute the gap between the envelopes
+    dx = fmax(0, fmax(a.x_min - b.x_max, b.x_min - a.x_max)),
+    dy = fmax(0, fmax(a.y_min - b.y_max, b.y_min - a.y_max));
+
+    // The envelopes are too far apart, or one of them is empty
+    if ( !( dx * dx + dy * dy <= distance * distance ) )
     {
 
-        // Initialized data
-        geometry_point _current_point = p_polygon->p_verticies[i],
-                       _next_point    = p_polygon->p_verticies[i + 1];
+        // Return the result to the caller
+        *p_result = false;
 
-        // Accumulate
-        blue += _current_point.x * _next_point.y;
-        red  += _current_point.y * _next_point.x;
+        // Success
+        return 1;
     }
 
-    // Final accumulate
-    blue += _first_point.y * _last_point.x;
-    red  += _first_point.x * _last_point.y;
+    // Compute the exact distance
+    if ( geometry_distance(p_a, p_b, &exact) == 0 ) goto failed_to_compute_distance;
 
-    // Store the absolute value of the result
-    result = fabs(blue - red);
-    
     // Return the result to the caller
-    *p_result = result;
+    *p_result = ( exact <= distance );
 
     // Success
     return 1;
@@ -868,13 +2085,22 @@ int geometry_polygon_area ( geometry_polygon *p_polygon, double *p_result )
 
         // Argument errors
         {
-            no_polygon:
+            no_a:
                 #ifndef NDEBUG
-                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // Error
                 return 0;
+
             no_result:
                 #ifndef NDEBUG
                     log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
@@ -883,10 +2109,29 @@ int geometry_polygon_area ( geometry_polygon *p_polygon, double *p_result )
                 // Error
                 return 0;
         }
+
+        // Geometry errors
+        {
+            failed_to_get_envelope:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to get envelope in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_compute_distance:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to compute distance in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
     }
 }
 
-int geometry_ccw ( geometry_point *p_a, geometry_point *p_b, geometry_point *p_c )
+int geometry_point_ccw ( geometry_point *p_a, geometry_point *p_b, geometry_point *p_c )
 {
 
     // Argument check
@@ -894,8 +2139,11 @@ int geometry_ccw ( geometry_point *p_a, geometry_point *p_b, geometry_point *p_c
     if ( p_b == (void *) 0 ) goto no_b;
     if ( p_c == (void *) 0 ) goto no_c;
 
+    // Initialized data
+    double d = geometry_orient2d(p_a, p_b, p_c);
+
     // Success
-    return (p_b->x - p_a->x) * (p_c->y - p_a->y) - (p_c->x - p_a->x) * (p_b->y - p_a->y);
+    return ( d > 0 ) - ( d < 0 );
     
     // Error handling
     {
@@ -929,9 +2177,222 @@ int geometry_ccw ( geometry_point *p_a, geometry_point *p_b, geometry_point *p_c
     }
 }
 
+int geometry_destroy ( geometry *p_geometry )
+{
+
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+
+    // Strategy
+    switch ( p_geometry->type )
+    {
+        case GEOMETRY_POINT_LIST:
+
+            // Release the points
+            p_geometry->point_list.p_points = GEOMETRY_REALLOC(p_geometry->point_list.p_points, 0);
+
+            // Done
+            break;
+
+        case GEOMETRY_LINE_LIST:
+
+            // Release the lines
+            p_geometry->line_list.p_lines = GEOMETRY_REALLOC(p_geometry->line_list.p_lines, 0);
+
+            // Done
+            break;
+
+        case GEOMETRY_POLYGON:
+
+            // Release the verticies
+            p_geometry->polygon.p_verticies = GEOMETRY_REALLOC(p_geometry->polygon.p_verticies, 0);
+
+            // Done
+            break;
+
+        case GEOMETRY_POLYGON_LIST:
+
+            // Release the offsets. The verticies live in the same block.
+            p_geometry->polygon_list.p_offsets = GEOMETRY_REALLOC(p_geometry->polygon_list.p_offsets, 0);
+
+            // Done
+            break;
+
+        default:
+
+            // Nothing to release
+            break;
+    }
+
+    // Clear the geometry
+    *p_geometry = (geometry) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static bool geometry_ring_contains ( const geometry_point *p_point, const geometry_point *p_verticies, size_t quantity )
+{
+
+    // Initialized data
+    bool   inside = false;
+    double px     = p_point->x,
+           py     = p_point->y;
+
+    // Cast a ray toward +x, and count the edges it crosses
+    for (size_t i = 0, j = quantity - 1; i < quantity; j = i++)
+    {
+
+        // Initialized data
+        geometry_point a = p_verticies[j],
+                       b = p_verticies[i];
+
+        // Does the edge straddle the ray?
+        if ( ( a.y > py ) != ( b.y > py ) )
+        {
+
+            // Initialized data
+            double x = a.x + ( py - a.y ) * ( b.x - a.x ) / ( b.y - a.y );
+
+            // Crossing
+            if ( px < x ) inside = !inside;
+        }
+    }
+
+    // Success
+    return inside;
+}
+
+static bool geometry_polygon_list_ring_is_hole ( const geometry_polygon_list *p_polygon_list, size_t index )
+{
+
+    // Initialized data
+    const size_t         *p_offsets   = p_polygon_list->p_offsets;
+    const geometry_point *p_verticies = p_polygon_list->p_verticies;
+    bool                  hole        = false;
+
+    // An empty ring has no first vertex
+    if ( p_offsets[index + 1] == p_offsets[index] ) return false;
+
+    // Count the rings around the first vertex of this ring
+    for (size_t j = 0; j < p_polygon_list->quantity; j++)
+    {
+
+        // Skip this ring, and rings with no area
+        if ( j == index || p_offsets[j + 1] - p_offsets[j] < 3 ) continue;
+
+        // Count the ring
+        if ( geometry_ring_contains(&p_verticies[p_offsets[index]], &p_verticies[p_offsets[j]], p_offsets[j + 1] - p_offsets[j]) ) hole = !hole;
+    }
+
+    // Success
+    return hole;
+}
+
+static double geometry_ring_distance_squared ( const geometry_point *p_point, const geometry_point *p_verticies, size_t quantity, bool *p_inside )
+{
+
+    // Initialized data
+    bool   inside = false;
+    double best   = INFINITY,
+           px     = p_point->x,
+           py     = p_point->y;
+
+    // Iterate over each edge
+    for (size_t i = 0, j = quantity - 1; i < quantity; j = i++)
+    {
+
+        // Initialized data
+        geometry_point a      = p_verticies[j],
+                       b      = p_verticies[i];
+        double         c      = px - a.x,
+                       d      = py - a.y,
+                       e      = b.x - a.x,
+                       f      = b.y - a.y,
+                       len_sq = e * e + f * f,
+                       t      = ( len_sq != 0 ) ? ( c * e + d * f ) / len_sq : 0.0,
+                       dx     = 0,
+                       dy     = 0;
+
+        // Does the edge straddle the ray toward +x?
+        if ( ( a.y > py ) != ( b.y > py ) && px < a.x + ( py - a.y ) * ( b.x - a.x ) / ( b.y - a.y ) ) inside = !inside;
+
+        // Clamp the projection to the edge
+        t  = ( t < 0 ) ? 0 : ( t > 1 ) ? 1 : t;
+        dx = c - t * e;
+        dy = d - t * f;
+
+        // Keep the nearest
+        if ( dx * dx + dy * dy < best ) best = dx * dx + dy * dy;
+    }
+
+    // Return the side to the caller
+    *p_inside = inside;
+
+    // Success
+    return best;
+}
+
+static double geometry_line_distance_squared ( const geometry_point *p_point, const geometry_line *p_line )
+{
+
+    // Initialized data
+    double c           = p_point->x - p_line->x0,
+           d           = p_point->y - p_line->y0,
+           e           = p_line->x1 - p_line->x0,
+           f           = p_line->y1 - p_line->y0,
+           xx          = 0,
+           yy          = 0,
+           dx          = 0,
+           dy          = 0,
+           dot_product = c * e + d * f,
+           len_squared = e * e + f * f,
+           p           = ( len_squared != 0 ) ? dot_product / len_squared : -1;
+
+    // Line length is 0
+    if ( p < 0 )
+        xx = p_line->x0,
+        yy = p_line->y0;
+
+    // Past the end of the line
+    else if ( p > 1 )
+        xx = p_line->x1,
+        yy = p_line->y1;
+
+    // Along the line
+    else
+        xx = p_line->x0 + p * e,
+        yy = p_line->y0 + p * f;
+
+    // Store deltas
+    dx = p_point->x - xx,
+    dy = p_point->y - yy;
+
+    // Success
+    return dx * dx + dy * dy;
+}
+
 int geometry_quit ( void )
 {
 
+    // Stop the executor
+    if ( geometry_parallel_quit() == 0 ) return 0;
+
     // Success
     return 1;   
 }
@@ -0,0 +1,2120 @@
+/** !
+ * Tests for the geometry library
+ *
+ * @file geometry_test.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+// log
+#include <log/log.h>
+
+// geometry
+#include <geometry/geometry.h>
+#include <geometry/batch.h>
+#include <geometry/arena.h>
+#include <geometry/serialize.h>
+#include <geometry/store.h>
+#include <geometry/stream.h>
+#include <geometry/quantized.h>
+#include <geometry/rtree.h>
+#include <geometry/kdtree.h>
+#include <geometry/prepared.h>
+#include <geometry/sweep.h>
+#include <geometry/hull.h>
+#include <geometry/parallel.h>
+#include <geometry/triangulate.h>
+#include <geometry/boolean.h>
+#include <geometry/simplify.h>
+#include <geometry/predicates.h>
+#include <geometry/measure.h>
+#include <geometry/relate.h>
+#include <geometry/join.h>
+#include <geometry/distance.h>
+#include <geometry/dispatch.h>
+
+// Preprocessor definitions
+#define GEOMETRY_TEST(expression) geometry_test_check((expression), #expression, __LINE__)
+
+// Data
+static size_t tests = 0,
+              fails = 0;
+
+// Forward declarations
+/** !
+ * Record the result of a test, and print a message if it fails
+ *
+ * @param result     the result of the test
+ * @param expression the text of the test
+ * @param line       the line of the test
+ *
+ * @return void
+ */
+void geometry_test_check ( int result, const char *expression, int line );
+
+/** !
+ * Test the batched distance kernels of a structure of arrays point list
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_batch ( void );
+
+/** !
+ * Test bump allocation, reset and statistics of a geometry arena
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_arena ( void );
+
+/** !
+ * Test packing polygons into a polygon list, and viewing each ring
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_polygon_list ( void );
+
+/** !
+ * Test WKB round trips of each geometry type
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_serialize ( void );
+
+/** !
+ * Test writing a store, and reading it back through views
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_store ( void );
+
+/** !
+ * Test loading polygons from json text
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_stream ( void );
+
+/** !
+ * Test loading a GeoJSON FeatureCollection in batches, from text and
+ * from a file
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_feature_collection ( void );
+
+/** !
+ * Test quantizing points and polygons, and the quantized operations
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_quantized ( void );
+
+/** !
+ * Test envelope, intersection and nearest neighbour queries on an R-tree
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_rtree ( void );
+
+/** !
+ * Test nearest neighbour, radius and envelope queries on a k-d tree
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_kdtree ( void );
+
+/** !
+ * Test the cached envelope of a geometry, and the envelope filters
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_envelope ( void );
+
+/** !
+ * Test prepared point in polygon tests against the unprepared test
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_prepared ( void );
+
+/** !
+ * Test the batched point in polygon kernel against the scalar test
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_batch_in_polygon ( void );
+
+/** !
+ * Test finding the intersections of line lists with a sweep
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_sweep ( void );
+
+/** !
+ * Test the convex hull of a point list
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_hull ( void );
+
+/** !
+ * Test that parallel loops visit each index once, and report failures
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_parallel ( void );
+
+/** !
+ * Test triangulating simple polygons of either orientation
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_triangulate ( void );
+
+/** !
+ * Test boolean operations of polygons
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_boolean ( void );
+
+/** !
+ * Test simplifying polygons and line lists
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_simplify ( void );
+
+/** !
+ * Test the signs of the orientation and in circle predicates
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_predicates ( void );
+
+/** !
+ * Test the area, perimeter and centroid of polygons
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_measure ( void );
+
+/** !
+ * Test DE-9IM matrices, and the predicates built on them
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_relate ( void );
+
+/** !
+ * Test spatial joins of polygons and points
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_join ( void );
+
+/** !
+ * Test the distance matrix, pairs within a distance and the closest pair
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_distance_matrix ( void );
+
+/** !
+ * Test the dispatch of binary operations to the kernel of each pair of
+ * types
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_dispatch ( void );
+
+/** !
+ * Test parallel reductions, and loops inside of loops
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_parallel_reduce ( void );
+
+/** !
+ * Test that a store with a corrupt ring offset is refused
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_store_corrupt ( void );
+
+/** !
+ * Test skipping well formed and malformed json values in a feature
+ * collection
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_stream_skip ( void );
+
+/** !
+ * Test the area of quantized polygons, wound either way
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_quantized_winding ( void );
+
+/** !
+ * Test the area and centroid of a polygon list with a hole
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_polygon_list_holes ( void );
+
+/** !
+ * Test the area and centroid of a polygon list of separate rings, wound
+ * opposite ways
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_polygon_list_separate ( void );
+
+/** !
+ * Test that arena allocations too large to address are refused
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_arena_overflow ( void );
+
+/** !
+ * Test the distance from points to a polygon list with a hole
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_polygon_list_distance ( void );
+
+/** !
+ * Test the binary operations before geometry_init, and registering
+ * kernels before it
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_dispatch_lazy ( void );
+
+/** !
+ * Test encoding triangles as WKB, and storing the output of a
+ * triangulation
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_triangle_encoding ( void );
+
+/** !
+ * Test that nearest neighbours of a polygon are ranked by their exact
+ * distance
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_rtree_refine ( void );
+
+/** !
+ * Test that text after the verticies of a json polygon is refused
+ *
+ * @param void
+ *
+ * @return void
+ */
+void geometry_test_stream_trailing ( void );
+
+// Function definitions
+int main ( int argc, const char *argv[] )
+{
+
+    // Unused
+    (void) argc;
+    (void) argv;
+
+    // Run the tests that need the library uninitialized
+    geometry_test_dispatch_lazy();
+
+    // Initialize the geometry library
+    if ( geometry_init() == 0 ) return EXIT_FAILURE;
+
+    // Run each test
+    geometry_test_batch();
+    geometry_test_arena();
+    geometry_test_polygon_list();
+    geometry_test_serialize();
+    geometry_test_store();
+    geometry_test_stream();
+    geometry_test_feature_collection();
+    geometry_test_quantized();
+    geometry_test_rtree();
+    geometry_test_kdtree();
+    geometry_test_envelope();
+    geometry_test_prepared();
+    geometry_test_batch_in_polygon();
+    geometry_test_sweep();
+    geometry_test_hull();
+    geometry_test_parallel();
+    geometry_test_triangulate();
+    geometry_test_boolean();
+    geometry_test_simplify();
+    geometry_test_predicates();
+    geometry_test_measure();
+    geometry_test_relate();
+    geometry_test_join();
+    geometry_test_distance_matrix();
+    geometry_test_dispatch();
+    geometry_test_parallel_reduce();
+    geometry_test_store_corrupt();
+    geometry_test_stream_skip();
+    geometry_test_quantized_winding();
+    geometry_test_polygon_list_holes();
+    geometry_test_polygon_list_separate();
+    geometry_test_arena_overflow();
+    geometry_test_polygon_list_distance();
+    geometry_test_triangle_encoding();
+    geometry_test_rtree_refine();
+    geometry_test_stream_trailing();
+
+    // Print the results
+    printf("[geometry] %zu of %zu tests passed\n", tests - fails, tests);
+
+    // Clean up
+    geometry_quit();
+
+    // Success
+    return ( fails ) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+void geometry_test_check ( int result, const char *expression, int line )
+{
+
+    // Count the test
+    tests++;
+
+    // Success
+    if ( result ) return;
+
+    // Count the failure
+    fails++;
+
+    // Print the failure
+    printf("[geometry] Test \"%s\" on line %d failed\n", expression, line);
+
+    // Done
+    return;
+}
+
+void geometry_test_batch ( void )
+{
+
+    // Initialized data
+    geometry_point          _points[37] = { { 0 } };
+    geometry_point_list     _list       = { 37, _points };
+    geometry_point_list_soa _soa        = { 0 };
+    geometry_point          _query      = { 3, -2 };
+    geometry_line           _line       = { .x0 = -5, .y0 = 0, .x1 = 5, .y1 = 0 };
+    double                  _distances[37];
+    size_t                  nearest     = 0,
+                            expected    = 0;
+    double                  distance    = 0;
+    bool                    exact       = true;
+
+    // A grid of points, so the vector loop and the remainder both run
+    for (size_t i = 0; i < 37; i++)
+        _points[i] = (geometry_point) { .x = (double) ( i % 7 ) * 1.5 - 4, .y = (double) ( i / 7 ) * 2.5 - 6 };
+
+    // Construct
+    GEOMETRY_TEST(geometry_point_list_soa_construct(&_soa, &_list, (void *) 0) == 1);
+    GEOMETRY_TEST(_soa.quantity == 37);
+
+    // The distance to a point
+    GEOMETRY_TEST(geometry_point_list_soa_distances(&_soa, &_query, _distances) == 1);
+    for (size_t i = 0; i < 37; i++)
+    {
+        exact = exact && fabs(_distances[i] - hypot(_points[i].x - _query.x, _points[i].y - _query.y)) < 1e-12;
+        if ( _distances[i] < _distances[expected] ) expected = i;
+    }
+    GEOMETRY_TEST(exact);
+
+    // The nearest point
+    GEOMETRY_TEST(geometry_point_list_soa_nearest(&_soa, &_query, &nearest, &distance) == 1);
+    GEOMETRY_TEST(nearest == expected);
+    GEOMETRY_TEST(fabs(distance - _distances[expected]) < 1e-12);
+
+    // The distance to a line, which spans every point
+    GEOMETRY_TEST(geometry_point_list_soa_line_distances(&_soa, &_line, _distances) == 1);
+    for (size_t i = 0; i < 37; i++) exact = exact && fabs(_distances[i] - fabs(_points[i].y)) < 1e-12;
+    GEOMETRY_TEST(exact);
+
+    // Destroy
+    GEOMETRY_TEST(geometry_point_list_soa_destroy(&_soa) == 1);
+
+    // Done
+    return;
+}
+
+void geometry_test_arena ( void )
+{
+
+    // Initialized data
+    geometry_arena            *p_arena     = (void *) 0;
+    geometry_arena_statistics  _statistics = { 0 };
+    void                      *p_a         = (void *) 0,
+                              *p_b         = (void *) 0,
+                              *p_c         = (void *) 0;
+
+    // Construct
+    GEOMETRY_TEST(geometry_arena_create(&p_arena, 256) == 1);
+
+    // Allocations are aligned, and follow each other
+    GEOMETRY_TEST(geometry_arena_allocate(p_arena, 10, &p_a) == 1);
+    GEOMETRY_TEST(geometry_arena_allocate(p_arena, 10, &p_b) == 1);
+    GEOMETRY_TEST((uintptr_t) p_a % GEOMETRY_ARENA_ALIGNMENT == 0);
+    GEOMETRY_TEST((uintptr_t) p_b % GEOMETRY_ARENA_ALIGNMENT == 0);
+    GEOMETRY_TEST((unsigned char *) p_b == (unsigned char *) p_a + GEOMETRY_ARENA_ALIGNMENT);
+
+    // An allocation larger than a block gets a block of its own
+    GEOMETRY_TEST(geometry_arena_allocate(p_arena, 1000, &p_c) == 1);
+    memset(p_c, 0xff, 1000);
+    GEOMETRY_TEST(geometry_arena_statistics_get(p_arena, &_statistics) == 1);
+    GEOMETRY_TEST(_statistics.allocations == 3 && _statistics.bytes_requested == 1020 && _statistics.blocks == 2);
+
+    // Reset keeps the blocks, and reuses them
+    GEOMETRY_TEST(geometry_arena_reset(p_arena) == 1);
+    GEOMETRY_TEST(geometry_arena_allocate(p_arena, 10, &p_b) == 1);
+    GEOMETRY_TEST(p_b == p_a);
+    GEOMETRY_TEST(geometry_arena_statistics_get(p_arena, &_statistics) == 1);
+    GEOMETRY_TEST(_statistics.allocations == 1 && _statistics.blocks == 2 && _statistics.resets == 1);
+
+    // Without an arena, memory comes from the heap
+    p_c = geometry_allocate((void *) 0, 16);
+    GEOMETRY_TEST(p_c != (void *) 0);
+    p_c = GEOMETRY_REALLOC(p_c, 0);
+
+    // Destroy
+    GEOMETRY_TEST(geometry_arena_destroy(&p_arena) == 1);
+    GEOMETRY_TEST(p_arena == (void *) 0);
+
+    // Done
+    return;
+}
+
+void geometry_test_polygon_list ( void )
+{
+
+    // Initialized data
+    geometry_point   _square[]   = { { 0, 0 }, { 4, 0 }, { 4, 4 }, { 0, 4 } },
+                     _triangle[] = { { 10, 0 }, { 12, 0 }, { 11, 2 } };
+    geometry_polygon _polygons[] = { { 4, _square }, { 3, _triangle } },
+                     _view       = { 0 };
+    geometry         _geometry   = { 0 };
+    geometry_arena  *p_arena     = (void *) 0;
+
+    // Pack the polygons into one vertex buffer
+    GEOMETRY_TEST(geometry_polygon_list_construct(&_geometry, _polygons, 2, (void *) 0) == 1);
+    GEOMETRY_TEST(_geometry.type == GEOMETRY_POLYGON_LIST);
+    GEOMETRY_TEST(_geometry.polygon_list.quantity == 2 && _geometry.polygon_list.vertex_quantity == 7);
+    GEOMETRY_TEST(_geometry.polygon_list.p_offsets[0] == 0 && _geometry.polygon_list.p_offsets[1] == 4 && _geometry.polygon_list.p_offsets[2] == 7);
+
+    // Each polygon is a view into the buffer
+    GEOMETRY_TEST(geometry_polygon_list_polygon(&_geometry.polygon_list, 1, &_view) == 1);
+    GEOMETRY_TEST(_view.quantity == 3 && _view.p_verticies == &_geometry.polygon_list.p_verticies[4]);
+    GEOMETRY_TEST(fabs(_view.p_verticies[2].x - 11) < 1e-9 && fabs(_view.p_verticies[2].y - 2) < 1e-9);
+    GEOMETRY_TEST(geometry_polygon_list_polygon(&_geometry.polygon_list, 2, &_view) == 0);
+
+    // Destroy
+    GEOMETRY_TEST(geometry_destroy(&_geometry) == 1);
+
+    // The same list, in an arena
+    GEOMETRY_TEST(geometry_arena_create(&p_arena, 0) == 1);
+    GEOMETRY_TEST(geometry_polygon_list_construct(&_geometry, _polygons, 2, p_arena) == 1);
+    GEOMETRY_TEST(fabs(_geometry.polygon_list.p_verticies[6].x - 11) < 1e-9);
+    GEOMETRY_TEST(geometry_arena_destroy(&p_arena) == 1);
+
+    // Done
+    return;
+}
+
+static int geometry_test_serialize_round_trip ( geometry *p_geometry, geometry *p_result, size_t *p_size )
+{
+
+    // Initialized data
+    unsigned char *p_buffer = (void *) 0;
+    size_t         size     = 0,
+                   read     = 0;
+    int            result   = 0;
+
+    // Encode the geometry
+    if ( geometry_serialize_size(p_geometry, &size) == 0 ) return 0;
+    p_buffer = GEOMETRY_REALLOC(0, size);
+    if ( p_buffer == (void *) 0 ) return 0;
+    if ( geometry_serialize(p_geometry, p_buffer) == 0 ) goto done;
+
+    // Every encoding starts with the byte order and the type
+    if ( p_buffer[0] != 1 ) goto done;
+
+    // Decode the geometry
+    result = geometry_deserialize(p_result, p_buffer, size, &read, (void *) 0) && read == size;
+
+    // Store the size
+    *p_size = size;
+
+    done:
+
+    // Clean up
+    p_buffer = GEOMETRY_REALLOC(p_buffer, 0);
+
+    // Done
+    return result;
+}
+
+void geometry_test_serialize ( void )
+{
+
+    // Initialized data
+    geometry_point     _square[]  = { { 0, 0 }, { 4, 0 }, { 4, 4 }, { 0, 4 } },
+                       _other[]   = { { 10, 0 }, { 12, 0 }, { 11, 2 } };
+    geometry_polygon   _polygons[] = { { 4, _square }, { 3, _other } };
+    geometry_line      _lines[]   = { { .x0 = 1, .y0 = 2, .x1 = 3, .y1 = 4 }, { .x0 = -1, .y0 = -2, .x1 = -3, .y1 = -4 } };
+    geometry           _point     = { .type = GEOMETRY_POINT    , .point     = { 1.5, -2.5 } },
+                       _line_list = { .type = GEOMETRY_LINE_LIST, .line_list = { 2, _lines } },
+                       _polygon   = { .type = GEOMETRY_POLYGON  , .polygon   = { 4, _square } },
+                       _list      = { 0 },
+                       _result    = { 0 };
+    unsigned char      _truncated[8] = { 1, 1, 0, 0, 0, 0, 0, 0 };
+    size_t             size       = 0,
+                       read       = 0;
+
+    // Point
+    GEOMETRY_TEST(geometry_test_serialize_round_trip(&_point, &_result, &size) == 1);
+    GEOMETRY_TEST(size == 21 && _result.type == GEOMETRY_POINT);
+    GEOMETRY_TEST(fabs(_result.point.x - 1.5) < 1e-12 && fabs(_result.point.y + 2.5) < 1e-12);
+
+    // Line list
+    GEOMETRY_TEST(geometry_test_serialize_round_trip(&_line_list, &_result, &size) == 1);
+    GEOMETRY_TEST(_result.type == GEOMETRY_LINE_LIST && _result.line_list.quantity == 2);
+    GEOMETRY_TEST(memcmp(_result.line_list.p_lines, _lines, sizeof(_lines)) == 0);
+    GEOMETRY_TEST(geometry_destroy(&_result) == 1);
+
+    // Polygon. The ring is closed on encode, and opened on decode.
+    GEOMETRY_TEST(geometry_test_serialize_round_trip(&_polygon, &_result, &size) == 1);
+    GEOMETRY_TEST(size == 9 + 4 + 16 * 5);
+    GEOMETRY_TEST(_result.type == GEOMETRY_POLYGON && _result.polygon.quantity == 4);
+    GEOMETRY_TEST(memcmp(_result.polygon.p_verticies, _square, sizeof(_square)) == 0);
+    GEOMETRY_TEST(geometry_destroy(&_result) == 1);
+
+    // Polygon list
+    GEOMETRY_TEST(geometry_polygon_list_construct(&_list, _polygons, 2, (void *) 0) == 1);
+    GEOMETRY_TEST(geometry_test_serialize_round_trip(&_list, &_result, &size) == 1);
+    GEOMETRY_TEST(_result.type == GEOMETRY_POLYGON_LIST && _result.polygon_list.quantity == 2 && _result.polygon_list.vertex_quantity == 7);
+    GEOMETRY_TEST(_result.polygon_list.p_offsets[1] == 4 && _result.polygon_list.p_offsets[2] == 7);
+    GEOMETRY_TEST(memcmp(_result.polygon_list.p_verticies, _list.polygon_list.p_verticies, 7 * sizeof(geometry_point)) == 0);
+    GEOMETRY_TEST(geometry_destroy(&_result) == 1);
+    GEOMETRY_TEST(geometry_destroy(&_list) == 1);
+
+    // A truncated buffer is an error
+    GEOMETRY_TEST(geometry_deserialize(&_result, _truncated, sizeof(_truncated), &read, (void *) 0) == 0);
+
+    // Done
+    return;
+}
+
+void geometry_test_store ( void )
+{
+
+    // Initialized data
+    const char      *path        = "geometry_test.store";
+    geometry_point   _square[]   = { { 0, 0 }, { 4, 0 }, { 4, 4 }, { 0, 4 } },
+                     _other[]    = { { 10, 0 }, { 12, 0 }, { 11, 2 } };
+    geometry_polygon _polygons[] = { { 4, _square }, { 3, _other } };
+    geometry         _geometries[3] =
+                     {
+                         { .type = GEOMETRY_POINT  , .point   = { 7, 8 } },
+                         { .type = GEOMETRY_POLYGON, .polygon = { 4, _square } },
+                         { 0 }
+                     },
+                     _view       = { 0 };
+    geometry_store  *p_store     = (void *) 0;
+
+    // Write the store
+    GEOMETRY_TEST(geometry_polygon_list_construct(&_geometries[2], _polygons, 2, (void *) 0) == 1);
+    GEOMETRY_TEST(geometry_store_write(path, _geometries, 3) == 1);
+
+    // Map the store
+    GEOMETRY_TEST(geometry_store_open(&p_store, path) == 1);
+    GEOMETRY_TEST(p_store != (void *) 0 && p_store->quantity == 3);
+
+    // Each view matches what was written
+    GEOMETRY_TEST(geometry_store_get(p_store, 0, &_view) == 1);
+    GEOMETRY_TEST(_view.type == GEOMETRY_POINT && fabs(_view.point.x - 7) < 1e-12 && fabs(_view.point.y - 8) < 1e-12);
+    GEOMETRY_TEST(geometry_store_get(p_store, 1, &_view) == 1);
+    GEOMETRY_TEST(_view.type == GEOMETRY_POLYGON && _view.polygon.quantity == 4);
+    GEOMETRY_TEST(memcmp(_view.polygon.p_verticies, _square, sizeof(_square)) == 0);
+    GEOMETRY_TEST(geometry_store_get(p_store, 2, &_view) == 1);
+    GEOMETRY_TEST(_view.type == GEOMETRY_POLYGON_LIST && _view.polygon_list.quantity == 2 && _view.polygon_list.p_offsets[2] == 7);
+    GEOMETRY_TEST(memcmp(_view.polygon_list.p_verticies, _geometries[2].polygon_list.p_verticies, 7 * sizeof(geometry_point)) == 0);
+    GEOMETRY_TEST(geometry_store_get(p_store, 3, &_view) == 0);
+
+    // Unmap the store
+    GEOMETRY_TEST(geometry_store_close(&p_store) == 1);
+    GEOMETRY_TEST(p_store == (void *) 0);
+
+    // Clean up
+    geometry_destroy(&_geometries[2]);
+    remove(path);
+
+    // Done
+    return;
+}
+
+static int geometry_test_stream_polygon ( geometry *p_geometry, const char *p_text )
+{
+
+    // Done
+    return geometry_polygon_load_as_json_text(p_geometry, p_text, strlen(p_text), (void *) 0);
+}
+
+void geometry_test_stream ( void )
+{
+
+    // Initialized data
+    geometry _geometry = { 0 };
+
+    // Verticies as objects
+    GEOMETRY_TEST(geometry_test_stream_polygon(&_geometry, "[ { \"x\" : 0, \"y\" : 0 }, { \"y\" : 0, \"x\" : 4 }, { \"x\" : 4, \"y\" : 4 } ]") == 1);
+    GEOMETRY_TEST(_geometry.type == GEOMETRY_POLYGON && _geometry.polygon.quantity == 3);
+    GEOMETRY_TEST(fabs(_geometry.polygon.p_verticies[1].x - 4) < 1e-12 && fabs(_geometry.polygon.p_verticies[1].y) < 1e-12);
+    GEOMETRY_TEST(geometry_destroy(&_geometry) == 1);
+
+    // Verticies as arrays, with signs, fractions and exponents
+    GEOMETRY_TEST(geometry_test_stream_polygon(&_geometry, "[[-1.5,2e1],[3.25E-1,-4],\n\t[0,0]]") == 1);
+    GEOMETRY_TEST(_geometry.type == GEOMETRY_POLYGON && _geometry.polygon.quantity == 3);
+    GEOMETRY_TEST(fabs(_geometry.polygon.p_verticies[0].x + 1.5) < 1e-12 && fabs(_geometry.polygon.p_verticies[0].y - 20) < 1e-12);
+    GEOMETRY_TEST(fabs(_geometry.polygon.p_verticies[1].x - 0.325) < 1e-12 && fabs(_geometry.polygon.p_verticies[1].y + 4) < 1e-12);
+    GEOMETRY_TEST(geometry_destroy(&_geometry) == 1);
+
+    // Malformed text is an error
+    GEOMETRY_TEST(geometry_test_stream_polygon(&_geometry, "[[0,0],[1,1]") == 0);
+    GEOMETRY_TEST(geometry_test_stream_polygon(&_geometry, "[[0,0],[1]]") == 0);
+    GEOMETRY_TEST(geometry_test_stream_polygon(&_geometry, "[{\"x\":0,\"z\":1}]") == 0);
+    GEOMETRY_TEST(geometry_test_stream_polygon(&_geometry, "{}") == 0);
+
+    // Done
+    return;
+}
+
+static int geometry_test_feature_collection_batch ( geometry *p_geometries, size_t quantity, void *p_parameter )
+{
+
+    // Initialized data
+    size_t *p_counts = p_parameter;
+
+    // Count the batch
+    p_counts[0]++;
+
+    // Count each type of geometry
+    for (size_t i = 0; i < quantity; i++) p_counts[p_geometries[i].type]++;
+
+    // Success
+    return 1;
+}
+
+void geometry_test_feature_collection ( void )
+{
+
+    // Initialized data
+    const char *p_text =
+        "{ \"type\" : \"FeatureCollection\", \"features\" : [\n"
+        "  { \"type\" : \"Feature\", \"properties\" : { \"name\" : \"a\" }, \"geometry\" : { \"type\" : \"Point\", \"coordinates\" : [ 1, 2 ] } },\n"
+        "  { \"type\" : \"Feature\", \"geometry\" : { \"type\" : \"LineString\", \"coordinates\" : [ [ 0, 0 ], [ 1, 1 ] ] } },\n"
+        "  { \"type\" : \"Feature\", \"geometry\" : { \"type\" : \"LineString\", \"coordinates\" : [ [ 0, 0 ], [ 1, 1 ], [ 2, 0 ] ] } },\n"
+        "  { \"type\" : \"Feature\", \"geometry\" : null },\n"
+        "  { \"type\" : \"Feature\", \"geometry\" : { \"type\" : \"Polygon\", \"coordinates\" : [ [ [ 0, 0 ], [ 4, 0 ], [ 4, 4 ], [ 0, 0 ] ] ] } },\n"
+        "  { \"type\" : \"Feature\", \"geometry\" : { \"type\" : \"MultiPolygon\", \"coordinates\" : [ [ [ [ 0, 0 ], [ 1, 0 ], [ 1, 1 ], [ 0, 0 ] ] ], [ [ [ 5, 5 ], [ 6, 5 ], [ 6, 6 ], [ 5, 5 ] ] ] ] } }\n"
+        "] }";
+    size_t      _counts[GEOMETRY_POLYGON_LIST + 1] = { 0 };
+    FILE       *p_file = tmpfile();
+
+    // Load the collection in batches of two
+    GEOMETRY_TEST(geometry_feature_collection_load_as_json_text(p_text, strlen(p_text), 2, geometry_test_feature_collection_batch, _counts) == 1);
+    GEOMETRY_TEST(_counts[0] == 3);
+    GEOMETRY_TEST(_counts[GEOMETRY_POINT] == 1 && _counts[GEOMETRY_LINE] == 1 && _counts[GEOMETRY_LINE_LIST] == 1);
+    GEOMETRY_TEST(_counts[GEOMETRY_POLYGON] == 1 && _counts[GEOMETRY_POLYGON_LIST] == 1);
+
+    // Load the same collection from a file
+    memset(_counts, 0, sizeof(_counts));
+    GEOMETRY_TEST(p_file != (void *) 0);
+    if ( p_file )
+    {
+        fputs(p_text, p_file);
+        rewind(p_file);
+        GEOMETRY_TEST(geometry_feature_collection_load_as_json_file(p_file, 16, geometry_test_feature_collection_batch, _counts) == 1);
+        GEOMETRY_TEST(_counts[0] == 1 && _counts[GEOMETRY_POLYGON_LIST] == 1);
+        fclose(p_file);
+    }
+
+    // A collection without features is an error
+    GEOMETRY_TEST(geometry_feature_collection_load_as_json_text("{\"type\":\"Feature\"}", 18, 2, geometry_test_feature_collection_batch, _counts) == 0);
+
+    // Done
+    return;
+}
+
+void geometry_test_quantized ( void )
+{
+
+    // Initialized data
+    geometry_point             _square[]     = { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } },
+                               _decoded[4]   = { { 0 } },
+                               _inside       = { 5, 5 },
+                               _outside      = { 13, 14 },
+                               _restored     = { 0 };
+    geometry                   _geometry     = { .type = GEOMETRY_POLYGON, .polygon = { 4, _square } };
+    geometry_quantization      _quantization = { 0 };
+    geometry_quantized_polygon _polygon      = { 0 };
+    geometry_quantized_point   _a            = { 0 },
+                               _b            = { 0 };
+    double                     area          = 0,
+                               distance      = 0;
+    bool                       exact         = true,
+                               inside        = false;
+
+    // A quantization that covers the polygon
+    GEOMETRY_TEST(geometry_quantization_construct(&_quantization, &_geometry, 1) == 1);
+    for (size_t i = 0; i < 4; i++) exact = exact && geometry_point_quantize(&_quantization, &_square[i], &_a);
+    GEOMETRY_TEST(exact);
+    GEOMETRY_TEST(geometry_point_quantize(&_quantization, &_outside, &_b) == 0);
+
+    // A finer grid, that also covers the point outside of the polygon
+    _quantization = (geometry_quantization) { .origin_x = 0, .origin_y = 0, .scale = 1.0 / 1024 };
+
+    // Points round trip to within a quantization step
+    GEOMETRY_TEST(geometry_point_quantize(&_quantization, &_outside, &_b) == 1);
+    GEOMETRY_TEST(geometry_point_dequantize(&_quantization, &_b, &_restored) == 1);
+    GEOMETRY_TEST(fabs(_restored.x - 13) <= _quantization.scale && fabs(_restored.y - 14) <= _quantization.scale);
+
+    // Polygons round trip to within a quantization step
+    GEOMETRY_TEST(geometry_quantized_polygon_encode(&_quantization, &_geometry.polygon, &_polygon, (void *) 0) == 1);
+    GEOMETRY_TEST(_polygon.quantity == 4);
+    GEOMETRY_TEST(geometry_quantized_polygon_decode(&_quantization, &_polygon, _decoded) == 1);
+    for (size_t i = 0; i < 4; i++) exact = exact && fabs(_decoded[i].x - _square[i].x) <= _quantization.scale && fabs(_decoded[i].y - _square[i].y) <= _quantization.scale;
+    GEOMETRY_TEST(exact);
+
+    // Area
+    GEOMETRY_TEST(geometry_quantized_polygon_area(&_quantization, &_polygon, &area) == 1);
+    GEOMETRY_TEST(fabs(area - 100) < 1e-6);
+
+    // Point in polygon
+    GEOMETRY_TEST(geometry_point_quantize(&_quantization, &_inside, &_a) == 1);
+    GEOMETRY_TEST(geometry_quantized_point_in_polygon(&_polygon, &_a, &inside) == 1 && inside == true);
+    GEOMETRY_TEST(geometry_quantized_point_in_polygon(&_polygon, &_b, &inside) == 1 && inside == false);
+
+    // Distance
+    GEOMETRY_TEST(geometry_quantized_point_distance(&_quantization, &_a, &_b, &distance) == 1);
+    GEOMETRY_TEST(fabs(distance - hypot(8, 9)) < 1e-6);
+    GEOMETRY_TEST(geometry_quantized_polygon_distance(&_quantization, &_polygon, &_a, &distance) == 1);
+    GEOMETRY_TEST(fabs(distance) < 1e-12);
+    GEOMETRY_TEST(geometry_quantized_polygon_distance(&_quantization, &_polygon, &_b, &distance) == 1);
+    GEOMETRY_TEST(fabs(distance - 5) < 1e-6);
+
+    // Points outside of the quantization are an error
+    _outside = (geometry_point) { 1e300, 0 };
+    GEOMETRY_TEST(geometry_point_quantize(&_quantization, &_outside, &_b) == 0);
+
+    // Destroy
+    GEOMETRY_TEST(geometry_quantized_polygon_destroy(&_polygon) == 1);
+
+    // Done
+    return;
+}
+
+void geometry_test_rtree ( void )
+{
+
+    // Initialized data
+    geometry          _points[100] = { { 0 } },
+                      _query       = { .type = GEOMETRY_POINT, .point = { 0.1, 0.2 } },
+                      _polygon     = { 0 };
+    geometry_point    _triangle[]  = { { 6.5, 6.5 }, { 7.5, 6.5 }, { 7, 7.5 } };
+    geometry_envelope _envelope    = { .x_min = 2.5, .y_min = 2.5, .x_max = 4.5, .y_max = 4.5 };
+    geometry_rtree   *p_rtree      = (void *) 0;
+    size_t            _results[8]  = { 0 },
+                      quantity     = 0;
+    double            _distances[3] = { 0 };
+
+    // A ten by ten grid of points
+    for (size_t i = 0; i < 100; i++)
+        _points[i] = (geometry) { .type = GEOMETRY_POINT, .point = { (double) ( i % 10 ), (double) ( i / 10 ) } };
+    _polygon = (geometry) { .type = GEOMETRY_POLYGON, .polygon = { 3, _triangle } };
+
+    // Construct
+    GEOMETRY_TEST(geometry_rtree_construct(&p_rtree, _points, 100) == 1);
+
+    // Envelope query
+    GEOMETRY_TEST(geometry_rtree_query_envelope(p_rtree, &_envelope, _results, 8, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 4);
+
+    // Results past the capacity are counted, not stored
+    GEOMETRY_TEST(geometry_rtree_query_envelope(p_rtree, &_envelope, _results, 2, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 4);
+
+    // Intersection candidates
+    GEOMETRY_TEST(geometry_rtree_query_intersects(p_rtree, &_polygon, _results, 8, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 1 && _results[0] == 77);
+
+    // Nearest neighbours, nearest first
+    GEOMETRY_TEST(geometry_rtree_nearest(p_rtree, &_query, 3, _results, _distances, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 3 && _results[0] == 0 && _results[1] == 10 && _results[2] == 1);
+    GEOMETRY_TEST(fabs(_distances[0] - hypot(0.1, 0.2)) < 1e-12 && fabs(_distances[2] - hypot(0.9, 0.2)) < 1e-12);
+
+    // Destroy
+    GEOMETRY_TEST(geometry_rtree_destroy(&p_rtree) == 1);
+    GEOMETRY_TEST(p_rtree == (void *) 0);
+
+    // Done
+    return;
+}
+
+void geometry_test_kdtree ( void )
+{
+
+    // Initialized data
+    geometry_point      _points[100] = { { 0 } },
+                        _queries[2]  = { { 0.1, 0.2 }, { 8.8, 9.1 } };
+    geometry_point_list _list        = { 100, _points };
+    geometry_envelope   _envelope    = { .x_min = 2.5, .y_min = 2.5, .x_max = 4.5, .y_max = 4.5 };
+    geometry_kdtree    *p_kdtree     = (void *) 0;
+    size_t              _results[8]  = { 0 },
+                        _counts[2]   = { 0 },
+                        quantity     = 0;
+    double              _distances[6] = { 0 };
+
+    // A ten by ten grid of points
+    for (size_t i = 0; i < 100; i++) _points[i] = (geometry_point) { (double) ( i % 10 ), (double) ( i / 10 ) };
+
+    // Construct
+    GEOMETRY_TEST(geometry_kdtree_construct(&p_kdtree, &_list) == 1);
+
+    // Nearest neighbours, nearest first
+    GEOMETRY_TEST(geometry_kdtree_nearest(p_kdtree, &_queries[0], 3, _results, _distances, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 3 && _results[0] == 0 && _results[1] == 10 && _results[2] == 1);
+    GEOMETRY_TEST(fabs(_distances[0] - hypot(0.1, 0.2)) < 1e-12);
+
+    // A batch of queries
+    GEOMETRY_TEST(geometry_kdtree_nearest_batch(p_kdtree, _queries, 2, 3, _results, _distances, _counts) == 1);
+    GEOMETRY_TEST(_counts[0] == 3 && _counts[1] == 3);
+    GEOMETRY_TEST(_results[0] == 0 && _results[3] == 99);
+
+    // Points within a radius
+    GEOMETRY_TEST(geometry_kdtree_radius(p_kdtree, &_points[55], 1.0, _results, 8, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 5);
+
+    // Points within an envelope
+    GEOMETRY_TEST(geometry_kdtree_envelope(p_kdtree, &_envelope, _results, 8, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 4);
+
+    // Destroy
+    GEOMETRY_TEST(geometry_kdtree_destroy(&p_kdtree) == 1);
+    GEOMETRY_TEST(p_kdtree == (void *) 0);
+
+    // Done
+    return;
+}
+
+void geometry_test_envelope ( void )
+{
+
+    // Initialized data
+    geometry_point    _verticies[] = { { 1, 2 }, { 5, -1 }, { 3, 7 } };
+    geometry          _polygon     = { .type = GEOMETRY_POLYGON, .polygon = { 3, _verticies } },
+                      _near        = { .type = GEOMETRY_POINT  , .point   = { 6, 0 } },
+                      _far         = { .type = GEOMETRY_POINT  , .point   = { 20, 20 } };
+    geometry_envelope _envelope    = { 0 };
+    bool              result       = false;
+
+    // The envelope is computed once, and cached
+    GEOMETRY_TEST(geometry_envelope_get(&_polygon, &_envelope) == 1);
+    GEOMETRY_TEST(_polygon.envelope_valid == true);
+    GEOMETRY_TEST(fabs(_envelope.x_min - 1) < 1e-12 && fabs(_envelope.y_min + 1) < 1e-12 && fabs(_envelope.x_max - 5) < 1e-12 && fabs(_envelope.y_max - 7) < 1e-12);
+
+    // Moving a vertex needs an invalidation
+    _verticies[1].x = 9;
+    GEOMETRY_TEST(geometry_envelope_get(&_polygon, &_envelope) == 1 && fabs(_envelope.x_max - 5) < 1e-12);
+    GEOMETRY_TEST(geometry_envelope_invalidate(&_polygon) == 1 && _polygon.envelope_valid == false);
+    GEOMETRY_TEST(geometry_envelope_get(&_polygon, &_envelope) == 1 && fabs(_envelope.x_max - 9) < 1e-12);
+
+    // Envelopes overlap
+    GEOMETRY_TEST(geometry_envelope_intersects(&_polygon, &_near, &result) == 1 && result == true);
+    GEOMETRY_TEST(geometry_envelope_intersects(&_polygon, &_far, &result) == 1 && result == false);
+
+    // Points within a distance
+    GEOMETRY_TEST(geometry_distance_within(&_near, &_far, 20.0, &result) == 1 && result == false);
+    GEOMETRY_TEST(geometry_distance_within(&_near, &_far, 25.0, &result) == 1 && result == true);
+
+    // Done
+    return;
+}
+
+void geometry_test_prepared ( void )
+{
+
+    // Initialized data
+    geometry_point             _u[]        = { { 0, 0 }, { 9, 0 }, { 9, 9 }, { 6, 9 }, { 6, 3 }, { 3, 3 }, { 3, 9 }, { 0, 9 } },
+                               _points[]   = { { 1, 1 }, { 4.5, 6 }, { 7.5, 8 }, { 4.5, 1 }, { -1, 4 }, { 10, 4 } };
+    geometry_polygon           _polygon    = { 8, _u };
+    geometry_prepared_polygon *p_prepared  = (void *) 0;
+    bool                       _results[6] = { false },
+                               _expected[6] = { true, false, true, true, false, false },
+                               result      = false,
+                               exact       = true;
+
+    // Construct
+    GEOMETRY_TEST(geometry_prepared_polygon_construct(&p_prepared, &_polygon) == 1);
+
+    // Each point agrees with the unprepared test
+    for (size_t i = 0; i < 6; i++)
+    {
+        exact = exact && geometry_prepared_polygon_contains(p_prepared, &_points[i], &result) && result == _expected[i];
+        exact = exact && geometry_point_in_polygon(&_points[i], &_polygon, &result) && result == _expected[i];
+    }
+    GEOMETRY_TEST(exact);
+
+    // A batch of points
+    GEOMETRY_TEST(geometry_prepared_polygon_contains_batch(p_prepared, _points, 6, _results) == 1);
+    GEOMETRY_TEST(memcmp(_results, _expected, sizeof(_expected)) == 0);
+
+    // Destroy
+    GEOMETRY_TEST(geometry_prepared_polygon_destroy(&p_prepared) == 1);
+    GEOMETRY_TEST(p_prepared == (void *) 0);
+
+    // Done
+    return;
+}
+
+void geometry_test_batch_in_polygon ( void )
+{
+
+    // Initialized data
+    geometry_point          _u[]         = { { 0, 0 }, { 9, 0 }, { 9, 9 }, { 6, 9 }, { 6, 3 }, { 3, 3 }, { 3, 9 }, { 0, 9 } },
+                            _points[19]  = { { 0 } };
+    geometry_polygon        _polygon     = { 8, _u };
+    geometry_point_list     _list        = { 19, _points };
+    geometry_point_list_soa _soa         = { 0 };
+    bool                    _results[19] = { false },
+                            result       = false,
+                            exact        = true;
+
+    // Points along a diagonal, through both arms of the polygon
+    for (size_t i = 0; i < 19; i++) _points[i] = (geometry_point) { (double) i * 0.55 - 0.6, (double) i * 0.4 + 0.5 };
+
+    // The batch agrees with the scalar test, in the vector loop and in the remainder
+    GEOMETRY_TEST(geometry_point_list_soa_construct(&_soa, &_list, (void *) 0) == 1);
+    GEOMETRY_TEST(geometry_point_list_soa_in_polygon(&_soa, &_polygon, _results) == 1);
+    for (size_t i = 0; i < 19; i++)
+        exact = exact && geometry_point_in_polygon(&_points[i], &_polygon, &result) && result == _results[i];
+    GEOMETRY_TEST(exact);
+    GEOMETRY_TEST(_results[0] == false && _results[4] == true && _results[8] == false && _results[14] == true);
+
+    // Destroy
+    GEOMETRY_TEST(geometry_point_list_soa_destroy(&_soa) == 1);
+
+    // Done
+    return;
+}
+
+void geometry_test_sweep ( void )
+{
+
+    // Initialized data
+    geometry_line              _x[]         = { { .x0 = 0, .y0 = 0, .x1 = 4, .y1 = 4 }, { .x0 = 0, .y0 = 4, .x1 = 4, .y1 = 0 }, { .x0 = 5, .y0 = 0, .x1 = 5, .y1 = 4 } },
+                               _vertical[]  = { { .x0 = 2, .y0 = -1, .x1 = 2, .y1 = 5 } },
+                               _touch[]     = { { .x0 = 4, .y0 = 4, .x1 = 6, .y1 = 4 } },
+                               _away[]      = { { .x0 = 7, .y0 = 0, .x1 = 8, .y1 = 9 } };
+    geometry_line_list         _a           = { 3, _x },
+                               _b           = { 1, _vertical },
+                               _c           = { 1, _touch },
+                               _d           = { 1, _away };
+    geometry_line_intersection _results[4]  = { { 0 } };
+    size_t                     quantity     = 0;
+    bool                       result       = false;
+
+    // Pairs of lines in one line list
+    GEOMETRY_TEST(geometry_line_list_intersections(&_a, (void *) 0, _results, 4, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 1 && _results[0].a == 0 && _results[0].b == 1 && _results[0].proper == true);
+    GEOMETRY_TEST(fabs(_results[0].point.x - 2) < 1e-12 && fabs(_results[0].point.y - 2) < 1e-12);
+
+    // Pairs of lines in two line lists, in order of a then b
+    GEOMETRY_TEST(geometry_line_list_intersections(&_a, &_b, _results, 4, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 2 && _results[0].a == 0 && _results[1].a == 1 && _results[1].b == 0);
+
+    // Lines that meet at an endpoint intersect, but do not cross
+    GEOMETRY_TEST(geometry_line_list_intersects(&_a, &_c, &result) == 1 && result == true);
+    GEOMETRY_TEST(geometry_line_list_crosses(&_a, &_c, &result) == 1 && result == false);
+    GEOMETRY_TEST(geometry_line_list_crosses(&_a, &_b, &result) == 1 && result == true);
+
+    // Lines that do not meet
+    GEOMETRY_TEST(geometry_line_list_intersects(&_a, &_d, &result) == 1 && result == false);
+
+    // Done
+    return;
+}
+
+void geometry_test_hull ( void )
+{
+
+    // Initialized data
+    geometry_point      _points[400] = { { 0 } };
+    geometry_point_list _list        = { 400, _points };
+    geometry_polygon    _hull        = { 0 };
+
+    // A twenty by twenty grid of points, in a scrambled order
+    for (size_t i = 0; i < 400; i++)
+    {
+        size_t j = ( i * 149 ) % 400;
+        _points[i] = (geometry_point) { (double) ( j % 20 ), (double) ( j / 20 ) };
+    }
+
+    // The hull is the corners, counterclockwise from the lowest leftmost point
+    GEOMETRY_TEST(geometry_point_list_convex_hull(&_list, &_hull, (void *) 0) == 1);
+    GEOMETRY_TEST(_hull.quantity == 4);
+    GEOMETRY_TEST(_hull.quantity == 4 && fabs(_hull.p_verticies[0].x) < 1e-12 && fabs(_hull.p_verticies[0].y) < 1e-12);
+    GEOMETRY_TEST(_hull.quantity == 4 && fabs(_hull.p_verticies[1].x - 19) < 1e-12 && fabs(_hull.p_verticies[1].y) < 1e-12);
+    GEOMETRY_TEST(_hull.quantity == 4 && fabs(_hull.p_verticies[2].x - 19) < 1e-12 && fabs(_hull.p_verticies[2].y - 19) < 1e-12);
+    _hull.p_verticies = GEOMETRY_REALLOC(_hull.p_verticies, 0);
+
+    // Colinear points give a hull of two verticies
+    for (size_t i = 0; i < 20; i++) _points[i] = (geometry_point) { (double) ( ( i * 7 ) % 20 ), (double) ( ( i * 7 ) % 20 ) * 0.5 };
+    _list.quantity = 20;
+    GEOMETRY_TEST(geometry_point_list_convex_hull(&_list, &_hull, (void *) 0) == 1);
+    GEOMETRY_TEST(_hull.quantity == 2);
+    _hull.p_verticies = GEOMETRY_REALLOC(_hull.p_verticies, 0);
+
+    // Done
+    return;
+}
+
+static int geometry_test_parallel_mark ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    unsigned char *p_marks = p_parameter;
+
+    // Unused
+    (void) chunk;
+
+    // Mark each index of the chunk
+    for (size_t i = first; i < last; i++) p_marks[i]++;
+
+    // Success
+    return 1;
+}
+
+static int geometry_test_parallel_fail ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Unused
+    (void) first;
+    (void) last;
+    (void) p_parameter;
+
+    // Fail on the last chunk
+    return chunk + 1 < geometry_parallel_chunks(10000, 16);
+}
+
+void geometry_test_parallel ( void )
+{
+
+    // Initialized data
+    static unsigned char _marks[10000] = { 0 };
+    bool                 exact         = true;
+
+    // Every index is visited once
+    GEOMETRY_TEST(geometry_parallel_chunks(10000, 16) >= 1);
+    GEOMETRY_TEST(geometry_parallel_chunks(10, 16) == 1);
+    GEOMETRY_TEST(geometry_parallel_for(10000, 16, geometry_test_parallel_mark, _marks) == 1);
+    for (size_t i = 0; i < 10000; i++) exact = exact && _marks[i] == 1;
+    GEOMETRY_TEST(exact);
+
+    // A failed task fails the loop
+    GEOMETRY_TEST(geometry_parallel_for(10000, 16, geometry_test_parallel_fail, (void *) 0) == 0);
+
+    // Done
+    return;
+}
+
+void geometry_test_triangulate ( void )
+{
+
+    // Initialized data
+    geometry_point   _u[]           = { { 0, 0 }, { 9, 0 }, { 9, 9 }, { 6, 9 }, { 6, 3 }, { 3, 3 }, { 3, 9 }, { 0, 9 } },
+                     _clockwise[]   = { { 0, 0 }, { 0, 4 }, { 4, 4 }, { 4, 0 } };
+    geometry_polygon _polygon       = { 8, _u },
+                     _square        = { 4, _clockwise };
+    geometry         _triangles[6]  = { { 0 } };
+    size_t           _indices[18]   = { 0 },
+                     quantity       = 0;
+    double           area           = 0,
+                     total          = 0;
+    bool             ccw            = true;
+
+    // A polygon of n verticies gives n - 2 triangles
+    GEOMETRY_TEST(geometry_polygon_triangulate(&_polygon, _indices, _triangles, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 6);
+
+    // The triangles are counterclockwise, and cover the polygon
+    for (size_t i = 0; i < quantity; i++)
+    {
+        // Initialized data
+        geometry_triangle *p_triangle = &_triangles[i].triangle;
+
+        area   = ( ( p_triangle->b.x - p_triangle->a.x ) * ( p_triangle->c.y - p_triangle->a.y ) - ( p_triangle->c.x - p_triangle->a.x ) * ( p_triangle->b.y - p_triangle->a.y ) ) / 2;
+        ccw    = ccw && _triangles[i].type == GEOMETRY_TRIANGLE && area > 0;
+        total += area;
+        ccw    = ccw && fabs(p_triangle->a.x - _u[_indices[3 * i]].x) < 1e-12 && fabs(p_triangle->a.y - _u[_indices[3 * i]].y) < 1e-12;
+    }
+    GEOMETRY_TEST(ccw);
+    GEOMETRY_TEST(fabs(total - 63) < 1e-9);
+
+    // A clockwise polygon
+    GEOMETRY_TEST(geometry_polygon_triangulate(&_square, (void *) 0, _triangles, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 2);
+
+    // Done
+    return;
+}
+
+static double geometry_test_boolean_area ( geometry *p_a, geometry *p_b, enum geometry_boolean_e operation )
+{
+
+    // Initialized data
+    geometry _result = { 0 };
+    double   area    = -1;
+
+    // Compute the operation
+    if ( geometry_boolean(p_a, p_b, operation, &_result, (void *) 0) == 0 ) return -1;
+
+    // Compute the area of the result
+    if ( _result.type != GEOMETRY_POLYGON_LIST || geometry_area(&_result, &area) == 0 ) area = -1;
+
+    // Clean up
+    geometry_destroy(&_result);
+
+    // Done
+    return area;
+}
+
+void geometry_test_boolean ( void )
+{
+
+    // Initialized data
+    geometry_point _a[] = { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } },
+                   _b[] = { { 5, 5 }, { 15, 5 }, { 15, 15 }, { 5, 15 } },
+                   _c[] = { { 20, 0 }, { 20, 4 }, { 24, 4 }, { 24, 0 } };
+    geometry       _square  = { .type = GEOMETRY_POLYGON, .polygon = { 4, _a } },
+                   _overlap = { .type = GEOMETRY_POLYGON, .polygon = { 4, _b } },
+                   _away    = { .type = GEOMETRY_POLYGON, .polygon = { 4, _c } },
+                   _result  = { 0 };
+
+    // Overlapping squares
+    GEOMETRY_TEST(fabs(geometry_test_boolean_area(&_square, &_overlap, GEOMETRY_BOOLEAN_INTERSECTION        ) -  25) < 1e-9);
+    GEOMETRY_TEST(fabs(geometry_test_boolean_area(&_square, &_overlap, GEOMETRY_BOOLEAN_UNION               ) - 175) < 1e-9);
+    GEOMETRY_TEST(fabs(geometry_test_boolean_area(&_square, &_overlap, GEOMETRY_BOOLEAN_DIFFERENCE          ) -  75) < 1e-9);
+    GEOMETRY_TEST(fabs(geometry_test_boolean_area(&_square, &_overlap, GEOMETRY_BOOLEAN_SYMMETRIC_DIFFERENCE) - 150) < 1e-9);
+
+    // Disjoint squares, one of them clockwise
+    GEOMETRY_TEST(fabs(geometry_test_boolean_area(&_square, &_away, GEOMETRY_BOOLEAN_INTERSECTION)      ) < 1e-9);
+    GEOMETRY_TEST(fabs(geometry_test_boolean_area(&_square, &_away, GEOMETRY_BOOLEAN_UNION       ) - 116) < 1e-9);
+
+    // The intersection of overlapping squares is one square
+    GEOMETRY_TEST(geometry_intersection(&_square, &_overlap, &_result) == 1);
+    GEOMETRY_TEST(_result.type == GEOMETRY_POLYGON_LIST && _result.polygon_list.quantity == 1 && _result.polygon_list.vertex_quantity == 4);
+    GEOMETRY_TEST(geometry_destroy(&_result) == 1);
+
+    // Done
+    return;
+}
+
+void geometry_test_simplify ( void )
+{
+
+    // Initialized data
+    geometry_point           _ring[]   = { { 0, 0 }, { 5, 0.01 }, { 10, 0 }, { 10.02, 5 }, { 10, 10 }, { 5, 9.5 }, { 0, 10 } };
+    geometry_line            _chain[]  =
+                             {
+                                 { .x0 = 0, .y0 = 0   , .x1 = 1, .y1 = 0.01 },
+                                 { .x0 = 1, .y0 = 0.01, .x1 = 2, .y1 = 0    },
+                                 { .x0 = 2, .y0 = 0   , .x1 = 3, .y1 = 0.02 },
+                                 { .x0 = 3, .y0 = 0.02, .x1 = 4, .y1 = 0    }
+                             };
+    geometry_polygon         _polygon  = { 7, _ring },
+                             _result   = { 0 };
+    geometry_line_list       _lines    = { 4, _chain },
+                             _simple   = { 0 };
+    geometry_simplification *p_ranking = (void *) 0;
+
+    // Douglas Peucker keeps verticies further than the tolerance
+    GEOMETRY_TEST(geometry_polygon_simplify(&_polygon, GEOMETRY_SIMPLIFY_DOUGLAS_PEUCKER, 0.1, &_result, (void *) 0) == 1);
+    GEOMETRY_TEST(_result.quantity == 5);
+    _result.p_verticies = GEOMETRY_REALLOC(_result.p_verticies, 0);
+
+    // Visvalingam Whyatt keeps verticies with more area than the tolerance
+    GEOMETRY_TEST(geometry_polygon_simplify(&_polygon, GEOMETRY_SIMPLIFY_VISVALINGAM_WHYATT, 0.2, &_result, (void *) 0) == 1);
+    GEOMETRY_TEST(_result.quantity == 5);
+    _result.p_verticies = GEOMETRY_REALLOC(_result.p_verticies, 0);
+
+    // One ranking, many tolerances
+    GEOMETRY_TEST(geometry_simplification_polygon_construct(&p_ranking, &_polygon, GEOMETRY_SIMPLIFY_DOUGLAS_PEUCKER) == 1);
+    GEOMETRY_TEST(geometry_simplification_polygon(p_ranking, 0.001, &_result, (void *) 0) == 1 && _result.quantity == 7);
+    _result.p_verticies = GEOMETRY_REALLOC(_result.p_verticies, 0);
+    GEOMETRY_TEST(geometry_simplification_polygon(p_ranking, 1.0, &_result, (void *) 0) == 1 && _result.quantity == 4);
+    _result.p_verticies = GEOMETRY_REALLOC(_result.p_verticies, 0);
+    GEOMETRY_TEST(geometry_simplification_destroy(&p_ranking) == 1);
+    GEOMETRY_TEST(p_ranking == (void *) 0);
+
+    // A chain of lines
+    GEOMETRY_TEST(geometry_line_list_simplify(&_lines, GEOMETRY_SIMPLIFY_DOUGLAS_PEUCKER, 0.1, &_simple, (void *) 0) == 1);
+    GEOMETRY_TEST(_simple.quantity == 1 && fabs(_simple.p_lines[0].x1 - 4) < 1e-12);
+    _simple.p_lines = GEOMETRY_REALLOC(_simple.p_lines, 0);
+
+    // Done
+    return;
+}
+
+void geometry_test_predicates ( void )
+{
+
+    // Initialized data
+    geometry_point _a     = { 12, 12 },
+                   _b     = { 24, 24 },
+                   _below = { 0.5 + 0x1p-53, 0.5 },
+                   _above = { 0.5, 0.5 + 0x1p-53 },
+                   _on    = { 0.5, 0.5 },
+                   _p     = { 0, 0 },
+                   _q     = { 1, 0 },
+                   _r     = { 0, 1 },
+                   _d     = { 1, 1 },
+                   _in    = { 0.5, 0.5 },
+                   _out   = { 2, 2 };
+
+    // The sign of the orientation is exact, even a rounding error away from the line
+    GEOMETRY_TEST(geometry_orient2d(&_below, &_a, &_b) < 0);
+    GEOMETRY_TEST(geometry_orient2d(&_above, &_a, &_b) > 0);
+    GEOMETRY_TEST(fabs(geometry_orient2d(&_on, &_a, &_b)) < 1e-300);
+    GEOMETRY_TEST(fabs(geometry_orient2d(&_p, &_q, &_r) - 1) < 1e-12);
+
+    // In circle
+    GEOMETRY_TEST(geometry_incircle(&_p, &_q, &_r, &_in ) > 0);
+    GEOMETRY_TEST(geometry_incircle(&_p, &_q, &_r, &_out) < 0);
+    GEOMETRY_TEST(fabs(geometry_incircle(&_p, &_q, &_r, &_d)) < 1e-300);
+
+    // Clockwise points reverse the sign
+    GEOMETRY_TEST(geometry_incircle(&_p, &_r, &_q, &_in) < 0);
+
+    // Done
+    return;
+}
+
+void geometry_test_measure ( void )
+{
+
+    // Initialized data
+    geometry_point   _ccw[]        = { { 0, 0 }, { 4, 0 }, { 4, 2 }, { 0, 2 } },
+                     _cw[]         = { { 0, 0 }, { 0, 2 }, { 4, 2 }, { 4, 0 } },
+                     _flat[]       = { { 0, 0 }, { 2, 0 } };
+    geometry_polygon _polygons[]   = { { 4, _ccw }, { 4, _cw }, { 2, _flat } };
+    geometry_measure _measures[3]  = { { 0 } };
+    geometry         _rectangle    = { .type = GEOMETRY_POLYGON, .polygon = { 4, _ccw } },
+                     _line         = { .type = GEOMETRY_LINE   , .line    = { .x0 = 0, .y0 = 0, .x1 = 3, .y1 = 4 } },
+                     _list         = { 0 },
+                     _centroid     = { 0 };
+    double           length        = 0;
+
+    // Area, perimeter and centroid in one pass
+    GEOMETRY_TEST(geometry_polygon_measure(&_polygons[0], &_measures[0]) == 1);
+    GEOMETRY_TEST(fabs(_measures[0].area - 8) < 1e-12 && fabs(_measures[0].perimeter - 12) < 1e-12);
+    GEOMETRY_TEST(fabs(_measures[0].centroid.x - 2) < 1e-12 && fabs(_measures[0].centroid.y - 1) < 1e-12);
+
+    // A clockwise ring has a negative area
+    GEOMETRY_TEST(geometry_polygon_measure(&_polygons[1], &_measures[1]) == 1);
+    GEOMETRY_TEST(fabs(_measures[1].area + 8) < 1e-12 && fabs(_measures[1].centroid.x - 2) < 1e-12);
+
+    // Each ring of a polygon list. A ring with no area is centered on its edges.
+    GEOMETRY_TEST(geometry_polygon_list_construct(&_list, _polygons, 3, (void *) 0) == 1);
+    GEOMETRY_TEST(geometry_polygon_list_measure(&_list.polygon_list, _measures) == 1);
+    GEOMETRY_TEST(fabs(_measures[1].area + 8) < 1e-12 && fabs(_measures[2].area) < 1e-12);
+    GEOMETRY_TEST(fabs(_measures[2].centroid.x - 1) < 1e-12 && fabs(_measures[2].centroid.y) < 1e-12);
+    GEOMETRY_TEST(geometry_destroy(&_list) == 1);
+
+    // Length and centroid of a geometry
+    GEOMETRY_TEST(geometry_length(&_rectangle, &length) == 1 && fabs(length - 12) < 1e-12);
+    GEOMETRY_TEST(geometry_length(&_line, &length) == 1 && fabs(length - 5) < 1e-12);
+    GEOMETRY_TEST(geometry_centroid(&_line, &_centroid) == 1);
+    GEOMETRY_TEST(_centroid.type == GEOMETRY_POINT && fabs(_centroid.point.x - 1.5) < 1e-12 && fabs(_centroid.point.y - 2) < 1e-12);
+
+    // Done
+    return;
+}
+
+void geometry_test_relate ( void )
+{
+
+    // Initialized data
+    geometry_point    _a[]      = { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } },
+                      _b[]      = { { 5, 5 }, { 15, 5 }, { 15, 15 }, { 5, 15 } },
+                      _c[]      = { { 10, 0 }, { 20, 0 }, { 20, 10 }, { 10, 10 } },
+                      _d[]      = { { 10, 10 }, { 0, 10 }, { 0, 0 }, { 10, 0 } };
+    geometry          _square   = { .type = GEOMETRY_POLYGON, .polygon = { 4, _a } },
+                      _overlap  = { .type = GEOMETRY_POLYGON, .polygon = { 4, _b } },
+                      _beside   = { .type = GEOMETRY_POLYGON, .polygon = { 4, _c } },
+                      _same     = { .type = GEOMETRY_POLYGON, .polygon = { 4, _d } },
+                      _inside   = { .type = GEOMETRY_POINT  , .point   = { 3, 4 } },
+                      _far      = { .type = GEOMETRY_POINT  , .point   = { 30, 4 } },
+                      _crossing = { .type = GEOMETRY_LINE   , .line    = { .x0 = -5, .y0 = 5, .x1 = 5, .y1 = 5 } };
+    geometry_relation _relation = { { { 0 } } };
+    bool              result    = false;
+
+    // Overlapping squares
+    GEOMETRY_TEST(geometry_relate(&_square, &_overlap, &_relation) == 1);
+    GEOMETRY_TEST(geometry_relation_matches(&_relation, "212101212", &result) == 1 && result == true);
+    GEOMETRY_TEST(geometry_overlaps(&_square, &_overlap, &result) == 1 && result == true);
+    GEOMETRY_TEST(geometry_contains(&_square, &_overlap, &result) == 1 && result == false);
+
+    // Squares that share an edge
+    GEOMETRY_TEST(geometry_relate_pattern(&_square, &_beside, "FF2F11212", &result) == 1 && result == true);
+    GEOMETRY_TEST(geometry_touches(&_square, &_beside, &result) == 1 && result == true);
+    GEOMETRY_TEST(geometry_intersects(&_square, &_beside, &result) == 1 && result == true);
+    GEOMETRY_TEST(geometry_overlaps(&_square, &_beside, &result) == 1 && result == false);
+
+    // The same square, from another vertex
+    GEOMETRY_TEST(geometry_equals(&_square, &_same, &result) == 1 && result == true);
+    GEOMETRY_TEST(geometry_equals(&_square, &_overlap, &result) == 1 && result == false);
+
+    // Points
+    GEOMETRY_TEST(geometry_contains(&_square, &_inside, &result) == 1 && result == true);
+    GEOMETRY_TEST(geometry_contains(&_square, &_far, &result) == 1 && result == false);
+    GEOMETRY_TEST(geometry_disjoint(&_square, &_far, &result) == 1 && result == true);
+
+    // A line through the boundary
+    GEOMETRY_TEST(geometry_crosses(&_crossing, &_square, &result) == 1 && result == true);
+    GEOMETRY_TEST(geometry_touches(&_crossing, &_square, &result) == 1 && result == false);
+
+    // Done
+    return;
+}
+
+static int geometry_test_join_count ( size_t a, size_t b, void *p_parameter )
+{
+
+    // Unused
+    (void) a;
+    (void) b;
+
+    // Count the pair
+    (*(size_t *) p_parameter)++;
+
+    // Success
+    return 1;
+}
+
+void geometry_test_join ( void )
+{
+
+    // Initialized data
+    geometry_point      _left[]     = { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } },
+                        _right[]    = { { 20, 0 }, { 30, 0 }, { 30, 10 }, { 20, 10 } };
+    geometry            _polygons[] =
+                        {
+                            { .type = GEOMETRY_POLYGON, .polygon = { 4, _left } },
+                            { .type = GEOMETRY_POLYGON, .polygon = { 4, _right } }
+                        },
+                        _points[64] = { { 0 } };
+    geometry_join_pair *p_pairs     = (void *) 0;
+    size_t              quantity    = 0,
+                        count       = 0;
+    bool                sorted      = true;
+
+    // A row of points, every half unit from 0 to 31.5
+    for (size_t i = 0; i < 64; i++) _points[i] = (geometry) { .type = GEOMETRY_POINT, .point = { (double) i * 0.5, 5 } };
+
+    // Points in polygons. Boundaries intersect, but are not contained.
+    GEOMETRY_TEST(geometry_join(_polygons, 2, _points, 64, GEOMETRY_JOIN_INTERSECTS, 0, &p_pairs, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 42);
+    for (size_t i = 1; i < quantity; i++)
+        sorted = sorted && ( p_pairs[i - 1].a < p_pairs[i].a || ( p_pairs[i - 1].a == p_pairs[i].a && p_pairs[i - 1].b < p_pairs[i].b ) );
+    GEOMETRY_TEST(sorted);
+    GEOMETRY_TEST(p_pairs != (void *) 0 && p_pairs[0].a == 0 && p_pairs[0].b == 0 && p_pairs[21].a == 1 && p_pairs[21].b == 40);
+    p_pairs = GEOMETRY_REALLOC(p_pairs, 0);
+
+    GEOMETRY_TEST(geometry_join(_polygons, 2, _points, 64, GEOMETRY_JOIN_CONTAINS, 0, &p_pairs, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 38);
+    p_pairs = GEOMETRY_REALLOC(p_pairs, 0);
+
+    // Points within a distance of points
+    GEOMETRY_TEST(geometry_join(_points, 64, _points, 64, GEOMETRY_JOIN_WITHIN_DISTANCE, 0.5, &p_pairs, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 64 + 2 * 63);
+    p_pairs = GEOMETRY_REALLOC(p_pairs, 0);
+
+    // Pairs passed to a callback
+    GEOMETRY_TEST(geometry_join_each(_polygons, 2, _points, 64, GEOMETRY_JOIN_INTERSECTS, 0, geometry_test_join_count, &count) == 1);
+    GEOMETRY_TEST(count == 42);
+
+    // Done
+    return;
+}
+
+void geometry_test_distance_matrix ( void )
+{
+
+    // Initialized data
+    geometry_point          _a[70]       = { { 0 } },
+                            _b[5]        = { { 0 } };
+    geometry_point_list     _list_a      = { 70, _a },
+                            _list_b      = { 5, _b };
+    geometry_distance_pair *p_pairs      = (void *) 0,
+                            _closest     = { 0 };
+    double                  _matrix[350] = { 0 };
+    size_t                  quantity     = 0;
+    bool                    exact        = true;
+
+    // Points on a scrambled grid, and a few points between them
+    for (size_t i = 0; i < 70; i++)
+    {
+        size_t j = ( i * 17 ) % 70;
+        _a[i] = (geometry_point) { (double) ( j % 10 ), (double) ( j / 10 ) };
+    }
+    for (size_t i = 0; i < 5; i++) _b[i] = (geometry_point) { (double) i * 2 + 0.25, 3 };
+    _a[33] = (geometry_point) { 4.125, 6.1 };
+
+    // Each entry of the matrix is a distance
+    GEOMETRY_TEST(geometry_point_list_distance_matrix(&_list_a, &_list_b, _matrix) == 1);
+    for (size_t i = 0; i < 70; i++)
+        for (size_t j = 0; j < 5; j++)
+            exact = exact && fabs(_matrix[i * 5 + j] - hypot(_a[i].x - _b[j].x, _a[i].y - _b[j].y)) < 1e-12;
+    GEOMETRY_TEST(exact);
+
+    // Pairs within a distance. Each point of b is a quarter from one point of
+    // a, and three quarters from another.
+    GEOMETRY_TEST(geometry_point_list_distance_pairs(&_list_a, &_list_b, 0.25, &p_pairs, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 5);
+    p_pairs = GEOMETRY_REALLOC(p_pairs, 0);
+    GEOMETRY_TEST(geometry_point_list_distance_pairs(&_list_a, &_list_b, 0.8, &p_pairs, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 10);
+    for (size_t i = 1; i < quantity; i++) exact = exact && ( p_pairs[i - 1].a < p_pairs[i].a || ( p_pairs[i - 1].a == p_pairs[i].a && p_pairs[i - 1].b < p_pairs[i].b ) );
+    GEOMETRY_TEST(exact);
+    p_pairs = GEOMETRY_REALLOC(p_pairs, 0);
+
+    // The closest pair
+    GEOMETRY_TEST(geometry_point_list_closest_pair(&_list_a, &_closest) == 1);
+    GEOMETRY_TEST(_closest.a < _closest.b && ( _closest.a == 33 || _closest.b == 33 ));
+    GEOMETRY_TEST(fabs(_closest.distance - hypot(0.125, 0.1)) < 1e-12);
+
+    // Done
+    return;
+}
+
+void geometry_test_dispatch ( void )
+{
+
+    // Initialized data
+    geometry_point           _square[]  = { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } },
+                             _inner[]   = { { 2, 2 }, {  4, 2 }, {  4,  4 }, { 2,  4 } },
+                             _points[]  = { { 20, 20 }, { 5, 5 } },
+                             _outside   = { 13, 4 };
+    geometry_line            _lines[]   = { { .x0 = 20, .y0 = 0, .x1 = 20, .y1 = 5 }, { .x0 = 11, .y0 = 5, .x1 = 16, .y1 = 5 } };
+    geometry                 _a[]       =
+                             {
+                                 { .type = GEOMETRY_POLYGON, .polygon = { 4, _square } },
+                                 { .type = GEOMETRY_LINE   , .line    = { .x0 = 13, .y0 = -5, .x1 = 13, .y1 = 15 } }
+                             },
+                             _b[]       =
+                             {
+                                 { .type = GEOMETRY_POLYGON , .polygon  = { 4, _inner } },
+                                 { .type = GEOMETRY_LINE    , .line     = { .x0 = 20, .y0 = 12, .x1 = 30, .y1 = 12 } },
+                                 { .type = GEOMETRY_TRIANGLE, .triangle = { { 11, 11 }, { 12, 11 }, { 11, 12 } } }
+                             },
+                             _crossing  = { .type = GEOMETRY_LINE      , .line       = { .x0 = 5, .y0 = -5, .x1 = 5, .y1 = 5 } },
+                             _list      = { .type = GEOMETRY_POINT_LIST, .point_list = { 2, _points } },
+                             _line_list = { .type = GEOMETRY_LINE_LIST , .line_list  = { 2, _lines } },
+                             _rectangle = { .type = GEOMETRY_RECTANGLE };
+    enum geometry_location_e location   = GEOMETRY_LOCATION_EXTERIOR;
+    geometry_join_pair      *p_pairs    = (void *) 0;
+    size_t                   quantity   = 0;
+    double                   distance   = -1;
+    bool                     result     = false;
+
+    // The kernels of a point can be called directly
+    GEOMETRY_TEST(geometry_point_polygon_distance(&_outside, &_a[0].polygon, &distance) == 1 && fabs(distance - 3) < 1e-9);
+    GEOMETRY_TEST(geometry_point_polygon_locate(&_outside, &_a[0].polygon, &location) == 1 && location == GEOMETRY_LOCATION_EXTERIOR);
+    GEOMETRY_TEST(geometry_point_polygon_locate(&_points[1], &_a[0].polygon, &location) == 1 && location == GEOMETRY_LOCATION_INTERIOR);
+    GEOMETRY_TEST(geometry_point_polygon_locate(&_square[2], &_a[0].polygon, &location) == 1 && location == GEOMETRY_LOCATION_BOUNDARY);
+
+    // The predicates agree with the relate engine
+    GEOMETRY_TEST(geometry_relate_contains(&_a[0], &_b[0], &result) == 1 && result == true);
+    GEOMETRY_TEST(geometry_contains(&_a[0], &_b[0], &result) == 1 && result == true);
+    GEOMETRY_TEST(geometry_contains(&_b[0], &_a[0], &result) == 1 && result == false);
+
+    // A line beside a polygon, in either order
+    GEOMETRY_TEST(geometry_distance(&_a[1], &_a[0], &distance) == 1);
+    GEOMETRY_TEST(fabs(distance - 3.0) < 1e-9);
+    GEOMETRY_TEST(geometry_distance(&_a[0], &_a[1], &distance) == 1);
+    GEOMETRY_TEST(fabs(distance - 3.0) < 1e-9);
+
+    // A polygon inside of a polygon
+    GEOMETRY_TEST(geometry_distance(&_a[0], &_b[0], &distance) == 1);
+    GEOMETRY_TEST(fabs(distance) < 1e-9);
+
+    // Corner to corner
+    GEOMETRY_TEST(geometry_distance(&_a[0], &_b[2], &distance) == 1);
+    GEOMETRY_TEST(fabs(distance - sqrt(2.0)) < 1e-9);
+
+    // Lines that cross, and lines that do not
+    GEOMETRY_TEST(geometry_distance(&_crossing, &_line_list, &distance) == 1 && fabs(distance - 6) < 1e-9);
+    GEOMETRY_TEST(geometry_distance(&_a[1], &_line_list, &distance) == 1 && fabs(distance) < 1e-9);
+    GEOMETRY_TEST(geometry_distance(&_a[1], &_b[1], &distance) == 1 && fabs(distance - 7) < 1e-9);
+
+    // A point list with a point inside of a polygon
+    GEOMETRY_TEST(geometry_distance(&_list, &_a[0], &distance) == 1 && fabs(distance) < 1e-9);
+    GEOMETRY_TEST(geometry_distance(&_list, &_b[0], &distance) == 1 && fabs(distance - hypot(1, 1)) < 1e-9);
+
+    // Rectangles have no kernel
+    GEOMETRY_TEST(geometry_distance(&_rectangle, &_a[0], &distance) == 0);
+
+    // Lines and polygons join within a distance
+    GEOMETRY_TEST(geometry_join(_a, 2, _b, 3, GEOMETRY_JOIN_WITHIN_DISTANCE, 2.0, &p_pairs, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 3);
+    GEOMETRY_TEST(p_pairs != (void *) 0 && p_pairs[0].a == 0 && p_pairs[0].b == 0);
+    GEOMETRY_TEST(p_pairs != (void *) 0 && p_pairs[1].a == 0 && p_pairs[1].b == 2);
+    GEOMETRY_TEST(p_pairs != (void *) 0 && p_pairs[2].a == 1 && p_pairs[2].b == 2);
+
+    // Clean up
+    p_pairs = GEOMETRY_REALLOC(p_pairs, 0);
+
+    // Done
+    return;
+}
+
+static int geometry_test_parallel_reduce_sum ( size_t first, size_t last, void *p_partial, void *p_parameter )
+{
+
+    // Unused
+    (void) p_parameter;
+
+    // Sum the indices of the chunk
+    for (size_t i = first; i < last; i++) *(size_t *) p_partial += i;
+
+    // Success
+    return 1;
+}
+
+static int geometry_test_parallel_reduce_combine ( void *p_result, const void *p_partial, void *p_parameter )
+{
+
+    // Unused
+    (void) p_parameter;
+
+    // Add the partial sum
+    *(size_t *) p_result += *(const size_t *) p_partial;
+
+    // Success
+    return 1;
+}
+
+static int geometry_test_parallel_reduce_nested ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Unused
+    (void) chunk;
+
+    // Run a loop inside of the task
+    return geometry_parallel_for(last - first, 8, geometry_test_parallel_mark, (unsigned char *) p_parameter + first);
+}
+
+void geometry_test_parallel_reduce ( void )
+{
+
+    // Initialized data
+    static unsigned char _marks[4096] = { 0 };
+    size_t               sum          = 0;
+    bool                 exact        = true;
+
+    // The executor has at least the calling thread
+    GEOMETRY_TEST(geometry_parallel_threads() >= 1);
+
+    // Sum a range
+    GEOMETRY_TEST(geometry_parallel_reduce(100000, 64, sizeof(size_t), geometry_test_parallel_reduce_sum, geometry_test_parallel_reduce_combine, &sum, (void *) 0) == 1);
+    GEOMETRY_TEST(sum == (size_t) 100000 * 99999 / 2);
+
+    // Loops inside of loops visit every index once
+    GEOMETRY_TEST(geometry_parallel_for(4096, 256, geometry_test_parallel_reduce_nested, _marks) == 1);
+    for (size_t i = 0; i < 4096; i++) exact = exact && _marks[i] == 1;
+    GEOMETRY_TEST(exact);
+
+    // Done
+    return;
+}
+
+void geometry_test_store_corrupt ( void )
+{
+
+    // Initialized data
+    const char      *path        = "geometry_test_corrupt.store";
+    geometry_point   _square[]   = { { 0, 0 }, { 4, 0 }, { 4, 4 }, { 0, 4 } },
+                     _other[]    = { { 10, 0 }, { 12, 0 }, { 11, 2 } };
+    geometry_polygon _polygons[] = { { 4, _square }, { 3, _other } };
+    geometry         _list       = { 0 },
+                     _view       = { 0 };
+    geometry_store  *p_store     = (void *) 0;
+    FILE            *p_file      = (void *) 0;
+    size_t           offset      = 0,
+                     ring        = 100;
+
+    // Write a store with a polygon list
+    GEOMETRY_TEST(geometry_polygon_list_construct(&_list, _polygons, 2, (void *) 0) == 1);
+    GEOMETRY_TEST(geometry_store_write(path, &_list, 1) == 1);
+    GEOMETRY_TEST(geometry_store_open(&p_store, path) == 1);
+    if ( p_store ) offset = (size_t) p_store->p_directory[0].offset;
+    GEOMETRY_TEST(geometry_store_close(&p_store) == 1);
+
+    // Move the end of the first ring past the verticies
+    p_file = fopen(path, "r+b");
+    GEOMETRY_TEST(p_file != (void *) 0);
+    if ( p_file )
+    {
+        fseek(p_file, (long) ( offset + sizeof(size_t) ), SEEK_SET);
+        fwrite(&ring, sizeof(size_t), 1, p_file);
+        fclose(p_file);
+    }
+
+    // The view is refused
+    GEOMETRY_TEST(geometry_store_open(&p_store, path) == 1);
+    GEOMETRY_TEST(geometry_store_get(p_store, 0, &_view) == 0);
+    GEOMETRY_TEST(geometry_store_close(&p_store) == 1);
+
+    // Clean up
+    geometry_destroy(&_list);
+    remove(path);
+
+    // Done
+    return;
+}
+
+static int geometry_test_stream_skip_batch ( geometry *p_geometries, size_t quantity, void *p_parameter )
+{
+
+    // Unused
+    (void) p_geometries;
+
+    // Count the geometry
+    *(size_t *) p_parameter += quantity;
+
+    // Success
+    return 1;
+}
+
+static int geometry_test_stream_skip_load ( const char *p_text, size_t *p_quantity )
+{
+
+    // Initialized data
+    *p_quantity = 0;
+
+    // Done
+    return geometry_feature_collection_load_as_json_text(p_text, strlen(p_text), 16, geometry_test_stream_skip_batch, p_quantity);
+}
+
+void geometry_test_stream_skip ( void )
+{
+
+    // Initialized data
+    size_t quantity = 0;
+
+    // Well formed properties are skipped
+    GEOMETRY_TEST(geometry_test_stream_skip_load("{\"type\":\"FeatureCollection\",\"features\":[{\"type\":\"Feature\",\"properties\":{\"ok\":true,\"n\":[1,-2.5E3,null]},\"geometry\":{\"type\":\"Point\",\"coordinates\":[1,2]}}]}", &quantity) == 1);
+    GEOMETRY_TEST(quantity == 1);
+
+    // Unrecognized characters are an error, not an endless loop
+    GEOMETRY_TEST(geometry_test_stream_skip_load("{\"type\":\"FeatureCollection\",\"features\":[{\"type\":\"Feature\",\"properties\":{\"ok\":True},\"geometry\":{\"type\":\"Point\",\"coordinates\":[1,2]}}]}", &quantity) == 0);
+    GEOMETRY_TEST(geometry_test_stream_skip_load("{\"type\":\"FeatureCollection\",\"features\":[{\"type\":\"Feature\",\"properties\":@,\"geometry\":null}]}", &quantity) == 0);
+    GEOMETRY_TEST(geometry_test_stream_skip_load("{\"type\":\"FeatureCollection\",\"features\":[],\"bbox\":[0,#]}", &quantity) == 0);
+
+    // Done
+    return;
+}
+
+static double geometry_test_quantized_winding_area ( geometry_point *p_verticies, size_t quantity )
+{
+
+    // Initialized data
+    geometry_polygon           _geometry      = { quantity, p_verticies };
+    geometry_quantization      _quantization  = { .origin_x = 0, .origin_y = 0, .scale = 1 };
+    geometry_quantized_polygon _polygon;
+    double                     area           = -1.0;
+
+    // Quantize the polygon onto the unit grid, so small areas have small sums
+    if ( geometry_quantized_polygon_encode(&_quantization, &_geometry, &_polygon, (void *) 0) == 0 ) return -1.0;
+
+    // Compute the area
+    if ( geometry_quantized_polygon_area(&_quantization, &_polygon, &area) == 0 ) area = -1.0;
+
+    // Clean up
+    geometry_quantized_polygon_destroy(&_polygon);
+
+    // Success
+    return area;
+}
+
+void geometry_test_quantized_winding ( void )
+{
+
+    // Initialized data
+    geometry_point small_ccw[] = { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } },
+                   small_cw[]  = { { 0, 0 }, { 0, 10 }, { 10, 10 }, { 10, 0 } },
+                   large_ccw[] = { { 0, 0 }, { 1000, 0 }, { 1000, 1000 }, { 0, 1000 } },
+                   large_cw[]  = { { 0, 0 }, { 0, 1000 }, { 1000, 1000 }, { 1000, 0 } };
+
+    // The area does not depend on the winding
+    GEOMETRY_TEST(fabs(geometry_test_quantized_winding_area(small_ccw, 4) - 100.0    ) < 1e-9);
+    GEOMETRY_TEST(fabs(geometry_test_quantized_winding_area(small_cw , 4) - 100.0    ) < 1e-9);
+    GEOMETRY_TEST(fabs(geometry_test_quantized_winding_area(large_ccw, 4) - 1000000.0) < 1e-9);
+    GEOMETRY_TEST(fabs(geometry_test_quantized_winding_area(large_cw , 4) - 1000000.0) < 1e-9);
+
+    // Done
+    return;
+}
+
+void geometry_test_polygon_list_holes ( void )
+{
+
+    // Initialized data
+    geometry_point _verticies[] =
+    {
+        { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 },
+        { 6, 6 }, {  6, 8 }, {  8,  8 }, { 8,  6 }
+    };
+    size_t         _offsets[]   = { 0, 4, 8 };
+    geometry       _geometry    = { .type = GEOMETRY_POLYGON_LIST, .polygon_list = { 2, 8, _offsets, _verticies } },
+                   _centroid    = { 0 };
+    double         area         = 0;
+
+    // The clockwise ring is a hole
+    GEOMETRY_TEST(geometry_area(&_geometry, &area) == 1);
+    GEOMETRY_TEST(fabs(area - 96.0) < 1e-9);
+
+    // The hole moves the centroid away from it
+    GEOMETRY_TEST(geometry_centroid(&_geometry, &_centroid) == 1);
+    GEOMETRY_TEST(fabs(_centroid.point.x - 472.0 / 96.0) < 1e-9);
+    GEOMETRY_TEST(fabs(_centroid.point.y - 472.0 / 96.0) < 1e-9);
+
+    // Done
+    return;
+}
+
+void geometry_test_polygon_list_separate ( void )
+{
+
+    // Initialized data
+    geometry_point _verticies[] =
+    {
+        {  0, 0 }, { 10, 0 }, { 10, 10 }, {  0, 10 },
+        { 20, 0 }, { 20, 10 }, { 30, 10 }, { 30,  0 }
+    };
+    size_t         _offsets[]   = { 0, 4, 8 };
+    geometry       _geometry    = { .type = GEOMETRY_POLYGON_LIST, .polygon_list = { 2, 8, _offsets, _verticies } },
+                   _centroid    = { 0 };
+    double         area         = 0;
+
+    // A clockwise ring outside of every other ring is not a hole
+    GEOMETRY_TEST(geometry_area(&_geometry, &area) == 1);
+    GEOMETRY_TEST(fabs(area - 200.0) < 1e-9);
+
+    // The centroid is between the squares
+    GEOMETRY_TEST(geometry_centroid(&_geometry, &_centroid) == 1);
+    GEOMETRY_TEST(fabs(_centroid.point.x - 15.0) < 1e-9);
+    GEOMETRY_TEST(fabs(_centroid.point.y -  5.0) < 1e-9);
+
+    // Done
+    return;
+}
+
+void geometry_test_arena_overflow ( void )
+{
+
+    // Initialized data
+    geometry_arena *p_arena  = (void *) 0;
+    void           *p_memory = (void *) 0;
+
+    // Construct
+    GEOMETRY_TEST(geometry_arena_create(&p_arena, 256) == 1);
+
+    // Sizes near the top of size_t are refused, with or without a block
+    GEOMETRY_TEST(geometry_arena_allocate(p_arena, SIZE_MAX - 8, &p_memory) == 0);
+    GEOMETRY_TEST(geometry_arena_allocate(p_arena, 10, &p_memory) == 1);
+    GEOMETRY_TEST(geometry_arena_allocate(p_arena, SIZE_MAX - 8, &p_memory) == 0);
+    GEOMETRY_TEST(geometry_arena_allocate(p_arena, SIZE_MAX, &p_memory) == 0);
+
+    // The arena is still usable
+    GEOMETRY_TEST(geometry_arena_allocate(p_arena, 10, &p_memory) == 1);
+
+    // Destroy
+    GEOMETRY_TEST(geometry_arena_destroy(&p_arena) == 1);
+
+    // Done
+    return;
+}
+
+void geometry_test_polygon_list_distance ( void )
+{
+
+    // Initialized data
+    geometry_point _verticies[] =
+    {
+        { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 },
+        { 2, 2 }, {  2, 8 }, {  8,  8 }, { 8,  2 }
+    };
+    size_t         _offsets[]   = { 0, 4, 8 };
+    geometry       _geometry    = { .type = GEOMETRY_POLYGON_LIST, .polygon_list = { 2, 8, _offsets, _verticies } },
+                   _hole        = { .type = GEOMETRY_POINT, .point = { 5, 5 } },
+                   _solid       = { .type = GEOMETRY_POINT, .point = { 1, 5 } };
+    double         distance     = -1;
+    bool           result       = true;
+
+    // A point inside of a hole is as far as the nearest edge
+    GEOMETRY_TEST(geometry_point_polygon_list_distance(&_hole.point, &_geometry.polygon_list, &distance) == 1);
+    GEOMETRY_TEST(fabs(distance - 3.0) < 1e-9);
+    GEOMETRY_TEST(geometry_distance(&_hole, &_geometry, &distance) == 1);
+    GEOMETRY_TEST(fabs(distance - 3.0) < 1e-9);
+    GEOMETRY_TEST(geometry_disjoint(&_hole, &_geometry, &result) == 1 && result == true);
+
+    // A point between the rings is no distance away
+    GEOMETRY_TEST(geometry_point_polygon_list_distance(&_solid.point, &_geometry.polygon_list, &distance) == 1);
+    GEOMETRY_TEST(fabs(distance) < 1e-9);
+    GEOMETRY_TEST(geometry_disjoint(&_solid, &_geometry, &result) == 1 && result == false);
+
+    // Done
+    return;
+}
+
+static int geometry_test_dispatch_lazy_contains ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Unused
+    (void) p_a;
+    (void) p_b;
+
+    // Every point is inside
+    *p_result = true;
+
+    // Success
+    return 1;
+}
+
+void geometry_test_dispatch_lazy ( void )
+{
+
+    // Initialized data
+    geometry_point _square[]  = { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } };
+    geometry       _polygon   = { .type = GEOMETRY_POLYGON, .polygon = { 4, _square } },
+                   _point     = { .type = GEOMETRY_POINT, .point = { 13, 14 } },
+                   _rectangle = { .type = GEOMETRY_RECTANGLE };
+    double         distance   = -1;
+    bool           result     = false;
+
+    // The operations register the kernels of the library on first use
+    GEOMETRY_TEST(geometry_distance(&_point, &_polygon, &distance) == 1);
+    GEOMETRY_TEST(fabs(distance - 5.0) < 1e-9);
+    GEOMETRY_TEST(geometry_disjoint(&_polygon, &_point, &result) == 1 && result == true);
+
+    // A kernel registered before geometry_init is kept by it
+    GEOMETRY_TEST(geometry_dispatch_register(GEOMETRY_OPERATION_CONTAINS, GEOMETRY_RECTANGLE, GEOMETRY_POINT, (geometry_kernel) { .pfn_predicate = geometry_test_dispatch_lazy_contains }) == 1);
+    GEOMETRY_TEST(geometry_dispatch_init() == 1);
+    GEOMETRY_TEST(geometry_dispatch_init() == 1);
+    result = false;
+    GEOMETRY_TEST(geometry_contains(&_rectangle, &_point, &result) == 1 && result == true);
+
+    // The kernels of the library are still registered
+    GEOMETRY_TEST(geometry_distance(&_polygon, &_point, &distance) == 1);
+    GEOMETRY_TEST(fabs(distance - 5.0) < 1e-9);
+
+    // Done
+    return;
+}
+
+void geometry_test_triangle_encoding ( void )
+{
+
+    // Initialized data
+    const char      *path          = "geometry_test_triangles.store";
+    geometry_point   _hexagon[]    = { { 0, 0 }, { 2, 0 }, { 3, 1 }, { 2, 2 }, { 0, 2 }, { -1, 1 } },
+                     _open[]       = { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 5, 5 } };
+    geometry_polygon _polygon      = { 6, _hexagon };
+    geometry         _triangles[4] = { 0 },
+                     _decoded      = { 0 },
+                     _view         = { 0 };
+    geometry_store  *p_store       = (void *) 0;
+    unsigned char    _buffer[128]  = { 0 };
+    size_t           quantity      = 0,
+                     size          = 0,
+                     read          = 0;
+
+    // Triangulate the polygon
+    GEOMETRY_TEST(geometry_polygon_triangulate(&_polygon, (void *) 0, _triangles, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 4);
+
+    // A triangle is a WKB Triangle with one closed ring
+    GEOMETRY_TEST(geometry_serialize_size(&_triangles[0], &size) == 1);
+    GEOMETRY_TEST(size == 9 + 4 + 16 * 4);
+    GEOMETRY_TEST(geometry_serialize(&_triangles[0], _buffer) == 1);
+    GEOMETRY_TEST(_buffer[1] == GEOMETRY_WKB_TRIANGLE && _buffer[5] == 1 && _buffer[9] == 4);
+    GEOMETRY_TEST(memcmp(&_buffer[13], &_buffer[13 + 48], sizeof(geometry_point)) == 0);
+
+    // The triangle survives the round trip
+    GEOMETRY_TEST(geometry_deserialize(&_decoded, _buffer, size, &read, (void *) 0) == 1);
+    GEOMETRY_TEST(read == size);
+    GEOMETRY_TEST(_decoded.type == GEOMETRY_TRIANGLE && memcmp(&_decoded.triangle, &_triangles[0].triangle, sizeof(geometry_triangle)) == 0);
+
+    // A ring that does not close is refused
+    memcpy(&_buffer[13], _open, sizeof(_open));
+    GEOMETRY_TEST(geometry_deserialize(&_decoded, _buffer, size, &read, (void *) 0) == 0);
+
+    // The output of a triangulation can be stored
+    GEOMETRY_TEST(geometry_store_write(path, _triangles, quantity) == 1);
+    GEOMETRY_TEST(geometry_store_open(&p_store, path) == 1);
+    GEOMETRY_TEST(p_store != (void *) 0 && p_store->quantity == 4);
+    GEOMETRY_TEST(geometry_store_get(p_store, 3, &_view) == 1);
+    GEOMETRY_TEST(_view.type == GEOMETRY_TRIANGLE && memcmp(&_view.triangle, &_triangles[3].triangle, sizeof(geometry_triangle)) == 0);
+    GEOMETRY_TEST(geometry_store_close(&p_store) == 1);
+
+    // Clean up
+    remove(path);
+
+    // Done
+    return;
+}
+
+void geometry_test_rtree_refine ( void )
+{
+
+    // Initialized data
+    geometry_point  _corner[]     = { { 0, 0 }, { 10, 0 }, { 0, 10 } };
+    geometry        _query        = { .type = GEOMETRY_POLYGON, .polygon = { 3, _corner } },
+                    _lines[]      =
+                    {
+                        { .type = GEOMETRY_LINE    , .line     = { .x0 = 8, .y0 = 8, .x1 = 9, .y1 = 9 } },
+                        { .type = GEOMETRY_LINE    , .line     = { .x0 = 12, .y0 = 0, .x1 = 12, .y1 = 1 } },
+                        { .type = GEOMETRY_TRIANGLE, .triangle = { { 30, 30 }, { 31, 30 }, { 30, 31 } } }
+                    };
+    geometry_rtree *p_rtree       = (void *) 0;
+    size_t          _results[2]   = { 0 },
+                    quantity      = 0;
+    double          _distances[2] = { 0 };
+
+    // Construct
+    GEOMETRY_TEST(geometry_rtree_construct(&p_rtree, _lines, 3) == 1);
+
+    // A line inside of the envelope of the polygon is further than a line outside of it
+    GEOMETRY_TEST(geometry_rtree_nearest(p_rtree, &_query, 2, _results, _distances, &quantity) == 1);
+    GEOMETRY_TEST(quantity == 2 && _results[0] == 1 && _results[1] == 0);
+    GEOMETRY_TEST(fabs(_distances[0] - 2.0) < 1e-12 && fabs(_distances[1] - 6.0 / sqrt(2.0)) < 1e-12);
+
+    // Destroy
+    GEOMETRY_TEST(geometry_rtree_destroy(&p_rtree) == 1);
+
+    // Done
+    return;
+}
+
+void geometry_test_stream_trailing ( void )
+{
+
+    // Initialized data
+    geometry _geometry = { 0 };
+
+    // Whitespace may follow the array
+    GEOMETRY_TEST(geometry_test_stream_polygon(&_geometry, "[[0,0],[4,0],[4,4]] \n\t") == 1);
+    GEOMETRY_TEST(_geometry.type == GEOMETRY_POLYGON && _geometry.polygon.quantity == 3);
+    GEOMETRY_TEST(geometry_destroy(&_geometry) == 1);
+
+    // Anything else is an error
+    GEOMETRY_TEST(geometry_test_stream_polygon(&_geometry, "[[0,0],[4,0],[4,4]]x") == 0);
+    GEOMETRY_TEST(geometry_test_stream_polygon(&_geometry, "[[0,0],[4,0],[4,4]] ]") == 0);
+    GEOMETRY_TEST(geometry_test_stream_polygon(&_geometry, "[[0,0],[4,0],[4,4]][[1,1]]") == 0);
+
+    // Done
+    return;
+}
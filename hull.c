@@ -0,0 +1,451 @@
+/** !
+ * Convex hull
+ *
+ * @file hull.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <string.h>
+
+// Header
+#include <geometry/hull.h>
+#include <geometry/arena.h>
+#include <geometry/parallel.h>
+
+// Structure declarations
+struct geometry_hull_s;
+
+// Type definitions
+typedef struct geometry_hull_s geometry_hull;
+
+// Structure definitions
+// The survivors of chunk i are stored in p_work from the chunk's first
+// index, and its partial hull in p_hulls from its first index plus i, so
+// that each partial hull has room for the closing vertex of the chain.
+struct geometry_hull_s
+{
+    geometry_point *p_points,
+                   *p_work,
+                   *p_hulls;
+    geometry_point  octagon[8];
+    size_t          octagon_quantity,
+                    counts[GEOMETRY_PARALLEL_THREADS_MAX];
+};
+
+// Data
+// Eight directions, counterclockwise from -x
+static const double geometry_hull_directions[8][2] =
+{
+    { -1,  0 }, { -1, -1 }, {  0, -1 }, {  1, -1 },
+    {  1,  0 }, {  1,  1 }, {  0,  1 }, { -1,  1 }
+};
+
+// Forward declarations
+/** !
+ * Find the extreme points of a chunk in eight directions, counterclockwise
+ * from -x
+ *
+ * @param first       the first point of the chunk
+ * @param last        one past the last point of the chunk
+ * @param p_partial   the extreme points; each is a candidate on entry
+ * @param p_parameter the hull
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_hull_extremes ( size_t first, size_t last, void *p_partial, void *p_parameter );
+
+/** !
+ * Keep the further of two extreme points in each direction
+ *
+ * @param p_result    the extreme points
+ * @param p_partial   the extreme points of a chunk
+ * @param p_parameter the hull
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_hull_extremes_combine ( void *p_result, const void *p_partial, void *p_parameter );
+
+/** !
+ * Discard the points of a chunk inside of the octagon, then sort and hull
+ * the rest
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first point of the chunk
+ * @param last        one past the last point of the chunk
+ * @param p_parameter the hull
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_hull_partial ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Sort points, and drop duplicates
+ *
+ * @param p_points the points
+ * @param quantity the quantity of points
+ *
+ * @return the quantity of distinct points
+ */
+static size_t geometry_hull_sort ( geometry_point *p_points, size_t quantity );
+
+/** !
+ * Compute the hull of sorted, distinct points with the monotone chain
+ *
+ * @param p_points the points
+ * @param quantity the quantity of points
+ * @param p_result return; must have room for quantity + 1 verticies
+ *
+ * @return the quantity of verticies of the hull
+ */
+static size_t geometry_hull_chain ( geometry_point *p_points, size_t quantity, geometry_point *p_result );
+
+/** !
+ * qsort comparator for points, by x and then by y
+ *
+ * @param p_a a point
+ * @param p_b another point
+ *
+ * @return < 0 if A is first, > 0 if B is first, else 0
+ */
+static int geometry_hull_point_compare ( const void *p_a, const void *p_b );
+
+// Function definitions
+int geometry_point_list_convex_hull ( geometry_point_list *p_point_list, geometry_polygon *p_result, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_point_list == (void *) 0 ) goto no_point_list;
+    if ( p_result     == (void *) 0 ) goto no_result;
+    if ( p_point_list->quantity && p_point_list->p_points == (void *) 0 ) goto no_points;
+
+    // Initialized data
+    geometry_hull  *p_hull      = (void *) 0;
+    geometry_point *p_verticies = (void *) 0,
+                    extremes[8];
+    size_t          quantity    = p_point_list->quantity,
+                    chunks      = geometry_parallel_chunks(quantity, GEOMETRY_HULL_GRAIN),
+                    merged      = 0,
+                    hull        = 0;
+
+    // Empty point list
+    if ( quantity == 0 )
+    {
+
+        // Store an empty polygon
+        *p_result = (geometry_polygon) { .quantity = 0, .p_verticies = (void *) 0 };
+
+        // Success
+        return 1;
+    }
+
+    // Allocate the state. The work and hull buffers follow it.
+    p_hull = GEOMETRY_REALLOC(0, sizeof(geometry_hull) + sizeof(geometry_point) * ( 2 * quantity + chunks ));
+
+    // Error check
+    if ( p_hull == (void *) 0 ) goto no_mem;
+
+    // Store the buffers
+    p_hull->p_points = p_point_list->p_points,
+    p_hull->p_work   = (geometry_point *) ( p_hull + 1 ),
+    p_hull->p_hulls  = p_hull->p_work + quantity;
+
+    // Find the extreme points, starting from the first point
+    for (size_t k = 0; k < 8; k++)
+        extremes[k] = p_hull->p_points[0];
+    if ( geometry_parallel_reduce(quantity, GEOMETRY_HULL_GRAIN, sizeof(extremes), geometry_hull_extremes, geometry_hull_extremes_combine, extremes, p_hull) == 0 ) goto failed_to_run_tasks;
+
+    // Store the extreme points as the octagon
+    p_hull->octagon_quantity = 0;
+    for (size_t k = 0; k < 8; k++)
+    {
+
+        // Initialized data
+        geometry_point best = extremes[k];
+
+        // Skip repeated verticies
+        if ( p_hull->octagon_quantity && p_hull->octagon[p_hull->octagon_quantity - 1].x == best.x && p_hull->octagon[p_hull->octagon_quantity - 1].y == best.y ) continue;
+
+        // Store the vertex
+        p_hull->octagon[p_hull->octagon_quantity++] = best;
+    }
+
+    // The last vertex may repeat the first
+    while ( p_hull->octagon_quantity > 1 && p_hull->octagon[p_hull->octagon_quantity - 1].x == p_hull->octagon[0].x && p_hull->octagon[p_hull->octagon_quantity - 1].y == p_hull->octagon[0].y ) p_hull->octagon_quantity--;
+
+    // Filter, sort and hull each chunk
+    if ( geometry_parallel_for(quantity, GEOMETRY_HULL_GRAIN, geometry_hull_partial, p_hull) == 0 ) goto failed_to_run_tasks;
+
+    // Gather the partial hulls
+    for (size_t c = 0; c < chunks; c++)
+    {
+
+        // Initialized data
+        size_t first = quantity / chunks * c + ( ( c < quantity % chunks ) ? c : quantity % chunks );
+
+        // Copy the partial hull
+        memmove(&p_hull->p_work[merged], &p_hull->p_hulls[first + c], sizeof(geometry_point) * p_hull->counts[c]);
+
+        // Accumulate
+        merged += p_hull->counts[c];
+    }
+
+    // Hull the partial hulls
+    merged = geometry_hull_sort(p_hull->p_work, merged),
+    hull   = geometry_hull_chain(p_hull->p_work, merged, p_hull->p_hulls);
+
+    // Allocate the verticies
+    p_verticies = geometry_allocate(p_arena, sizeof(geometry_point) * hull);
+
+    // Error check
+    if ( p_verticies == (void *) 0 ) goto no_mem;
+
+    // Copy the verticies
+    memcpy(p_verticies, p_hull->p_hulls, sizeof(geometry_point) * hull);
+
+    // Return the hull to the caller
+    *p_result = (geometry_polygon) { .quantity = hull, .p_verticies = p_verticies };
+
+    // Clean up
+    p_hull = GEOMETRY_REALLOC(p_hull, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_point_list:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_points:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_point_list\" has no points in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_run_tasks:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to run parallel tasks in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                p_hull = GEOMETRY_REALLOC(p_hull, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( p_hull ) p_hull = GEOMETRY_REALLOC(p_hull, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_hull_extremes ( size_t first, size_t last, void *p_partial, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_hull  *p_hull   = p_parameter;
+    geometry_point *p_points = p_hull->p_points,
+                   *p_best   = p_partial;
+    double          best[8];
+
+    // Start from the candidates
+    for (size_t k = 0; k < 8; k++)
+        best[k] = geometry_hull_directions[k][0] * p_best[k].x + geometry_hull_directions[k][1] * p_best[k].y;
+
+    // Find the furthest point in each direction
+    for (size_t i = first; i < last; i++)
+    {
+
+        // Initialized data
+        geometry_point p = p_points[i];
+
+        // Keep the further point
+        for (size_t k = 0; k < 8; k++)
+        {
+
+            // Initialized data
+            double score = geometry_hull_directions[k][0] * p.x + geometry_hull_directions[k][1] * p.y;
+
+            // Further
+            if ( score > best[k] ) best[k] = score, p_best[k] = p;
+        }
+    }
+
+    // Success
+    return 1;
+}
+
+static int geometry_hull_extremes_combine ( void *p_result, const void *p_partial, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_point       *p_best  = p_result;
+    const geometry_point *p_other = p_partial;
+
+    // Unused
+    (void) p_parameter;
+
+    // Keep the further point in each direction
+    for (size_t k = 0; k < 8; k++)
+    {
+
+        // Initialized data
+        double dx = geometry_hull_directions[k][0],
+               dy = geometry_hull_directions[k][1];
+
+        // Further
+        if ( dx * p_other[k].x + dy * p_other[k].y > dx * p_best[k].x + dy * p_best[k].y ) p_best[k] = p_other[k];
+    }
+
+    // Success
+    return 1;
+}
+
+static int geometry_hull_partial ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_hull  *p_hull    = p_parameter;
+    geometry_point *p_work    = &p_hull->p_work[first],
+                   *p_octagon = p_hull->octagon;
+    size_t          octagon   = p_hull->octagon_quantity,
+                    kept      = 0;
+
+    // Keep the points that are not strictly inside of the octagon. The
+    // octagon's verticies are points of the list, so it is inside of the
+    // hull, and no point strictly inside of it is a vertex of the hull.
+    for (size_t i = first; i < last; i++)
+    {
+
+        // Initialized data
+        geometry_point *p_point = &p_hull->p_points[i];
+        bool            inside  = ( octagon >= 3 );
+
+        // Test each edge of the octagon
+        for (size_t j = 0; j < octagon && inside; j++)
+            inside = geometry_point_ccw(&p_octagon[j], &p_octagon[( j + 1 ) % octagon], p_point) > 0;
+
+        // Keep the point
+        if ( inside == false ) p_work[kept++] = *p_point;
+    }
+
+    // Sort, and drop duplicates
+    kept = geometry_hull_sort(p_work, kept);
+
+    // Hull the chunk
+    p_hull->counts[chunk] = geometry_hull_chain(p_work, kept, &p_hull->p_hulls[first + chunk]);
+
+    // Success
+    return 1;
+}
+
+static size_t geometry_hull_sort ( geometry_point *p_points, size_t quantity )
+{
+
+    // Initialized data
+    size_t ret = 0;
+
+    // Sort
+    qsort(p_points, quantity, sizeof(geometry_point), geometry_hull_point_compare);
+
+    // Drop duplicates
+    for (size_t i = 0; i < quantity; i++)
+        if ( ret == 0 || p_points[i].x != p_points[ret - 1].x || p_points[i].y != p_points[ret - 1].y )
+            p_points[ret++] = p_points[i];
+
+    // Success
+    return ret;
+}
+
+static size_t geometry_hull_chain ( geometry_point *p_points, size_t quantity, geometry_point *p_result )
+{
+
+    // Initialized data
+    size_t k = 0;
+
+    // One or two points are their own hull
+    if ( quantity < 3 )
+    {
+
+        // Copy the points
+        for (size_t i = 0; i < quantity; i++)
+            p_result[i] = p_points[i];
+
+        // Success
+        return quantity;
+    }
+
+    // Lower hull, left to right
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Drop verticies that do not turn left
+        while ( k >= 2 && geometry_point_ccw(&p_result[k - 2], &p_result[k - 1], &p_points[i]) <= 0 ) k--;
+
+        // Push the point
+        p_result[k++] = p_points[i];
+    }
+
+    // Upper hull, right to left
+    for (size_t i = quantity - 1, t = k + 1; i-- > 0;)
+    {
+
+        // Drop verticies that do not turn left
+        while ( k >= t && geometry_point_ccw(&p_result[k - 2], &p_result[k - 1], &p_points[i]) <= 0 ) k--;
+
+        // Push the point
+        p_result[k++] = p_points[i];
+    }
+
+    // The last vertex repeats the first
+    return k - 1;
+}
+
+static int geometry_hull_point_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_point *p_x = p_a,
+                         *p_y = p_b;
+
+    // Compare x
+    if ( p_x->x < p_y->x ) return -1;
+    if ( p_x->x > p_y->x ) return  1;
+
+    // Compare y
+    return ( p_x->y > p_y->y ) - ( p_x->y < p_y->y );
+}
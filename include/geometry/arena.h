@@ -0,0 +1,137 @@
+/** !
+ * Geometry arena allocator header
+ *
+ * @file geometry/arena.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Arena allocations are aligned for 256 bit vector loads
+#ifndef GEOMETRY_ARENA_ALIGNMENT
+#define GEOMETRY_ARENA_ALIGNMENT 32
+#endif
+
+// Default block size
+#ifndef GEOMETRY_ARENA_BLOCK_SIZE
+#define GEOMETRY_ARENA_BLOCK_SIZE 65536
+#endif
+
+// Structure declarations
+struct geometry_arena_block_s;
+struct geometry_arena_statistics_s;
+
+// Type definitions
+typedef struct geometry_arena_block_s      geometry_arena_block;
+typedef struct geometry_arena_statistics_s geometry_arena_statistics;
+
+// Structure definitions
+struct geometry_arena_block_s
+{
+    geometry_arena_block *p_next;
+    size_t                size,
+                          used;
+    unsigned char         data[];
+};
+
+struct geometry_arena_statistics_s
+{
+    size_t allocations,     // allocations since the last reset
+           bytes_requested, // bytes requested since the last reset
+           bytes_used,      // bytes consumed since the last reset, including alignment
+           bytes_reserved,  // bytes held in blocks
+           high_water,      // largest value of bytes_used over the life of the arena
+           blocks,          // blocks held by the arena
+           resets;          // resets over the life of the arena
+};
+
+struct geometry_arena_s
+{
+    size_t                     block_size;
+    geometry_arena_block      *p_head,
+                              *p_current;
+    geometry_arena_statistics  statistics;
+};
+
+// Function declarations
+
+// Allocators
+/** !
+ * Allocate an arena
+ *
+ * @param pp_arena   return
+ * @param block_size the size of each block, in bytes, or 0 for GEOMETRY_ARENA_BLOCK_SIZE
+ *
+ * @sa geometry_arena_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_arena_create ( geometry_arena **pp_arena, size_t block_size );
+
+// Accessors
+/** !
+ * Get the statistics of an arena
+ *
+ * @param p_arena      the arena
+ * @param p_statistics return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_arena_statistics_get ( geometry_arena *p_arena, geometry_arena_statistics *p_statistics );
+
+// Mutators
+/** !
+ * Bump allocate memory from an arena. The memory is aligned to
+ * GEOMETRY_ARENA_ALIGNMENT bytes, and lives until the arena is
+ * reset or destroyed.
+ *
+ * @param p_arena   the arena
+ * @param size      the size of the allocation, in bytes
+ * @param pp_memory return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_arena_allocate ( geometry_arena *p_arena, size_t size, void **pp_memory );
+
+/** !
+ * Release every allocation in an arena in constant time. The blocks are
+ * kept, so the next batch of geometry reuses them.
+ *
+ * @param p_arena the arena
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_arena_reset ( geometry_arena *p_arena );
+
+/** !
+ * Allocate memory from an arena, or from GEOMETRY_REALLOC if the arena
+ * is null. Constructors use this, so they can build geometry either way.
+ *
+ * @param p_arena the arena, or null for the heap
+ * @param size    the size of the allocation, in bytes
+ *
+ * @return pointer to memory on success, null on error
+ */
+DLLEXPORT void *geometry_allocate ( geometry_arena *p_arena, size_t size );
+
+// Destructors
+/** !
+ * Release an arena, and every block it holds
+ *
+ * @param pp_arena pointer to arena pointer
+ *
+ * @sa geometry_arena_create
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_arena_destroy ( geometry_arena **pp_arena );
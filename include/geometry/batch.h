@@ -0,0 +1,109 @@
+/** !
+ * Batched geometry kernels header
+ *
+ * @file geometry/batch.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Structure declarations
+struct geometry_point_list_soa_s;
+
+// Type definitions
+typedef struct geometry_point_list_soa_s geometry_point_list_soa;
+
+// Structure definitions
+struct geometry_point_list_soa_s
+{
+    size_t  quantity;
+    double *p_x,
+           *p_y;
+};
+
+// Function declarations
+
+// Constructors
+/** !
+ * Construct a structure of arrays point list from a point list. The x
+ * and y coordinates are stored in two contiguous arrays, so the batched
+ * kernels can stream through them with vector loads.
+ *
+ * @param p_soa        return
+ * @param p_point_list the point list
+ * @param p_arena      the arena, or null for the heap
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_point_list_soa_construct ( geometry_point_list_soa *p_soa, geometry_point_list *p_point_list, geometry_arena *p_arena );
+
+// Batched operations
+/** !
+ * Compute the distance from a point to each point in a point list
+ *
+ * @param p_soa     the point list
+ * @param p_point   the point
+ * @param p_results return; must have room for p_soa->quantity values
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_point_list_soa_distances ( geometry_point_list_soa *p_soa, geometry_point *p_point, double *p_results );
+
+/** !
+ * Find the point in a point list nearest to a point
+ *
+ * @param p_soa      the point list
+ * @param p_point    the point
+ * @param p_index    return; the index of the nearest point
+ * @param p_distance return; the distance to the nearest point. May be null.
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_point_list_soa_nearest ( geometry_point_list_soa *p_soa, geometry_point *p_point, size_t *p_index, double *p_distance );
+
+/** !
+ * Compute the distance from a line to each point in a point list
+ *
+ * @param p_soa     the point list
+ * @param p_line    the line
+ * @param p_results return; must have room for p_soa->quantity values
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_point_list_soa_line_distances ( geometry_point_list_soa *p_soa, geometry_line *p_line, double *p_results );
+
+/** !
+ * Test if each point in a point list is inside of a polygon, with the
+ * crossing number rule of geometry_point_in_polygon. Each edge of the
+ * polygon is tested against several points at once, and each result is
+ * the same as geometry_point_in_polygon would give for that point.
+ *
+ * @param p_soa     the point list
+ * @param p_polygon the polygon
+ * @param p_results return; must have room for p_soa->quantity values
+ *
+ * @sa geometry_point_in_polygon
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_point_list_soa_in_polygon ( geometry_point_list_soa *p_soa, geometry_polygon *p_polygon, bool *p_results );
+
+// Destructors
+/** !
+ * Release the coordinate arrays of a structure of arrays point list built
+ * on the heap
+ *
+ * @param p_soa the point list
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_point_list_soa_destroy ( geometry_point_list_soa *p_soa );
@@ -0,0 +1,74 @@
+/** !
+ * Polygon boolean operations header
+ *
+ * Polygons and polygon lists are overlaid in three steps. First, the
+ * edges of both operands are cut where they meet, with the plane sweep
+ * of geometry/sweep.h. Next, each piece of an edge is labeled with which
+ * side of it is inside of each operand. Pieces that are inside on the
+ * edge of the other operand are found with prepared polygons. Last, the
+ * pieces with the result inside on exactly one side are linked into
+ * rings. The intersection of two convex polygons is computed directly,
+ * in linear time, by walking both boundaries at once.
+ *
+ * The rings of a polygon list are combined by the even odd rule, so a
+ * ring inside of another ring is a hole. The rings of a result are
+ * counterclockwise, except for holes, which are clockwise. Summing the
+ * signed areas of the rings gives the area of the result.
+ *
+ * @file geometry/boolean.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Enumeration definitions
+enum geometry_boolean_e
+{
+    GEOMETRY_BOOLEAN_INTERSECTION         = 0,
+    GEOMETRY_BOOLEAN_UNION                = 1,
+    GEOMETRY_BOOLEAN_DIFFERENCE           = 2,
+    GEOMETRY_BOOLEAN_SYMMETRIC_DIFFERENCE = 3,
+    GEOMETRY_BOOLEAN_QUANTITY             = 4
+};
+
+// Function declarations
+
+// Operations
+/** !
+ * Compute a boolean operation of two polygons or polygon lists. The
+ * result is a polygon list.
+ *
+ * @param p_a       a polygon or polygon list
+ * @param p_b       another polygon or polygon list
+ * @param operation the operation
+ * @param p_result  return
+ * @param p_arena   the arena, or null for the heap
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_boolean ( geometry *p_a, geometry *p_b, enum geometry_boolean_e operation, geometry *p_result, geometry_arena *p_arena );
+
+/** !
+ * Compute the intersection of two polygons or polygon lists. The result
+ * is a polygon list, allocated on the heap. The kernel is found in the
+ * dispatch table of geometry/dispatch.h.
+ *
+ * @param p_a      a polygon or polygon list
+ * @param p_b      another polygon or polygon list
+ * @param p_result return
+ *
+ * @sa geometry_boolean
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_intersection ( geometry *p_a, geometry *p_b, geometry *p_result );
@@ -0,0 +1,92 @@
+/** !
+ * Dispatch header
+ *
+ * The binary operations of geometry/geometry.h find their kernel in a
+ * table indexed by the operation and the types of both geometries, and
+ * call it. Neither type is switched on, so an operation costs one lookup
+ * and its kernel. Callers that know their types can call a kernel
+ * directly, like geometry_point_polygon_distance.
+ *
+ * A kernel registered for the types (a, b) of a symmetric operation also
+ * serves the types (b, a), and is called with the geometries swapped.
+ * Each operation but contains is symmetric. The last kernel registered
+ * for a pair of types is used, so a kernel registered for (b, a) after
+ * (a, b) replaces the swap. Pairs without a kernel are not supported.
+ *
+ * The kernels of the library are registered the first time the table is
+ * used, so the operations work without geometry_init. Other kernels may
+ * be registered at any time before the operations are used on more than
+ * one thread, and replace the kernels of the library.
+ *
+ * @file geometry/dispatch.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Enumeration definitions
+enum geometry_operation_e
+{
+    GEOMETRY_OPERATION_DISTANCE     = 0,
+    GEOMETRY_OPERATION_EQUALS       = 1,
+    GEOMETRY_OPERATION_DISJOINT     = 2,
+    GEOMETRY_OPERATION_INTERSECTS   = 3,
+    GEOMETRY_OPERATION_TOUCHES      = 4,
+    GEOMETRY_OPERATION_CROSSES      = 5,
+    GEOMETRY_OPERATION_OVERLAPS     = 6,
+    GEOMETRY_OPERATION_CONTAINS     = 7,
+    GEOMETRY_OPERATION_INTERSECTION = 8,
+    GEOMETRY_OPERATION_QUANTITY     = 9
+};
+
+// Union declarations
+union geometry_kernel_u;
+
+// Type definitions
+typedef union geometry_kernel_u geometry_kernel;
+
+// Union definitions
+// The kernel of an operation. Distance uses pfn_distance, intersection
+// uses pfn_intersection, and the predicates use pfn_predicate.
+union geometry_kernel_u
+{
+    fn_geometry_distance     pfn_distance;
+    fn_geometry_contains     pfn_predicate;
+    fn_geometry_intersection pfn_intersection;
+};
+
+// Function declarations
+
+// Initializers
+/** !
+ * Register the kernels of the library, if they are not registered yet.
+ * Called by geometry_init, and safe to call more than once.
+ *
+ * @param void
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_dispatch_init ( void );
+
+// Mutators
+/** !
+ * Register the kernel of an operation for a pair of types
+ *
+ * @param operation the operation
+ * @param a         the type of the first geometry
+ * @param b         the type of the second geometry
+ * @param kernel    the kernel
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_dispatch_register ( enum geometry_operation_e operation, enum geometry_type_e a, enum geometry_type_e b, geometry_kernel kernel );
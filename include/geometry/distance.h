@@ -0,0 +1,98 @@
+/** !
+ * Point list distance header
+ *
+ * Distance matrices are computed in tiles. A tile is a block of rows of
+ * the first point list and a block of columns of the second, small enough
+ * that the columns stay in cache while each row of the block is compared
+ * against them with the vector kernels of geometry/batch.h. The blocks of
+ * rows are split between threads. The pairs within a distance skip each
+ * tile whose envelopes are further apart than the distance, so point
+ * lists in spatial order skip most tiles.
+ *
+ * The closest pair of a point list is found by divide and conquer. The
+ * points are sorted by x in chunks on their own threads, and the sorted
+ * chunks are merged in parallel. Each chunk of the sorted points then
+ * finds its own closest pair, and the pairs that straddle a boundary
+ * between chunks are found in a strip around the boundary.
+ *
+ * @file geometry/distance.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// The quantity of rows in a tile
+#define GEOMETRY_DISTANCE_TILE_ROWS 64
+
+// The quantity of columns in a tile
+#define GEOMETRY_DISTANCE_TILE_COLUMNS 1024
+
+// Matrices with fewer entries than this are computed on one thread
+#define GEOMETRY_DISTANCE_GRAIN 65536
+
+// Point lists smaller than this find their closest pair on one thread
+#define GEOMETRY_CLOSEST_PAIR_GRAIN 16384
+
+// Structure declarations
+struct geometry_distance_pair_s;
+
+// Type definitions
+typedef struct geometry_distance_pair_s geometry_distance_pair;
+
+// Structure definitions
+struct geometry_distance_pair_s
+{
+    size_t a,
+           b;
+    double distance;
+};
+
+// Function declarations
+
+// Operations
+/** !
+ * Compute the distance from each point of a point list to each point of
+ * another point list. Entry [i][j] of the matrix is the distance from
+ * point i of p_a to point j of p_b, and the matrix is stored by rows.
+ *
+ * @param p_a       a point list
+ * @param p_b       another point list
+ * @param p_results return; must have room for p_a->quantity * p_b->quantity values
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_point_list_distance_matrix ( geometry_point_list *p_a, geometry_point_list *p_b, double *p_results );
+
+/** !
+ * Find each pair of a point of a point list and a point of another point
+ * list that are no further apart than a distance. The pairs are sorted
+ * by a, then by b.
+ *
+ * @param p_a        a point list
+ * @param p_b        another point list
+ * @param distance   the distance
+ * @param pp_pairs   return; allocated with GEOMETRY_REALLOC, and released by the caller. Null if there are no pairs.
+ * @param p_quantity return the quantity of pairs
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_point_list_distance_pairs ( geometry_point_list *p_a, geometry_point_list *p_b, double distance, geometry_distance_pair **pp_pairs, size_t *p_quantity );
+
+/** !
+ * Find the closest pair of points of a point list
+ *
+ * @param p_point_list the point list; must have at least two points
+ * @param p_result     return; a is less than b
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_point_list_closest_pair ( geometry_point_list *p_point_list, geometry_distance_pair *p_result );
@@ -60,15 +60,16 @@
 // Enumeration definitions
 enum geometry_type_e
 {
-    GEOMETRY_INVALID      = 0,
-    GEOMETRY_POINT        = 1,
-    GEOMETRY_POINT_LIST   = 2,
-    GEOMETRY_LINE         = 3,
-    GEOMETRY_LINE_LIST    = 4,
-    GEOMETRY_TRIANGLE     = 5,
-    GEOMETRY_RECTANGLE    = 6,
-    GEOMETRY_POLYGON      = 7,
-    GEOMETRY_POLYGON_LIST = 8,
+    GEOMETRY_INVALID       = 0,
+    GEOMETRY_POINT         = 1,
+    GEOMETRY_POINT_LIST    = 2,
+    GEOMETRY_LINE          = 3,
+    GEOMETRY_LINE_LIST     = 4,
+    GEOMETRY_TRIANGLE      = 5,
+    GEOMETRY_RECTANGLE     = 6,
+    GEOMETRY_POLYGON       = 7,
+    GEOMETRY_POLYGON_LIST  = 8,
+    GEOMETRY_TYPE_QUANTITY = 9
 };
 
 // Structure declarations
@@ -76,18 +77,24 @@ struct geometry_point_s;
 struct geometry_point_list_s;
 struct geometry_line_s;
 struct geometry_line_list_s;
+struct geometry_triangle_s;
 struct geometry_polygon_s;
 struct geometry_polygon_list_s;
+struct geometry_envelope_s;
 struct geometry_s;
+struct geometry_arena_s;
 
 // Type definitions
 typedef struct geometry_point_s        geometry_point;
 typedef struct geometry_point_list_s   geometry_point_list;
 typedef struct geometry_line_s         geometry_line;
 typedef struct geometry_line_list_s    geometry_line_list;
+typedef struct geometry_triangle_s     geometry_triangle;
 typedef struct geometry_polygon_s      geometry_polygon;
 typedef struct geometry_polygon_list_s geometry_polygon_list;
+typedef struct geometry_envelope_s     geometry_envelope;
 typedef struct geometry_s              geometry;
+typedef struct geometry_arena_s        geometry_arena;
 
 typedef int (*fn_geometry_distance)     (geometry *p_a, geometry *p_b, double *p_return);
 typedef int (*fn_geometry_equals)       (geometry *p_a, geometry *p_b, bool   *p_return);
@@ -127,18 +134,39 @@ struct geometry_line_list_s
     geometry_line *p_lines;
 };
 
+struct geometry_triangle_s
+{
+    geometry_point a, b, c;
+};
+
 struct geometry_polygon_s
 {
     size_t quantity;
     geometry_point *p_verticies;
 };
 
+// Polygon lists are stored compressed sparse row style. The verticies of
+// every polygon are packed into one buffer, and polygon i is the range
+// [ p_offsets[i], p_offsets[i + 1] ) of that buffer.
 struct geometry_polygon_list_s
 {
     size_t quantity;
-    geometry_polygon *p_polygons;
+    size_t vertex_quantity;
+    size_t *p_offsets;
+    geometry_point *p_verticies;
+};
+
+// An axis aligned bounding box. Empty geometry has an inverted envelope,
+// with min = +infinity and max = -infinity, which overlaps nothing.
+struct geometry_envelope_s
+{
+    double x_min, y_min,
+           x_max, y_max;
 };
 
+// The envelope is computed on first use and cached. Code that modifies
+// the coordinates of a geometry in place must call
+// geometry_envelope_invalidate afterwards.
 struct geometry_s
 {
     enum geometry_type_e type;
@@ -149,9 +177,13 @@ struct geometry_s
         geometry_point_list   point_list;
         geometry_line         line;
         geometry_line_list    line_list;
+        geometry_triangle     triangle;
         geometry_polygon      polygon;
         geometry_polygon_list polygon_list;
     };
+
+    geometry_envelope envelope;
+    bool              envelope_valid;
 };
 
 // Function declarations
@@ -211,9 +243,68 @@ int geometry_line_construct ( geometry *p_geometry, double x0, double y0, double
  */
 int geometry_polygon_load_as_json ( geometry *p_geometry, json_value *p_value );
 
+/** !
+ * Construct a polygon from a json value, allocating the verticies from an arena
+ * 
+ * @param p_geometry return
+ * @param p_value    the json value 
+ * @param p_arena    the arena, or null for the heap
+ * 
+ * @return 1 on success, 0 on error
+ */
+int geometry_polygon_load_as_json_arena ( geometry *p_geometry, json_value *p_value, geometry_arena *p_arena );
+
+/** !
+ * Construct a polygon list by packing a list of polygons into one vertex buffer
+ * 
+ * @param p_geometry return
+ * @param p_polygons the polygons
+ * @param quantity   the quantity of polygons
+ * @param p_arena    the arena, or null for the heap
+ * 
+ * @return 1 on success, 0 on error
+ */
+int geometry_polygon_list_construct ( geometry *p_geometry, geometry_polygon *p_polygons, size_t quantity, geometry_arena *p_arena );
+
+/** !
+ * Construct a polygon list from a json array of polygons
+ * 
+ * @param p_geometry return
+ * @param p_value    the json value 
+ * 
+ * @return 1 on success, 0 on error
+ */
+int geometry_polygon_list_load_as_json ( geometry *p_geometry, json_value *p_value );
+
+/** !
+ * Construct a polygon list from a json array of polygons, allocating the
+ * verticies from an arena
+ * 
+ * @param p_geometry return
+ * @param p_value    the json value 
+ * @param p_arena    the arena, or null for the heap
+ * 
+ * @return 1 on success, 0 on error
+ */
+int geometry_polygon_list_load_as_json_arena ( geometry *p_geometry, json_value *p_value, geometry_arena *p_arena );
+
+// Accessors
+/** !
+ * Get a view of a polygon in a polygon list. The view points into the
+ * vertex buffer of the polygon list, and must not be destroyed.
+ * 
+ * @param p_polygon_list the polygon list
+ * @param index          the index of the polygon
+ * @param p_polygon      return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int geometry_polygon_list_polygon ( geometry_polygon_list *p_polygon_list, size_t index, geometry_polygon *p_polygon );
+
 // Geometric operations
 /** !
- * Compute the area of a geometry
+ * Compute the area of a geometry. A ring of a polygon list inside of an
+ * odd quantity of other rings is a hole, and its area is subtracted.
  * 
  * @param p_geometry the area
  * @param p_result   return
@@ -233,7 +324,36 @@ int geometry_area ( geometry *p_geometry, double *p_result );
 int geometry_polygon_area ( geometry_polygon *p_polygon, double *p_result );
 
 /** !
- * Compute the distance between two geometries
+ * Compute the length of a geometry. The length of a triangle, polygon or
+ * polygon list is its perimeter.
+ * 
+ * @param p_geometry the geometry
+ * @param p_result   return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_length ( geometry *p_geometry, double *p_result );
+
+/** !
+ * Compute the centroid of a geometry. Areas are weighted by area, lines by
+ * length, and points equally. The rings of a polygon list are weighted by
+ * area, and holes weigh against the centroid. Geometry with no area is
+ * weighted as its edges, and empty geometry has a centroid that is not a
+ * number.
+ * 
+ * @param p_geometry the geometry
+ * @param p_result   return; a point
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_centroid ( geometry *p_geometry, geometry *p_result );
+
+/** !
+ * Compute the distance between two geometries. The kernel is looked up
+ * by the types of the pair in the dispatch table of geometry/dispatch.h.
+ * The distance between any two geometries but rectangles is supported.
+ * Geometry that intersects, or that contains the other, is no distance
+ * apart.
  * 
  * @param p_a      the first geometry
  * @param p_b      the second geometry
@@ -243,6 +363,235 @@ int geometry_polygon_area ( geometry_polygon *p_polygon, double *p_result );
 */
 int geometry_distance ( geometry *p_a, geometry *p_b, double *p_result );
 
+/** !
+ * Compute the distance between two points
+ * 
+ * @param p_a      a point
+ * @param p_b      another point
+ * @param p_result return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_point_point_distance ( geometry_point *p_a, geometry_point *p_b, double *p_result );
+
+/** !
+ * Compute the distance from a point to the nearest point of a point list.
+ * An empty point list is infinitely far away.
+ * 
+ * @param p_point      the point
+ * @param p_point_list the point list
+ * @param p_result     return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_point_point_list_distance ( geometry_point *p_point, geometry_point_list *p_point_list, double *p_result );
+
+/** !
+ * Compute the distance from a point to a line
+ * 
+ * @param p_point  the point
+ * @param p_line   the line
+ * @param p_result return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_point_line_distance ( geometry_point *p_point, geometry_line *p_line, double *p_result );
+
+/** !
+ * Compute the distance from a point to the nearest line of a line list.
+ * An empty line list is infinitely far away.
+ * 
+ * @param p_point     the point
+ * @param p_line_list the line list
+ * @param p_result    return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_point_line_list_distance ( geometry_point *p_point, geometry_line_list *p_line_list, double *p_result );
+
+/** !
+ * Compute the distance from a point to a triangle. Points inside of the
+ * triangle are no distance away.
+ * 
+ * @param p_point    the point
+ * @param p_triangle the triangle
+ * @param p_result   return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_point_triangle_distance ( geometry_point *p_point, geometry_triangle *p_triangle, double *p_result );
+
+/** !
+ * Compute the distance from a point to a polygon. Points inside of the
+ * polygon, by the crossing number rule, are no distance away.
+ * 
+ * @param p_point   the point
+ * @param p_polygon the polygon
+ * @param p_result  return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_point_polygon_distance ( geometry_point *p_point, geometry_polygon *p_polygon, double *p_result );
+
+/** !
+ * Compute the distance from a point to the nearest polygon of a polygon
+ * list. A point inside of an odd quantity of rings is no distance away,
+ * and a point inside of a hole is as far as the nearest edge.
+ * 
+ * @param p_point        the point
+ * @param p_polygon_list the polygon list
+ * @param p_result       return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_point_polygon_list_distance ( geometry_point *p_point, geometry_polygon_list *p_polygon_list, double *p_result );
+
+/** !
+ * Test if two geometry are equal, covering the same points
+ * 
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_equals ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if two geometry are disjoint, sharing no point
+ * 
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_disjoint ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if two geometry intersect, sharing any point
+ * 
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_intersects ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if two geometry touch, meeting only on their boundaries
+ * 
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_touches ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if two geometry cross. The interiors meet in less than the greater
+ * dimension of the two, and each geometry leaves the other. Lines cross
+ * at a point inside of both.
+ * 
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_crosses ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if two geometry of the same dimension overlap. The interiors meet
+ * in that dimension, and each geometry leaves the other.
+ * 
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_overlaps ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if a geometry contains another geometry. No point of the other
+ * geometry is outside of the geometry, and the interiors meet.
+ * 
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_contains ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if a point is inside of a polygon, with the crossing number rule
+ * 
+ * @param p_point   the point
+ * @param p_polygon the polygon
+ * @param p_result  return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_point_in_polygon ( geometry_point *p_point, geometry_polygon *p_polygon, bool *p_result );
+
+/** !
+ * Compute the envelope of a geometry
+ * 
+ * @param p_geometry the geometry
+ * @param p_envelope return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_envelope_compute ( geometry *p_geometry, geometry_envelope *p_envelope );
+
+/** !
+ * Get the envelope of a geometry, computing it if it is not cached
+ * 
+ * @param p_geometry the geometry
+ * @param p_envelope return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_envelope_get ( geometry *p_geometry, geometry_envelope *p_envelope );
+
+/** !
+ * Discard the cached envelope of a geometry, after its coordinates change
+ * 
+ * @param p_geometry the geometry
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_envelope_invalidate ( geometry *p_geometry );
+
+/** !
+ * Test if the envelopes of two geometries overlap. Geometry whose
+ * envelopes do not overlap can not intersect.
+ * 
+ * @param p_a      the first geometry
+ * @param p_b      the second geometry
+ * @param p_result return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_envelope_intersects ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if two geometries are within a distance of each other. Pairs whose
+ * envelopes are further apart are rejected without computing the distance.
+ * 
+ * @param p_a      the first geometry
+ * @param p_b      the second geometry
+ * @param distance the distance
+ * @param p_result return
+ * 
+ * @return 1 on success, 0 on error
+*/
+int geometry_distance_within ( geometry *p_a, geometry *p_b, double distance, bool *p_result );
+
 /** !
  * Given three points, determine wether they form a counterclockwise angle.
  * 
@@ -250,10 +599,21 @@ int geometry_distance ( geometry *p_a, geometry *p_b, double *p_result );
  * @param p_b point B
  * @param p_c point C
  * 
- * @return If A -> B -> C is counterclockwise, > 0. If clockwise, < 0. If colinear, 0.  
+ * @return If A -> B -> C is counterclockwise, 1. If clockwise, -1. If colinear, 0.
  */
 int geometry_point_ccw ( geometry_point *p_a, geometry_point *p_b, geometry_point *p_c );
 
+// Destructors
+/** !
+ * Release the memory held by a geometry. Only geometry built on the heap
+ * should be destroyed; arena backed geometry is released with its arena.
+ * 
+ * @param p_geometry the geometry
+ * 
+ * @return 1 on success, 0 on error
+ */
+int geometry_destroy ( geometry *p_geometry );
+
 // Cleanup
 /** !
  * Cleanup the geometry library 
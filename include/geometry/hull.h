@@ -0,0 +1,43 @@
+/** !
+ * Convex hull header
+ *
+ * Hulls are computed with Andrew's monotone chain. Before sorting, the
+ * points strictly inside the octagon of the eight extreme points are
+ * discarded (Akl-Toussaint), which removes most of a large cloud. The
+ * remaining points are split into chunks, each chunk is sorted and hulled
+ * on its own thread, and the hull of the partial hulls is the result.
+ *
+ * @file geometry/hull.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Point lists smaller than this are hulled on one thread
+#define GEOMETRY_HULL_GRAIN 65536
+
+// Function declarations
+
+// Operations
+/** !
+ * Compute the convex hull of a point list. The hull is counterclockwise,
+ * starts at the lowest of the leftmost points, and has no colinear
+ * verticies. A single point, or colinear points, give a hull of one or
+ * two verticies.
+ *
+ * @param p_point_list the point list
+ * @param p_result     return
+ * @param p_arena      the arena, or null for the heap
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_point_list_convex_hull ( geometry_point_list *p_point_list, geometry_polygon *p_result, geometry_arena *p_arena );
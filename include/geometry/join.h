@@ -0,0 +1,127 @@
+/** !
+ * Spatial join header
+ *
+ * A spatial join finds each pair (i, j) of geometry i of one array and
+ * geometry j of another array that satisfy a predicate. The envelopes of
+ * both arrays are binned into a uniform grid over the region where they
+ * overlap, and each cell compares the geometry binned in it. A pair whose
+ * envelopes share more than one cell is only tested in the cell holding
+ * the lower left corner of the overlap of their envelopes, so each pair
+ * is reported once without a pass to remove duplicates.
+ *
+ * The cells are processed in rounds. The cells of a round are split
+ * between threads with geometry_parallel_for, and each thread collects
+ * its pairs in its own buffer. The pairs of a round are handed to the
+ * caller before the next round starts, so the memory held by a join does
+ * not grow with the quantity of pairs.
+ *
+ * The envelope of each geometry is cached before the threads start, so
+ * the threads only read the geometry.
+ *
+ * @file geometry/join.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// The grid has about one cell for this many geometries
+#define GEOMETRY_JOIN_CELL_LOAD 8
+
+// The greatest quantity of columns, or rows, of the grid
+#define GEOMETRY_JOIN_CELLS_MAX 4096
+
+// The quantity of cells in each round
+#define GEOMETRY_JOIN_ROUND 16384
+
+// Rounds with fewer cells than this are joined on one thread
+#define GEOMETRY_JOIN_GRAIN 64
+
+// Arrays with fewer geometries than this get their envelopes on one thread
+#define GEOMETRY_JOIN_ENVELOPE_GRAIN 4096
+
+// Enumeration definitions
+enum geometry_join_predicate_e
+{
+    GEOMETRY_JOIN_INTERSECTS      = 0,
+    GEOMETRY_JOIN_CONTAINS        = 1,
+    GEOMETRY_JOIN_WITHIN_DISTANCE = 2,
+    GEOMETRY_JOIN_QUANTITY        = 3
+};
+
+// Structure declarations
+struct geometry_join_pair_s;
+
+// Type definitions
+typedef struct geometry_join_pair_s geometry_join_pair;
+
+/** !
+ * Receive a pair of a spatial join
+ *
+ * @param a           the index of the geometry of the first array
+ * @param b           the index of the geometry of the second array
+ * @param p_parameter the parameter
+ *
+ * @return 1 to continue, 0 to stop the join with an error
+ */
+typedef int (*fn_geometry_join_callback) ( size_t a, size_t b, void *p_parameter );
+
+// Structure definitions
+struct geometry_join_pair_s
+{
+    size_t a,
+           b;
+};
+
+// Function declarations
+
+// Operations
+/** !
+ * Join two arrays of geometry, and pass each pair that satisfies a
+ * predicate to a callback. The callback is called on the calling thread.
+ * Pairs are passed one round of cells at a time, in no particular order.
+ *
+ * The predicates are geometry_intersects, geometry_contains, with the
+ * geometry of the first array containing the geometry of the second, and
+ * geometry_distance_within.
+ *
+ * @param p_a          an array of geometry
+ * @param a_quantity   the quantity of geometry in p_a
+ * @param p_b          another array of geometry
+ * @param b_quantity   the quantity of geometry in p_b
+ * @param predicate    the predicate
+ * @param distance     the distance of GEOMETRY_JOIN_WITHIN_DISTANCE, else unused
+ * @param pfn_callback the callback
+ * @param p_parameter  the parameter of the callback
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_join_each ( geometry *p_a, size_t a_quantity, geometry *p_b, size_t b_quantity, enum geometry_join_predicate_e predicate, double distance, fn_geometry_join_callback pfn_callback, void *p_parameter );
+
+/** !
+ * Join two arrays of geometry, and store each pair that satisfies a
+ * predicate. The pairs are sorted by a, then by b.
+ *
+ * @param p_a        an array of geometry
+ * @param a_quantity the quantity of geometry in p_a
+ * @param p_b        another array of geometry
+ * @param b_quantity the quantity of geometry in p_b
+ * @param predicate  the predicate
+ * @param distance   the distance of GEOMETRY_JOIN_WITHIN_DISTANCE, else unused
+ * @param pp_pairs   return; allocated with GEOMETRY_REALLOC, and released by the caller. Null if there are no pairs.
+ * @param p_quantity return the quantity of pairs
+ *
+ * @sa geometry_join_each
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_join ( geometry *p_a, size_t a_quantity, geometry *p_b, size_t b_quantity, enum geometry_join_predicate_e predicate, double distance, geometry_join_pair **pp_pairs, size_t *p_quantity );
@@ -0,0 +1,138 @@
+/** !
+ * k-d tree header
+ *
+ * The tree is a copy of the points of a point list, reordered so that
+ * each range of the array is a subtree with its median point in the
+ * middle. Points left of the median are below it on the split axis, and
+ * points right of the median are above it. The axis alternates between x
+ * and y with depth, so the tree needs no nodes or child pointers.
+ *
+ * @file geometry/kdtree.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Subtrees with this many points or fewer are scanned, not split
+#define GEOMETRY_KDTREE_LEAF_SIZE 8
+
+// Subtrees with more points than this build their two sides in parallel
+#define GEOMETRY_KDTREE_GRAIN 16384
+
+// Batches with fewer queries than this are answered on one thread
+#define GEOMETRY_KDTREE_BATCH_GRAIN 1024
+
+// Structure declarations
+struct geometry_kdtree_s;
+
+// Type definitions
+typedef struct geometry_kdtree_s geometry_kdtree;
+
+// Structure definitions
+struct geometry_kdtree_s
+{
+    size_t          quantity;
+    geometry_point *p_points;
+    size_t         *p_indices;
+};
+
+// Function declarations
+
+// Constructors
+/** !
+ * Construct a k-d tree over the points of a point list
+ *
+ * @param pp_kdtree    return
+ * @param p_point_list the point list
+ *
+ * @sa geometry_kdtree_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_kdtree_construct ( geometry_kdtree **pp_kdtree, geometry_point_list *p_point_list );
+
+// Queries
+/** !
+ * Find the k nearest points to a point
+ *
+ * @param p_kdtree    the k-d tree
+ * @param p_point     the point
+ * @param k           the quantity of neighbours
+ * @param p_results   return the indices of the neighbours in the point list, nearest first
+ * @param p_distances return the distances to the neighbours
+ * @param p_quantity  return the quantity of neighbours, at most k
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_kdtree_nearest ( geometry_kdtree *p_kdtree, geometry_point *p_point, size_t k, size_t *p_results, double *p_distances, size_t *p_quantity );
+
+/** !
+ * Find the k nearest points to each of many points. Queries are answered
+ * in Morton order, and each search starts from the neighbours of the
+ * previous query, so nearby queries prune most of the tree at once.
+ *
+ * @param p_kdtree    the k-d tree
+ * @param p_points    the points
+ * @param quantity    the quantity of points
+ * @param k           the quantity of neighbours
+ * @param p_results   return; k indices for each point, nearest first
+ * @param p_distances return; k distances for each point
+ * @param p_counts    return the quantity of neighbours of each point; may be null
+ *
+ * @sa geometry_kdtree_nearest
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_kdtree_nearest_batch ( geometry_kdtree *p_kdtree, geometry_point *p_points, size_t quantity, size_t k, size_t *p_results, double *p_distances, size_t *p_counts );
+
+/** !
+ * Find the points within a distance of a point. If there are more than
+ * capacity results, only the first capacity are stored, but all of them
+ * are counted.
+ *
+ * @param p_kdtree   the k-d tree
+ * @param p_point    the point
+ * @param radius     the distance
+ * @param p_results  return the indices of the points in the point list
+ * @param capacity   the capacity of p_results
+ * @param p_quantity return the quantity of results
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_kdtree_radius ( geometry_kdtree *p_kdtree, geometry_point *p_point, double radius, size_t *p_results, size_t capacity, size_t *p_quantity );
+
+/** !
+ * Find the points inside of an envelope. If there are more than capacity
+ * results, only the first capacity are stored, but all of them are
+ * counted.
+ *
+ * @param p_kdtree   the k-d tree
+ * @param p_envelope the envelope
+ * @param p_results  return the indices of the points in the point list
+ * @param capacity   the capacity of p_results
+ * @param p_quantity return the quantity of results
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_kdtree_envelope ( geometry_kdtree *p_kdtree, geometry_envelope *p_envelope, size_t *p_results, size_t capacity, size_t *p_quantity );
+
+// Destructors
+/** !
+ * Release a k-d tree
+ *
+ * @param pp_kdtree pointer to k-d tree pointer
+ *
+ * @sa geometry_kdtree_construct
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_kdtree_destroy ( geometry_kdtree **pp_kdtree );
@@ -0,0 +1,68 @@
+/** !
+ * Measure header
+ *
+ * The signed area, centroid and perimeter of a ring are computed together,
+ * in one pass over its verticies. The verticies are translated so that the
+ * first vertex is the origin, which keeps the shoelace terms small, and
+ * each sum is compensated (Kahan). Where the instruction set allows, two or
+ * four edges are measured at once, each in its own lane.
+ *
+ * @file geometry/measure.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Polygon lists with fewer polygons than this are measured on one thread
+#define GEOMETRY_MEASURE_GRAIN 4096
+
+// Structure declarations
+struct geometry_measure_s;
+
+// Type definitions
+typedef struct geometry_measure_s geometry_measure;
+
+// Structure definitions
+// The area is positive if the ring is counterclockwise. The centroid of a
+// ring with no area is the centroid of its edges, and the centroid of a
+// ring with no verticies is not a number.
+struct geometry_measure_s
+{
+    double         area,
+                   perimeter;
+    geometry_point centroid;
+};
+
+// Function declarations
+
+// Operations
+/** !
+ * Measure a polygon
+ *
+ * @param p_polygon the polygon
+ * @param p_result  return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_polygon_measure ( geometry_polygon *p_polygon, geometry_measure *p_result );
+
+/** !
+ * Measure each polygon in a polygon list
+ *
+ * @param p_polygon_list the polygon list
+ * @param p_results      return; must have room for p_polygon_list->quantity results
+ *
+ * @sa geometry_polygon_measure
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_polygon_list_measure ( geometry_polygon_list *p_polygon_list, geometry_measure *p_results );
@@ -0,0 +1,151 @@
+/** !
+ * Parallel loop header
+ *
+ * A parallel loop splits the range [0, quantity) into contiguous chunks,
+ * and runs a task on each chunk. The calling thread runs the first chunk.
+ * The chunks of a range depend only on the range, the grain and the
+ * quantity of threads, so a caller can size per chunk results before the
+ * loop.
+ *
+ * The chunks run on an executor owned by the library, which geometry_init
+ * starts and geometry_quit stops. Each thread of the executor has a work
+ * stealing deque. A loop pushes its chunks onto the deque of its thread,
+ * and idle threads steal them, so a loop inside of a task splits its
+ * chunks between the threads without starting any. Until the executor is
+ * started, each loop runs on the calling thread in one chunk.
+ *
+ * The executor uses the quantity of threads in the GEOMETRY_THREADS
+ * environment variable, else one per processor. Each of its threads is
+ * pinned to a processor if GEOMETRY_PIN is 1.
+ *
+ * @file geometry/parallel.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// The maximum quantity of threads in a parallel loop
+#define GEOMETRY_PARALLEL_THREADS_MAX 64
+
+/** !
+ * Run a task on a chunk of a range
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first index of the chunk
+ * @param last        one past the last index of the chunk
+ * @param p_parameter the parameter
+ *
+ * @return 1 on success, 0 on error
+ */
+typedef int (*fn_geometry_parallel_task) ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Reduce a chunk of a range into a partial result
+ *
+ * @param first       the first index of the chunk
+ * @param last        one past the last index of the chunk
+ * @param p_partial   the partial result of the chunk; holds the identity on entry
+ * @param p_parameter the parameter
+ *
+ * @return 1 on success, 0 on error
+ */
+typedef int (*fn_geometry_parallel_reduce_task) ( size_t first, size_t last, void *p_partial, void *p_parameter );
+
+/** !
+ * Combine a partial result into a result
+ *
+ * @param p_result    the result
+ * @param p_partial   the partial result
+ * @param p_parameter the parameter
+ *
+ * @return 1 on success, 0 on error
+ */
+typedef int (*fn_geometry_parallel_combine) ( void *p_result, const void *p_partial, void *p_parameter );
+
+// Function declarations
+
+// Initializers
+/** !
+ * Start the executor. Called by geometry_init.
+ *
+ * @param threads the quantity of threads, counting the caller of each loop, or 0 for the default
+ * @param pin     true to pin each thread of the executor to a processor
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_parallel_init ( size_t threads, bool pin );
+
+// Queries
+/** !
+ * Get the quantity of threads a parallel loop may use
+ *
+ * @param void
+ *
+ * @return the quantity of threads of the executor, or 1 if it is stopped
+ */
+DLLEXPORT size_t geometry_parallel_threads ( void );
+
+/** !
+ * Compute the quantity of chunks a parallel loop splits a range into
+ *
+ * @param quantity the size of the range
+ * @param grain    the smallest chunk worth a thread
+ *
+ * @return the quantity of chunks, at least 1
+ */
+DLLEXPORT size_t geometry_parallel_chunks ( size_t quantity, size_t grain );
+
+// Operations
+/** !
+ * Run a task on each chunk of a range, in parallel
+ *
+ * @param quantity    the size of the range
+ * @param grain       the smallest chunk worth a thread
+ * @param pfn_task    the task
+ * @param p_parameter the parameter of the task
+ *
+ * @sa geometry_parallel_chunks
+ *
+ * @return 1 if every task succeeds, 0 on error
+ */
+DLLEXPORT int geometry_parallel_for ( size_t quantity, size_t grain, fn_geometry_parallel_task pfn_task, void *p_parameter );
+
+/** !
+ * Reduce a range in parallel. Each chunk is reduced into a copy of the
+ * identity, and the partial results are combined into the result in the
+ * order of the chunks.
+ *
+ * @param quantity    the size of the range
+ * @param grain       the smallest chunk worth a thread
+ * @param size        the size of a result, in bytes
+ * @param pfn_task    the reduction of a chunk
+ * @param pfn_combine the combination of a partial result into the result
+ * @param p_result    the result; holds the identity on entry
+ * @param p_parameter the parameter of the task and the combination
+ *
+ * @sa geometry_parallel_for
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_parallel_reduce ( size_t quantity, size_t grain, size_t size, fn_geometry_parallel_reduce_task pfn_task, fn_geometry_parallel_combine pfn_combine, void *p_result, void *p_parameter );
+
+// Cleanup
+/** !
+ * Stop the executor. Called by geometry_quit. Loops after this run on
+ * the calling thread.
+ *
+ * @param void
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_parallel_quit ( void );
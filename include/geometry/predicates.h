@@ -0,0 +1,60 @@
+/** !
+ * Robust predicates header
+ *
+ * The orientation and in circle tests are Shewchuk's adaptive predicates.
+ * Each test first computes its determinant in plain floating point, with
+ * a bound on the rounding error. If the determinant is farther from zero
+ * than the bound, its sign is right, and it is returned after a few
+ * operations. Otherwise, the determinant is computed again in stages of
+ * exact expansion arithmetic, and each stage stops as soon as its sign is
+ * certain. The sign of the result is always exact.
+ *
+ * The library is compiled without contracting multiplies and adds, which
+ * the exact arithmetic depends on.
+ *
+ * @file geometry/predicates.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Function declarations
+
+// Predicates
+/** !
+ * Compute the orientation of three points. The result is positive if A,
+ * B and C are counterclockwise, negative if they are clockwise, and zero
+ * if they are colinear. It approximates twice the signed area of the
+ * triangle ABC.
+ *
+ * @param p_a point A
+ * @param p_b point B
+ * @param p_c point C
+ *
+ * @return the orientation, with an exact sign
+ */
+DLLEXPORT double geometry_orient2d ( geometry_point *p_a, geometry_point *p_b, geometry_point *p_c );
+
+/** !
+ * Test if a point is inside of the circle through three counterclockwise
+ * points. The result is positive if D is inside of the circle, negative if
+ * it is outside, and zero if it is on the circle. The sign is reversed if
+ * A, B and C are clockwise.
+ *
+ * @param p_a point A
+ * @param p_b point B
+ * @param p_c point C
+ * @param p_d point D
+ *
+ * @return the in circle determinant, with an exact sign
+ */
+DLLEXPORT double geometry_incircle ( geometry_point *p_a, geometry_point *p_b, geometry_point *p_c, geometry_point *p_d );
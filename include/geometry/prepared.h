@@ -0,0 +1,107 @@
+/** !
+ * Prepared geometry header
+ *
+ * A prepared polygon is built once, and answers many point in polygon
+ * queries. The envelope of the polygon is cut into horizontal bands, and
+ * each band lists the edges that cross it. A query only tests the edges
+ * of the band that holds the point, with the same crossing rule as
+ * geometry_point_in_polygon, so both give the same answer for every point.
+ *
+ * @file geometry/prepared.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Bands are halved until the edges of all the bands, counting an edge
+// once for each band it crosses, fit in this many times the verticies
+#define GEOMETRY_PREPARED_EDGE_RATIO 8
+
+// Batches with fewer points than this are tested on one thread
+#define GEOMETRY_PREPARED_GRAIN 4096
+
+// Structure declarations
+struct geometry_prepared_polygon_s;
+
+// Type definitions
+typedef struct geometry_prepared_polygon_s geometry_prepared_polygon;
+
+// Structure definitions
+// The edges of band i are p_edges[p_offsets[i]] to p_edges[p_offsets[i+1]],
+// each stored from the previous vertex to the next vertex of the ring
+struct geometry_prepared_polygon_s
+{
+    size_t         band_quantity;
+    double         y_min,
+                   y_max,
+                   band_scale;
+    size_t        *p_offsets;
+    geometry_line *p_edges;
+};
+
+// Function declarations
+
+// Constructors
+/** !
+ * Construct a prepared polygon. The prepared polygon copies the edges it
+ * needs, so the polygon may be released or modified afterwards.
+ *
+ * @param pp_prepared_polygon return
+ * @param p_polygon           the polygon
+ *
+ * @sa geometry_prepared_polygon_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_prepared_polygon_construct ( geometry_prepared_polygon **pp_prepared_polygon, geometry_polygon *p_polygon );
+
+// Queries
+/** !
+ * Test if a point is inside of a prepared polygon
+ *
+ * @param p_prepared_polygon the prepared polygon
+ * @param p_point            the point
+ * @param p_result           return
+ *
+ * @sa geometry_point_in_polygon
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_prepared_polygon_contains ( geometry_prepared_polygon *p_prepared_polygon, geometry_point *p_point, bool *p_result );
+
+/** !
+ * Test if each of many points is inside of a prepared polygon. The points
+ * are split between the threads of geometry/parallel.h.
+ *
+ * @param p_prepared_polygon the prepared polygon
+ * @param p_points           the points
+ * @param quantity           the quantity of points
+ * @param p_results          return; one result for each point
+ *
+ * @sa geometry_prepared_polygon_contains
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_prepared_polygon_contains_batch ( geometry_prepared_polygon *p_prepared_polygon, geometry_point *p_points, size_t quantity, bool *p_results );
+
+// Destructors
+/** !
+ * Release a prepared polygon
+ *
+ * @param pp_prepared_polygon pointer to prepared polygon pointer
+ *
+ * @sa geometry_prepared_polygon_construct
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_prepared_polygon_destroy ( geometry_prepared_polygon **pp_prepared_polygon );
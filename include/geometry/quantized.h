@@ -0,0 +1,182 @@
+/** !
+ * Quantized geometry header
+ *
+ * Quantized coordinates are 32 bit integers, measured in steps of a
+ * shared scale from a shared origin. Polygon rings are stored as the
+ * zigzag varint encoded differences between neighbouring verticies, so
+ * a ring of nearby verticies takes a few bytes per vertex instead of 16.
+ *
+ * Area and point in polygon are computed with integer arithmetic, so
+ * they are exact and give the same result on every platform.
+ *
+ * @file geometry/quantized.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Quantized coordinates are limited to [ -2^30, 2^30 ], so the products
+// and differences of coordinates fit in 64 bit integers
+#define GEOMETRY_QUANTIZED_MAX ( (int32_t) 1 << 30 )
+
+// Structure declarations
+struct geometry_quantization_s;
+struct geometry_quantized_point_s;
+struct geometry_quantized_polygon_s;
+
+// Type definitions
+typedef struct geometry_quantization_s      geometry_quantization;
+typedef struct geometry_quantized_point_s   geometry_quantized_point;
+typedef struct geometry_quantized_polygon_s geometry_quantized_polygon;
+
+// Structure definitions
+struct geometry_quantization_s
+{
+    double origin_x,
+           origin_y,
+           scale;
+};
+
+struct geometry_quantized_point_s
+{
+    int32_t x, y;
+};
+
+struct geometry_quantized_polygon_s
+{
+    size_t         quantity,
+                   size;
+    unsigned char *p_data;
+};
+
+// Function declarations
+
+// Constructors
+/** !
+ * Construct a quantization that covers a collection of geometry, using
+ * the full range of quantized coordinates
+ *
+ * @param p_quantization return
+ * @param p_geometries   the geometry
+ * @param quantity       the quantity of geometry
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_quantization_construct ( geometry_quantization *p_quantization, geometry *p_geometries, size_t quantity );
+
+/** !
+ * Quantize a point
+ *
+ * @param p_quantization the quantization
+ * @param p_point        the point
+ * @param p_result       return
+ *
+ * @return 1 on success, 0 if the point is outside of the quantization
+ */
+DLLEXPORT int geometry_point_quantize ( geometry_quantization *p_quantization, geometry_point *p_point, geometry_quantized_point *p_result );
+
+/** !
+ * Restore a point from its quantized coordinates
+ *
+ * @param p_quantization the quantization
+ * @param p_point        the quantized point
+ * @param p_result       return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_point_dequantize ( geometry_quantization *p_quantization, geometry_quantized_point *p_point, geometry_point *p_result );
+
+/** !
+ * Quantize and delta encode a polygon
+ *
+ * @param p_quantization the quantization
+ * @param p_polygon      the polygon
+ * @param p_result       return
+ * @param p_arena        the arena, or null for the heap
+ *
+ * @sa geometry_quantized_polygon_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_quantized_polygon_encode ( geometry_quantization *p_quantization, geometry_polygon *p_polygon, geometry_quantized_polygon *p_result, geometry_arena *p_arena );
+
+/** !
+ * Decode the verticies of a quantized polygon
+ *
+ * @param p_quantization the quantization
+ * @param p_polygon      the quantized polygon
+ * @param p_verticies    return; must have room for p_polygon->quantity points
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_quantized_polygon_decode ( geometry_quantization *p_quantization, geometry_quantized_polygon *p_polygon, geometry_point *p_verticies );
+
+// Operations
+/** !
+ * Compute the area of a quantized polygon. The area is accumulated
+ * exactly, and rounded once when it is scaled.
+ *
+ * @param p_quantization the quantization
+ * @param p_polygon      the quantized polygon
+ * @param p_area         return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_quantized_polygon_area ( geometry_quantization *p_quantization, geometry_quantized_polygon *p_polygon, double *p_area );
+
+/** !
+ * Test if a quantized point is inside of a quantized polygon. The test is
+ * exact.
+ *
+ * @param p_polygon the quantized polygon
+ * @param p_point   the quantized point
+ * @param p_result  return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_quantized_point_in_polygon ( geometry_quantized_polygon *p_polygon, geometry_quantized_point *p_point, bool *p_result );
+
+/** !
+ * Compute the distance between two quantized points
+ *
+ * @param p_quantization the quantization
+ * @param p_a            the first point
+ * @param p_b            the second point
+ * @param p_distance     return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_quantized_point_distance ( geometry_quantization *p_quantization, geometry_quantized_point *p_a, geometry_quantized_point *p_b, double *p_distance );
+
+/** !
+ * Compute the distance from a quantized point to a quantized polygon.
+ * Points inside of the polygon are at distance 0.
+ *
+ * @param p_quantization the quantization
+ * @param p_polygon      the quantized polygon
+ * @param p_point        the quantized point
+ * @param p_distance     return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_quantized_polygon_distance ( geometry_quantization *p_quantization, geometry_quantized_polygon *p_polygon, geometry_quantized_point *p_point, double *p_distance );
+
+// Destructors
+/** !
+ * Release a quantized polygon encoded on the heap
+ *
+ * @param p_polygon the quantized polygon
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_quantized_polygon_destroy ( geometry_quantized_polygon *p_polygon );
@@ -0,0 +1,221 @@
+/** !
+ * Relate header
+ *
+ * Two geometries are related by their DE-9IM matrix. Entry [a][b] of the
+ * matrix is the dimension of the intersection of part a of the first
+ * geometry and part b of the second, where the parts are the interior,
+ * the boundary and the exterior, or -1 if they do not meet.
+ *
+ * The matrix is computed in one pass, for any pair of types. Points are
+ * treated as edges of no length, so the edges of both geometries are
+ * cut where they meet with one plane sweep. Lines that cross themselves,
+ * and rings that share edges, are also cut where they meet themselves,
+ * and edges that lie on each other share their cuts. Each point where
+ * the geometries meet is located in both of them, and so is each piece
+ * of an edge, with the sides of a piece for geometries with area. Points
+ * that meet nothing are located last. Entries only grow, so a pattern is
+ * settled as soon as an entry breaks it, or every entry it needs is
+ * found, and the pass stops there. The predicates of geometry/geometry.h
+ * are each a pattern, or a few patterns, tested this way. They are the
+ * kernels of the dispatch table of geometry/dispatch.h for each pair of
+ * types without a faster kernel.
+ *
+ * The boundary of a line list is the endpoints its lines share an odd
+ * quantity of times. The rings of a polygon list are combined by the
+ * even odd rule.
+ *
+ * @file geometry/relate.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// The entry of parts that do not meet
+#define GEOMETRY_RELATE_FALSE -1
+
+// Enumeration definitions
+enum geometry_location_e
+{
+    GEOMETRY_LOCATION_INTERIOR = 0,
+    GEOMETRY_LOCATION_BOUNDARY = 1,
+    GEOMETRY_LOCATION_EXTERIOR = 2,
+    GEOMETRY_LOCATION_QUANTITY = 3
+};
+
+// Structure declarations
+struct geometry_relation_s;
+
+// Type definitions
+typedef struct geometry_relation_s geometry_relation;
+
+// Structure definitions
+struct geometry_relation_s
+{
+    signed char matrix[GEOMETRY_LOCATION_QUANTITY][GEOMETRY_LOCATION_QUANTITY];
+};
+
+// Function declarations
+
+// Operations
+/** !
+ * Compute the DE-9IM matrix of two geometries
+ *
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_relate ( geometry *p_a, geometry *p_b, geometry_relation *p_result );
+
+/** !
+ * Test if the DE-9IM matrix of two geometries matches a pattern. The
+ * pattern is nine characters, one for each entry in row order. 'T'
+ * matches any intersection, 'F' matches no intersection, '0', '1' and '2'
+ * match that dimension, and '*' matches anything. The matrix is only
+ * computed until the pattern is settled.
+ *
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param pattern  the pattern
+ * @param p_result return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_relate_pattern ( geometry *p_a, geometry *p_b, const char *pattern, bool *p_result );
+
+// Queries
+/** !
+ * Test if a DE-9IM matrix matches a pattern
+ *
+ * @param p_relation the matrix
+ * @param pattern    the pattern
+ * @param p_result   return
+ *
+ * @sa geometry_relate_pattern
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_relation_matches ( geometry_relation *p_relation, const char *pattern, bool *p_result );
+
+/** !
+ * Locate a point in a polygon. This is the location geometry_relate finds
+ * for the point, without cutting the edges of the polygon. A polygon with
+ * no area has no interior, and no boundary.
+ *
+ * @param p_point   the point
+ * @param p_polygon the polygon
+ * @param p_result  return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_point_polygon_locate ( geometry_point *p_point, geometry_polygon *p_polygon, enum geometry_location_e *p_result );
+
+// Predicates
+/** !
+ * Test if two geometry are equal with the relate engine, for any pair of
+ * types
+ *
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ *
+ * @sa geometry_equals
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_relate_equals ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if two geometry are disjoint with the relate engine, for any pair
+ * of types
+ *
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ *
+ * @sa geometry_disjoint
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_relate_disjoint ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if two geometry intersect with the relate engine, for any pair of
+ * types. Lines and line lists are swept instead.
+ *
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ *
+ * @sa geometry_intersects
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_relate_intersects ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if two geometry touch with the relate engine, for any pair of
+ * types
+ *
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ *
+ * @sa geometry_touches
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_relate_touches ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if two geometry cross with the relate engine, for any pair of
+ * types. Lines and line lists are swept instead.
+ *
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ *
+ * @sa geometry_crosses
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_relate_crosses ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if two geometry overlap with the relate engine, for any pair of
+ * types
+ *
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ *
+ * @sa geometry_overlaps
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_relate_overlaps ( geometry *p_a, geometry *p_b, bool *p_result );
+
+/** !
+ * Test if a geometry contains another geometry with the relate engine,
+ * for any pair of types
+ *
+ * @param p_a      a geometry
+ * @param p_b      another geometry
+ * @param p_result return
+ *
+ * @sa geometry_contains
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_relate_contains ( geometry *p_a, geometry *p_b, bool *p_result );
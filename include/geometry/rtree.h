@@ -0,0 +1,148 @@
+/** !
+ * R-tree spatial index header
+ *
+ * The tree is bulk loaded with Sort-Tile-Recursive packing, and stored as
+ * one flat array of cache line sized nodes. The children of a node are
+ * adjacent in the array, so a node only records where they start and how
+ * many there are. Queries walk the tree with a fixed size stack, and do
+ * not allocate.
+ *
+ * @file geometry/rtree.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// The maximum quantity of children in a node
+#define GEOMETRY_RTREE_FANOUT 16
+
+// The maximum height of a tree. 16^16 leaves exceeds any addressable collection.
+#define GEOMETRY_RTREE_HEIGHT_MAX 16
+
+// Trees over fewer geometries than this are built on one thread
+#define GEOMETRY_RTREE_GRAIN 4096
+
+// Structure declarations
+struct geometry_rtree_item_s;
+struct geometry_rtree_node_s;
+struct geometry_rtree_s;
+
+// Type definitions
+typedef struct geometry_rtree_item_s geometry_rtree_item;
+typedef struct geometry_rtree_node_s geometry_rtree_node;
+typedef struct geometry_rtree_s      geometry_rtree;
+
+// Structure definitions
+struct geometry_rtree_item_s
+{
+    geometry_envelope envelope;
+    size_t            index;
+};
+
+// The children of a node are items when level is 0, else nodes
+struct geometry_rtree_node_s
+{
+    geometry_envelope envelope;
+    size_t            first,
+                      quantity,
+                      level;
+    char              _padding[64 - sizeof(geometry_envelope) - 3 * sizeof(size_t)];
+};
+
+struct geometry_rtree_s
+{
+    size_t               quantity,
+                         node_quantity;
+    geometry            *p_geometries;
+    geometry_rtree_item *p_items;
+    geometry_rtree_node *p_nodes;
+    void                *p_block;
+};
+
+// Function declarations
+
+// Constructors
+/** !
+ * Bulk load an R-tree over an array of geometry. The tree refers to the
+ * geometry, which must outlive it. Empty geometry is not indexed.
+ *
+ * @param pp_rtree     return
+ * @param p_geometries the geometry
+ * @param quantity     the quantity of geometry
+ *
+ * @sa geometry_rtree_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_rtree_construct ( geometry_rtree **pp_rtree, geometry *p_geometries, size_t quantity );
+
+// Queries
+/** !
+ * Find the geometry whose envelopes overlap an envelope. If there are
+ * more than capacity results, only the first capacity are stored, but
+ * all of them are counted.
+ *
+ * @param p_rtree    the R-tree
+ * @param p_envelope the envelope
+ * @param p_results  return the indices of the geometry
+ * @param capacity   the capacity of p_results
+ * @param p_quantity return the quantity of results
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_rtree_query_envelope ( geometry_rtree *p_rtree, geometry_envelope *p_envelope, size_t *p_results, size_t capacity, size_t *p_quantity );
+
+/** !
+ * Find the geometry that may intersect a geometry, by comparing envelopes.
+ * Every geometry that intersects is a candidate, but not every candidate
+ * intersects.
+ *
+ * @param p_rtree    the R-tree
+ * @param p_geometry the geometry
+ * @param p_results  return the indices of the candidates
+ * @param capacity   the capacity of p_results
+ * @param p_quantity return the quantity of candidates
+ *
+ * @sa geometry_rtree_query_envelope
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_rtree_query_intersects ( geometry_rtree *p_rtree, geometry *p_geometry, size_t *p_results, size_t capacity, size_t *p_quantity );
+
+/** !
+ * Find the k nearest geometry to a geometry. Subtrees are pruned by the
+ * distance between envelopes, and each candidate is ranked by
+ * geometry_distance. Candidates that geometry_distance does not support
+ * are skipped.
+ *
+ * @param p_rtree     the R-tree
+ * @param p_geometry  the geometry
+ * @param k           the quantity of neighbours
+ * @param p_results   return the indices of the neighbours, nearest first
+ * @param p_distances return the distances to the neighbours
+ * @param p_quantity  return the quantity of neighbours, at most k
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_rtree_nearest ( geometry_rtree *p_rtree, geometry *p_geometry, size_t k, size_t *p_results, double *p_distances, size_t *p_quantity );
+
+// Destructors
+/** !
+ * Release an R-tree
+ *
+ * @param pp_rtree pointer to R-tree pointer
+ *
+ * @sa geometry_rtree_construct
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_rtree_destroy ( geometry_rtree **pp_rtree );
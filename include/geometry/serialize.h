@@ -0,0 +1,76 @@
+/** !
+ * Geometry binary serialization header
+ *
+ * Geometry is encoded as well known binary (WKB). Points, point lists,
+ * lines, line lists, triangles, polygons and polygon lists are written as
+ * WKB Point, MultiPoint, LineString, MultiLineString, Triangle, Polygon and
+ * MultiPolygon.
+ *
+ * @file geometry/serialize.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Enumeration definitions
+enum geometry_wkb_type_e
+{
+    GEOMETRY_WKB_POINT            = 1,
+    GEOMETRY_WKB_LINESTRING       = 2,
+    GEOMETRY_WKB_POLYGON          = 3,
+    GEOMETRY_WKB_MULTIPOINT       = 4,
+    GEOMETRY_WKB_MULTILINESTRING  = 5,
+    GEOMETRY_WKB_MULTIPOLYGON     = 6,
+    GEOMETRY_WKB_TRIANGLE         = 17
+};
+
+// Function declarations
+
+// Serializers
+/** !
+ * Compute the size of the WKB encoding of a geometry
+ *
+ * @param p_geometry the geometry
+ * @param p_size     return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_serialize_size ( geometry *p_geometry, size_t *p_size );
+
+/** !
+ * Encode a geometry as little endian WKB
+ *
+ * @param p_geometry the geometry
+ * @param p_buffer   return; must have room for geometry_serialize_size bytes
+ *
+ * @sa geometry_serialize_size
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_serialize ( geometry *p_geometry, void *p_buffer );
+
+// Deserializers
+/** !
+ * Decode a WKB geometry. Either byte order is accepted. A LineString with
+ * more than two points decodes to a line list of its segments, and rings
+ * are returned without their closing vertex.
+ *
+ * @param p_geometry return
+ * @param p_buffer   the WKB
+ * @param size       the size of the WKB, in bytes
+ * @param p_read     return; the quantity of bytes consumed. May be null.
+ * @param p_arena    the arena, or null for the heap
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_deserialize ( geometry *p_geometry, const void *p_buffer, size_t size, size_t *p_read, geometry_arena *p_arena );
@@ -0,0 +1,168 @@
+/** !
+ * Simplification header
+ *
+ * The verticies of a line or ring are ranked once, and then any tolerance
+ * is extracted from the ranking. Douglas Peucker ranks a vertex by its
+ * distance from the line between the verticies kept on either side of it.
+ * Visvalingam Whyatt removes the vertex that makes the smallest triangle
+ * with its neighbours, over and over, with a heap, in O(n log n). A vertex
+ * never ranks above the vertex that was kept before it, so the verticies
+ * kept at a tolerance are the top of a binary tree, and are extracted in
+ * order by visiting only them. Where a simplified line would cross itself,
+ * the best ranked vertex removed from between the crossing verticies is
+ * put back, until nothing crosses.
+ *
+ * @file geometry/simplify.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// The child of a vertex with no child
+#define GEOMETRY_SIMPLIFY_NONE SIZE_MAX
+
+// Enumeration definitions
+enum geometry_simplify_e
+{
+    GEOMETRY_SIMPLIFY_DOUGLAS_PEUCKER    = 0,
+    GEOMETRY_SIMPLIFY_VISVALINGAM_WHYATT = 1,
+    GEOMETRY_SIMPLIFY_QUANTITY           = 2
+};
+
+// Structure declarations
+struct geometry_simplification_s;
+
+// Type definitions
+typedef struct geometry_simplification_s geometry_simplification;
+
+// Structure definitions
+// Chain i is the verticies p_points[p_offsets[i]] to p_points[p_offsets[i+1]-1].
+// A ring is one chain, which ends with its first vertex again. Vertex v
+// was removed from between v's neighbours at the time, and p_end[v] is
+// the neighbour after v. p_left[v] and p_right[v] are the first verticies
+// removed from either side of v, after v was.
+struct geometry_simplification_s
+{
+    size_t          quantity,
+                    chain_quantity;
+    bool            ring;
+    geometry_point *p_points;
+    double         *p_importance;
+    size_t         *p_offsets,
+                   *p_left,
+                   *p_right,
+                   *p_end;
+};
+
+// Function declarations
+
+// Constructors
+/** !
+ * Rank the verticies of a polygon. The farthest vertex from the first
+ * vertex, and the best ranked vertex after it, are always kept, so that
+ * a simplified polygon has at least three verticies.
+ *
+ * @param pp_simplification return
+ * @param p_polygon         the polygon
+ * @param method            the method
+ *
+ * @sa geometry_simplification_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_simplification_polygon_construct ( geometry_simplification **pp_simplification, geometry_polygon *p_polygon, enum geometry_simplify_e method );
+
+/** !
+ * Rank the verticies of a line list. Lines that start where the line
+ * before them ends are one chain, and the ends of each chain are always
+ * kept.
+ *
+ * @param pp_simplification return
+ * @param p_line_list       the line list
+ * @param method            the method
+ *
+ * @sa geometry_simplification_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_simplification_line_list_construct ( geometry_simplification **pp_simplification, geometry_line_list *p_line_list, enum geometry_simplify_e method );
+
+// Operations
+/** !
+ * Extract a polygon from the ranking of a polygon. Verticies with an
+ * importance greater than the tolerance are kept. Importance is a
+ * distance for Douglas Peucker, and an area for Visvalingam Whyatt.
+ *
+ * @param p_simplification the ranking of a polygon
+ * @param tolerance        the tolerance
+ * @param p_result         return
+ * @param p_arena          the arena, or null for the heap
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_simplification_polygon ( geometry_simplification *p_simplification, double tolerance, geometry_polygon *p_result, geometry_arena *p_arena );
+
+/** !
+ * Extract a line list from the ranking of a line list
+ *
+ * @param p_simplification the ranking of a line list
+ * @param tolerance        the tolerance
+ * @param p_result         return
+ * @param p_arena          the arena, or null for the heap
+ *
+ * @sa geometry_simplification_polygon
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_simplification_line_list ( geometry_simplification *p_simplification, double tolerance, geometry_line_list *p_result, geometry_arena *p_arena );
+
+/** !
+ * Simplify a polygon once
+ *
+ * @param p_polygon the polygon
+ * @param method    the method
+ * @param tolerance the tolerance
+ * @param p_result  return
+ * @param p_arena   the arena, or null for the heap
+ *
+ * @sa geometry_simplification_polygon
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_polygon_simplify ( geometry_polygon *p_polygon, enum geometry_simplify_e method, double tolerance, geometry_polygon *p_result, geometry_arena *p_arena );
+
+/** !
+ * Simplify a line list once
+ *
+ * @param p_line_list the line list
+ * @param method      the method
+ * @param tolerance   the tolerance
+ * @param p_result    return
+ * @param p_arena     the arena, or null for the heap
+ *
+ * @sa geometry_simplification_line_list
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_line_list_simplify ( geometry_line_list *p_line_list, enum geometry_simplify_e method, double tolerance, geometry_line_list *p_result, geometry_arena *p_arena );
+
+// Destructors
+/** !
+ * Destroy a ranking
+ *
+ * @param pp_simplification pointer to the ranking
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_simplification_destroy ( geometry_simplification **pp_simplification );
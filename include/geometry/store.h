@@ -0,0 +1,126 @@
+/** !
+ * Memory mapped geometry store header
+ *
+ * A store is a file holding a collection of geometry in the in memory
+ * layout of this library. Opening a store maps the file read only, and
+ * geometry taken from the store point straight into the mapping, so no
+ * coordinates are parsed or copied. Stores use the byte order and word
+ * size of the host that wrote them.
+ *
+ * @file geometry/store.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Store file format
+#define GEOMETRY_STORE_MAGIC   "GEOSTORE"
+#define GEOMETRY_STORE_VERSION 1
+
+// Structure declarations
+struct geometry_store_header_s;
+struct geometry_store_entry_s;
+struct geometry_store_s;
+
+// Type definitions
+typedef struct geometry_store_header_s geometry_store_header;
+typedef struct geometry_store_entry_s  geometry_store_entry;
+typedef struct geometry_store_s        geometry_store;
+
+// Structure definitions
+struct geometry_store_header_s
+{
+    char     magic[8];
+    uint32_t version,
+             byte_order;
+    uint64_t quantity,
+             directory_offset,
+             size;
+};
+
+struct geometry_store_entry_s
+{
+    uint32_t type,
+             reserved;
+    uint64_t quantity,
+             vertex_quantity,
+             offset;
+};
+
+struct geometry_store_s
+{
+    size_t                      quantity,
+                                size;
+    const unsigned char        *p_base;
+    const geometry_store_entry *p_directory;
+    #ifdef _WIN64
+        void *file,
+             *mapping;
+    #endif
+};
+
+// Function declarations
+
+// Writers
+/** !
+ * Write a collection of geometry to a store file
+ *
+ * @param path         the path to the store file
+ * @param p_geometries the geometry
+ * @param quantity     the quantity of geometry
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_store_write ( const char *path, geometry *p_geometries, size_t quantity );
+
+// Constructors
+/** !
+ * Map a store file into memory. This validates the directory, but does not
+ * read the coordinates, so it takes time in proportion to the quantity of
+ * geometry, not to the quantity of verticies.
+ *
+ * @param pp_store return
+ * @param path     the path to the store file
+ *
+ * @sa geometry_store_close
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_store_open ( geometry_store **pp_store, const char *path );
+
+// Accessors
+/** !
+ * Get a view of a geometry in a store. The view points into the read
+ * only mapping, so it must not be modified or destroyed, and must not
+ * outlive the store. The ring offsets of a polygon list are validated
+ * before the view is returned.
+ *
+ * @param p_store    the store
+ * @param index      the index of the geometry
+ * @param p_geometry return
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_store_get ( geometry_store *p_store, size_t index, geometry *p_geometry );
+
+// Destructors
+/** !
+ * Unmap a store
+ *
+ * @param pp_store pointer to store pointer
+ *
+ * @sa geometry_store_open
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_store_close ( geometry_store **pp_store );
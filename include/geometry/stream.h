@@ -0,0 +1,89 @@
+/** !
+ * Streaming geometry loaders header
+ *
+ * These loaders tokenize JSON text directly into geometry, without
+ * building a json_value tree first. GeoJSON feature collections are
+ * read incrementally and handed to a callback in fixed size batches, so
+ * memory use depends on the batch size, not on the size of the input.
+ *
+ * @file geometry/stream.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Size of each chunk read from a file
+#ifndef GEOMETRY_STREAM_CHUNK_SIZE
+    #define GEOMETRY_STREAM_CHUNK_SIZE 65536
+#endif
+
+// Type definitions
+/** !
+ * Receive a batch of geometry. The geometry, and any memory it refers to,
+ * is only valid until the callback returns.
+ *
+ * @param p_geometries the geometry
+ * @param quantity     the quantity of geometry
+ * @param p_parameter  the parameter passed to the loader
+ *
+ * @return 1 to continue loading, 0 to stop
+ */
+typedef int (*fn_geometry_batch) ( geometry *p_geometries, size_t quantity, void *p_parameter );
+
+// Function declarations
+
+// Constructors
+/** !
+ * Construct a polygon from json text. The text is an array of verticies,
+ * where each vertex is either { "x" : x, "y" : y } or [ x, y ]. Only
+ * whitespace may follow the array.
+ *
+ * @param p_geometry return
+ * @param p_text     the json text
+ * @param length     the length of the json text, in bytes
+ * @param p_arena    the arena, or null for the heap
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_polygon_load_as_json_text ( geometry *p_geometry, const char *p_text, size_t length, geometry_arena *p_arena );
+
+/** !
+ * Load the features of a GeoJSON FeatureCollection from json text, and
+ * pass their geometry to a callback in batches. Point, LineString,
+ * Polygon, MultiPoint, MultiLineString and MultiPolygon geometry is
+ * supported. Features with a null or empty geometry are skipped.
+ *
+ * @param p_text      the json text
+ * @param length      the length of the json text, in bytes
+ * @param batch_size  the maximum quantity of geometry in each batch
+ * @param pfn_batch   the callback
+ * @param p_parameter a parameter for the callback
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_feature_collection_load_as_json_text ( const char *p_text, size_t length, size_t batch_size, fn_geometry_batch pfn_batch, void *p_parameter );
+
+/** !
+ * Load the features of a GeoJSON FeatureCollection from a file, and pass
+ * their geometry to a callback in batches. The file is read in chunks of
+ * GEOMETRY_STREAM_CHUNK_SIZE bytes, and is never held in memory whole.
+ *
+ * @param p_file      the file
+ * @param batch_size  the maximum quantity of geometry in each batch
+ * @param pfn_batch   the callback
+ * @param p_parameter a parameter for the callback
+ *
+ * @sa geometry_feature_collection_load_as_json_text
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_feature_collection_load_as_json_file ( FILE *p_file, size_t batch_size, fn_geometry_batch pfn_batch, void *p_parameter );
@@ -0,0 +1,93 @@
+/** !
+ * Plane sweep header
+ *
+ * Segment intersections are found with a Bentley-Ottmann sweep. A
+ * vertical line sweeps the plane from left to right, and a treap holds
+ * the segments it crosses, from bottom to top. Segments that cross can
+ * only meet after they are neighbours in the treap, so only neighbours
+ * are tested, and all k intersections of n segments are found in
+ * O((n + k) log n). Segments that meet at an endpoint are found when the
+ * sweep reaches the endpoint. Every decision is made with
+ * geometry_point_ccw.
+ *
+ * @file geometry/sweep.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Structure declarations
+struct geometry_line_intersection_s;
+
+// Type definitions
+typedef struct geometry_line_intersection_s geometry_line_intersection;
+
+// Structure definitions
+// a and b are indices of lines. A proper intersection is a crossing at a
+// point that is not the endpoint of either line.
+struct geometry_line_intersection_s
+{
+    size_t         a,
+                   b;
+    geometry_point point;
+    bool           proper;
+};
+
+// Function declarations
+
+// Queries
+/** !
+ * Find the intersecting pairs of lines in two line lists, or in one line
+ * list. Each pair is reported once, in order of a then b, with a point
+ * where the lines meet. If there are more than capacity results, only
+ * the first capacity are stored, but all of them are counted.
+ *
+ * @param p_a        a line list
+ * @param p_b        another line list. If null, pairs of lines in p_a are
+ *                   found, and a < b.
+ * @param p_results  return the intersections
+ * @param capacity   the capacity of p_results
+ * @param p_quantity return the quantity of intersections
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_line_list_intersections ( geometry_line_list *p_a, geometry_line_list *p_b, geometry_line_intersection *p_results, size_t capacity, size_t *p_quantity );
+
+/** !
+ * Test if two line lists intersect, or if any two lines of one line list
+ * intersect. The sweep stops at the first intersection.
+ *
+ * @param p_a      a line list
+ * @param p_b      another line list, or null
+ * @param p_result return
+ *
+ * @sa geometry_line_list_intersections
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_line_list_intersects ( geometry_line_list *p_a, geometry_line_list *p_b, bool *p_result );
+
+/** !
+ * Test if two line lists cross, or if any two lines of one line list
+ * cross. Lines cross when they meet at a single point that is not the
+ * endpoint of either line. The sweep stops at the first crossing.
+ *
+ * @param p_a      a line list
+ * @param p_b      another line list, or null
+ * @param p_result return
+ *
+ * @sa geometry_line_list_intersections
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_line_list_crosses ( geometry_line_list *p_a, geometry_line_list *p_b, bool *p_result );
@@ -0,0 +1,202 @@
+/** !
+ * Treap header
+ *
+ * A treap is a balanced binary search tree of items, where items are
+ * indices into some array the caller owns. The order of the items is
+ * decided by a comparator at insertion, so the same tree can order
+ * segments by where they cross a sweep line, or anything else whose order
+ * is only known relative to the other items. Nodes keep a parent link, so
+ * the neighbours of an item are found without searching, and two items
+ * can trade places without touching the tree.
+ *
+ * @file geometry/treap.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// The item before the first item, and after the last item
+#define GEOMETRY_TREAP_NONE SIZE_MAX
+
+// Structure declarations
+struct geometry_treap_node_s;
+struct geometry_treap_s;
+
+// Type definitions
+typedef struct geometry_treap_node_s geometry_treap_node;
+typedef struct geometry_treap_s      geometry_treap;
+
+/** !
+ * Compare two items
+ *
+ * @param a           an item
+ * @param b           another item
+ * @param p_parameter the parameter
+ *
+ * @return < 0 if a is before b, else > 0
+ */
+typedef int (*fn_geometry_treap_compare) ( size_t a, size_t b, void *p_parameter );
+
+/** !
+ * Compare a key to an item
+ *
+ * @param item        the item
+ * @param p_parameter the parameter, which holds the key
+ *
+ * @return > 0 if the key is after the item, else <= 0
+ */
+typedef int (*fn_geometry_treap_locate) ( size_t item, void *p_parameter );
+
+// Structure definitions
+struct geometry_treap_node_s
+{
+    size_t   item,
+             left,
+             right,
+             parent;
+    uint64_t priority;
+};
+
+// Nodes are a pool of capacity nodes, and p_positions maps each item to
+// its node. The free nodes are linked through their left child.
+struct geometry_treap_s
+{
+    size_t               capacity,
+                         root,
+                         free;
+    uint64_t             seed;
+    geometry_treap_node *p_nodes;
+    size_t              *p_positions;
+};
+
+// Function declarations
+
+// Constructors
+/** !
+ * Construct an empty treap with room for the items [0, capacity)
+ *
+ * @param p_treap  return
+ * @param capacity the quantity of items
+ *
+ * @sa geometry_treap_destroy
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_treap_construct ( geometry_treap *p_treap, size_t capacity );
+
+// Operations
+/** !
+ * Insert an item. The item must not already be in the treap.
+ *
+ * @param p_treap     the treap
+ * @param item        the item
+ * @param pfn_compare the comparator
+ * @param p_parameter the parameter of the comparator
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_treap_insert ( geometry_treap *p_treap, size_t item, fn_geometry_treap_compare pfn_compare, void *p_parameter );
+
+/** !
+ * Remove an item
+ *
+ * @param p_treap the treap
+ * @param item    the item
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_treap_remove ( geometry_treap *p_treap, size_t item );
+
+/** !
+ * Exchange the places of two items in the treap
+ *
+ * @param p_treap the treap
+ * @param a       an item
+ * @param b       another item
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_treap_swap ( geometry_treap *p_treap, size_t a, size_t b );
+
+// Queries
+/** !
+ * Test if an item is in the treap
+ *
+ * @param p_treap the treap
+ * @param item    the item
+ *
+ * @return true if the item is in the treap, else false
+ */
+DLLEXPORT bool geometry_treap_contains ( geometry_treap *p_treap, size_t item );
+
+/** !
+ * Find the first item
+ *
+ * @param p_treap the treap
+ *
+ * @return the first item, or GEOMETRY_TREAP_NONE if the treap is empty
+ */
+DLLEXPORT size_t geometry_treap_first ( geometry_treap *p_treap );
+
+/** !
+ * Find the last item
+ *
+ * @param p_treap the treap
+ *
+ * @return the last item, or GEOMETRY_TREAP_NONE if the treap is empty
+ */
+DLLEXPORT size_t geometry_treap_last ( geometry_treap *p_treap );
+
+/** !
+ * Find the item after an item
+ *
+ * @param p_treap the treap
+ * @param item    the item
+ *
+ * @return the next item, or GEOMETRY_TREAP_NONE
+ */
+DLLEXPORT size_t geometry_treap_next ( geometry_treap *p_treap, size_t item );
+
+/** !
+ * Find the item before an item
+ *
+ * @param p_treap the treap
+ * @param item    the item
+ *
+ * @return the previous item, or GEOMETRY_TREAP_NONE
+ */
+DLLEXPORT size_t geometry_treap_previous ( geometry_treap *p_treap, size_t item );
+
+/** !
+ * Find the first item that a key is not after
+ *
+ * @param p_treap     the treap
+ * @param pfn_locate  the key comparator
+ * @param p_parameter the parameter of the key comparator
+ *
+ * @return the item, or GEOMETRY_TREAP_NONE if the key is after every item
+ */
+DLLEXPORT size_t geometry_treap_lower_bound ( geometry_treap *p_treap, fn_geometry_treap_locate pfn_locate, void *p_parameter );
+
+// Destructors
+/** !
+ * Release the nodes of a treap
+ *
+ * @param p_treap the treap
+ *
+ * @sa geometry_treap_construct
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_treap_destroy ( geometry_treap *p_treap );
@@ -0,0 +1,46 @@
+/** !
+ * Triangulation header
+ *
+ * A simple polygon is cut into y monotone pieces by a sweep from the top
+ * down, which adds a diagonal at every vertex where the boundary turns
+ * back on itself. Each piece is then triangulated in one pass with a
+ * stack. Both steps are O(n log n) in the verticies of the polygon. Rings
+ * with only a few verticies are clipped ear by ear instead, which is
+ * faster than setting up the sweep.
+ *
+ * @file geometry/triangulate.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+// geometry
+#include <geometry/geometry.h>
+
+// Rings with this many verticies or less are clipped ear by ear
+#define GEOMETRY_TRIANGULATE_EAR_LIMIT 8
+
+// Function declarations
+
+// Operations
+/** !
+ * Triangulate a simple polygon of either orientation. A polygon of n
+ * verticies gives n - 2 counterclockwise triangles. Triangle i is stored
+ * as the indices p_indices[3 * i] to p_indices[3 * i + 2] of the verticies
+ * of the polygon, and as the geometry p_triangles[i].
+ *
+ * @param p_polygon   the polygon
+ * @param p_indices   return room for 3 * ( n - 2 ) indices; may be null
+ * @param p_triangles return room for n - 2 triangles; may be null
+ * @param p_quantity  return the quantity of triangles
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int geometry_polygon_triangulate ( geometry_polygon *p_polygon, size_t *p_indices, geometry *p_triangles, size_t *p_quantity );
@@ -0,0 +1,756 @@
+/** !
+ * Spatial join
+ *
+ * @file join.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <string.h>
+
+// Header
+#include <geometry/join.h>
+#include <geometry/parallel.h>
+
+// Structure declarations
+struct geometry_join_buffer_s;
+struct geometry_join_s;
+struct geometry_join_result_s;
+
+// Type definitions
+typedef struct geometry_join_buffer_s geometry_join_buffer;
+typedef struct geometry_join_s        geometry_join_state;
+typedef struct geometry_join_result_s geometry_join_result;
+
+// Structure definitions
+// The pairs one thread found in one round
+struct geometry_join_buffer_s
+{
+    geometry_join_pair *p_pairs;
+    size_t              quantity,
+                        capacity;
+};
+
+// The envelopes of the second array follow the envelopes of the first.
+// The geometry binned in cell i of an array is p_entries[p_offsets[i]] to
+// p_entries[p_offsets[i+1]], and cell i is column i % columns of row
+// i / columns.
+struct geometry_join_s
+{
+    geometry                       *p_a,
+                                   *p_b;
+    size_t                          a_quantity,
+                                    b_quantity;
+    enum geometry_join_predicate_e  predicate;
+    double                          distance;
+    geometry_envelope              *p_envelopes,
+                                    extent;
+    double                          cell_width,
+                                    cell_height;
+    size_t                          columns,
+                                    rows,
+                                    round;
+    size_t                         *p_offsets[2],
+                                   *p_entries[2];
+    geometry_join_buffer            buffers[GEOMETRY_PARALLEL_THREADS_MAX];
+};
+
+// The pairs of a join, gathered by a callback
+struct geometry_join_result_s
+{
+    geometry_join_pair *p_pairs;
+    size_t              quantity,
+                        capacity;
+};
+
+// Forward declarations
+/** !
+ * Get the envelope of each geometry of a range of both arrays
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first index of the chunk
+ * @param last        one past the last index of the chunk
+ * @param p_parameter the join
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_join_envelopes ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Find the cells an envelope covers
+ *
+ * @param p_join     the join
+ * @param p_envelope the envelope
+ * @param p_columns  return the first and last column
+ * @param p_rows     return the first and last row
+ *
+ * @return true if the envelope covers any cell, else false
+ */
+static bool geometry_join_cells ( geometry_join_state *p_join, const geometry_envelope *p_envelope, size_t *p_columns, size_t *p_rows );
+
+/** !
+ * Bin the envelopes of an array into the cells they cover
+ *
+ * @param p_join the join
+ * @param side   0 for the first array, 1 for the second array
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_join_bin ( geometry_join_state *p_join, size_t side );
+
+/** !
+ * Join the geometry of a range of the cells of a round
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first cell of the chunk, from the start of the round
+ * @param last        one past the last cell of the chunk, from the start of the round
+ * @param p_parameter the join
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_join_round ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Test if a pair of geometry satisfies the predicate of a join
+ *
+ * @param p_join   the join
+ * @param a        the index of the geometry of the first array
+ * @param b        the index of the geometry of the second array
+ * @param p_result return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_join_test ( geometry_join_state *p_join, size_t a, size_t b, bool *p_result );
+
+/** !
+ * Store a pair in a buffer
+ *
+ * @param pp_pairs   the pairs
+ * @param p_quantity the quantity of pairs
+ * @param p_capacity the capacity of the pairs
+ * @param a          the index of the geometry of the first array
+ * @param b          the index of the geometry of the second array
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_join_push ( geometry_join_pair **pp_pairs, size_t *p_quantity, size_t *p_capacity, size_t a, size_t b );
+
+/** !
+ * Gather a pair into a result
+ *
+ * @param a           the index of the geometry of the first array
+ * @param b           the index of the geometry of the second array
+ * @param p_parameter the result
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_join_gather ( size_t a, size_t b, void *p_parameter );
+
+/** !
+ * @return < 0 if A is first, > 0 if B is first, else 0
+ */
+static int geometry_join_pair_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * Release the memory held by a join
+ *
+ * @param p_join the join
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_join_destroy ( geometry_join_state *p_join );
+
+// Function definitions
+int geometry_join_each ( geometry *p_a, size_t a_quantity, geometry *p_b, size_t b_quantity, enum geometry_join_predicate_e predicate, double distance, fn_geometry_join_callback pfn_callback, void *p_parameter )
+{
+
+    // Argument check
+    if ( p_a == (void *) 0 && a_quantity ) goto no_a;
+    if ( p_b == (void *) 0 && b_quantity ) goto no_b;
+    if ( predicate >= GEOMETRY_JOIN_QUANTITY ) goto invalid_predicate;
+    if ( predicate == GEOMETRY_JOIN_WITHIN_DISTANCE && !( distance >= 0 ) ) goto invalid_distance;
+    if ( pfn_callback == (void *) 0 ) goto no_callback;
+
+    // Initialized data
+    geometry_join_state _join   = { .p_a = p_a, .p_b = p_b, .a_quantity = a_quantity, .b_quantity = b_quantity, .predicate = predicate, .distance = distance },
+                        *p_join = &_join;
+    geometry_envelope   _a      = { INFINITY, INFINITY, -INFINITY, -INFINITY },
+                        _b      = { INFINITY, INFINITY, -INFINITY, -INFINITY };
+    size_t              cells   = 0;
+
+    // Nothing to join
+    if ( a_quantity == 0 || b_quantity == 0 ) return 1;
+
+    // Allocate memory for the envelopes
+    p_join->p_envelopes = GEOMETRY_REALLOC(0, sizeof(geometry_envelope) * ( a_quantity + b_quantity ));
+
+    // Error check
+    if ( p_join->p_envelopes == (void *) 0 ) goto no_mem;
+
+    // Get the envelopes, caching them in the geometry
+    if ( geometry_parallel_for(a_quantity + b_quantity, GEOMETRY_JOIN_ENVELOPE_GRAIN, geometry_join_envelopes, p_join) == 0 ) goto failed_to_get_envelopes;
+
+    // Compute the extent of each array
+    for (size_t i = 0; i < a_quantity + b_quantity; i++)
+    {
+
+        // Initialized data
+        geometry_envelope *p_envelope = &p_join->p_envelopes[i],
+                          *p_extent   = ( i < a_quantity ) ? &_a : &_b;
+
+        // Grow the extent
+        p_extent->x_min = fmin(p_extent->x_min, p_envelope->x_min),
+        p_extent->y_min = fmin(p_extent->y_min, p_envelope->y_min),
+        p_extent->x_max = fmax(p_extent->x_max, p_envelope->x_max),
+        p_extent->y_max = fmax(p_extent->y_max, p_envelope->y_max);
+    }
+
+    // The grid covers the region where the extents overlap
+    p_join->extent = (geometry_envelope)
+    {
+        .x_min = fmax(_a.x_min, _b.x_min),
+        .y_min = fmax(_a.y_min, _b.y_min),
+        .x_max = fmin(_a.x_max, _b.x_max),
+        .y_max = fmin(_a.y_max, _b.y_max)
+    };
+
+    // Extents that do not overlap have no pairs
+    if ( !( p_join->extent.x_min <= p_join->extent.x_max && p_join->extent.y_min <= p_join->extent.y_max ) ) goto done;
+
+    // Size the grid
+    {
+
+        // Initialized data
+        double width  = p_join->extent.x_max - p_join->extent.x_min,
+               height = p_join->extent.y_max - p_join->extent.y_min,
+               span   = ceil(sqrt((double) ( a_quantity + b_quantity ) / GEOMETRY_JOIN_CELL_LOAD));
+
+        // Clamp
+        if ( span < 1 ) span = 1;
+        if ( span > GEOMETRY_JOIN_CELLS_MAX ) span = GEOMETRY_JOIN_CELLS_MAX;
+
+        // Store the grid
+        p_join->columns     = ( width  > 0 ) ? (size_t) span : 1,
+        p_join->rows        = ( height > 0 ) ? (size_t) span : 1,
+        p_join->cell_width  = ( width  > 0 ) ? width  / (double) p_join->columns : 1,
+        p_join->cell_height = ( height > 0 ) ? height / (double) p_join->rows    : 1;
+    }
+
+    // Bin both arrays
+    cells = p_join->columns * p_join->rows;
+    for (size_t i = 0; i < 2; i++)
+        if ( geometry_join_bin(p_join, i) == 0 ) goto failed_to_bin;
+
+    // Join each round of cells
+    for (p_join->round = 0; p_join->round < cells; p_join->round += GEOMETRY_JOIN_ROUND)
+    {
+
+        // Initialized data
+        size_t quantity = ( cells - p_join->round < GEOMETRY_JOIN_ROUND ) ? cells - p_join->round : GEOMETRY_JOIN_ROUND;
+
+        // Join the cells of the round
+        if ( geometry_parallel_for(quantity, GEOMETRY_JOIN_GRAIN, geometry_join_round, p_join) == 0 ) goto failed_to_join;
+
+        // Pass the pairs of each thread to the caller
+        for (size_t i = 0; i < GEOMETRY_PARALLEL_THREADS_MAX; i++)
+        {
+            for (size_t j = 0; j < p_join->buffers[i].quantity; j++)
+                if ( pfn_callback(p_join->buffers[i].p_pairs[j].a, p_join->buffers[i].p_pairs[j].b, p_parameter) == 0 ) goto callback_failed;
+
+            // Empty the buffer
+            p_join->buffers[i].quantity = 0;
+        }
+    }
+
+    done:
+
+    // Clean up
+    geometry_join_destroy(p_join);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            invalid_predicate:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"predicate\" is invalid in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            invalid_distance:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"distance\" must not be negative in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_callback:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pfn_callback\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_get_envelopes:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to get envelopes in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_join_destroy(p_join);
+
+                // Error
+                return 0;
+
+            failed_to_bin:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to bin geometry in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_join_destroy(p_join);
+
+                // Error
+                return 0;
+
+            failed_to_join:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to join cells in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_join_destroy(p_join);
+
+                // Error
+                return 0;
+
+            callback_failed:
+                #ifndef NDEBUG
+                    log_error("[geometry] Callback returned an error in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_join_destroy(p_join);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_join ( geometry *p_a, size_t a_quantity, geometry *p_b, size_t b_quantity, enum geometry_join_predicate_e predicate, double distance, geometry_join_pair **pp_pairs, size_t *p_quantity )
+{
+
+    // Argument check
+    if ( pp_pairs   == (void *) 0 ) goto no_pairs;
+    if ( p_quantity == (void *) 0 ) goto no_quantity;
+
+    // Initialized data
+    geometry_join_result _result = { 0 };
+
+    // Gather the pairs
+    if ( geometry_join_each(p_a, a_quantity, p_b, b_quantity, predicate, distance, geometry_join_gather, &_result) == 0 ) goto failed_to_join;
+
+    // Sort the pairs
+    if ( _result.quantity ) qsort(_result.p_pairs, _result.quantity, sizeof(geometry_join_pair), geometry_join_pair_compare);
+
+    // Return the pairs to the caller
+    *pp_pairs   = _result.p_pairs,
+    *p_quantity = _result.quantity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_pairs:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_pairs\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_quantity:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_join:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to join geometry in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( _result.p_pairs ) _result.p_pairs = GEOMETRY_REALLOC(_result.p_pairs, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_join_envelopes ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_join_state *p_join = p_parameter;
+
+    // Unused
+    (void) chunk;
+
+    // Get the envelope of each geometry
+    for (size_t i = first; i < last; i++)
+    {
+
+        // Initialized data
+        geometry_envelope *p_envelope = &p_join->p_envelopes[i];
+
+        // Get the envelope
+        if ( geometry_envelope_get(( i < p_join->a_quantity ) ? &p_join->p_a[i] : &p_join->p_b[i - p_join->a_quantity], p_envelope) == 0 ) return 0;
+
+        // Geometry within the distance of the first array has envelopes within the distance
+        if ( p_join->predicate == GEOMETRY_JOIN_WITHIN_DISTANCE && i < p_join->a_quantity )
+            p_envelope->x_min -= p_join->distance,
+            p_envelope->y_min -= p_join->distance,
+            p_envelope->x_max += p_join->distance,
+            p_envelope->y_max += p_join->distance;
+    }
+
+    // Success
+    return 1;
+}
+
+static bool geometry_join_cells ( geometry_join_state *p_join, const geometry_envelope *p_envelope, size_t *p_columns, size_t *p_rows )
+{
+
+    // Initialized data
+    double x_min = fmax(p_envelope->x_min, p_join->extent.x_min),
+           y_min = fmax(p_envelope->y_min, p_join->extent.y_min),
+           x_max = fmin(p_envelope->x_max, p_join->extent.x_max),
+           y_max = fmin(p_envelope->y_max, p_join->extent.y_max);
+
+    // Empty envelopes, and envelopes off of the grid, cover no cell
+    if ( !( x_min <= x_max && y_min <= y_max ) ) return false;
+
+    // Find the cells
+    p_columns[0] = (size_t) ( ( x_min - p_join->extent.x_min ) / p_join->cell_width ),
+    p_columns[1] = (size_t) ( ( x_max - p_join->extent.x_min ) / p_join->cell_width ),
+    p_rows[0]    = (size_t) ( ( y_min - p_join->extent.y_min ) / p_join->cell_height ),
+    p_rows[1]    = (size_t) ( ( y_max - p_join->extent.y_min ) / p_join->cell_height );
+
+    // Clamp the far edge of the grid into the last cell
+    if ( p_columns[0] >= p_join->columns ) p_columns[0] = p_join->columns - 1;
+    if ( p_columns[1] >= p_join->columns ) p_columns[1] = p_join->columns - 1;
+    if ( p_rows[0]    >= p_join->rows    ) p_rows[0]    = p_join->rows - 1;
+    if ( p_rows[1]    >= p_join->rows    ) p_rows[1]    = p_join->rows - 1;
+
+    // Done
+    return true;
+}
+
+static int geometry_join_bin ( geometry_join_state *p_join, size_t side )
+{
+
+    // Initialized data
+    size_t             cells       = p_join->columns * p_join->rows,
+                       quantity    = ( side ) ? p_join->b_quantity : p_join->a_quantity;
+    geometry_envelope *p_envelopes = p_join->p_envelopes + ( ( side ) ? p_join->a_quantity : 0 );
+    size_t            *p_offsets   = GEOMETRY_REALLOC(0, sizeof(size_t) * ( cells + 1 )),
+                      *p_entries   = (void *) 0;
+
+    // Error check
+    if ( p_offsets == (void *) 0 ) goto no_mem;
+
+    // Store the offsets
+    p_join->p_offsets[side] = p_offsets;
+
+    // Clear the counts
+    memset(p_offsets, 0, sizeof(size_t) * ( cells + 1 ));
+
+    // Count the geometry of each cell, one cell ahead
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        size_t columns[2] = { 0 },
+               rows[2]    = { 0 };
+
+        // Skip geometry off of the grid
+        if ( geometry_join_cells(p_join, &p_envelopes[i], columns, rows) == false ) continue;
+
+        // Count the geometry in each cell it covers
+        for (size_t r = rows[0]; r <= rows[1]; r++)
+            for (size_t c = columns[0]; c <= columns[1]; c++)
+                p_offsets[r * p_join->columns + c + 1]++;
+    }
+
+    // Sum the counts
+    for (size_t i = 0; i < cells; i++)
+        p_offsets[i + 1] += p_offsets[i];
+
+    // Allocate memory for the entries
+    p_entries = GEOMETRY_REALLOC(0, sizeof(size_t) * ( p_offsets[cells] + 1 ));
+
+    // Error check
+    if ( p_entries == (void *) 0 ) goto no_mem;
+
+    // Store the entries
+    p_join->p_entries[side] = p_entries;
+
+    // Fill each cell, moving its offset to its end
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        size_t columns[2] = { 0 },
+               rows[2]    = { 0 };
+
+        // Skip geometry off of the grid
+        if ( geometry_join_cells(p_join, &p_envelopes[i], columns, rows) == false ) continue;
+
+        // Store the geometry in each cell it covers
+        for (size_t r = rows[0]; r <= rows[1]; r++)
+            for (size_t c = columns[0]; c <= columns[1]; c++)
+                p_entries[p_offsets[r * p_join->columns + c]++] = i;
+    }
+
+    // Move each offset back to the start of its cell
+    for (size_t i = cells; i > 0; i--)
+        p_offsets[i] = p_offsets[i - 1];
+    p_offsets[0] = 0;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_join_round ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_join_state  *p_join   = p_parameter;
+    geometry_join_buffer *p_buffer = &p_join->buffers[chunk];
+
+    // Join each cell
+    for (size_t cell = p_join->round + first; cell < p_join->round + last; cell++)
+    {
+
+        // Initialized data
+        size_t *p_a        = &p_join->p_entries[0][p_join->p_offsets[0][cell]],
+               *p_b        = &p_join->p_entries[1][p_join->p_offsets[1][cell]],
+                a_quantity = p_join->p_offsets[0][cell + 1] - p_join->p_offsets[0][cell],
+                b_quantity = p_join->p_offsets[1][cell + 1] - p_join->p_offsets[1][cell];
+
+        // Compare each pair of the cell
+        for (size_t i = 0; i < a_quantity; i++)
+            for (size_t j = 0; j < b_quantity; j++)
+            {
+
+                // Initialized data
+                geometry_envelope *p_a_envelope = &p_join->p_envelopes[p_a[i]],
+                                  *p_b_envelope = &p_join->p_envelopes[p_join->a_quantity + p_b[j]];
+                double             x            = fmax(p_a_envelope->x_min, p_b_envelope->x_min),
+                                   y            = fmax(p_a_envelope->y_min, p_b_envelope->y_min);
+                geometry_envelope  _corner      = { x, y, x, y };
+                size_t             columns[2]   = { 0 },
+                                   rows[2]      = { 0 };
+                bool               result       = false;
+
+                // Skip pairs whose envelopes are apart
+                if ( p_a_envelope->x_max < p_b_envelope->x_min || p_b_envelope->x_max < p_a_envelope->x_min ) continue;
+                if ( p_a_envelope->y_max < p_b_envelope->y_min || p_b_envelope->y_max < p_a_envelope->y_min ) continue;
+
+                // Only the first array contains the second
+                if ( p_join->predicate == GEOMETRY_JOIN_CONTAINS &&
+                     ( p_b_envelope->x_min < p_a_envelope->x_min || p_b_envelope->x_max > p_a_envelope->x_max ||
+                       p_b_envelope->y_min < p_a_envelope->y_min || p_b_envelope->y_max > p_a_envelope->y_max ) ) continue;
+
+                // Test each pair in one cell, the cell of the lower left corner of the overlap
+                geometry_join_cells(p_join, &_corner, columns, rows);
+                if ( rows[0] * p_join->columns + columns[0] != cell ) continue;
+
+                // Test the pair
+                if ( geometry_join_test(p_join, p_a[i], p_b[j], &result) == 0 ) return 0;
+
+                // Store the pair
+                if ( result && geometry_join_push(&p_buffer->p_pairs, &p_buffer->quantity, &p_buffer->capacity, p_a[i], p_b[j]) == 0 ) return 0;
+            }
+    }
+
+    // Success
+    return 1;
+}
+
+static int geometry_join_test ( geometry_join_state *p_join, size_t a, size_t b, bool *p_result )
+{
+
+    // Initialized data
+    geometry *p_a = &p_join->p_a[a],
+             *p_b = &p_join->p_b[b];
+
+    // Strategy
+    switch ( p_join->predicate )
+    {
+        case GEOMETRY_JOIN_INTERSECTS:
+            return geometry_intersects(p_a, p_b, p_result);
+
+        case GEOMETRY_JOIN_CONTAINS:
+            return geometry_contains(p_a, p_b, p_result);
+
+        case GEOMETRY_JOIN_WITHIN_DISTANCE:
+            return geometry_distance_within(p_a, p_b, p_join->distance, p_result);
+
+        case GEOMETRY_JOIN_QUANTITY:
+        default:
+            return 0;
+    }
+}
+
+static int geometry_join_push ( geometry_join_pair **pp_pairs, size_t *p_quantity, size_t *p_capacity, size_t a, size_t b )
+{
+
+    // Grow
+    if ( *p_quantity == *p_capacity )
+    {
+
+        // Initialized data
+        size_t              capacity = ( *p_capacity ) ? 2 * *p_capacity : 64;
+        geometry_join_pair *p_pairs  = GEOMETRY_REALLOC(*pp_pairs, sizeof(geometry_join_pair) * capacity);
+
+        // Error check
+        if ( p_pairs == (void *) 0 ) goto no_mem;
+
+        // Store the pairs
+        *pp_pairs   = p_pairs,
+        *p_capacity = capacity;
+    }
+
+    // Store the pair
+    (*pp_pairs)[(*p_quantity)++] = (geometry_join_pair) { .a = a, .b = b };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_join_gather ( size_t a, size_t b, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_join_result *p_result = p_parameter;
+
+    // Done
+    return geometry_join_push(&p_result->p_pairs, &p_result->quantity, &p_result->capacity, a, b);
+}
+
+static int geometry_join_pair_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_join_pair *p_pair_a = p_a,
+                             *p_pair_b = p_b;
+
+    // By a
+    if ( p_pair_a->a != p_pair_b->a ) return ( p_pair_a->a > p_pair_b->a ) ? 1 : -1;
+
+    // By b
+    return ( p_pair_a->b > p_pair_b->b ) - ( p_pair_a->b < p_pair_b->b );
+}
+
+static int geometry_join_destroy ( geometry_join_state *p_join )
+{
+
+    // Release the buffers
+    for (size_t i = 0; i < GEOMETRY_PARALLEL_THREADS_MAX; i++)
+        if ( p_join->buffers[i].p_pairs ) p_join->buffers[i].p_pairs = GEOMETRY_REALLOC(p_join->buffers[i].p_pairs, 0);
+
+    // Release the cells
+    for (size_t i = 0; i < 2; i++)
+    {
+        if ( p_join->p_offsets[i] ) p_join->p_offsets[i] = GEOMETRY_REALLOC(p_join->p_offsets[i], 0);
+        if ( p_join->p_entries[i] ) p_join->p_entries[i] = GEOMETRY_REALLOC(p_join->p_entries[i], 0);
+    }
+
+    // Release the envelopes
+    if ( p_join->p_envelopes ) p_join->p_envelopes = GEOMETRY_REALLOC(p_join->p_envelopes, 0);
+
+    // Success
+    return 1;
+}
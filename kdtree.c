@@ -0,0 +1,1010 @@
+/** !
+ * k-d tree
+ *
+ * @file kdtree.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Header
+#include <geometry/kdtree.h>
+#include <geometry/parallel.h>
+
+// Preprocessor definitions
+#define GEOMETRY_KDTREE_AXIS(p, axis) ( ( axis ) ? ( p ).y : ( p ).x )
+
+// Structure declarations
+struct geometry_kdtree_nearest_s;
+struct geometry_kdtree_range_s;
+struct geometry_kdtree_morton_s;
+struct geometry_kdtree_split_s;
+struct geometry_kdtree_batch_s;
+
+// Type definitions
+typedef struct geometry_kdtree_nearest_s geometry_kdtree_nearest_state;
+typedef struct geometry_kdtree_range_s   geometry_kdtree_range_state;
+typedef struct geometry_kdtree_morton_s  geometry_kdtree_morton;
+typedef struct geometry_kdtree_split_s   geometry_kdtree_split;
+typedef struct geometry_kdtree_batch_s   geometry_kdtree_batch;
+
+// Structure definitions
+// Positions are indices into the tree, and distances are squared, until
+// the search is finished
+struct geometry_kdtree_nearest_s
+{
+    geometry_point  point;
+    size_t          k,
+                    quantity,
+                   *p_results;
+    double         *p_distances;
+};
+
+struct geometry_kdtree_range_s
+{
+    geometry_point     point;
+    double             radius_squared;
+    geometry_envelope  envelope;
+    size_t             capacity,
+                       quantity,
+                      *p_results;
+};
+
+struct geometry_kdtree_morton_s
+{
+    uint32_t code;
+    size_t   index;
+};
+
+// The sides of a subtree are lo to median, and median + 1 to hi
+struct geometry_kdtree_split_s
+{
+    geometry_kdtree *p_kdtree;
+    size_t           lo,
+                     median,
+                     hi,
+                     depth;
+};
+
+// The queries are answered in the order of p_order. The neighbours of
+// the previous query of chunk i are stored in p_previous from k * i.
+struct geometry_kdtree_batch_s
+{
+    geometry_kdtree        *p_kdtree;
+    geometry_point         *p_points;
+    geometry_kdtree_morton *p_order;
+    size_t                  k,
+                           *p_results,
+                           *p_counts,
+                           *p_previous;
+    double                 *p_distances;
+};
+
+// Forward declarations
+/** !
+ * Reorder a range of the tree so the nth point is the one that would be
+ * there if the range were sorted on an axis
+ *
+ * @param p_kdtree the k-d tree
+ * @param lo       the first point of the range
+ * @param hi       one past the last point of the range
+ * @param nth      the point to place
+ * @param axis     0 for x, 1 for y
+ *
+ * @return void
+ */
+static void geometry_kdtree_select ( geometry_kdtree *p_kdtree, size_t lo, size_t hi, size_t nth, int axis );
+
+/** !
+ * Arrange a range of the tree into a subtree
+ *
+ * @param p_kdtree the k-d tree
+ * @param lo       the first point of the range
+ * @param hi       one past the last point of the range
+ * @param depth    the depth of the subtree
+ *
+ * @return void
+ */
+static void geometry_kdtree_build ( geometry_kdtree *p_kdtree, size_t lo, size_t hi, size_t depth );
+
+/** !
+ * Arrange the sides of a split into subtrees
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first side of the chunk; 0 for below the median, 1 for above
+ * @param last        one past the last side of the chunk
+ * @param p_parameter the split
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_kdtree_build_sides ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Answer a chunk of the queries of a batch, in order
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first query of the chunk, in order
+ * @param last        one past the last query of the chunk
+ * @param p_parameter the batch
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_kdtree_nearest_chunk ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Offer a point to a k nearest search
+ *
+ * @param p_state          the search
+ * @param position         the position of the point in the tree
+ * @param distance_squared the squared distance to the point
+ *
+ * @return void
+ */
+static void geometry_kdtree_nearest_insert ( geometry_kdtree_nearest_state *p_state, size_t position, double distance_squared );
+
+/** !
+ * Visit a subtree of a k nearest search, nearest side first
+ *
+ * @param p_kdtree the k-d tree
+ * @param lo       the first point of the subtree
+ * @param hi       one past the last point of the subtree
+ * @param depth    the depth of the subtree
+ * @param p_state  the search
+ *
+ * @return void
+ */
+static void geometry_kdtree_nearest_visit ( geometry_kdtree *p_kdtree, size_t lo, size_t hi, size_t depth, geometry_kdtree_nearest_state *p_state );
+
+/** !
+ * Finish a k nearest search, storing indices and distances
+ *
+ * @param p_kdtree the k-d tree
+ * @param p_state  the search
+ *
+ * @return void
+ */
+static void geometry_kdtree_nearest_finish ( geometry_kdtree *p_kdtree, geometry_kdtree_nearest_state *p_state );
+
+/** !
+ * Visit a subtree of a radius or envelope search
+ *
+ * @param p_kdtree the k-d tree
+ * @param lo       the first point of the subtree
+ * @param hi       one past the last point of the subtree
+ * @param depth    the depth of the subtree
+ * @param p_state  the search
+ *
+ * @return void
+ */
+static void geometry_kdtree_range_visit ( geometry_kdtree *p_kdtree, size_t lo, size_t hi, size_t depth, geometry_kdtree_range_state *p_state );
+
+/** !
+ * Compare two Morton codes
+ *
+ * @param p_a the first code
+ * @param p_b the second code
+ *
+ * @return -1, 0 or 1, as for qsort
+ */
+static int geometry_kdtree_morton_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * Spread the low 16 bits of an integer over the even bits
+ *
+ * @param value the integer
+ *
+ * @return the spread bits
+ */
+static uint32_t geometry_morton_spread ( uint32_t value );
+
+// Function definitions
+int geometry_kdtree_construct ( geometry_kdtree **pp_kdtree, geometry_point_list *p_point_list )
+{
+
+    // Argument check
+    if ( pp_kdtree    == (void *) 0 ) goto no_kdtree;
+    if ( p_point_list == (void *) 0 ) goto no_point_list;
+
+    // Initialized data
+    size_t           quantity = p_point_list->quantity;
+    geometry_kdtree *p_kdtree = GEOMETRY_REALLOC(0, sizeof(geometry_kdtree) + ( sizeof(geometry_point) + sizeof(size_t) ) * quantity);
+
+    // Error check
+    if ( p_kdtree == (void *) 0 ) goto no_mem;
+
+    // The points and their indices follow the tree
+    *p_kdtree = (geometry_kdtree)
+    {
+        .quantity  = quantity,
+        .p_points  = (geometry_point *) ( p_kdtree + 1 ),
+        .p_indices = (size_t *) ( (geometry_point *) ( p_kdtree + 1 ) + quantity )
+    };
+
+    // Copy the points
+    if ( quantity ) memcpy(p_kdtree->p_points, p_point_list->p_points, sizeof(geometry_point) * quantity);
+
+    // Store the indices
+    for (size_t i = 0; i < quantity; i++)
+        p_kdtree->p_indices[i] = i;
+
+    // Arrange the points
+    geometry_kdtree_build(p_kdtree, 0, quantity, 0);
+
+    // Return a pointer to the caller
+    *pp_kdtree = p_kdtree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_kdtree:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_kdtree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_point_list:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_kdtree_nearest ( geometry_kdtree *p_kdtree, geometry_point *p_point, size_t k, size_t *p_results, double *p_distances, size_t *p_quantity )
+{
+
+    // Argument check
+    if ( p_kdtree    == (void *) 0 ) goto no_kdtree;
+    if ( p_point     == (void *) 0 ) goto no_point;
+    if ( p_results   == (void *) 0 ) goto no_results;
+    if ( p_distances == (void *) 0 ) goto no_distances;
+    if ( p_quantity  == (void *) 0 ) goto no_quantity;
+
+    // Initialized data
+    geometry_kdtree_nearest_state _state =
+    {
+        .point       = *p_point,
+        .k           = k,
+        .quantity    = 0,
+        .p_results   = p_results,
+        .p_distances = p_distances
+    };
+
+    // Search the tree
+    if ( k ) geometry_kdtree_nearest_visit(p_kdtree, 0, p_kdtree->quantity, 0, &_state);
+
+    // Store the results
+    geometry_kdtree_nearest_finish(p_kdtree, &_state);
+
+    // Return the quantity to the caller
+    *p_quantity = _state.quantity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_kdtree:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_kdtree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_distances:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_distances\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_quantity:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_kdtree_nearest_batch ( geometry_kdtree *p_kdtree, geometry_point *p_points, size_t quantity, size_t k, size_t *p_results, double *p_distances, size_t *p_counts )
+{
+
+    // Argument check
+    if ( p_kdtree    == (void *) 0 ) goto no_kdtree;
+    if ( p_points    == (void *) 0 ) goto no_points;
+    if ( p_results   == (void *) 0 ) goto no_results;
+    if ( p_distances == (void *) 0 ) goto no_distances;
+
+    // Initialized data
+    geometry_kdtree_morton *p_order    = (void *) 0;
+    geometry_kdtree_batch   _batch     = { 0 };
+    size_t                  chunks     = geometry_parallel_chunks(quantity, GEOMETRY_KDTREE_BATCH_GRAIN);
+    geometry_envelope       _bounds    = { INFINITY, INFINITY, -INFINITY, -INFINITY };
+    double                  scale_x    = 0,
+                            scale_y    = 0;
+
+    // Nothing to do
+    if ( quantity == 0 || k == 0 ) goto done;
+
+    // Allocate the query order, and the neighbours of the previous query
+    // of each chunk
+    p_order = GEOMETRY_REALLOC(0, sizeof(geometry_kdtree_morton) * quantity + sizeof(size_t) * k * chunks);
+
+    // Error check
+    if ( p_order == (void *) 0 ) goto no_mem;
+
+    // Compute the bounds of the queries
+    for (size_t i = 0; i < quantity; i++)
+        _bounds.x_min = fmin(_bounds.x_min, p_points[i].x),
+        _bounds.y_min = fmin(_bounds.y_min, p_points[i].y),
+        _bounds.x_max = fmax(_bounds.x_max, p_points[i].x),
+        _bounds.y_max = fmax(_bounds.y_max, p_points[i].y);
+
+    // Map the bounds onto a 16 bit grid
+    scale_x = ( _bounds.x_max > _bounds.x_min ) ? 65535.0 / ( _bounds.x_max - _bounds.x_min ) : 0,
+    scale_y = ( _bounds.y_max > _bounds.y_min ) ? 65535.0 / ( _bounds.y_max - _bounds.y_min ) : 0;
+
+    // Compute the Morton code of each query
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        double x = ( p_points[i].x - _bounds.x_min ) * scale_x,
+               y = ( p_points[i].y - _bounds.y_min ) * scale_y;
+
+        // Store the code. Points that are not numbers go last.
+        p_order[i] = (geometry_kdtree_morton)
+        {
+            .code  = ( x >= 0 && y >= 0 ) ? geometry_morton_spread((uint32_t) x) | geometry_morton_spread((uint32_t) y) << 1 : UINT32_MAX,
+            .index = i
+        };
+    }
+
+    // Sort the queries along the curve
+    qsort(p_order, quantity, sizeof(geometry_kdtree_morton), geometry_kdtree_morton_compare);
+
+    // Store the batch. The neighbours of the previous queries follow the order.
+    _batch = (geometry_kdtree_batch)
+    {
+        .p_kdtree    = p_kdtree,
+        .p_points    = p_points,
+        .p_order     = p_order,
+        .k           = k,
+        .p_results   = p_results,
+        .p_counts    = p_counts,
+        .p_previous  = (size_t *) ( p_order + quantity ),
+        .p_distances = p_distances
+    };
+
+    // Answer each query. Each chunk follows its own part of the curve.
+    if ( geometry_parallel_for(quantity, GEOMETRY_KDTREE_BATCH_GRAIN, geometry_kdtree_nearest_chunk, &_batch) == 0 ) goto failed_to_run_tasks;
+
+    // Release the order
+    p_order = GEOMETRY_REALLOC(p_order, 0);
+
+    done:
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_kdtree:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_kdtree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_points:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_points\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_distances:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_distances\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_run_tasks:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to run parallel tasks in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                p_order = GEOMETRY_REALLOC(p_order, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_kdtree_radius ( geometry_kdtree *p_kdtree, geometry_point *p_point, double radius, size_t *p_results, size_t capacity, size_t *p_quantity )
+{
+
+    // Argument check
+    if ( p_kdtree   == (void *) 0 ) goto no_kdtree;
+    if ( p_point    == (void *) 0 ) goto no_point;
+    if ( p_results  == (void *) 0 && capacity ) goto no_results;
+    if ( p_quantity == (void *) 0 ) goto no_quantity;
+
+    // Initialized data
+    geometry_kdtree_range_state _state =
+    {
+        .point          = *p_point,
+        .radius_squared = radius * radius,
+        .envelope       = { p_point->x - radius, p_point->y - radius, p_point->x + radius, p_point->y + radius },
+        .capacity       = capacity,
+        .quantity       = 0,
+        .p_results      = p_results
+    };
+
+    // Search the tree
+    if ( radius >= 0 ) geometry_kdtree_range_visit(p_kdtree, 0, p_kdtree->quantity, 0, &_state);
+
+    // Return the quantity to the caller
+    *p_quantity = _state.quantity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_kdtree:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_kdtree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_quantity:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_kdtree_envelope ( geometry_kdtree *p_kdtree, geometry_envelope *p_envelope, size_t *p_results, size_t capacity, size_t *p_quantity )
+{
+
+    // Argument check
+    if ( p_kdtree   == (void *) 0 ) goto no_kdtree;
+    if ( p_envelope == (void *) 0 ) goto no_envelope;
+    if ( p_results  == (void *) 0 && capacity ) goto no_results;
+    if ( p_quantity == (void *) 0 ) goto no_quantity;
+
+    // Initialized data
+    geometry_kdtree_range_state _state =
+    {
+        .radius_squared = INFINITY,
+        .envelope       = *p_envelope,
+        .capacity       = capacity,
+        .quantity       = 0,
+        .p_results      = p_results
+    };
+
+    // Search the tree
+    geometry_kdtree_range_visit(p_kdtree, 0, p_kdtree->quantity, 0, &_state);
+
+    // Return the quantity to the caller
+    *p_quantity = _state.quantity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_kdtree:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_kdtree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_envelope:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_envelope\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_quantity:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static void geometry_kdtree_select ( geometry_kdtree *p_kdtree, size_t lo, size_t hi, size_t nth, int axis )
+{
+
+    // Initialized data
+    geometry_point *p_points  = p_kdtree->p_points;
+    size_t         *p_indices = p_kdtree->p_indices;
+    ptrdiff_t       l         = (ptrdiff_t) lo,
+                    r         = (ptrdiff_t) hi - 1,
+                    n         = (ptrdiff_t) nth;
+
+    // Narrow the range around the nth point
+    while ( l < r )
+    {
+
+        // Initialized data
+        double    pivot = GEOMETRY_KDTREE_AXIS(p_points[l + ( r - l ) / 2], axis);
+        ptrdiff_t i     = l,
+                  j     = r;
+
+        // Partition around the pivot
+        while ( i <= j )
+        {
+
+            // Find a pair on the wrong sides
+            while ( GEOMETRY_KDTREE_AXIS(p_points[i], axis) < pivot ) i++;
+            while ( GEOMETRY_KDTREE_AXIS(p_points[j], axis) > pivot ) j--;
+
+            // Swap the pair
+            if ( i <= j )
+            {
+
+                // Initialized data
+                geometry_point _point = p_points[i];
+                size_t         index  = p_indices[i];
+
+                // Swap
+                p_points[i]  = p_points[j],
+                p_indices[i] = p_indices[j],
+                p_points[j]  = _point,
+                p_indices[j] = index;
+
+                // Next
+                i++, j--;
+            }
+        }
+
+        // Keep the side holding the nth point. Between the sides, every
+        // point equals the pivot.
+        if      ( n <= j ) r = j;
+        else if ( n >= i ) l = i;
+        else               break;
+    }
+
+    // Done
+    return;
+}
+
+static void geometry_kdtree_build ( geometry_kdtree *p_kdtree, size_t lo, size_t hi, size_t depth )
+{
+
+    // Initialized data
+    size_t median = lo + ( hi - lo ) / 2;
+
+    // Leaf
+    if ( hi - lo <= GEOMETRY_KDTREE_LEAF_SIZE ) return;
+
+    // Place the median
+    geometry_kdtree_select(p_kdtree, lo, hi, median, (int) ( depth & 1 ));
+
+    // Build the sides of a large subtree in parallel
+    if ( hi - lo > GEOMETRY_KDTREE_GRAIN )
+    {
+
+        // Initialized data
+        geometry_kdtree_split _split = { .p_kdtree = p_kdtree, .lo = lo, .median = median, .hi = hi, .depth = depth };
+
+        // Build each side
+        geometry_parallel_for(2, 1, geometry_kdtree_build_sides, &_split);
+
+        // Done
+        return;
+    }
+
+    // Build each side
+    geometry_kdtree_build(p_kdtree, lo, median, depth + 1);
+    geometry_kdtree_build(p_kdtree, median + 1, hi, depth + 1);
+
+    // Done
+    return;
+}
+
+static int geometry_kdtree_build_sides ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_kdtree_split *p_split = p_parameter;
+
+    // Unused
+    (void) chunk;
+
+    // Build each side of the chunk
+    for (size_t i = first; i < last; i++)
+    {
+        if ( i == 0 ) geometry_kdtree_build(p_split->p_kdtree, p_split->lo, p_split->median, p_split->depth + 1);
+        else          geometry_kdtree_build(p_split->p_kdtree, p_split->median + 1, p_split->hi, p_split->depth + 1);
+    }
+
+    // Success
+    return 1;
+}
+
+static int geometry_kdtree_nearest_chunk ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_kdtree_batch *p_batch    = p_parameter;
+    size_t                *p_previous = &p_batch->p_previous[p_batch->k * chunk],
+                           previous   = 0;
+
+    // Answer each query of the chunk
+    for (size_t i = first; i < last; i++)
+    {
+
+        // Initialized data
+        size_t                        query  = p_batch->p_order[i].index;
+        geometry_kdtree_nearest_state _state =
+        {
+            .point       = p_batch->p_points[query],
+            .k           = p_batch->k,
+            .quantity    = 0,
+            .p_results   = &p_batch->p_results[query * p_batch->k],
+            .p_distances = &p_batch->p_distances[query * p_batch->k]
+        };
+
+        // Start from the neighbours of the previous query. Their distances
+        // bound the search before the first descent.
+        for (size_t j = 0; j < previous; j++)
+        {
+
+            // Initialized data
+            geometry_point *p_point = &p_batch->p_kdtree->p_points[p_previous[j]];
+            double          dx      = p_point->x - _state.point.x,
+                            dy      = p_point->y - _state.point.y;
+
+            // Offer the point
+            geometry_kdtree_nearest_insert(&_state, p_previous[j], dx * dx + dy * dy);
+        }
+
+        // Search the tree
+        geometry_kdtree_nearest_visit(p_batch->p_kdtree, 0, p_batch->p_kdtree->quantity, 0, &_state);
+
+        // Remember the neighbours
+        memcpy(p_previous, _state.p_results, sizeof(size_t) * _state.quantity);
+        previous = _state.quantity;
+
+        // Store the results
+        geometry_kdtree_nearest_finish(p_batch->p_kdtree, &_state);
+
+        // Store the quantity
+        if ( p_batch->p_counts ) p_batch->p_counts[query] = _state.quantity;
+    }
+
+
+    // Success
+    return 1;
+}
+
+static void geometry_kdtree_nearest_insert ( geometry_kdtree_nearest_state *p_state, size_t position, double distance_squared )
+{
+
+    // Initialized data
+    size_t j = 0;
+
+    // Too far
+    if ( p_state->quantity == p_state->k && !( distance_squared < p_state->p_distances[p_state->k - 1] ) ) return;
+
+    // Already found, when the search started from other results
+    for (size_t i = 0; i < p_state->quantity; i++)
+        if ( p_state->p_results[i] == position ) return;
+
+    // Insert the point, keeping the results sorted
+    j = ( p_state->quantity < p_state->k ) ? p_state->quantity++ : p_state->k - 1;
+    for (; j > 0 && p_state->p_distances[j - 1] > distance_squared; j--)
+        p_state->p_distances[j] = p_state->p_distances[j - 1],
+        p_state->p_results[j]   = p_state->p_results[j - 1];
+
+    // Store the point
+    p_state->p_distances[j] = distance_squared,
+    p_state->p_results[j]   = position;
+
+    // Done
+    return;
+}
+
+static void geometry_kdtree_nearest_visit ( geometry_kdtree *p_kdtree, size_t lo, size_t hi, size_t depth, geometry_kdtree_nearest_state *p_state )
+{
+
+    // Initialized data
+    geometry_point *p_points = p_kdtree->p_points;
+    size_t          median   = lo + ( hi - lo ) / 2;
+    int             axis     = (int) ( depth & 1 );
+    double          dx       = 0,
+                    dy       = 0,
+                    split    = 0;
+
+    // Leaf
+    if ( hi - lo <= GEOMETRY_KDTREE_LEAF_SIZE )
+    {
+
+        // Offer each point
+        for (size_t i = lo; i < hi; i++)
+            dx = p_points[i].x - p_state->point.x,
+            dy = p_points[i].y - p_state->point.y,
+            geometry_kdtree_nearest_insert(p_state, i, dx * dx + dy * dy);
+
+        // Done
+        return;
+    }
+
+    // Offer the median
+    dx    = p_points[median].x - p_state->point.x,
+    dy    = p_points[median].y - p_state->point.y,
+    split = GEOMETRY_KDTREE_AXIS(p_state->point, axis) - GEOMETRY_KDTREE_AXIS(p_points[median], axis);
+    geometry_kdtree_nearest_insert(p_state, median, dx * dx + dy * dy);
+
+    // Visit the near side
+    if ( split < 0 ) geometry_kdtree_nearest_visit(p_kdtree, lo, median, depth + 1, p_state);
+    else             geometry_kdtree_nearest_visit(p_kdtree, median + 1, hi, depth + 1, p_state);
+
+    // Visit the far side, if it might hold a nearer point
+    if ( p_state->quantity < p_state->k || split * split < p_state->p_distances[p_state->k - 1] )
+    {
+        if ( split < 0 ) geometry_kdtree_nearest_visit(p_kdtree, median + 1, hi, depth + 1, p_state);
+        else             geometry_kdtree_nearest_visit(p_kdtree, lo, median, depth + 1, p_state);
+    }
+
+    // Done
+    return;
+}
+
+static void geometry_kdtree_nearest_finish ( geometry_kdtree *p_kdtree, geometry_kdtree_nearest_state *p_state )
+{
+
+    // Map positions to indices, and squared distances to distances
+    for (size_t i = 0; i < p_state->quantity; i++)
+        p_state->p_results[i]   = p_kdtree->p_indices[p_state->p_results[i]],
+        p_state->p_distances[i] = sqrt(p_state->p_distances[i]);
+
+    // Done
+    return;
+}
+
+static void geometry_kdtree_range_visit ( geometry_kdtree *p_kdtree, size_t lo, size_t hi, size_t depth, geometry_kdtree_range_state *p_state )
+{
+
+    // Initialized data
+    geometry_point    *p_points   = p_kdtree->p_points;
+    geometry_envelope *p_envelope = &p_state->envelope;
+    size_t             median     = lo + ( hi - lo ) / 2;
+    int                axis       = (int) ( depth & 1 );
+    double             split      = 0;
+
+    // Visit each point of a leaf, or the median of a branch
+    for (size_t i = ( hi - lo <= GEOMETRY_KDTREE_LEAF_SIZE ) ? lo : median; i < hi; i++)
+    {
+
+        // Initialized data
+        double dx = p_points[i].x - p_state->point.x,
+               dy = p_points[i].y - p_state->point.y;
+
+        // Test the point
+        if ( p_points[i].x >= p_envelope->x_min && p_points[i].x <= p_envelope->x_max &&
+             p_points[i].y >= p_envelope->y_min && p_points[i].y <= p_envelope->y_max &&
+             ( isinf(p_state->radius_squared) || dx * dx + dy * dy <= p_state->radius_squared ) )
+        {
+
+            // Store the result
+            if ( p_state->quantity < p_state->capacity ) p_state->p_results[p_state->quantity] = p_kdtree->p_indices[i];
+
+            // Count the result
+            p_state->quantity++;
+        }
+
+        // Only the median of a branch is tested here
+        if ( hi - lo > GEOMETRY_KDTREE_LEAF_SIZE ) break;
+    }
+
+    // Leaf
+    if ( hi - lo <= GEOMETRY_KDTREE_LEAF_SIZE ) return;
+
+    // Initialized data
+    split = GEOMETRY_KDTREE_AXIS(p_points[median], axis);
+
+    // Visit each side that overlaps the envelope
+    if ( ( axis ? p_envelope->y_min : p_envelope->x_min ) <= split ) geometry_kdtree_range_visit(p_kdtree, lo, median, depth + 1, p_state);
+    if ( ( axis ? p_envelope->y_max : p_envelope->x_max ) >= split ) geometry_kdtree_range_visit(p_kdtree, median + 1, hi, depth + 1, p_state);
+
+    // Done
+    return;
+}
+
+static int geometry_kdtree_morton_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_kdtree_morton *p_ma = p_a,
+                                 *p_mb = p_b;
+
+    // Success
+    return ( p_ma->code > p_mb->code ) - ( p_ma->code < p_mb->code );
+}
+
+static uint32_t geometry_morton_spread ( uint32_t value )
+{
+
+    // Interleave zeros between the bits
+    value &= 0x0000ffff;
+    value  = ( value | ( value << 8 ) ) & 0x00ff00ff;
+    value  = ( value | ( value << 4 ) ) & 0x0f0f0f0f;
+    value  = ( value | ( value << 2 ) ) & 0x33333333;
+    value  = ( value | ( value << 1 ) ) & 0x55555555;
+
+    // Success
+    return value;
+}
+
+int geometry_kdtree_destroy ( geometry_kdtree **pp_kdtree )
+{
+
+    // Argument check
+    if ( pp_kdtree == (void *) 0 ) goto no_kdtree;
+
+    // Initialized data
+    geometry_kdtree *p_kdtree = *pp_kdtree;
+
+    // Error check
+    if ( p_kdtree == (void *) 0 ) goto pointer_to_null_pointer;
+
+    // No more pointer for caller
+    *pp_kdtree = (void *) 0;
+
+    // Free the tree. The points and indices live in the same block.
+    p_kdtree = GEOMETRY_REALLOC(p_kdtree, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_kdtree:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_kdtree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            pointer_to_null_pointer:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"pp_kdtree\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,418 @@
+/** !
+ * Measure
+ *
+ * @file measure.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <geometry/measure.h>
+#include <geometry/parallel.h>
+
+// Instruction set extensions
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+#endif
+
+// Macros
+// Add v to the compensated sum s, whose running error is c
+#define GEOMETRY_MEASURE_KAHAN(s, c, v) { double _y = ( v ) - ( c ), _t = ( s ) + _y; ( c ) = ( _t - ( s ) ) - _y; ( s ) = _t; }
+
+// Lanes of compensated sums
+#if defined(__AVX2__)
+    #define GEOMETRY_MEASURE_KAHAN_LANES(s, c, v) { __m256d _y = _mm256_sub_pd(v, c), _t = _mm256_add_pd(s, _y); c = _mm256_sub_pd(_mm256_sub_pd(_t, s), _y); s = _t; }
+#elif defined(__SSE2__) || defined(_M_X64)
+    #define GEOMETRY_MEASURE_KAHAN_LANES(s, c, v) { __m128d _y = _mm_sub_pd(v, c), _t = _mm_add_pd(s, _y); c = _mm_sub_pd(_mm_sub_pd(_t, s), _y); s = _t; }
+#endif
+
+// Sums of the measure kernel
+enum geometry_measure_sum_e
+{
+    GEOMETRY_MEASURE_SUM_AREA      = 0,
+    GEOMETRY_MEASURE_SUM_X         = 1,
+    GEOMETRY_MEASURE_SUM_Y         = 2,
+    GEOMETRY_MEASURE_SUM_PERIMETER = 3,
+    GEOMETRY_MEASURE_SUM_QUANTITY  = 4
+};
+
+// Structure declarations
+struct geometry_measure_batch_s;
+
+// Type definitions
+typedef struct geometry_measure_batch_s geometry_measure_batch;
+
+// Structure definitions
+struct geometry_measure_batch_s
+{
+    geometry_polygon_list *p_polygon_list;
+    geometry_measure      *p_results;
+};
+
+// Forward declarations
+/** !
+ * Measure a ring, in one pass over its verticies
+ *
+ * @param p_verticies the verticies of the ring
+ * @param quantity    the quantity of verticies
+ * @param p_result    return
+ *
+ * @return void
+ */
+static void geometry_measure_ring ( const geometry_point *p_verticies, size_t quantity, geometry_measure *p_result );
+
+/** !
+ * Compute the centroid of the edges of a ring, weighted by their length.
+ * This is the centroid of a ring with no area.
+ *
+ * @param p_verticies the verticies of the ring
+ * @param quantity    the quantity of verticies
+ * @param p_result    return
+ *
+ * @return void
+ */
+static void geometry_measure_ring_edges ( const geometry_point *p_verticies, size_t quantity, geometry_point *p_result );
+
+/** !
+ * Measure each polygon of a chunk of a polygon list
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first polygon of the chunk
+ * @param last        one past the last polygon of the chunk
+ * @param p_parameter the batch
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_measure_chunk ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+// Function definitions
+int geometry_polygon_measure ( geometry_polygon *p_polygon, geometry_measure *p_result )
+{
+
+    // Argument check
+    if ( p_polygon == (void *) 0 ) goto no_polygon;
+    if ( p_result  == (void *) 0 ) goto no_result;
+    if ( p_polygon->quantity && p_polygon->p_verticies == (void *) 0 ) goto no_verticies;
+
+    // Measure the ring
+    geometry_measure_ring(p_polygon->p_verticies, p_polygon->quantity, p_result);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_verticies:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon->p_verticies\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_polygon_list_measure ( geometry_polygon_list *p_polygon_list, geometry_measure *p_results )
+{
+
+    // Argument check
+    if ( p_polygon_list == (void *) 0 ) goto no_polygon_list;
+    if ( p_results      == (void *) 0 ) goto no_results;
+
+    // Initialized data
+    geometry_measure_batch _batch = { .p_polygon_list = p_polygon_list, .p_results = p_results };
+
+    // Empty polygon list
+    if ( p_polygon_list->quantity == 0 ) return 1;
+
+    // Measure each chunk of polygons
+    if ( geometry_parallel_for(p_polygon_list->quantity, GEOMETRY_MEASURE_GRAIN, geometry_measure_chunk, &_batch) == 0 ) goto failed_to_run_tasks;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_polygon_list:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_run_tasks:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to run parallel tasks in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static void geometry_measure_ring ( const geometry_point *p_verticies, size_t quantity, geometry_measure *p_result )
+{
+
+    // Initialized data
+    double         sum[GEOMETRY_MEASURE_SUM_QUANTITY] = { 0 },
+                   err[GEOMETRY_MEASURE_SUM_QUANTITY] = { 0 },
+                   ox                                 = 0,
+                   oy                                 = 0,
+                   area2                              = 0;
+    geometry_point last                               = { 0 };
+    size_t         i                                  = 1;
+
+    // Empty ring
+    if ( quantity == 0 )
+    {
+
+        // Store an empty measure
+        *p_result = (geometry_measure) { .area = 0, .perimeter = 0, .centroid = { NAN, NAN } };
+
+        // Done
+        return;
+    }
+
+    // The first vertex is the origin
+    ox = p_verticies[0].x,
+    oy = p_verticies[0].y;
+
+    #if defined(__AVX2__)
+    {
+
+        // Initialized data
+        const double *p = (const double *) p_verticies;
+        __m256d       o_x = _mm256_set1_pd(ox),
+                      o_y = _mm256_set1_pd(oy),
+                      s[GEOMETRY_MEASURE_SUM_QUANTITY],
+                      c[GEOMETRY_MEASURE_SUM_QUANTITY];
+        double        lanes[2][4];
+
+        // Clear the lanes
+        for (size_t k = 0; k < GEOMETRY_MEASURE_SUM_QUANTITY; k++)
+            s[k] = _mm256_setzero_pd(),
+            c[k] = _mm256_setzero_pd();
+
+        // Four edges at a time, from vertex i - 1 to vertex i
+        for (; i + 4 <= quantity; i += 4)
+        {
+
+            // Initialized data
+            __m256d j0 = _mm256_loadu_pd(&p[2 * ( i - 1 )]),
+                    j1 = _mm256_loadu_pd(&p[2 * ( i + 1 )]),
+                    i0 = _mm256_loadu_pd(&p[2 * i]),
+                    i1 = _mm256_loadu_pd(&p[2 * ( i + 2 )]),
+                    xj = _mm256_sub_pd(_mm256_unpacklo_pd(j0, j1), o_x),
+                    yj = _mm256_sub_pd(_mm256_unpackhi_pd(j0, j1), o_y),
+                    xi = _mm256_sub_pd(_mm256_unpacklo_pd(i0, i1), o_x),
+                    yi = _mm256_sub_pd(_mm256_unpackhi_pd(i0, i1), o_y),
+                    dx = _mm256_sub_pd(xi, xj),
+                    dy = _mm256_sub_pd(yi, yj),
+                    cross = _mm256_sub_pd(_mm256_mul_pd(xj, yi), _mm256_mul_pd(xi, yj));
+
+            // Accumulate
+            GEOMETRY_MEASURE_KAHAN_LANES(s[GEOMETRY_MEASURE_SUM_AREA], c[GEOMETRY_MEASURE_SUM_AREA], cross);
+            GEOMETRY_MEASURE_KAHAN_LANES(s[GEOMETRY_MEASURE_SUM_X], c[GEOMETRY_MEASURE_SUM_X], _mm256_mul_pd(_mm256_add_pd(xj, xi), cross));
+            GEOMETRY_MEASURE_KAHAN_LANES(s[GEOMETRY_MEASURE_SUM_Y], c[GEOMETRY_MEASURE_SUM_Y], _mm256_mul_pd(_mm256_add_pd(yj, yi), cross));
+            GEOMETRY_MEASURE_KAHAN_LANES(s[GEOMETRY_MEASURE_SUM_PERIMETER], c[GEOMETRY_MEASURE_SUM_PERIMETER], _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy))));
+        }
+
+        // Fold the lanes into the sums
+        for (size_t k = 0; k < GEOMETRY_MEASURE_SUM_QUANTITY; k++)
+        {
+
+            // Store the lanes
+            _mm256_storeu_pd(lanes[0], s[k]);
+            _mm256_storeu_pd(lanes[1], c[k]);
+
+            // Accumulate each lane
+            for (size_t l = 0; l < 4; l++)
+                GEOMETRY_MEASURE_KAHAN(sum[k], err[k], lanes[0][l] - lanes[1][l]);
+        }
+    }
+    #elif defined(__SSE2__) || defined(_M_X64)
+    {
+
+        // Initialized data
+        const double *p = (const double *) p_verticies;
+        __m128d       o_x = _mm_set1_pd(ox),
+                      o_y = _mm_set1_pd(oy),
+                      s[GEOMETRY_MEASURE_SUM_QUANTITY],
+                      c[GEOMETRY_MEASURE_SUM_QUANTITY];
+        double        lanes[2][2];
+
+        // Clear the lanes
+        for (size_t k = 0; k < GEOMETRY_MEASURE_SUM_QUANTITY; k++)
+            s[k] = _mm_setzero_pd(),
+            c[k] = _mm_setzero_pd();
+
+        // Two edges at a time, from vertex i - 1 to vertex i
+        for (; i + 2 <= quantity; i += 2)
+        {
+
+            // Initialized data
+            __m128d j0 = _mm_loadu_pd(&p[2 * ( i - 1 )]),
+                    i0 = _mm_loadu_pd(&p[2 * i]),
+                    i1 = _mm_loadu_pd(&p[2 * ( i + 1 )]),
+                    xj = _mm_sub_pd(_mm_unpacklo_pd(j0, i0), o_x),
+                    yj = _mm_sub_pd(_mm_unpackhi_pd(j0, i0), o_y),
+                    xi = _mm_sub_pd(_mm_unpacklo_pd(i0, i1), o_x),
+                    yi = _mm_sub_pd(_mm_unpackhi_pd(i0, i1), o_y),
+                    dx = _mm_sub_pd(xi, xj),
+                    dy = _mm_sub_pd(yi, yj),
+                    cross = _mm_sub_pd(_mm_mul_pd(xj, yi), _mm_mul_pd(xi, yj));
+
+            // Accumulate
+            GEOMETRY_MEASURE_KAHAN_LANES(s[GEOMETRY_MEASURE_SUM_AREA], c[GEOMETRY_MEASURE_SUM_AREA], cross);
+            GEOMETRY_MEASURE_KAHAN_LANES(s[GEOMETRY_MEASURE_SUM_X], c[GEOMETRY_MEASURE_SUM_X], _mm_mul_pd(_mm_add_pd(xj, xi), cross));
+            GEOMETRY_MEASURE_KAHAN_LANES(s[GEOMETRY_MEASURE_SUM_Y], c[GEOMETRY_MEASURE_SUM_Y], _mm_mul_pd(_mm_add_pd(yj, yi), cross));
+            GEOMETRY_MEASURE_KAHAN_LANES(s[GEOMETRY_MEASURE_SUM_PERIMETER], c[GEOMETRY_MEASURE_SUM_PERIMETER], _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy))));
+        }
+
+        // Fold the lanes into the sums
+        for (size_t k = 0; k < GEOMETRY_MEASURE_SUM_QUANTITY; k++)
+        {
+
+            // Store the lanes
+            _mm_storeu_pd(lanes[0], s[k]);
+            _mm_storeu_pd(lanes[1], c[k]);
+
+            // Accumulate each lane
+            for (size_t l = 0; l < 2; l++)
+                GEOMETRY_MEASURE_KAHAN(sum[k], err[k], lanes[0][l] - lanes[1][l]);
+        }
+    }
+    #endif
+
+    // Remaining edges
+    for (; i < quantity; i++)
+    {
+
+        // Initialized data
+        double xj    = p_verticies[i - 1].x - ox,
+               yj    = p_verticies[i - 1].y - oy,
+               xi    = p_verticies[i].x - ox,
+               yi    = p_verticies[i].y - oy,
+               cross = xj * yi - xi * yj;
+
+        // Accumulate
+        GEOMETRY_MEASURE_KAHAN(sum[GEOMETRY_MEASURE_SUM_AREA], err[GEOMETRY_MEASURE_SUM_AREA], cross);
+        GEOMETRY_MEASURE_KAHAN(sum[GEOMETRY_MEASURE_SUM_X], err[GEOMETRY_MEASURE_SUM_X], ( xj + xi ) * cross);
+        GEOMETRY_MEASURE_KAHAN(sum[GEOMETRY_MEASURE_SUM_Y], err[GEOMETRY_MEASURE_SUM_Y], ( yj + yi ) * cross);
+        GEOMETRY_MEASURE_KAHAN(sum[GEOMETRY_MEASURE_SUM_PERIMETER], err[GEOMETRY_MEASURE_SUM_PERIMETER], sqrt(( xi - xj ) * ( xi - xj ) + ( yi - yj ) * ( yi - yj )));
+    }
+
+    // The closing edge ends at the origin, so it only adds to the perimeter
+    last = (geometry_point) { .x = p_verticies[quantity - 1].x - ox, .y = p_verticies[quantity - 1].y - oy };
+    GEOMETRY_MEASURE_KAHAN(sum[GEOMETRY_MEASURE_SUM_PERIMETER], err[GEOMETRY_MEASURE_SUM_PERIMETER], sqrt(last.x * last.x + last.y * last.y));
+
+    // Store the area and the perimeter
+    area2               = sum[GEOMETRY_MEASURE_SUM_AREA] - err[GEOMETRY_MEASURE_SUM_AREA],
+    p_result->area      = area2 * 0.5,
+    p_result->perimeter = sum[GEOMETRY_MEASURE_SUM_PERIMETER] - err[GEOMETRY_MEASURE_SUM_PERIMETER];
+
+    // Store the centroid
+    if ( area2 != 0 )
+        p_result->centroid = (geometry_point)
+        {
+            .x = ox + ( sum[GEOMETRY_MEASURE_SUM_X] - err[GEOMETRY_MEASURE_SUM_X] ) / ( 3 * area2 ),
+            .y = oy + ( sum[GEOMETRY_MEASURE_SUM_Y] - err[GEOMETRY_MEASURE_SUM_Y] ) / ( 3 * area2 )
+        };
+
+    // A ring with no area is weighted by its edges
+    else
+        geometry_measure_ring_edges(p_verticies, quantity, &p_result->centroid);
+
+    // Done
+    return;
+}
+
+static void geometry_measure_ring_edges ( const geometry_point *p_verticies, size_t quantity, geometry_point *p_result )
+{
+
+    // Initialized data
+    double sx     = 0,
+           sy     = 0,
+           length = 0;
+
+    // Accumulate the midpoint of each edge, closing the ring from the last vertex to the first
+    for (size_t i = 0, j = quantity - 1; i < quantity; j = i++)
+    {
+
+        // Initialized data
+        double dx = p_verticies[i].x - p_verticies[j].x,
+               dy = p_verticies[i].y - p_verticies[j].y,
+               l  = sqrt(dx * dx + dy * dy);
+
+        // Accumulate
+        sx     += l * ( p_verticies[i].x + p_verticies[j].x ) * 0.5,
+        sy     += l * ( p_verticies[i].y + p_verticies[j].y ) * 0.5,
+        length += l;
+    }
+
+    // Every vertex is the same point
+    if ( length == 0 ) { *p_result = p_verticies[0]; return; }
+
+    // Store the centroid
+    *p_result = (geometry_point) { .x = sx / length, .y = sy / length };
+
+    // Done
+    return;
+}
+
+static int geometry_measure_chunk ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_measure_batch *p_batch     = p_parameter;
+    const size_t           *p_offsets   = p_batch->p_polygon_list->p_offsets;
+    const geometry_point   *p_verticies = p_batch->p_polygon_list->p_verticies;
+
+    // Unused
+    (void) chunk;
+
+    // Measure each polygon
+    for (size_t i = first; i < last; i++)
+        geometry_measure_ring(&p_verticies[p_offsets[i]], p_offsets[i + 1] - p_offsets[i], &p_batch->p_results[i]);
+
+    // Success
+    return 1;
+}
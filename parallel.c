@@ -0,0 +1,877 @@
+/** !
+ * Parallel loop
+ *
+ * @file parallel.c
+ *
+ * @author Jacob Smith
+ */
+
+// Platform dependent feature macros
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE
+#endif
+
+// Standard library
+#include <string.h>
+#include <stdatomic.h>
+
+// Header
+#include <geometry/parallel.h>
+
+// Platform dependent includes
+#ifdef _WIN64
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <sched.h>
+    #include <unistd.h>
+#endif
+
+// The quantity of chunks a deque can hold. Must be a power of two.
+#define GEOMETRY_PARALLEL_DEQUE_SIZE 256
+
+// Structure declarations
+struct geometry_parallel_chunk_s;
+struct geometry_parallel_reduce_s;
+struct geometry_parallel_deque_s;
+struct geometry_parallel_executor_s;
+
+// Type definitions
+typedef struct geometry_parallel_chunk_s    geometry_parallel_chunk;
+typedef struct geometry_parallel_reduce_s   geometry_parallel_reduce_state;
+typedef struct geometry_parallel_deque_s    geometry_parallel_deque;
+typedef struct geometry_parallel_executor_s geometry_parallel_executor;
+
+// Structure definitions
+struct geometry_parallel_chunk_s
+{
+    fn_geometry_parallel_task  pfn_task;
+    void                      *p_parameter;
+    size_t                     chunk,
+                               first,
+                               last;
+    int                        result;
+    atomic_size_t             *p_remaining;
+};
+
+// The partial result of chunk i is stored in p_partials from size * i
+struct geometry_parallel_reduce_s
+{
+    fn_geometry_parallel_reduce_task  pfn_task;
+    char                             *p_partials;
+    size_t                            size;
+    void                             *p_parameter;
+};
+
+// A Chase-Lev deque. The owner pushes and takes at the bottom, and other
+// threads steal from the top. The indices are on their own cache lines.
+struct geometry_parallel_deque_s
+{
+    atomic_llong                        top;
+    char                                _padding_top[64 - sizeof(atomic_llong)];
+    atomic_llong                        bottom;
+    char                                _padding_bottom[64 - sizeof(atomic_llong)];
+    _Atomic(geometry_parallel_chunk *)  p_chunks[GEOMETRY_PARALLEL_DEQUE_SIZE];
+};
+
+// Slot 0 belongs to the thread that calls a loop from outside of the
+// executor, and slot i to the i'th thread of the executor. started counts
+// the threads of the executor that started, with the caller's slot.
+// pending counts the chunks in the deques, and sleeping the threads
+// waiting for some.
+struct geometry_parallel_executor_s
+{
+    geometry_parallel_deque  deques[GEOMETRY_PARALLEL_THREADS_MAX];
+    size_t                   threads,
+                             started;
+    bool                     pin;
+    atomic_bool              stop,
+                             caller;
+    atomic_size_t            pending,
+                             sleeping;
+    #ifdef _WIN64
+        HANDLE               handles[GEOMETRY_PARALLEL_THREADS_MAX];
+        CRITICAL_SECTION     lock;
+        CONDITION_VARIABLE   wake;
+    #else
+        pthread_t            handles[GEOMETRY_PARALLEL_THREADS_MAX];
+        pthread_mutex_t      lock;
+        pthread_cond_t       wake;
+    #endif
+};
+
+// Data
+static geometry_parallel_executor geometry_parallel_executor_state;
+
+// One more than the slot of this thread, or 0 if it has none
+static _Thread_local size_t geometry_parallel_slot = 0;
+
+// Forward declarations
+/** !
+ * Get the quantity of processors
+ *
+ * @param void
+ *
+ * @return the quantity of processors, at least 1
+ */
+static size_t geometry_parallel_processors ( void );
+
+/** !
+ * Push a chunk onto the bottom of the deque of a slot. Only the thread of
+ * the slot may push.
+ *
+ * @param slot    the slot
+ * @param p_chunk the chunk
+ *
+ * @return true on success, false if the deque is full
+ */
+static bool geometry_parallel_push ( size_t slot, geometry_parallel_chunk *p_chunk );
+
+/** !
+ * Take a chunk from the bottom of the deque of a slot. Only the thread of
+ * the slot may take.
+ *
+ * @param slot the slot
+ *
+ * @return a chunk, or null if the deque is empty
+ */
+static geometry_parallel_chunk *geometry_parallel_take ( size_t slot );
+
+/** !
+ * Steal a chunk from the top of the deque of a slot
+ *
+ * @param slot the slot
+ *
+ * @return a chunk, or null if the deque is empty or another thread won it
+ */
+static geometry_parallel_chunk *geometry_parallel_steal ( size_t slot );
+
+/** !
+ * Find a chunk to run, from the deque of a slot and then from the others
+ *
+ * @param slot the slot
+ *
+ * @return a chunk, or null if there is none
+ */
+static geometry_parallel_chunk *geometry_parallel_find ( size_t slot );
+
+/** !
+ * Run the task of a chunk, and count it as done
+ *
+ * @param p_chunk the chunk
+ *
+ * @return void
+ */
+static void geometry_parallel_run ( geometry_parallel_chunk *p_chunk );
+
+/** !
+ * Reduce a chunk into its partial result
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first index of the chunk
+ * @param last        one past the last index of the chunk
+ * @param p_parameter the reduction
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_parallel_reduce_chunk ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Wake the threads of the executor that wait for chunks
+ *
+ * @param void
+ *
+ * @return void
+ */
+static void geometry_parallel_wake ( void );
+
+/** !
+ * Run chunks until the executor stops. This is the entry point of each
+ * thread of the executor.
+ *
+ * @param p_slot the slot of the thread
+ *
+ * @return null
+ */
+#ifdef _WIN64
+    static DWORD WINAPI geometry_parallel_worker ( LPVOID p_slot );
+#else
+    static void *geometry_parallel_worker ( void *p_slot );
+#endif
+
+// Function definitions
+int geometry_parallel_init ( size_t threads, bool pin )
+{
+
+    // Initialized data
+    geometry_parallel_executor *p_executor = &geometry_parallel_executor_state;
+    const char                 *p_threads  = getenv("GEOMETRY_THREADS"),
+                               *p_pin      = getenv("GEOMETRY_PIN");
+
+    // Already started
+    if ( p_executor->threads ) return 1;
+
+    // Default quantity of threads
+    if ( threads == 0 && p_threads ) threads = (size_t) strtoul(p_threads, (void *) 0, 10);
+    if ( threads == 0 ) threads = geometry_parallel_processors();
+
+    // Default pinning
+    if ( p_pin && strcmp(p_pin, "1") == 0 ) pin = true;
+
+    // Clamp
+    if ( threads > GEOMETRY_PARALLEL_THREADS_MAX ) threads = GEOMETRY_PARALLEL_THREADS_MAX;
+
+    // Store the state
+    memset(p_executor->deques, 0, sizeof(p_executor->deques));
+    p_executor->pin = pin;
+    atomic_init(&p_executor->stop, false);
+    atomic_init(&p_executor->caller, false);
+    atomic_init(&p_executor->pending, 0);
+    atomic_init(&p_executor->sleeping, 0);
+
+    // One thread needs no executor
+    if ( threads < 2 ) goto done;
+
+    // Construct the lock, and the condition to wait on
+    #ifdef _WIN64
+        InitializeCriticalSection(&p_executor->lock);
+        InitializeConditionVariable(&p_executor->wake);
+    #else
+        if ( pthread_mutex_init(&p_executor->lock, NULL) ) goto failed_to_construct_lock;
+        if ( pthread_cond_init(&p_executor->wake, NULL) )
+        {
+            pthread_mutex_destroy(&p_executor->lock);
+            goto failed_to_construct_lock;
+        }
+    #endif
+
+    // Store the quantity of threads before any thread reads it
+    p_executor->threads = threads,
+    p_executor->started = 1;
+
+    // Start a thread for each slot but the caller's. The slots of threads
+    // that fail to start stay empty, and the other threads run the chunks.
+    for (size_t i = 1; i < threads; i++)
+    {
+        #ifdef _WIN64
+            p_executor->handles[i] = CreateThread(NULL, 0, geometry_parallel_worker, (LPVOID) i, 0, NULL);
+            if ( p_executor->handles[i] == NULL ) break;
+        #else
+            if ( pthread_create(&p_executor->handles[i], NULL, geometry_parallel_worker, (void *) i) ) break;
+        #endif
+
+        // Count the thread
+        p_executor->started++;
+    }
+
+    // Done
+    done:
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Platform errors
+        {
+            #ifndef _WIN64
+                failed_to_construct_lock:
+                    #ifndef NDEBUG
+                        log_error("[pthread] Failed to construct a mutex or condition in call to function \"%s\"\n", __FUNCTION__);
+                    #endif
+
+                    // Error
+                    return 0;
+            #endif
+        }
+    }
+}
+
+size_t geometry_parallel_threads ( void )
+{
+
+    // Success
+    return ( geometry_parallel_executor_state.threads ) ? geometry_parallel_executor_state.threads : 1;
+}
+
+size_t geometry_parallel_chunks ( size_t quantity, size_t grain )
+{
+
+    // Initialized data
+    size_t threads = geometry_parallel_threads(),
+           ret     = ( grain ) ? quantity / grain : quantity;
+
+    // Clamp
+    if ( ret > threads ) ret = threads;
+    if ( ret < 1 ) ret = 1;
+
+    // Success
+    return ret;
+}
+
+int geometry_parallel_for ( size_t quantity, size_t grain, fn_geometry_parallel_task pfn_task, void *p_parameter )
+{
+
+    // Argument check
+    if ( pfn_task == (void *) 0 ) goto no_task;
+
+    // Initialized data
+    geometry_parallel_executor *p_executor = &geometry_parallel_executor_state;
+    geometry_parallel_chunk     _chunks[GEOMETRY_PARALLEL_THREADS_MAX];
+    atomic_size_t               remaining;
+    size_t                      chunks     = geometry_parallel_chunks(quantity, grain),
+                                slot       = 0;
+    bool                        caller     = false,
+                                expected   = false;
+    int                         ret        = 1;
+
+    // One chunk runs on this thread
+    if ( chunks == 1 )
+    {
+
+        // Run the task
+        if ( pfn_task(0, 0, quantity, p_parameter) == 0 ) goto failed_task;
+
+        // Success
+        return 1;
+    }
+
+    // Split the range
+    atomic_init(&remaining, chunks);
+    for (size_t i = 0; i < chunks; i++)
+        _chunks[i] = (geometry_parallel_chunk)
+        {
+            .pfn_task    = pfn_task,
+            .p_parameter = p_parameter,
+            .chunk       = i,
+            .first       = quantity / chunks * i + ( ( i < quantity % chunks ) ? i : quantity % chunks ),
+            .last        = quantity / chunks * ( i + 1 ) + ( ( i + 1 < quantity % chunks ) ? i + 1 : quantity % chunks ),
+            .result      = 0,
+            .p_remaining = &remaining
+        };
+
+    // A thread outside of the executor takes the caller's slot. If another
+    // thread has it, the chunks run on this thread.
+    if ( geometry_parallel_slot == 0 )
+    {
+
+        // Take the slot
+        caller = atomic_compare_exchange_strong(&p_executor->caller, &expected, true);
+
+        // Run each chunk on this thread
+        if ( caller == false )
+        {
+            for (size_t i = 0; i < chunks; i++)
+                geometry_parallel_run(&_chunks[i]);
+
+            // Collect the results
+            goto collect;
+        }
+
+        // Store the slot
+        geometry_parallel_slot = 1;
+    }
+
+    // The slot of this thread
+    slot = geometry_parallel_slot - 1;
+
+    // Push each chunk but the first, last first, so that thieves take the
+    // furthest chunks. A chunk that does not fit runs on this thread.
+    for (size_t i = chunks - 1; i > 0; i--)
+        if ( geometry_parallel_push(slot, &_chunks[i]) == false )
+            geometry_parallel_run(&_chunks[i]);
+
+    // Wake the executor
+    geometry_parallel_wake();
+
+    // Run the first chunk on this thread
+    geometry_parallel_run(&_chunks[0]);
+
+    // Run chunks until each chunk of this loop is done
+    while ( atomic_load_explicit(&remaining, memory_order_acquire) )
+    {
+
+        // Initialized data
+        geometry_parallel_chunk *p_chunk = geometry_parallel_find(slot);
+
+        // Run the chunk
+        if ( p_chunk ) geometry_parallel_run(p_chunk);
+
+        // Let the threads with the chunks of this loop run
+        else
+        {
+            #ifdef _WIN64
+                SwitchToThread();
+            #else
+                sched_yield();
+            #endif
+        }
+    }
+
+    // Give back the caller's slot
+    if ( caller )
+        geometry_parallel_slot = 0,
+        atomic_store(&p_executor->caller, false);
+
+    // Collect the results
+    collect:
+    for (size_t i = 0; i < chunks; i++)
+        if ( _chunks[i].result == 0 ) ret = 0;
+
+    // Error check
+    if ( ret == 0 ) goto failed_task;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_task:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pfn_task\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_task:
+                #ifndef NDEBUG
+                    log_error("[geometry] A task failed in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_parallel_reduce ( size_t quantity, size_t grain, size_t size, fn_geometry_parallel_reduce_task pfn_task, fn_geometry_parallel_combine pfn_combine, void *p_result, void *p_parameter )
+{
+
+    // Argument check
+    if ( pfn_task    == (void *) 0 ) goto no_task;
+    if ( pfn_combine == (void *) 0 ) goto no_combine;
+    if ( p_result    == (void *) 0 ) goto no_result;
+    if ( size        ==          0 ) goto no_size;
+
+    // Initialized data
+    size_t                          chunks     = geometry_parallel_chunks(quantity, grain);
+    char                           *p_partials = GEOMETRY_REALLOC(0, size * chunks);
+    geometry_parallel_reduce_state  _reduce    = { .pfn_task = pfn_task, .p_partials = p_partials, .size = size, .p_parameter = p_parameter };
+
+    // Error check
+    if ( p_partials == (void *) 0 ) goto no_mem;
+
+    // Start each partial result at the identity
+    for (size_t i = 0; i < chunks; i++)
+        memcpy(&p_partials[size * i], p_result, size);
+
+    // Reduce each chunk
+    if ( geometry_parallel_for(quantity, grain, geometry_parallel_reduce_chunk, &_reduce) == 0 ) goto failed_to_run_tasks;
+
+    // Combine the partial results, in order
+    for (size_t i = 0; i < chunks; i++)
+        if ( pfn_combine(p_result, &p_partials[size * i], p_parameter) == 0 ) goto failed_to_combine;
+
+    // Release the partial results
+    p_partials = GEOMETRY_REALLOC(p_partials, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_task:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pfn_task\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_combine:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pfn_combine\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_size:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"size\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_run_tasks:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to run parallel tasks in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the partial results
+                p_partials = GEOMETRY_REALLOC(p_partials, 0);
+
+                // Error
+                return 0;
+
+            failed_to_combine:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to combine a partial result in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the partial results
+                p_partials = GEOMETRY_REALLOC(p_partials, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_parallel_quit ( void )
+{
+
+    // Initialized data
+    geometry_parallel_executor *p_executor = &geometry_parallel_executor_state;
+
+    // Not started, or one thread
+    if ( p_executor->threads < 2 ) goto done;
+
+    // Stop the threads
+    atomic_store(&p_executor->stop, true);
+    #ifdef _WIN64
+        EnterCriticalSection(&p_executor->lock);
+        WakeAllConditionVariable(&p_executor->wake);
+        LeaveCriticalSection(&p_executor->lock);
+    #else
+        pthread_mutex_lock(&p_executor->lock);
+        pthread_cond_broadcast(&p_executor->wake);
+        pthread_mutex_unlock(&p_executor->lock);
+    #endif
+
+    // Wait for the threads
+    for (size_t i = 1; i < p_executor->started; i++)
+    {
+        #ifdef _WIN64
+            WaitForSingleObject(p_executor->handles[i], INFINITE);
+            CloseHandle(p_executor->handles[i]);
+        #else
+            pthread_join(p_executor->handles[i], NULL);
+        #endif
+    }
+
+    // Destroy the lock, and the condition
+    #ifdef _WIN64
+        DeleteCriticalSection(&p_executor->lock);
+    #else
+        pthread_cond_destroy(&p_executor->wake);
+        pthread_mutex_destroy(&p_executor->lock);
+    #endif
+
+    // Done
+    done:
+
+    // Forget the threads
+    p_executor->threads = 0;
+
+    // Success
+    return 1;
+}
+
+static size_t geometry_parallel_processors ( void )
+{
+
+    // Initialized data
+    size_t ret = 1;
+
+    // Ask the platform
+    #ifdef _WIN64
+    {
+
+        // Initialized data
+        SYSTEM_INFO _info;
+
+        // Get the system info
+        GetSystemInfo(&_info);
+
+        // Store the quantity of processors
+        ret = (size_t) _info.dwNumberOfProcessors;
+    }
+    #else
+    {
+
+        // Initialized data
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+        // Store the quantity of processors
+        if ( processors > 0 ) ret = (size_t) processors;
+    }
+    #endif
+
+    // Clamp
+    if ( ret < 1 ) ret = 1;
+
+    // Success
+    return ret;
+}
+
+static bool geometry_parallel_push ( size_t slot, geometry_parallel_chunk *p_chunk )
+{
+
+    // Initialized data
+    geometry_parallel_deque *p_deque = &geometry_parallel_executor_state.deques[slot];
+    long long                bottom  = atomic_load_explicit(&p_deque->bottom, memory_order_relaxed),
+                             top     = atomic_load_explicit(&p_deque->top, memory_order_acquire);
+
+    // Full
+    if ( bottom - top >= GEOMETRY_PARALLEL_DEQUE_SIZE ) return false;
+
+    // Count the chunk before a thief can take it
+    atomic_fetch_add(&geometry_parallel_executor_state.pending, 1);
+
+    // Store the chunk, then publish it
+    atomic_store_explicit(&p_deque->p_chunks[bottom & ( GEOMETRY_PARALLEL_DEQUE_SIZE - 1 )], p_chunk, memory_order_relaxed);
+    atomic_store_explicit(&p_deque->bottom, bottom + 1, memory_order_release);
+
+    // Success
+    return true;
+}
+
+static geometry_parallel_chunk *geometry_parallel_take ( size_t slot )
+{
+
+    // Initialized data
+    geometry_parallel_deque *p_deque = &geometry_parallel_executor_state.deques[slot];
+    geometry_parallel_chunk *p_chunk = (void *) 0;
+    long long                bottom  = atomic_load_explicit(&p_deque->bottom, memory_order_relaxed) - 1,
+                             top     = 0;
+
+    // Claim the bottom chunk before looking at the top
+    atomic_store(&p_deque->bottom, bottom);
+    top = atomic_load(&p_deque->top);
+
+    // Empty
+    if ( top > bottom )
+    {
+
+        // Restore the bottom
+        atomic_store_explicit(&p_deque->bottom, bottom + 1, memory_order_relaxed);
+
+        // Done
+        return (void *) 0;
+    }
+
+    // Load the chunk
+    p_chunk = atomic_load_explicit(&p_deque->p_chunks[bottom & ( GEOMETRY_PARALLEL_DEQUE_SIZE - 1 )], memory_order_relaxed);
+
+    // The last chunk is raced for with the thieves
+    if ( top == bottom )
+    {
+
+        // Lost the race
+        if ( atomic_compare_exchange_strong(&p_deque->top, &top, top + 1) == false ) p_chunk = (void *) 0;
+
+        // Restore the bottom
+        atomic_store_explicit(&p_deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+
+    // Count the chunk
+    if ( p_chunk ) atomic_fetch_sub(&geometry_parallel_executor_state.pending, 1);
+
+    // Success
+    return p_chunk;
+}
+
+static geometry_parallel_chunk *geometry_parallel_steal ( size_t slot )
+{
+
+    // Initialized data
+    geometry_parallel_deque *p_deque = &geometry_parallel_executor_state.deques[slot];
+    geometry_parallel_chunk *p_chunk = (void *) 0;
+    long long                top     = atomic_load(&p_deque->top),
+                             bottom  = atomic_load(&p_deque->bottom);
+
+    // Empty
+    if ( top >= bottom ) return (void *) 0;
+
+    // Load the chunk
+    p_chunk = atomic_load_explicit(&p_deque->p_chunks[top & ( GEOMETRY_PARALLEL_DEQUE_SIZE - 1 )], memory_order_relaxed);
+
+    // Another thread took it first
+    if ( atomic_compare_exchange_strong(&p_deque->top, &top, top + 1) == false ) return (void *) 0;
+
+    // Count the chunk
+    atomic_fetch_sub(&geometry_parallel_executor_state.pending, 1);
+
+    // Success
+    return p_chunk;
+}
+
+static geometry_parallel_chunk *geometry_parallel_find ( size_t slot )
+{
+
+    // Initialized data
+    size_t                   threads = geometry_parallel_executor_state.threads;
+    geometry_parallel_chunk *p_chunk = geometry_parallel_take(slot);
+
+    // Steal from the other slots, starting at the next one
+    for (size_t i = 1; p_chunk == (void *) 0 && i < threads; i++)
+        p_chunk = geometry_parallel_steal(( slot + i ) % threads);
+
+    // Done
+    return p_chunk;
+}
+
+static void geometry_parallel_run ( geometry_parallel_chunk *p_chunk )
+{
+
+    // Run the task
+    p_chunk->result = p_chunk->pfn_task(p_chunk->chunk, p_chunk->first, p_chunk->last, p_chunk->p_parameter);
+
+    // Count the chunk as done. The chunk may not be used after this.
+    atomic_fetch_sub_explicit(p_chunk->p_remaining, 1, memory_order_release);
+
+    // Done
+    return;
+}
+
+static int geometry_parallel_reduce_chunk ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_parallel_reduce_state *p_reduce = p_parameter;
+
+    // Done
+    return p_reduce->pfn_task(first, last, &p_reduce->p_partials[p_reduce->size * chunk], p_reduce->p_parameter);
+}
+
+static void geometry_parallel_wake ( void )
+{
+
+    // Initialized data
+    geometry_parallel_executor *p_executor = &geometry_parallel_executor_state;
+
+    // No thread is waiting
+    if ( atomic_load(&p_executor->sleeping) == 0 ) return;
+
+    // Wake the threads
+    #ifdef _WIN64
+        EnterCriticalSection(&p_executor->lock);
+        WakeAllConditionVariable(&p_executor->wake);
+        LeaveCriticalSection(&p_executor->lock);
+    #else
+        pthread_mutex_lock(&p_executor->lock);
+        pthread_cond_broadcast(&p_executor->wake);
+        pthread_mutex_unlock(&p_executor->lock);
+    #endif
+
+    // Done
+    return;
+}
+
+#ifdef _WIN64
+static DWORD WINAPI geometry_parallel_worker ( LPVOID p_slot )
+#else
+static void *geometry_parallel_worker ( void *p_slot )
+#endif
+{
+
+    // Initialized data
+    geometry_parallel_executor *p_executor = &geometry_parallel_executor_state;
+    size_t                      slot       = (size_t) p_slot;
+
+    // Store the slot
+    geometry_parallel_slot = slot + 1;
+
+    // Pin the thread to a processor
+    if ( p_executor->pin )
+    {
+        #ifdef _WIN64
+            SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR) 1 << ( slot % geometry_parallel_processors() ));
+        #elif defined(__linux__)
+        {
+
+            // Initialized data
+            cpu_set_t _set;
+
+            // Pin the thread
+            CPU_ZERO(&_set);
+            CPU_SET(slot % geometry_parallel_processors(), &_set);
+            pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &_set);
+        }
+        #endif
+    }
+
+    // Run chunks until the executor stops
+    while ( atomic_load(&p_executor->stop) == false )
+    {
+
+        // Initialized data
+        geometry_parallel_chunk *p_chunk = geometry_parallel_find(slot);
+
+        // Run the chunk
+        if ( p_chunk )
+        {
+            geometry_parallel_run(p_chunk);
+
+            continue;
+        }
+
+        // Wait for a chunk. A loop counts its chunks as pending before it
+        // reads the quantity of waiting threads, and a thread counts itself
+        // as waiting before it reads the quantity of pending chunks, so
+        // the thread sees the chunks or the loop wakes it.
+        #ifdef _WIN64
+            EnterCriticalSection(&p_executor->lock);
+            atomic_fetch_add(&p_executor->sleeping, 1);
+            while ( atomic_load(&p_executor->pending) == 0 && atomic_load(&p_executor->stop) == false )
+                SleepConditionVariableCS(&p_executor->wake, &p_executor->lock, INFINITE);
+            atomic_fetch_sub(&p_executor->sleeping, 1);
+            LeaveCriticalSection(&p_executor->lock);
+        #else
+            pthread_mutex_lock(&p_executor->lock);
+            atomic_fetch_add(&p_executor->sleeping, 1);
+            while ( atomic_load(&p_executor->pending) == 0 && atomic_load(&p_executor->stop) == false )
+                pthread_cond_wait(&p_executor->wake, &p_executor->lock);
+            atomic_fetch_sub(&p_executor->sleeping, 1);
+            pthread_mutex_unlock(&p_executor->lock);
+        #endif
+    }
+
+    // Done
+    return 0;
+}
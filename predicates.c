@@ -0,0 +1,1070 @@
+/** !
+ * Robust predicates
+ *
+ * Adapted from Jonathan Shewchuk's public domain predicates.c. An
+ * expansion is an array of doubles, ordered by increasing magnitude, that
+ * do not overlap, and whose sum is a number held exactly.
+ *
+ * @file predicates.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <geometry/predicates.h>
+
+// Macros
+// Half of the unit in the last place of 1
+#define GEOMETRY_PREDICATES_EPSILON 0x1p-53
+
+// Data
+// Splits a double into two halves of 26 bits each
+static const double geometry_predicates_splitter = 0x1p27 + 1;
+
+// Error bounds of each stage of each predicate
+static const double geometry_predicates_result_bound = ( 3.0 +   8.0 * GEOMETRY_PREDICATES_EPSILON ) * GEOMETRY_PREDICATES_EPSILON,
+                    geometry_predicates_ccw_bound_a  = ( 3.0 +  16.0 * GEOMETRY_PREDICATES_EPSILON ) * GEOMETRY_PREDICATES_EPSILON,
+                    geometry_predicates_ccw_bound_b  = ( 2.0 +  12.0 * GEOMETRY_PREDICATES_EPSILON ) * GEOMETRY_PREDICATES_EPSILON,
+                    geometry_predicates_ccw_bound_c  = ( 9.0 +  64.0 * GEOMETRY_PREDICATES_EPSILON ) * GEOMETRY_PREDICATES_EPSILON * GEOMETRY_PREDICATES_EPSILON,
+                    geometry_predicates_icc_bound_a  = ( 10.0 + 96.0 * GEOMETRY_PREDICATES_EPSILON ) * GEOMETRY_PREDICATES_EPSILON,
+                    geometry_predicates_icc_bound_b  = ( 4.0 +  48.0 * GEOMETRY_PREDICATES_EPSILON ) * GEOMETRY_PREDICATES_EPSILON,
+                    geometry_predicates_icc_bound_c  = ( 44.0 + 576.0 * GEOMETRY_PREDICATES_EPSILON ) * GEOMETRY_PREDICATES_EPSILON * GEOMETRY_PREDICATES_EPSILON;
+
+// Forward declarations
+/** !
+ * Compute a + b exactly, as x + y, if |a| >= |b|
+ *
+ * @param a   a double
+ * @param b   a double no greater in magnitude than a
+ * @param p_x return the rounded sum
+ * @param p_y return the rounding error
+ *
+ * @return void
+ */
+static void geometry_predicates_fast_two_sum ( double a, double b, double *p_x, double *p_y );
+
+/** !
+ * Compute a + b exactly, as x + y
+ *
+ * @param a   a double
+ * @param b   a double
+ * @param p_x return the rounded sum
+ * @param p_y return the rounding error
+ *
+ * @return void
+ */
+static void geometry_predicates_two_sum ( double a, double b, double *p_x, double *p_y );
+
+/** !
+ * Compute a - b exactly, as x + y
+ *
+ * @param a   a double
+ * @param b   a double
+ * @param p_x return the rounded difference
+ * @param p_y return the rounding error
+ *
+ * @return void
+ */
+static void geometry_predicates_two_diff ( double a, double b, double *p_x, double *p_y );
+
+/** !
+ * Compute the rounding error of a rounded difference
+ *
+ * @param a a double
+ * @param b a double
+ * @param x a - b, rounded
+ *
+ * @return the rounding error
+ */
+static double geometry_predicates_two_diff_tail ( double a, double b, double x );
+
+/** !
+ * Split a double into two halves, each with at most 26 significant bits
+ *
+ * @param a    a double
+ * @param p_hi return the high half
+ * @param p_lo return the low half
+ *
+ * @return void
+ */
+static void geometry_predicates_split ( double a, double *p_hi, double *p_lo );
+
+/** !
+ * Compute a * b exactly, as x + y
+ *
+ * @param a   a double
+ * @param b   a double
+ * @param p_x return the rounded product
+ * @param p_y return the rounding error
+ *
+ * @return void
+ */
+static void geometry_predicates_two_product ( double a, double b, double *p_x, double *p_y );
+
+/** !
+ * Compute a * b exactly, as x + y, with b already split
+ *
+ * @param a    a double
+ * @param b    a double
+ * @param b_hi the high half of b
+ * @param b_lo the low half of b
+ * @param p_x  return the rounded product
+ * @param p_y  return the rounding error
+ *
+ * @return void
+ */
+static void geometry_predicates_two_product_presplit ( double a, double b, double b_hi, double b_lo, double *p_x, double *p_y );
+
+/** !
+ * Compute a * a exactly, as x + y
+ *
+ * @param a   a double
+ * @param p_x return the rounded square
+ * @param p_y return the rounding error
+ *
+ * @return void
+ */
+static void geometry_predicates_square ( double a, double *p_x, double *p_y );
+
+/** !
+ * Compute ( a1 + a0 ) + ( b1 + b0 ) as an expansion of four components
+ *
+ * @param a1  the high part of a
+ * @param a0  the low part of a
+ * @param b1  the high part of b
+ * @param b0  the low part of b
+ * @param p_x return the expansion, from least to most significant
+ *
+ * @return void
+ */
+static void geometry_predicates_two_two_sum ( double a1, double a0, double b1, double b0, double *p_x );
+
+/** !
+ * Compute ( a1 + a0 ) - ( b1 + b0 ) as an expansion of four components
+ *
+ * @param a1  the high part of a
+ * @param a0  the low part of a
+ * @param b1  the high part of b
+ * @param b0  the low part of b
+ * @param p_x return the expansion, from least to most significant
+ *
+ * @return void
+ */
+static void geometry_predicates_two_two_diff ( double a1, double a0, double b1, double b0, double *p_x );
+
+/** !
+ * Sum two expansions, dropping zero components
+ *
+ * @param e_length the quantity of components of e
+ * @param p_e      an expansion
+ * @param f_length the quantity of components of f
+ * @param p_f      another expansion
+ * @param p_h      return the sum; room for e_length + f_length components
+ *
+ * @return the quantity of components of the sum
+ */
+static int geometry_predicates_expansion_sum ( int e_length, const double *p_e, int f_length, const double *p_f, double *p_h );
+
+/** !
+ * Multiply an expansion by a double, dropping zero components
+ *
+ * @param e_length the quantity of components of e
+ * @param p_e      an expansion
+ * @param b        a double
+ * @param p_h      return the product; room for 2 * e_length components
+ *
+ * @return the quantity of components of the product
+ */
+static int geometry_predicates_expansion_scale ( int e_length, const double *p_e, double b, double *p_h );
+
+/** !
+ * Approximate the value of an expansion
+ *
+ * @param e_length the quantity of components of e
+ * @param p_e      an expansion
+ *
+ * @return the approximate value
+ */
+static double geometry_predicates_estimate ( int e_length, const double *p_e );
+
+/** !
+ * Compute the orientation determinant of three points in stages of exact
+ * arithmetic, after the floating point filter could not decide its sign
+ *
+ * @param p_a       point A
+ * @param p_b       point B
+ * @param p_c       point C
+ * @param permanent the sum of the magnitudes of the products of the determinant
+ *
+ * @return the orientation, with an exact sign
+ */
+static double geometry_predicates_orient2d_adapt ( const geometry_point *p_a, const geometry_point *p_b, const geometry_point *p_c, double permanent );
+
+/** !
+ * Compute the in circle determinant of four points in stages of exact
+ * arithmetic, after the floating point filter could not decide its sign
+ *
+ * @param p_a       point A
+ * @param p_b       point B
+ * @param p_c       point C
+ * @param p_d       point D
+ * @param permanent the sum of the magnitudes of the products of the determinant
+ *
+ * @return the in circle determinant, with an exact sign
+ */
+static double geometry_predicates_incircle_adapt ( const geometry_point *p_a, const geometry_point *p_b, const geometry_point *p_c, const geometry_point *p_d, double permanent );
+
+/** !
+ * Add the expansion of a stage to the running total, and swap the buffers
+ * of the total
+ *
+ * @param pp_now   the running total
+ * @param pp_other the other buffer
+ * @param p_length the quantity of components of the running total
+ * @param length   the quantity of components of the stage
+ * @param p_stage  the stage
+ *
+ * @return void
+ */
+static void geometry_predicates_accumulate ( double **pp_now, double **pp_other, int *p_length, int length, const double *p_stage );
+
+// Function definitions
+double geometry_orient2d ( geometry_point *p_a, geometry_point *p_b, geometry_point *p_c )
+{
+
+    // Initialized data
+    double left      = ( p_a->x - p_c->x ) * ( p_b->y - p_c->y ),
+           right     = ( p_a->y - p_c->y ) * ( p_b->x - p_c->x ),
+           det       = left - right,
+           permanent = 0;
+
+    // If the products have different signs, or either is zero, the
+    // difference is not cancelled, and its sign is right
+    if      ( left > 0 ) { if ( right <= 0 ) return det; permanent =  left + right; }
+    else if ( left < 0 ) { if ( right >= 0 ) return det; permanent = -left - right; }
+    else                 return det;
+
+    // The determinant is far enough from zero
+    if ( det >= geometry_predicates_ccw_bound_a * permanent || -det >= geometry_predicates_ccw_bound_a * permanent ) return det;
+
+    // Success
+    return geometry_predicates_orient2d_adapt(p_a, p_b, p_c, permanent);
+}
+
+double geometry_incircle ( geometry_point *p_a, geometry_point *p_b, geometry_point *p_c, geometry_point *p_d )
+{
+
+    // Initialized data
+    double adx       = p_a->x - p_d->x,
+           bdx       = p_b->x - p_d->x,
+           cdx       = p_c->x - p_d->x,
+           ady       = p_a->y - p_d->y,
+           bdy       = p_b->y - p_d->y,
+           cdy       = p_c->y - p_d->y,
+           bdxcdy    = bdx * cdy,
+           cdxbdy    = cdx * bdy,
+           alift     = adx * adx + ady * ady,
+           cdxady    = cdx * ady,
+           adxcdy    = adx * cdy,
+           blift     = bdx * bdx + bdy * bdy,
+           adxbdy    = adx * bdy,
+           bdxady    = bdx * ady,
+           clift     = cdx * cdx + cdy * cdy,
+           det       = alift * ( bdxcdy - cdxbdy ) + blift * ( cdxady - adxcdy ) + clift * ( adxbdy - bdxady ),
+           permanent = ( fabs(bdxcdy) + fabs(cdxbdy) ) * alift + ( fabs(cdxady) + fabs(adxcdy) ) * blift + ( fabs(adxbdy) + fabs(bdxady) ) * clift,
+           bound     = geometry_predicates_icc_bound_a * permanent;
+
+    // The determinant is far enough from zero
+    if ( det > bound || -det > bound ) return det;
+
+    // Success
+    return geometry_predicates_incircle_adapt(p_a, p_b, p_c, p_d, permanent);
+}
+
+static void geometry_predicates_fast_two_sum ( double a, double b, double *p_x, double *p_y )
+{
+
+    // Initialized data
+    double x         = a + b,
+           b_virtual = x - a;
+
+    // Return the sum and its error
+    *p_x = x,
+    *p_y = b - b_virtual;
+
+    // Done
+    return;
+}
+
+static void geometry_predicates_two_sum ( double a, double b, double *p_x, double *p_y )
+{
+
+    // Initialized data
+    double x         = a + b,
+           b_virtual = x - a,
+           a_virtual = x - b_virtual,
+           b_round   = b - b_virtual,
+           a_round   = a - a_virtual;
+
+    // Return the sum and its error
+    *p_x = x,
+    *p_y = a_round + b_round;
+
+    // Done
+    return;
+}
+
+static void geometry_predicates_two_diff ( double a, double b, double *p_x, double *p_y )
+{
+
+    // Initialized data
+    double x = a - b;
+
+    // Return the difference and its error
+    *p_x = x,
+    *p_y = geometry_predicates_two_diff_tail(a, b, x);
+
+    // Done
+    return;
+}
+
+static double geometry_predicates_two_diff_tail ( double a, double b, double x )
+{
+
+    // Initialized data
+    double b_virtual = a - x,
+           a_virtual = x + b_virtual,
+           b_round   = b_virtual - b,
+           a_round   = a - a_virtual;
+
+    // Success
+    return a_round + b_round;
+}
+
+static void geometry_predicates_split ( double a, double *p_hi, double *p_lo )
+{
+
+    // Initialized data
+    double c     = geometry_predicates_splitter * a,
+           a_big = c - a,
+           hi    = c - a_big;
+
+    // Return the halves
+    *p_hi = hi,
+    *p_lo = a - hi;
+
+    // Done
+    return;
+}
+
+static void geometry_predicates_two_product ( double a, double b, double *p_x, double *p_y )
+{
+
+    // Initialized data
+    double b_hi = 0,
+           b_lo = 0;
+
+    // Split b
+    geometry_predicates_split(b, &b_hi, &b_lo);
+
+    // Multiply
+    geometry_predicates_two_product_presplit(a, b, b_hi, b_lo, p_x, p_y);
+
+    // Done
+    return;
+}
+
+static void geometry_predicates_two_product_presplit ( double a, double b, double b_hi, double b_lo, double *p_x, double *p_y )
+{
+
+    // Initialized data
+    double x    = a * b,
+           a_hi = 0,
+           a_lo = 0,
+           err1 = 0,
+           err2 = 0,
+           err3 = 0;
+
+    // Split a
+    geometry_predicates_split(a, &a_hi, &a_lo);
+
+    // Take away the products of the halves, from the largest
+    err1 = x - ( a_hi * b_hi ),
+    err2 = err1 - ( a_lo * b_hi ),
+    err3 = err2 - ( a_hi * b_lo );
+
+    // Return the product and its error
+    *p_x = x,
+    *p_y = ( a_lo * b_lo ) - err3;
+
+    // Done
+    return;
+}
+
+static void geometry_predicates_square ( double a, double *p_x, double *p_y )
+{
+
+    // Initialized data
+    double x    = a * a,
+           a_hi = 0,
+           a_lo = 0,
+           err1 = 0,
+           err3 = 0;
+
+    // Split a
+    geometry_predicates_split(a, &a_hi, &a_lo);
+
+    // Take away the products of the halves, from the largest
+    err1 = x - ( a_hi * a_hi ),
+    err3 = err1 - ( ( a_hi + a_hi ) * a_lo );
+
+    // Return the square and its error
+    *p_x = x,
+    *p_y = ( a_lo * a_lo ) - err3;
+
+    // Done
+    return;
+}
+
+static void geometry_predicates_two_two_sum ( double a1, double a0, double b1, double b0, double *p_x )
+{
+
+    // Initialized data
+    double i = 0, j = 0, k = 0, l = 0;
+
+    // Add b0
+    geometry_predicates_two_sum(a0, b0, &i, &p_x[0]);
+    geometry_predicates_two_sum(a1, i,  &j, &k);
+
+    // Add b1
+    geometry_predicates_two_sum(k, b1, &i, &p_x[1]);
+    geometry_predicates_two_sum(j, i,  &p_x[3], &l);
+
+    // Store the third component
+    p_x[2] = l;
+
+    // Done
+    return;
+}
+
+static void geometry_predicates_two_two_diff ( double a1, double a0, double b1, double b0, double *p_x )
+{
+
+    // Initialized data
+    double i = 0, j = 0, k = 0, l = 0;
+
+    // Take away b0
+    geometry_predicates_two_diff(a0, b0, &i, &p_x[0]);
+    geometry_predicates_two_sum(a1, i, &j, &k);
+
+    // Take away b1
+    geometry_predicates_two_diff(k, b1, &i, &p_x[1]);
+    geometry_predicates_two_sum(j, i, &p_x[3], &l);
+
+    // Store the third component
+    p_x[2] = l;
+
+    // Done
+    return;
+}
+
+static int geometry_predicates_expansion_sum ( int e_length, const double *p_e, int f_length, const double *p_f, double *p_h )
+{
+
+    // Initialized data
+    double q     = 0,
+           q_new = 0,
+           hh    = 0,
+           e_now = p_e[0],
+           f_now = p_f[0];
+    int    e     = 0,
+           f     = 0,
+           h     = 0;
+
+    // Start with the smaller of the first components
+    if ( ( f_now > e_now ) == ( f_now > -e_now ) ) { q = e_now; if ( ++e < e_length ) e_now = p_e[e]; }
+    else                                         { q = f_now; if ( ++f < f_length ) f_now = p_f[f]; }
+
+    // Merge the expansions by magnitude
+    if ( e < e_length && f < f_length )
+    {
+
+        // The first sum can not round away from the smaller component
+        if ( ( f_now > e_now ) == ( f_now > -e_now ) ) { geometry_predicates_fast_two_sum(e_now, q, &q_new, &hh); if ( ++e < e_length ) e_now = p_e[e]; }
+        else                                         { geometry_predicates_fast_two_sum(f_now, q, &q_new, &hh); if ( ++f < f_length ) f_now = p_f[f]; }
+
+        // Keep nonzero components
+        q = q_new;
+        if ( hh != 0 ) p_h[h++] = hh;
+
+        // Add the rest of the components, smallest first
+        while ( e < e_length && f < f_length )
+        {
+
+            // Add the smaller component
+            if ( ( f_now > e_now ) == ( f_now > -e_now ) ) { geometry_predicates_two_sum(q, e_now, &q_new, &hh); if ( ++e < e_length ) e_now = p_e[e]; }
+            else                                         { geometry_predicates_two_sum(q, f_now, &q_new, &hh); if ( ++f < f_length ) f_now = p_f[f]; }
+
+            // Keep nonzero components
+            q = q_new;
+            if ( hh != 0 ) p_h[h++] = hh;
+        }
+    }
+
+    // Add the rest of e
+    while ( e < e_length )
+    {
+        geometry_predicates_two_sum(q, e_now, &q_new, &hh);
+        if ( ++e < e_length ) e_now = p_e[e];
+        q = q_new;
+        if ( hh != 0 ) p_h[h++] = hh;
+    }
+
+    // Add the rest of f
+    while ( f < f_length )
+    {
+        geometry_predicates_two_sum(q, f_now, &q_new, &hh);
+        if ( ++f < f_length ) f_now = p_f[f];
+        q = q_new;
+        if ( hh != 0 ) p_h[h++] = hh;
+    }
+
+    // Store the most significant component
+    if ( q != 0 || h == 0 ) p_h[h++] = q;
+
+    // Success
+    return h;
+}
+
+static int geometry_predicates_expansion_scale ( int e_length, const double *p_e, double b, double *p_h )
+{
+
+    // Initialized data
+    double q    = 0,
+           hh   = 0,
+           b_hi = 0,
+           b_lo = 0,
+           sum  = 0,
+           high = 0,
+           low  = 0;
+    int    h    = 0;
+
+    // Split b once
+    geometry_predicates_split(b, &b_hi, &b_lo);
+
+    // Multiply the first component
+    geometry_predicates_two_product_presplit(p_e[0], b, b_hi, b_lo, &q, &hh);
+    if ( hh != 0 ) p_h[h++] = hh;
+
+    // Multiply the rest of the components, and carry
+    for (int e = 1; e < e_length; e++)
+    {
+
+        // Multiply
+        geometry_predicates_two_product_presplit(p_e[e], b, b_hi, b_lo, &high, &low);
+
+        // Carry the low part
+        geometry_predicates_two_sum(q, low, &sum, &hh);
+        if ( hh != 0 ) p_h[h++] = hh;
+
+        // Carry the high part
+        geometry_predicates_fast_two_sum(high, sum, &q, &hh);
+        if ( hh != 0 ) p_h[h++] = hh;
+    }
+
+    // Store the most significant component
+    if ( q != 0 || h == 0 ) p_h[h++] = q;
+
+    // Success
+    return h;
+}
+
+static double geometry_predicates_estimate ( int e_length, const double *p_e )
+{
+
+    // Initialized data
+    double q = p_e[0];
+
+    // Sum the components
+    for (int e = 1; e < e_length; e++)
+        q += p_e[e];
+
+    // Success
+    return q;
+}
+
+static void geometry_predicates_accumulate ( double **pp_now, double **pp_other, int *p_length, int length, const double *p_stage )
+{
+
+    // Initialized data
+    double *p_swap = *pp_now;
+
+    // Add the stage
+    *p_length = geometry_predicates_expansion_sum(*p_length, *pp_now, length, p_stage, *pp_other);
+
+    // Swap the buffers
+    *pp_now   = *pp_other,
+    *pp_other = p_swap;
+
+    // Done
+    return;
+}
+
+static double geometry_predicates_orient2d_adapt ( const geometry_point *p_a, const geometry_point *p_b, const geometry_point *p_c, double permanent )
+{
+
+    // Initialized data
+    double acx        = p_a->x - p_c->x,
+           bcx        = p_b->x - p_c->x,
+           acy        = p_a->y - p_c->y,
+           bcy        = p_b->y - p_c->y,
+           acx_tail   = 0,
+           bcx_tail   = 0,
+           acy_tail   = 0,
+           bcy_tail   = 0,
+           left       = 0,
+           left_tail  = 0,
+           right      = 0,
+           right_tail = 0,
+           s1 = 0, s0 = 0, t1 = 0, t0 = 0,
+           det        = 0,
+           bound      = 0,
+           b[4], u[4], c1[8], c2[12], d[16];
+    int    c1_length = 0,
+           c2_length = 0,
+           d_length  = 0;
+
+    // Compute the determinant of the rounded differences exactly
+    geometry_predicates_two_product(acx, bcy, &left, &left_tail);
+    geometry_predicates_two_product(acy, bcx, &right, &right_tail);
+    geometry_predicates_two_two_diff(left, left_tail, right, right_tail, b);
+
+    // Estimate it
+    det   = geometry_predicates_estimate(4, b),
+    bound = geometry_predicates_ccw_bound_b * permanent;
+
+    // The determinant is far enough from zero
+    if ( det >= bound || -det >= bound ) return det;
+
+    // Compute the rounding errors of the differences
+    acx_tail = geometry_predicates_two_diff_tail(p_a->x, p_c->x, acx),
+    bcx_tail = geometry_predicates_two_diff_tail(p_b->x, p_c->x, bcx),
+    acy_tail = geometry_predicates_two_diff_tail(p_a->y, p_c->y, acy),
+    bcy_tail = geometry_predicates_two_diff_tail(p_b->y, p_c->y, bcy);
+
+    // The differences were exact, so the determinant is too
+    if ( acx_tail == 0 && acy_tail == 0 && bcx_tail == 0 && bcy_tail == 0 ) return det;
+
+    // Correct the determinant by the first order error terms
+    bound = geometry_predicates_ccw_bound_c * permanent + geometry_predicates_result_bound * fabs(det),
+    det  += ( acx * bcy_tail + bcy * acx_tail ) - ( acy * bcx_tail + bcx * acy_tail );
+
+    // The determinant is far enough from zero
+    if ( det >= bound || -det >= bound ) return det;
+
+    // Add every error term exactly
+    geometry_predicates_two_product(acx_tail, bcy, &s1, &s0);
+    geometry_predicates_two_product(acy_tail, bcx, &t1, &t0);
+    geometry_predicates_two_two_diff(s1, s0, t1, t0, u);
+    c1_length = geometry_predicates_expansion_sum(4, b, 4, u, c1);
+
+    geometry_predicates_two_product(acx, bcy_tail, &s1, &s0);
+    geometry_predicates_two_product(acy, bcx_tail, &t1, &t0);
+    geometry_predicates_two_two_diff(s1, s0, t1, t0, u);
+    c2_length = geometry_predicates_expansion_sum(c1_length, c1, 4, u, c2);
+
+    geometry_predicates_two_product(acx_tail, bcy_tail, &s1, &s0);
+    geometry_predicates_two_product(acy_tail, bcx_tail, &t1, &t0);
+    geometry_predicates_two_two_diff(s1, s0, t1, t0, u);
+    d_length = geometry_predicates_expansion_sum(c2_length, c2, 4, u, d);
+
+    // Success
+    return d[d_length - 1];
+}
+
+static double geometry_predicates_incircle_adapt ( const geometry_point *p_a, const geometry_point *p_b, const geometry_point *p_c, const geometry_point *p_d, double permanent )
+{
+
+    // Initialized data
+    double adx = p_a->x - p_d->x,
+           bdx = p_b->x - p_d->x,
+           cdx = p_c->x - p_d->x,
+           ady = p_a->y - p_d->y,
+           bdy = p_b->y - p_d->y,
+           cdy = p_c->y - p_d->y,
+           adx_tail = 0, bdx_tail = 0, cdx_tail = 0,
+           ady_tail = 0, bdy_tail = 0, cdy_tail = 0,
+           det = 0, bound = 0,
+           s1 = 0, s0 = 0, t1 = 0, t0 = 0,
+           bc[4], ca[4], ab[4], aa[4], bb[4], cc[4], u[4], v[4],
+           axtbc[8], aytbc[8], bxtca[8], bytca[8], cxtab[8], cytab[8],
+           axxbc[16], ayybc[16], bxxca[16], byyca[16], cxxab[16], cyyab[16],
+           adet[32], bdet[32], cdet[32], abdet[64],
+           fin1[1152], fin2[1152],
+           *p_now = fin1, *p_other = fin2,
+           temp8[8], temp16a[16], temp16b[16], temp16c[16],
+           temp32a[32], temp32b[32], temp48[48], temp64[64],
+           bct[8], cat[8], abt[8], bctt[4], catt[4], abtt[4],
+           xtt[16], xttt[8];
+    int    axtbc_length = 0, aytbc_length = 0, bxtca_length = 0,
+           bytca_length = 0, cxtab_length = 0, cytab_length = 0,
+           a_length = 0, b_length = 0, c_length = 0, ab_length = 0,
+           fin_length = 0,
+           temp8_length = 0, temp16a_length = 0, temp16b_length = 0, temp16c_length = 0,
+           temp32a_length = 0, temp32b_length = 0, temp48_length = 0, temp64_length = 0,
+           bct_length = 0, cat_length = 0, abt_length = 0,
+           bctt_length = 0, catt_length = 0, abtt_length = 0,
+           xtt_length = 0, xttt_length = 0;
+
+    // Compute the determinant of the rounded differences exactly
+    geometry_predicates_two_product(bdx, cdy, &s1, &s0);
+    geometry_predicates_two_product(cdx, bdy, &t1, &t0);
+    geometry_predicates_two_two_diff(s1, s0, t1, t0, bc);
+    axtbc_length = geometry_predicates_expansion_scale(4, bc, adx, axtbc);
+    temp16a_length = geometry_predicates_expansion_scale(axtbc_length, axtbc, adx, axxbc);
+    aytbc_length = geometry_predicates_expansion_scale(4, bc, ady, aytbc);
+    temp16b_length = geometry_predicates_expansion_scale(aytbc_length, aytbc, ady, ayybc);
+    a_length = geometry_predicates_expansion_sum(temp16a_length, axxbc, temp16b_length, ayybc, adet);
+
+    geometry_predicates_two_product(cdx, ady, &s1, &s0);
+    geometry_predicates_two_product(adx, cdy, &t1, &t0);
+    geometry_predicates_two_two_diff(s1, s0, t1, t0, ca);
+    bxtca_length = geometry_predicates_expansion_scale(4, ca, bdx, bxtca);
+    temp16a_length = geometry_predicates_expansion_scale(bxtca_length, bxtca, bdx, bxxca);
+    bytca_length = geometry_predicates_expansion_scale(4, ca, bdy, bytca);
+    temp16b_length = geometry_predicates_expansion_scale(bytca_length, bytca, bdy, byyca);
+    b_length = geometry_predicates_expansion_sum(temp16a_length, bxxca, temp16b_length, byyca, bdet);
+
+    geometry_predicates_two_product(adx, bdy, &s1, &s0);
+    geometry_predicates_two_product(bdx, ady, &t1, &t0);
+    geometry_predicates_two_two_diff(s1, s0, t1, t0, ab);
+    cxtab_length = geometry_predicates_expansion_scale(4, ab, cdx, cxtab);
+    temp16a_length = geometry_predicates_expansion_scale(cxtab_length, cxtab, cdx, cxxab);
+    cytab_length = geometry_predicates_expansion_scale(4, ab, cdy, cytab);
+    temp16b_length = geometry_predicates_expansion_scale(cytab_length, cytab, cdy, cyyab);
+    c_length = geometry_predicates_expansion_sum(temp16a_length, cxxab, temp16b_length, cyyab, cdet);
+
+    ab_length  = geometry_predicates_expansion_sum(a_length, adet, b_length, bdet, abdet);
+    fin_length = geometry_predicates_expansion_sum(ab_length, abdet, c_length, cdet, p_now);
+
+    // Estimate it
+    det   = geometry_predicates_estimate(fin_length, p_now),
+    bound = geometry_predicates_icc_bound_b * permanent;
+
+    // The determinant is far enough from zero
+    if ( det >= bound || -det >= bound ) return det;
+
+    // Compute the rounding errors of the differences
+    adx_tail = geometry_predicates_two_diff_tail(p_a->x, p_d->x, adx),
+    ady_tail = geometry_predicates_two_diff_tail(p_a->y, p_d->y, ady),
+    bdx_tail = geometry_predicates_two_diff_tail(p_b->x, p_d->x, bdx),
+    bdy_tail = geometry_predicates_two_diff_tail(p_b->y, p_d->y, bdy),
+    cdx_tail = geometry_predicates_two_diff_tail(p_c->x, p_d->x, cdx),
+    cdy_tail = geometry_predicates_two_diff_tail(p_c->y, p_d->y, cdy);
+
+    // The differences were exact, so the determinant is too
+    if ( adx_tail == 0 && bdx_tail == 0 && cdx_tail == 0 && ady_tail == 0 && bdy_tail == 0 && cdy_tail == 0 ) return det;
+
+    // Correct the determinant by the first order error terms
+    bound = geometry_predicates_icc_bound_c * permanent + geometry_predicates_result_bound * fabs(det),
+    det  += ( ( adx * adx + ady * ady ) * ( ( bdx * cdy_tail + cdy * bdx_tail ) - ( bdy * cdx_tail + cdx * bdy_tail ) )
+            + 2.0 * ( adx * adx_tail + ady * ady_tail ) * ( bdx * cdy - bdy * cdx ) )
+          + ( ( bdx * bdx + bdy * bdy ) * ( ( cdx * ady_tail + ady * cdx_tail ) - ( cdy * adx_tail + adx * cdy_tail ) )
+            + 2.0 * ( bdx * bdx_tail + bdy * bdy_tail ) * ( cdx * ady - cdy * adx ) )
+          + ( ( cdx * cdx + cdy * cdy ) * ( ( adx * bdy_tail + bdy * adx_tail ) - ( ady * bdx_tail + bdx * ady_tail ) )
+            + 2.0 * ( cdx * cdx_tail + cdy * cdy_tail ) * ( adx * bdy - ady * bdx ) );
+
+    // The determinant is far enough from zero
+    if ( det >= bound || -det >= bound ) return det;
+
+    // Square the differences that multiply error terms
+    if ( bdx_tail != 0 || bdy_tail != 0 || cdx_tail != 0 || cdy_tail != 0 )
+    {
+        geometry_predicates_square(adx, &s1, &s0);
+        geometry_predicates_square(ady, &t1, &t0);
+        geometry_predicates_two_two_sum(s1, s0, t1, t0, aa);
+    }
+    if ( cdx_tail != 0 || cdy_tail != 0 || adx_tail != 0 || ady_tail != 0 )
+    {
+        geometry_predicates_square(bdx, &s1, &s0);
+        geometry_predicates_square(bdy, &t1, &t0);
+        geometry_predicates_two_two_sum(s1, s0, t1, t0, bb);
+    }
+    if ( adx_tail != 0 || ady_tail != 0 || bdx_tail != 0 || bdy_tail != 0 )
+    {
+        geometry_predicates_square(cdx, &s1, &s0);
+        geometry_predicates_square(cdy, &t1, &t0);
+        geometry_predicates_two_two_sum(s1, s0, t1, t0, cc);
+    }
+
+    // Add the terms with one error term of each point
+    if ( adx_tail != 0 )
+    {
+        axtbc_length   = geometry_predicates_expansion_scale(4, bc, adx_tail, axtbc);
+        temp16a_length = geometry_predicates_expansion_scale(axtbc_length, axtbc, 2.0 * adx, temp16a);
+        temp8_length   = geometry_predicates_expansion_scale(4, cc, adx_tail, temp8);
+        temp16b_length = geometry_predicates_expansion_scale(temp8_length, temp8, bdy, temp16b);
+        temp8_length   = geometry_predicates_expansion_scale(4, bb, adx_tail, temp8);
+        temp16c_length = geometry_predicates_expansion_scale(temp8_length, temp8, -cdy, temp16c);
+        temp32a_length = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp16b_length, temp16b, temp32a);
+        temp48_length  = geometry_predicates_expansion_sum(temp16c_length, temp16c, temp32a_length, temp32a, temp48);
+        geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp48_length, temp48);
+    }
+    if ( ady_tail != 0 )
+    {
+        aytbc_length   = geometry_predicates_expansion_scale(4, bc, ady_tail, aytbc);
+        temp16a_length = geometry_predicates_expansion_scale(aytbc_length, aytbc, 2.0 * ady, temp16a);
+        temp8_length   = geometry_predicates_expansion_scale(4, bb, ady_tail, temp8);
+        temp16b_length = geometry_predicates_expansion_scale(temp8_length, temp8, cdx, temp16b);
+        temp8_length   = geometry_predicates_expansion_scale(4, cc, ady_tail, temp8);
+        temp16c_length = geometry_predicates_expansion_scale(temp8_length, temp8, -bdx, temp16c);
+        temp32a_length = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp16b_length, temp16b, temp32a);
+        temp48_length  = geometry_predicates_expansion_sum(temp16c_length, temp16c, temp32a_length, temp32a, temp48);
+        geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp48_length, temp48);
+    }
+    if ( bdx_tail != 0 )
+    {
+        bxtca_length   = geometry_predicates_expansion_scale(4, ca, bdx_tail, bxtca);
+        temp16a_length = geometry_predicates_expansion_scale(bxtca_length, bxtca, 2.0 * bdx, temp16a);
+        temp8_length   = geometry_predicates_expansion_scale(4, aa, bdx_tail, temp8);
+        temp16b_length = geometry_predicates_expansion_scale(temp8_length, temp8, cdy, temp16b);
+        temp8_length   = geometry_predicates_expansion_scale(4, cc, bdx_tail, temp8);
+        temp16c_length = geometry_predicates_expansion_scale(temp8_length, temp8, -ady, temp16c);
+        temp32a_length = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp16b_length, temp16b, temp32a);
+        temp48_length  = geometry_predicates_expansion_sum(temp16c_length, temp16c, temp32a_length, temp32a, temp48);
+        geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp48_length, temp48);
+    }
+    if ( bdy_tail != 0 )
+    {
+        bytca_length   = geometry_predicates_expansion_scale(4, ca, bdy_tail, bytca);
+        temp16a_length = geometry_predicates_expansion_scale(bytca_length, bytca, 2.0 * bdy, temp16a);
+        temp8_length   = geometry_predicates_expansion_scale(4, cc, bdy_tail, temp8);
+        temp16b_length = geometry_predicates_expansion_scale(temp8_length, temp8, adx, temp16b);
+        temp8_length   = geometry_predicates_expansion_scale(4, aa, bdy_tail, temp8);
+        temp16c_length = geometry_predicates_expansion_scale(temp8_length, temp8, -cdx, temp16c);
+        temp32a_length = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp16b_length, temp16b, temp32a);
+        temp48_length  = geometry_predicates_expansion_sum(temp16c_length, temp16c, temp32a_length, temp32a, temp48);
+        geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp48_length, temp48);
+    }
+    if ( cdx_tail != 0 )
+    {
+        cxtab_length   = geometry_predicates_expansion_scale(4, ab, cdx_tail, cxtab);
+        temp16a_length = geometry_predicates_expansion_scale(cxtab_length, cxtab, 2.0 * cdx, temp16a);
+        temp8_length   = geometry_predicates_expansion_scale(4, bb, cdx_tail, temp8);
+        temp16b_length = geometry_predicates_expansion_scale(temp8_length, temp8, ady, temp16b);
+        temp8_length   = geometry_predicates_expansion_scale(4, aa, cdx_tail, temp8);
+        temp16c_length = geometry_predicates_expansion_scale(temp8_length, temp8, -bdy, temp16c);
+        temp32a_length = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp16b_length, temp16b, temp32a);
+        temp48_length  = geometry_predicates_expansion_sum(temp16c_length, temp16c, temp32a_length, temp32a, temp48);
+        geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp48_length, temp48);
+    }
+    if ( cdy_tail != 0 )
+    {
+        cytab_length   = geometry_predicates_expansion_scale(4, ab, cdy_tail, cytab);
+        temp16a_length = geometry_predicates_expansion_scale(cytab_length, cytab, 2.0 * cdy, temp16a);
+        temp8_length   = geometry_predicates_expansion_scale(4, aa, cdy_tail, temp8);
+        temp16b_length = geometry_predicates_expansion_scale(temp8_length, temp8, bdx, temp16b);
+        temp8_length   = geometry_predicates_expansion_scale(4, bb, cdy_tail, temp8);
+        temp16c_length = geometry_predicates_expansion_scale(temp8_length, temp8, -adx, temp16c);
+        temp32a_length = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp16b_length, temp16b, temp32a);
+        temp48_length  = geometry_predicates_expansion_sum(temp16c_length, temp16c, temp32a_length, temp32a, temp48);
+        geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp48_length, temp48);
+    }
+
+    // Add the terms with error terms of two points
+    if ( adx_tail != 0 || ady_tail != 0 )
+    {
+
+        // The error terms of b and c
+        if ( bdx_tail != 0 || bdy_tail != 0 || cdx_tail != 0 || cdy_tail != 0 )
+        {
+            geometry_predicates_two_product(bdx_tail, cdy, &s1, &s0);
+            geometry_predicates_two_product(bdx, cdy_tail, &t1, &t0);
+            geometry_predicates_two_two_sum(s1, s0, t1, t0, u);
+            geometry_predicates_two_product(cdx_tail, -bdy, &s1, &s0);
+            geometry_predicates_two_product(cdx, -bdy_tail, &t1, &t0);
+            geometry_predicates_two_two_sum(s1, s0, t1, t0, v);
+            bct_length = geometry_predicates_expansion_sum(4, u, 4, v, bct);
+            geometry_predicates_two_product(bdx_tail, cdy_tail, &s1, &s0);
+            geometry_predicates_two_product(cdx_tail, bdy_tail, &t1, &t0);
+            geometry_predicates_two_two_diff(s1, s0, t1, t0, bctt);
+            bctt_length = 4;
+        }
+        else
+            bct[0] = 0, bct_length = 1, bctt[0] = 0, bctt_length = 1;
+
+        if ( adx_tail != 0 )
+        {
+            temp16a_length = geometry_predicates_expansion_scale(axtbc_length, axtbc, adx_tail, temp16a);
+            xtt_length     = geometry_predicates_expansion_scale(bct_length, bct, adx_tail, xtt);
+            temp32a_length = geometry_predicates_expansion_scale(xtt_length, xtt, 2.0 * adx, temp32a);
+            temp48_length  = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp32a_length, temp32a, temp48);
+            geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp48_length, temp48);
+            if ( bdy_tail != 0 )
+            {
+                temp8_length   = geometry_predicates_expansion_scale(4, cc, adx_tail, temp8);
+                temp16a_length = geometry_predicates_expansion_scale(temp8_length, temp8, bdy_tail, temp16a);
+                geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp16a_length, temp16a);
+            }
+            if ( cdy_tail != 0 )
+            {
+                temp8_length   = geometry_predicates_expansion_scale(4, bb, -adx_tail, temp8);
+                temp16a_length = geometry_predicates_expansion_scale(temp8_length, temp8, cdy_tail, temp16a);
+                geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp16a_length, temp16a);
+            }
+            temp32a_length = geometry_predicates_expansion_scale(xtt_length, xtt, adx_tail, temp32a);
+            xttt_length    = geometry_predicates_expansion_scale(bctt_length, bctt, adx_tail, xttt);
+            temp16a_length = geometry_predicates_expansion_scale(xttt_length, xttt, 2.0 * adx, temp16a);
+            temp16b_length = geometry_predicates_expansion_scale(xttt_length, xttt, adx_tail, temp16b);
+            temp32b_length = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp16b_length, temp16b, temp32b);
+            temp64_length  = geometry_predicates_expansion_sum(temp32a_length, temp32a, temp32b_length, temp32b, temp64);
+            geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp64_length, temp64);
+        }
+        if ( ady_tail != 0 )
+        {
+            temp16a_length = geometry_predicates_expansion_scale(aytbc_length, aytbc, ady_tail, temp16a);
+            xtt_length     = geometry_predicates_expansion_scale(bct_length, bct, ady_tail, xtt);
+            temp32a_length = geometry_predicates_expansion_scale(xtt_length, xtt, 2.0 * ady, temp32a);
+            temp48_length  = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp32a_length, temp32a, temp48);
+            geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp48_length, temp48);
+            temp32a_length = geometry_predicates_expansion_scale(xtt_length, xtt, ady_tail, temp32a);
+            xttt_length    = geometry_predicates_expansion_scale(bctt_length, bctt, ady_tail, xttt);
+            temp16a_length = geometry_predicates_expansion_scale(xttt_length, xttt, 2.0 * ady, temp16a);
+            temp16b_length = geometry_predicates_expansion_scale(xttt_length, xttt, ady_tail, temp16b);
+            temp32b_length = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp16b_length, temp16b, temp32b);
+            temp64_length  = geometry_predicates_expansion_sum(temp32a_length, temp32a, temp32b_length, temp32b, temp64);
+            geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp64_length, temp64);
+        }
+    }
+    if ( bdx_tail != 0 || bdy_tail != 0 )
+    {
+
+        // The error terms of c and a
+        if ( cdx_tail != 0 || cdy_tail != 0 || adx_tail != 0 || ady_tail != 0 )
+        {
+            geometry_predicates_two_product(cdx_tail, ady, &s1, &s0);
+            geometry_predicates_two_product(cdx, ady_tail, &t1, &t0);
+            geometry_predicates_two_two_sum(s1, s0, t1, t0, u);
+            geometry_predicates_two_product(adx_tail, -cdy, &s1, &s0);
+            geometry_predicates_two_product(adx, -cdy_tail, &t1, &t0);
+            geometry_predicates_two_two_sum(s1, s0, t1, t0, v);
+            cat_length = geometry_predicates_expansion_sum(4, u, 4, v, cat);
+            geometry_predicates_two_product(cdx_tail, ady_tail, &s1, &s0);
+            geometry_predicates_two_product(adx_tail, cdy_tail, &t1, &t0);
+            geometry_predicates_two_two_diff(s1, s0, t1, t0, catt);
+            catt_length = 4;
+        }
+        else
+            cat[0] = 0, cat_length = 1, catt[0] = 0, catt_length = 1;
+
+        if ( bdx_tail != 0 )
+        {
+            temp16a_length = geometry_predicates_expansion_scale(bxtca_length, bxtca, bdx_tail, temp16a);
+            xtt_length     = geometry_predicates_expansion_scale(cat_length, cat, bdx_tail, xtt);
+            temp32a_length = geometry_predicates_expansion_scale(xtt_length, xtt, 2.0 * bdx, temp32a);
+            temp48_length  = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp32a_length, temp32a, temp48);
+            geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp48_length, temp48);
+            if ( cdy_tail != 0 )
+            {
+                temp8_length   = geometry_predicates_expansion_scale(4, aa, bdx_tail, temp8);
+                temp16a_length = geometry_predicates_expansion_scale(temp8_length, temp8, cdy_tail, temp16a);
+                geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp16a_length, temp16a);
+            }
+            if ( ady_tail != 0 )
+            {
+                temp8_length   = geometry_predicates_expansion_scale(4, cc, -bdx_tail, temp8);
+                temp16a_length = geometry_predicates_expansion_scale(temp8_length, temp8, ady_tail, temp16a);
+                geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp16a_length, temp16a);
+            }
+            temp32a_length = geometry_predicates_expansion_scale(xtt_length, xtt, bdx_tail, temp32a);
+            xttt_length    = geometry_predicates_expansion_scale(catt_length, catt, bdx_tail, xttt);
+            temp16a_length = geometry_predicates_expansion_scale(xttt_length, xttt, 2.0 * bdx, temp16a);
+            temp16b_length = geometry_predicates_expansion_scale(xttt_length, xttt, bdx_tail, temp16b);
+            temp32b_length = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp16b_length, temp16b, temp32b);
+            temp64_length  = geometry_predicates_expansion_sum(temp32a_length, temp32a, temp32b_length, temp32b, temp64);
+            geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp64_length, temp64);
+        }
+        if ( bdy_tail != 0 )
+        {
+            temp16a_length = geometry_predicates_expansion_scale(bytca_length, bytca, bdy_tail, temp16a);
+            xtt_length     = geometry_predicates_expansion_scale(cat_length, cat, bdy_tail, xtt);
+            temp32a_length = geometry_predicates_expansion_scale(xtt_length, xtt, 2.0 * bdy, temp32a);
+            temp48_length  = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp32a_length, temp32a, temp48);
+            geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp48_length, temp48);
+            temp32a_length = geometry_predicates_expansion_scale(xtt_length, xtt, bdy_tail, temp32a);
+            xttt_length    = geometry_predicates_expansion_scale(catt_length, catt, bdy_tail, xttt);
+            temp16a_length = geometry_predicates_expansion_scale(xttt_length, xttt, 2.0 * bdy, temp16a);
+            temp16b_length = geometry_predicates_expansion_scale(xttt_length, xttt, bdy_tail, temp16b);
+            temp32b_length = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp16b_length, temp16b, temp32b);
+            temp64_length  = geometry_predicates_expansion_sum(temp32a_length, temp32a, temp32b_length, temp32b, temp64);
+            geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp64_length, temp64);
+        }
+    }
+    if ( cdx_tail != 0 || cdy_tail != 0 )
+    {
+
+        // The error terms of a and b
+        if ( adx_tail != 0 || ady_tail != 0 || bdx_tail != 0 || bdy_tail != 0 )
+        {
+            geometry_predicates_two_product(adx_tail, bdy, &s1, &s0);
+            geometry_predicates_two_product(adx, bdy_tail, &t1, &t0);
+            geometry_predicates_two_two_sum(s1, s0, t1, t0, u);
+            geometry_predicates_two_product(bdx_tail, -ady, &s1, &s0);
+            geometry_predicates_two_product(bdx, -ady_tail, &t1, &t0);
+            geometry_predicates_two_two_sum(s1, s0, t1, t0, v);
+            abt_length = geometry_predicates_expansion_sum(4, u, 4, v, abt);
+            geometry_predicates_two_product(adx_tail, bdy_tail, &s1, &s0);
+            geometry_predicates_two_product(bdx_tail, ady_tail, &t1, &t0);
+            geometry_predicates_two_two_diff(s1, s0, t1, t0, abtt);
+            abtt_length = 4;
+        }
+        else
+            abt[0] = 0, abt_length = 1, abtt[0] = 0, abtt_length = 1;
+
+        if ( cdx_tail != 0 )
+        {
+            temp16a_length = geometry_predicates_expansion_scale(cxtab_length, cxtab, cdx_tail, temp16a);
+            xtt_length     = geometry_predicates_expansion_scale(abt_length, abt, cdx_tail, xtt);
+            temp32a_length = geometry_predicates_expansion_scale(xtt_length, xtt, 2.0 * cdx, temp32a);
+            temp48_length  = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp32a_length, temp32a, temp48);
+            geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp48_length, temp48);
+            if ( ady_tail != 0 )
+            {
+                temp8_length   = geometry_predicates_expansion_scale(4, bb, cdx_tail, temp8);
+                temp16a_length = geometry_predicates_expansion_scale(temp8_length, temp8, ady_tail, temp16a);
+                geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp16a_length, temp16a);
+            }
+            if ( bdy_tail != 0 )
+            {
+                temp8_length   = geometry_predicates_expansion_scale(4, aa, -cdx_tail, temp8);
+                temp16a_length = geometry_predicates_expansion_scale(temp8_length, temp8, bdy_tail, temp16a);
+                geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp16a_length, temp16a);
+            }
+            temp32a_length = geometry_predicates_expansion_scale(xtt_length, xtt, cdx_tail, temp32a);
+            xttt_length    = geometry_predicates_expansion_scale(abtt_length, abtt, cdx_tail, xttt);
+            temp16a_length = geometry_predicates_expansion_scale(xttt_length, xttt, 2.0 * cdx, temp16a);
+            temp16b_length = geometry_predicates_expansion_scale(xttt_length, xttt, cdx_tail, temp16b);
+            temp32b_length = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp16b_length, temp16b, temp32b);
+            temp64_length  = geometry_predicates_expansion_sum(temp32a_length, temp32a, temp32b_length, temp32b, temp64);
+            geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp64_length, temp64);
+        }
+        if ( cdy_tail != 0 )
+        {
+            temp16a_length = geometry_predicates_expansion_scale(cytab_length, cytab, cdy_tail, temp16a);
+            xtt_length     = geometry_predicates_expansion_scale(abt_length, abt, cdy_tail, xtt);
+            temp32a_length = geometry_predicates_expansion_scale(xtt_length, xtt, 2.0 * cdy, temp32a);
+            temp48_length  = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp32a_length, temp32a, temp48);
+            geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp48_length, temp48);
+            temp32a_length = geometry_predicates_expansion_scale(xtt_length, xtt, cdy_tail, temp32a);
+            xttt_length    = geometry_predicates_expansion_scale(abtt_length, abtt, cdy_tail, xttt);
+            temp16a_length = geometry_predicates_expansion_scale(xttt_length, xttt, 2.0 * cdy, temp16a);
+            temp16b_length = geometry_predicates_expansion_scale(xttt_length, xttt, cdy_tail, temp16b);
+            temp32b_length = geometry_predicates_expansion_sum(temp16a_length, temp16a, temp16b_length, temp16b, temp32b);
+            temp64_length  = geometry_predicates_expansion_sum(temp32a_length, temp32a, temp32b_length, temp32b, temp64);
+            geometry_predicates_accumulate(&p_now, &p_other, &fin_length, temp64_length, temp64);
+        }
+    }
+
+    // Success
+    return p_now[fin_length - 1];
+}
@@ -0,0 +1,510 @@
+/** !
+ * Prepared geometry
+ *
+ * @file prepared.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <math.h>
+
+// Header
+#include <geometry/prepared.h>
+#include <geometry/parallel.h>
+
+// Structure declarations
+struct geometry_prepared_batch_s;
+
+// Type definitions
+typedef struct geometry_prepared_batch_s geometry_prepared_batch;
+
+// Structure definitions
+struct geometry_prepared_batch_s
+{
+    geometry_prepared_polygon *p_prepared_polygon;
+    geometry_point            *p_points;
+    bool                      *p_results;
+};
+
+// Forward declarations
+/** !
+ * Compute the band that holds a y coordinate. The band never decreases
+ * as y increases, so an edge from y0 to y1 crosses every band from the
+ * band of y0 to the band of y1.
+ *
+ * @param y_min         the bottom of the first band
+ * @param band_scale    the quantity of bands per unit of y
+ * @param band_quantity the quantity of bands
+ * @param y             the y coordinate
+ *
+ * @return the band
+ */
+static size_t geometry_prepared_band ( double y_min, double band_scale, size_t band_quantity, double y );
+
+/** !
+ * Count the edges of each band, counting an edge once for each band it
+ * crosses. Horizontal edges never cross the ray of a query, and are not
+ * counted.
+ *
+ * @param p_polygon     the polygon
+ * @param y_min         the bottom of the first band
+ * @param band_scale    the quantity of bands per unit of y
+ * @param band_quantity the quantity of bands
+ * @param p_counts      return the quantity of edges of each band; may be null
+ *
+ * @return the quantity of edges of all the bands
+ */
+static size_t geometry_prepared_count ( geometry_polygon *p_polygon, double y_min, double band_scale, size_t band_quantity, size_t *p_counts );
+
+/** !
+ * Test if a point is inside of a prepared polygon
+ *
+ * @param p_prepared_polygon the prepared polygon
+ * @param p_point            the point
+ *
+ * @return true if the point is inside, else false
+ */
+static bool geometry_prepared_test ( const geometry_prepared_polygon *p_prepared_polygon, const geometry_point *p_point );
+
+/** !
+ * Test each point of a chunk of a batch
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first point of the chunk
+ * @param last        one past the last point of the chunk
+ * @param p_parameter the batch
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_prepared_batch_chunk ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+// Function definitions
+int geometry_prepared_polygon_construct ( geometry_prepared_polygon **pp_prepared_polygon, geometry_polygon *p_polygon )
+{
+
+    // Argument check
+    if ( pp_prepared_polygon == (void *) 0 ) goto no_prepared_polygon;
+    if ( p_polygon           == (void *) 0 ) goto no_polygon;
+    if ( p_polygon->quantity && p_polygon->p_verticies == (void *) 0 ) goto no_verticies;
+
+    // Initialized data
+    geometry_prepared_polygon *p_prepared_polygon = (void *) 0;
+    size_t                     quantity           = p_polygon->quantity,
+                               band_quantity      = 0,
+                               edge_quantity      = 0;
+    double                     y_min              = INFINITY,
+                               y_max              = -INFINITY,
+                               band_scale         = 0;
+
+    // Compute the vertical extent of the polygon
+    for (size_t i = 0; i < quantity; i++)
+    {
+        if ( p_polygon->p_verticies[i].y < y_min ) y_min = p_polygon->p_verticies[i].y;
+        if ( p_polygon->p_verticies[i].y > y_max ) y_max = p_polygon->p_verticies[i].y;
+    }
+
+    // Strategy
+    //
+    // Start with one band for each vertex. Edges that are long compared to
+    // a band are stored in many bands, so halve the bands until the edges
+    // fit in a small multiple of the verticies. A polygon with no height
+    // has one band, and no edges.
+    if ( y_max > y_min )
+    {
+
+        // Start with one band for each vertex
+        band_quantity = quantity;
+
+        // Halve the bands until the edges fit
+        for (;;)
+        {
+
+            // Compute the scale
+            band_scale = (double) band_quantity / ( y_max - y_min );
+
+            // Count the edges
+            edge_quantity = geometry_prepared_count(p_polygon, y_min, band_scale, band_quantity, (void *) 0);
+
+            // Done
+            if ( band_quantity == 1 || edge_quantity <= GEOMETRY_PREPARED_EDGE_RATIO * quantity ) break;
+
+            // Halve the bands
+            band_quantity /= 2;
+        }
+    }
+    else if ( quantity )
+        band_quantity = 1;
+
+    // Allocate the prepared polygon. The offsets and the edges follow it.
+    p_prepared_polygon = GEOMETRY_REALLOC(0, sizeof(geometry_prepared_polygon) + sizeof(size_t) * ( band_quantity + 1 ) + sizeof(geometry_line) * edge_quantity);
+
+    // Error check
+    if ( p_prepared_polygon == (void *) 0 ) goto no_mem;
+
+    // Populate the prepared polygon
+    *p_prepared_polygon = (geometry_prepared_polygon)
+    {
+        .band_quantity = band_quantity,
+        .y_min         = y_min,
+        .y_max         = y_max,
+        .band_scale    = band_scale,
+        .p_offsets     = (size_t *) ( p_prepared_polygon + 1 ),
+        .p_edges       = (geometry_line *) ( (size_t *) ( p_prepared_polygon + 1 ) + band_quantity + 1 )
+    };
+
+    // Count the edges of each band
+    p_prepared_polygon->p_offsets[0] = 0;
+    geometry_prepared_count(p_polygon, y_min, band_scale, band_quantity, p_prepared_polygon->p_offsets + 1);
+
+    // Compute where each band ends
+    for (size_t i = 1; i <= band_quantity; i++)
+        p_prepared_polygon->p_offsets[i] += p_prepared_polygon->p_offsets[i - 1];
+
+    // Store the edges. Each band writes at its offset, and advances it.
+    if ( edge_quantity )
+    {
+        for (size_t i = 0, j = quantity - 1; i < quantity; j = i++)
+        {
+
+            // Initialized data
+            geometry_point a = p_polygon->p_verticies[j],
+                           b = p_polygon->p_verticies[i];
+            size_t         first = 0,
+                           last  = 0;
+
+            // Skip horizontal edges
+            if ( a.y == b.y ) continue;
+
+            // Compute the bands of the edge
+            first = geometry_prepared_band(y_min, band_scale, band_quantity, ( a.y < b.y ) ? a.y : b.y),
+            last  = geometry_prepared_band(y_min, band_scale, band_quantity, ( a.y < b.y ) ? b.y : a.y);
+
+            // Store the edge in each band
+            for (size_t k = first; k <= last; k++)
+                p_prepared_polygon->p_edges[p_prepared_polygon->p_offsets[k]++] = (geometry_line) { .x0 = a.x, .y0 = a.y, .x1 = b.x, .y1 = b.y };
+        }
+    }
+
+    // Each offset is now the end of its band, so move them up by one band
+    for (size_t i = band_quantity; i > 0; i--)
+        p_prepared_polygon->p_offsets[i] = p_prepared_polygon->p_offsets[i - 1];
+
+    // The first band starts at the first edge
+    p_prepared_polygon->p_offsets[0] = 0;
+
+    // Return a pointer to the caller
+    *pp_prepared_polygon = p_prepared_polygon;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_prepared_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_prepared_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_verticies:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_polygon\" has no verticies in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_prepared_polygon_contains ( geometry_prepared_polygon *p_prepared_polygon, geometry_point *p_point, bool *p_result )
+{
+
+    // Argument check
+    if ( p_prepared_polygon == (void *) 0 ) goto no_prepared_polygon;
+    if ( p_point            == (void *) 0 ) goto no_point;
+    if ( p_result           == (void *) 0 ) goto no_result;
+
+    // Return the result to the caller
+    *p_result = geometry_prepared_test(p_prepared_polygon, p_point);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_prepared_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_prepared_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_prepared_polygon_contains_batch ( geometry_prepared_polygon *p_prepared_polygon, geometry_point *p_points, size_t quantity, bool *p_results )
+{
+
+    // Argument check
+    if ( p_prepared_polygon == (void *) 0 ) goto no_prepared_polygon;
+    if ( quantity && p_points  == (void *) 0 ) goto no_points;
+    if ( quantity && p_results == (void *) 0 ) goto no_results;
+
+    // Initialized data
+    geometry_prepared_batch _batch = { .p_prepared_polygon = p_prepared_polygon, .p_points = p_points, .p_results = p_results };
+
+    // Test each point
+    if ( geometry_parallel_for(quantity, GEOMETRY_PREPARED_GRAIN, geometry_prepared_batch_chunk, &_batch) == 0 ) goto failed_to_run_tasks;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_prepared_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_prepared_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_points:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_points\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_run_tasks:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to run parallel tasks in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_prepared_polygon_destroy ( geometry_prepared_polygon **pp_prepared_polygon )
+{
+
+    // Argument check
+    if ( pp_prepared_polygon == (void *) 0 ) goto no_prepared_polygon;
+
+    // Initialized data
+    geometry_prepared_polygon *p_prepared_polygon = *pp_prepared_polygon;
+
+    // Error check
+    if ( p_prepared_polygon == (void *) 0 ) goto pointer_to_null_pointer;
+
+    // No more pointer for caller
+    *pp_prepared_polygon = (void *) 0;
+
+    // Free the prepared polygon. The offsets and edges live in the same block.
+    p_prepared_polygon = GEOMETRY_REALLOC(p_prepared_polygon, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_prepared_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_prepared_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            pointer_to_null_pointer:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"pp_prepared_polygon\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static size_t geometry_prepared_band ( double y_min, double band_scale, size_t band_quantity, double y )
+{
+
+    // Initialized data
+    double t = ( y - y_min ) * band_scale;
+
+    // Below the first band, or not a number
+    if ( !( t > 0 ) ) return 0;
+
+    // Above the last band
+    if ( t >= (double) band_quantity ) return band_quantity - 1;
+
+    // Success
+    return (size_t) t;
+}
+
+static size_t geometry_prepared_count ( geometry_polygon *p_polygon, double y_min, double band_scale, size_t band_quantity, size_t *p_counts )
+{
+
+    // Initialized data
+    size_t ret      = 0,
+           quantity = p_polygon->quantity;
+
+    // Clear the counts
+    if ( p_counts )
+        for (size_t i = 0; i < band_quantity; i++)
+            p_counts[i] = 0;
+
+    // Count each edge
+    for (size_t i = 0, j = quantity - 1; i < quantity; j = i++)
+    {
+
+        // Initialized data
+        double a     = p_polygon->p_verticies[j].y,
+               b     = p_polygon->p_verticies[i].y;
+        size_t first = 0,
+               last  = 0;
+
+        // Skip horizontal edges
+        if ( a == b ) continue;
+
+        // Compute the bands of the edge
+        first = geometry_prepared_band(y_min, band_scale, band_quantity, ( a < b ) ? a : b),
+        last  = geometry_prepared_band(y_min, band_scale, band_quantity, ( a < b ) ? b : a);
+
+        // Accumulate
+        ret += last - first + 1;
+
+        // Count the edge in each band
+        if ( p_counts )
+            for (size_t k = first; k <= last; k++)
+                p_counts[k]++;
+    }
+
+    // Success
+    return ret;
+}
+
+static bool geometry_prepared_test ( const geometry_prepared_polygon *p_prepared_polygon, const geometry_point *p_point )
+{
+
+    // Initialized data
+    bool                 inside = false;
+    double               px     = p_point->x,
+                         py     = p_point->y;
+    size_t               band   = 0;
+    const geometry_line *p_edge = (void *) 0,
+                        *p_end  = (void *) 0;
+
+    // No edge straddles a ray outside of the polygon's vertical extent
+    if ( !( py >= p_prepared_polygon->y_min && py < p_prepared_polygon->y_max ) ) return false;
+
+    // Find the band of the point
+    band   = geometry_prepared_band(p_prepared_polygon->y_min, p_prepared_polygon->band_scale, p_prepared_polygon->band_quantity, py),
+    p_edge = &p_prepared_polygon->p_edges[p_prepared_polygon->p_offsets[band]],
+    p_end  = &p_prepared_polygon->p_edges[p_prepared_polygon->p_offsets[band + 1]];
+
+    // Cast a ray toward +x, and count the edges of the band it crosses.
+    // This is the test of geometry_point_in_polygon, operation for
+    // operation, so the answers match exactly.
+    for (; p_edge < p_end; p_edge++)
+    {
+
+        // Does the edge straddle the ray?
+        if ( ( p_edge->y0 > py ) != ( p_edge->y1 > py ) )
+        {
+
+            // Initialized data
+            double x = p_edge->x0 + ( py - p_edge->y0 ) * ( p_edge->x1 - p_edge->x0 ) / ( p_edge->y1 - p_edge->y0 );
+
+            // Crossing
+            if ( px < x ) inside = !inside;
+        }
+    }
+
+    // Success
+    return inside;
+}
+
+static int geometry_prepared_batch_chunk ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_prepared_batch *p_batch = p_parameter;
+
+    // Unused
+    (void) chunk;
+
+    // Test each point
+    for (size_t i = first; i < last; i++)
+        p_batch->p_results[i] = geometry_prepared_test(p_batch->p_prepared_polygon, &p_batch->p_points[i]);
+
+    // Success
+    return 1;
+}
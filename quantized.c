@@ -0,0 +1,963 @@
+/** !
+ * Quantized geometry
+ *
+ * @file quantized.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <string.h>
+
+// Header
+#include <geometry/quantized.h>
+#include <geometry/arena.h>
+
+// Preprocessor definitions
+// Zigzag encoding maps small negative differences to small unsigned integers
+#define GEOMETRY_ZIGZAG_ENCODE(v) ( ( (uint64_t) (v) << 1 ) ^ (uint64_t) ( (int64_t) (v) >> 63 ) )
+#define GEOMETRY_ZIGZAG_DECODE(u) ( (int64_t) ( (u) >> 1 ) ^ -(int64_t) ( (u) & 1 ) )
+
+// Structure declarations
+struct geometry_int128_s;
+struct geometry_quantized_ring_reader_s;
+
+// Type definitions
+typedef struct geometry_int128_s                geometry_int128;
+typedef struct geometry_quantized_ring_reader_s geometry_quantized_ring_reader;
+
+// Structure definitions
+// A two's complement 128 bit integer, for sums of 64 bit products
+struct geometry_int128_s
+{
+    uint64_t lo;
+    int64_t  hi;
+};
+
+struct geometry_quantized_ring_reader_s
+{
+    const unsigned char      *p_data,
+                             *p_end;
+    geometry_quantized_point  point;
+};
+
+// Forward declarations
+/** !
+ * Add a 64 bit integer to a 128 bit integer
+ *
+ * @param p_sum the 128 bit integer
+ * @param value the 64 bit integer
+ *
+ * @return void
+ */
+static void geometry_int128_add ( geometry_int128 *p_sum, int64_t value );
+
+/** !
+ * Convert a 128 bit integer to the nearest double
+ *
+ * @param sum the 128 bit integer
+ *
+ * @return the value of the integer
+ */
+static double geometry_int128_to_double ( geometry_int128 sum );
+
+/** !
+ * Compute the size of a varint
+ *
+ * @param value the value
+ *
+ * @return the size of the varint, in bytes
+ */
+static size_t geometry_varint_size ( uint64_t value );
+
+/** !
+ * Write a varint
+ *
+ * @param p     the output
+ * @param value the value
+ *
+ * @return the output, after the varint
+ */
+static unsigned char *geometry_varint_write ( unsigned char *p, uint64_t value );
+
+/** !
+ * Read the next vertex of a quantized ring
+ *
+ * @param p_reader the ring reader
+ * @param p_point  return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_quantized_ring_next ( geometry_quantized_ring_reader *p_reader, geometry_quantized_point *p_point );
+
+// Function definitions
+int geometry_quantization_construct ( geometry_quantization *p_quantization, geometry *p_geometries, size_t quantity )
+{
+
+    // Argument check
+    if ( p_quantization == (void *) 0 ) goto no_quantization;
+    if ( p_geometries   == (void *) 0 ) goto no_geometries;
+    if ( quantity       ==          0 ) goto no_geometries;
+
+    // Initialized data
+    geometry_envelope _bounds = { INFINITY, INFINITY, -INFINITY, -INFINITY };
+    double            half    = 0;
+
+    // Compute the bounds of the collection
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        geometry_envelope _envelope = { 0 };
+
+        // Compute the envelope of the geometry
+        if ( geometry_envelope_get(&p_geometries[i], &_envelope) == 0 ) goto no_verticies;
+
+        // Grow the bounds
+        _bounds.x_min = fmin(_bounds.x_min, _envelope.x_min),
+        _bounds.y_min = fmin(_bounds.y_min, _envelope.y_min),
+        _bounds.x_max = fmax(_bounds.x_max, _envelope.x_max),
+        _bounds.y_max = fmax(_bounds.y_max, _envelope.y_max);
+    }
+
+    // Error check
+    if ( !( _bounds.x_min <= _bounds.x_max && _bounds.y_min <= _bounds.y_max ) ) goto no_verticies;
+    if ( isfinite(_bounds.x_max - _bounds.x_min) == 0 || isfinite(_bounds.y_max - _bounds.y_min) == 0 ) goto no_verticies;
+
+    // Use the larger half extent
+    half = fmax(_bounds.x_max - _bounds.x_min, _bounds.y_max - _bounds.y_min) * 0.5;
+
+    // Center the quantization on the collection. One step of headroom
+    // absorbs rounding at the edges.
+    *p_quantization = (geometry_quantization)
+    {
+        .origin_x = ( _bounds.x_min + _bounds.x_max ) * 0.5,
+        .origin_y = ( _bounds.y_min + _bounds.y_max ) * 0.5,
+        .scale    = ( half > 0 ) ? half / ( GEOMETRY_QUANTIZED_MAX - 1 ) : 1
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_quantization:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantization\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_geometries:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometries\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            no_verticies:
+                #ifndef NDEBUG
+                    log_error("[geometry] Geometry must have finite verticies in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_quantize ( geometry_quantization *p_quantization, geometry_point *p_point, geometry_quantized_point *p_result )
+{
+
+    // Argument check
+    if ( p_quantization == (void *) 0 ) goto no_quantization;
+    if ( p_point        == (void *) 0 ) goto no_point;
+    if ( p_result       == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    double x = round(( p_point->x - p_quantization->origin_x ) / p_quantization->scale),
+           y = round(( p_point->y - p_quantization->origin_y ) / p_quantization->scale);
+
+    // Out of range, or not a number
+    if ( !( fabs(x) <= GEOMETRY_QUANTIZED_MAX && fabs(y) <= GEOMETRY_QUANTIZED_MAX ) ) return 0;
+
+    // Store the result
+    *p_result = (geometry_quantized_point) { (int32_t) x, (int32_t) y };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_quantization:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantization\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_point_dequantize ( geometry_quantization *p_quantization, geometry_quantized_point *p_point, geometry_point *p_result )
+{
+
+    // Argument check
+    if ( p_quantization == (void *) 0 ) goto no_quantization;
+    if ( p_point        == (void *) 0 ) goto no_point;
+    if ( p_result       == (void *) 0 ) goto no_result;
+
+    // Store the result
+    *p_result = (geometry_point)
+    {
+        .x = p_quantization->origin_x + p_point->x * p_quantization->scale,
+        .y = p_quantization->origin_y + p_point->y * p_quantization->scale
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_quantization:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantization\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_quantized_polygon_encode ( geometry_quantization *p_quantization, geometry_polygon *p_polygon, geometry_quantized_polygon *p_result, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_quantization == (void *) 0 ) goto no_quantization;
+    if ( p_polygon      == (void *) 0 ) goto no_polygon;
+    if ( p_result       == (void *) 0 ) goto no_result;
+    if ( p_polygon->quantity < 3 )      goto not_a_polygon;
+
+    // Initialized data
+    geometry_quantized_point  _previous = { 0 };
+    size_t                    size      = 0;
+    unsigned char            *p_data    = (void *) 0,
+                             *p         = (void *) 0;
+
+    // Compute the size of the encoded ring
+    for (size_t i = 0; i < p_polygon->quantity; i++)
+    {
+
+        // Initialized data
+        geometry_quantized_point _point = { 0 };
+
+        // Quantize the vertex
+        if ( geometry_point_quantize(p_quantization, &p_polygon->p_verticies[i], &_point) == 0 ) goto out_of_range;
+
+        // Accumulate the size of the difference
+        size += geometry_varint_size(GEOMETRY_ZIGZAG_ENCODE((int64_t) _point.x - _previous.x));
+        size += geometry_varint_size(GEOMETRY_ZIGZAG_ENCODE((int64_t) _point.y - _previous.y));
+
+        // Next
+        _previous = _point;
+    }
+
+    // Allocate the encoded ring
+    p_data = geometry_allocate(p_arena, size);
+
+    // Error check
+    if ( p_data == (void *) 0 ) goto no_mem;
+
+    // Encode the ring. The first vertex is a difference from the origin.
+    _previous = (geometry_quantized_point) { 0 },
+    p         = p_data;
+    for (size_t i = 0; i < p_polygon->quantity; i++)
+    {
+
+        // Initialized data
+        geometry_quantized_point _point = { 0 };
+
+        // Quantize the vertex
+        geometry_point_quantize(p_quantization, &p_polygon->p_verticies[i], &_point);
+
+        // Write the difference
+        p = geometry_varint_write(p, GEOMETRY_ZIGZAG_ENCODE((int64_t) _point.x - _previous.x));
+        p = geometry_varint_write(p, GEOMETRY_ZIGZAG_ENCODE((int64_t) _point.y - _previous.y));
+
+        // Next
+        _previous = _point;
+    }
+
+    // Store the result
+    *p_result = (geometry_quantized_polygon)
+    {
+        .quantity = p_polygon->quantity,
+        .size     = size,
+        .p_data   = p_data
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_quantization:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantization\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            not_a_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Polygon must have at least 3 points in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            out_of_range:
+                #ifndef NDEBUG
+                    log_error("[geometry] Polygon is outside of the quantization in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_quantized_polygon_decode ( geometry_quantization *p_quantization, geometry_quantized_polygon *p_polygon, geometry_point *p_verticies )
+{
+
+    // Argument check
+    if ( p_quantization == (void *) 0 ) goto no_quantization;
+    if ( p_polygon      == (void *) 0 ) goto no_polygon;
+    if ( p_verticies    == (void *) 0 ) goto no_verticies;
+
+    // Initialized data
+    geometry_quantized_ring_reader _reader = { .p_data = p_polygon->p_data, .p_end = p_polygon->p_data + p_polygon->size };
+
+    // Decode each vertex
+    for (size_t i = 0; i < p_polygon->quantity; i++)
+    {
+
+        // Initialized data
+        geometry_quantized_point _point = { 0 };
+
+        // Read the vertex
+        if ( geometry_quantized_ring_next(&_reader, &_point) == 0 ) goto failed_to_decode;
+
+        // Restore the vertex
+        geometry_point_dequantize(p_quantization, &_point, &p_verticies[i]);
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_quantization:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantization\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_verticies:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_verticies\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            failed_to_decode:
+                #ifndef NDEBUG
+                    log_error("[geometry] Quantized polygon is corrupt in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_quantized_polygon_area ( geometry_quantization *p_quantization, geometry_quantized_polygon *p_polygon, double *p_area )
+{
+
+    // Argument check
+    if ( p_quantization == (void *) 0 ) goto no_quantization;
+    if ( p_polygon      == (void *) 0 ) goto no_polygon;
+    if ( p_area         == (void *) 0 ) goto no_area;
+
+    // Initialized data
+    geometry_quantized_ring_reader _reader = { .p_data = p_polygon->p_data, .p_end = p_polygon->p_data + p_polygon->size };
+    geometry_quantized_point       _first  = { 0 },
+                                   _a      = { 0 },
+                                   _b      = { 0 };
+    geometry_int128                _sum    = { 0 };
+
+    // Read the first vertex
+    if ( geometry_quantized_ring_next(&_reader, &_first) == 0 ) goto failed_to_decode;
+
+    // Accumulate the shoelace sum. Each term fits in 62 bits; the sum
+    // does not, so it is kept in 128 bits.
+    _a = _first;
+    for (size_t i = 1; i <= p_polygon->quantity; i++)
+    {
+
+        // Read the next vertex, closing the ring on the last edge
+        if ( i == p_polygon->quantity ) _b = _first;
+        else if ( geometry_quantized_ring_next(&_reader, &_b) == 0 ) goto failed_to_decode;
+
+        // Accumulate
+        geometry_int128_add(&_sum, (int64_t) _a.x * _b.y - (int64_t) _b.x * _a.y);
+
+        // Next
+        _a = _b;
+    }
+
+    // Store the result
+    *p_area = fabs(geometry_int128_to_double(_sum)) * 0.5 * p_quantization->scale * p_quantization->scale;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_quantization:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantization\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_area:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_area\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            failed_to_decode:
+                #ifndef NDEBUG
+                    log_error("[geometry] Quantized polygon is corrupt in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_quantized_point_in_polygon ( geometry_quantized_polygon *p_polygon, geometry_quantized_point *p_point, bool *p_result )
+{
+
+    // Argument check
+    if ( p_polygon == (void *) 0 ) goto no_polygon;
+    if ( p_point   == (void *) 0 ) goto no_point;
+    if ( p_result  == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    geometry_quantized_ring_reader _reader = { .p_data = p_polygon->p_data, .p_end = p_polygon->p_data + p_polygon->size };
+    geometry_quantized_point       _first  = { 0 },
+                                   _a      = { 0 },
+                                   _b      = { 0 };
+    bool                           inside  = false;
+
+    // Read the first vertex
+    if ( geometry_quantized_ring_next(&_reader, &_first) == 0 ) goto failed_to_decode;
+
+    // Count the edges crossed by a ray in the +x direction
+    _a = _first;
+    for (size_t i = 1; i <= p_polygon->quantity; i++)
+    {
+
+        // Read the next vertex, closing the ring on the last edge
+        if ( i == p_polygon->quantity ) _b = _first;
+        else if ( geometry_quantized_ring_next(&_reader, &_b) == 0 ) goto failed_to_decode;
+
+        // The edge straddles the ray
+        if ( ( _a.y > p_point->y ) != ( _b.y > p_point->y ) )
+        {
+
+            // Compare the point with the crossing, without dividing.
+            // Each product fits in 62 bits.
+            int64_t lhs = ( (int64_t) p_point->x - _a.x ) * ( (int64_t) _b.y - _a.y ),
+                    rhs = ( (int64_t) p_point->y - _a.y ) * ( (int64_t) _b.x - _a.x );
+
+            // The point is left of the crossing
+            if ( ( _b.y > _a.y ) ? lhs < rhs : lhs > rhs ) inside = !inside;
+        }
+
+        // Next
+        _a = _b;
+    }
+
+    // Store the result
+    *p_result = inside;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            failed_to_decode:
+                #ifndef NDEBUG
+                    log_error("[geometry] Quantized polygon is corrupt in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_quantized_point_distance ( geometry_quantization *p_quantization, geometry_quantized_point *p_a, geometry_quantized_point *p_b, double *p_distance )
+{
+
+    // Argument check
+    if ( p_quantization == (void *) 0 ) goto no_quantization;
+    if ( p_a            == (void *) 0 ) goto no_a;
+    if ( p_b            == (void *) 0 ) goto no_b;
+    if ( p_distance     == (void *) 0 ) goto no_distance;
+
+    // Initialized data
+    double dx = (double) ( (int64_t) p_b->x - p_a->x ),
+           dy = (double) ( (int64_t) p_b->y - p_a->y );
+
+    // Store the result
+    *p_distance = sqrt(dx * dx + dy * dy) * p_quantization->scale;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_quantization:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantization\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_distance:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_distance\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_quantized_polygon_distance ( geometry_quantization *p_quantization, geometry_quantized_polygon *p_polygon, geometry_quantized_point *p_point, double *p_distance )
+{
+
+    // Argument check
+    if ( p_quantization == (void *) 0 ) goto no_quantization;
+    if ( p_polygon      == (void *) 0 ) goto no_polygon;
+    if ( p_point        == (void *) 0 ) goto no_point;
+    if ( p_distance     == (void *) 0 ) goto no_distance;
+
+    // Initialized data
+    geometry_quantized_ring_reader _reader = { .p_data = p_polygon->p_data, .p_end = p_polygon->p_data + p_polygon->size };
+    geometry_quantized_point       _first  = { 0 },
+                                   _a      = { 0 },
+                                   _b      = { 0 };
+    double                         result  = INFINITY;
+    bool                           inside  = false;
+
+    // Points inside of the polygon are at distance 0
+    if ( geometry_quantized_point_in_polygon(p_polygon, p_point, &inside) == 0 ) goto failed_to_decode;
+    if ( inside ) result = 0;
+
+    // Read the first vertex
+    if ( geometry_quantized_ring_next(&_reader, &_first) == 0 ) goto failed_to_decode;
+
+    // Find the nearest edge. Differences of quantized coordinates are
+    // exact in double precision.
+    _a = _first;
+    for (size_t i = 1; i <= p_polygon->quantity && result > 0; i++)
+    {
+
+        // Read the next vertex, closing the ring on the last edge
+        if ( i == p_polygon->quantity ) _b = _first;
+        else if ( geometry_quantized_ring_next(&_reader, &_b) == 0 ) goto failed_to_decode;
+
+        // Initialized data
+        double dx = (double) ( (int64_t) _b.x - _a.x ),
+               dy = (double) ( (int64_t) _b.y - _a.y ),
+               wx = (double) ( (int64_t) p_point->x - _a.x ),
+               wy = (double) ( (int64_t) p_point->y - _a.y ),
+               length_squared = dx * dx + dy * dy,
+               t              = ( length_squared > 0 ) ? ( wx * dx + wy * dy ) / length_squared : 0;
+
+        // Clamp the projection to the edge
+        t = ( t < 0 ) ? 0 : ( t > 1 ) ? 1 : t;
+
+        // Keep the nearest edge
+        result = fmin(result, ( wx - t * dx ) * ( wx - t * dx ) + ( wy - t * dy ) * ( wy - t * dy ));
+
+        // Next
+        _a = _b;
+    }
+
+    // Store the result
+    *p_distance = sqrt(result) * p_quantization->scale;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_quantization:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantization\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_distance:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_distance\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            failed_to_decode:
+                #ifndef NDEBUG
+                    log_error("[geometry] Quantized polygon is corrupt in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static void geometry_int128_add ( geometry_int128 *p_sum, int64_t value )
+{
+
+    // Initialized data
+    uint64_t lo = p_sum->lo + (uint64_t) value;
+
+    // Sign extend the value, and carry out of the low word
+    p_sum->hi += ( value < 0 ? -1 : 0 ) + ( lo < p_sum->lo ? 1 : 0 ),
+    p_sum->lo  = lo;
+
+    // Done
+    return;
+}
+
+static double geometry_int128_to_double ( geometry_int128 sum )
+{
+
+    // Initialized data
+    int      negative = sum.hi < 0;
+    uint64_t hi       = (uint64_t) sum.hi,
+             lo       = sum.lo;
+
+    // Take the magnitude, so the low word is not cancelled by the high word
+    if ( negative ) hi = ~hi + ( lo == 0 ? 1 : 0 ), lo = ~lo + 1;
+
+    // Success
+    return ( negative ? -1.0 : 1.0 ) * ( (double) hi * 18446744073709551616.0 + (double) lo );
+}
+
+static size_t geometry_varint_size ( uint64_t value )
+{
+
+    // Initialized data
+    size_t size = 1;
+
+    // Seven bits per byte
+    while ( value >= 0x80 ) value >>= 7, size++;
+
+    // Success
+    return size;
+}
+
+static unsigned char *geometry_varint_write ( unsigned char *p, uint64_t value )
+{
+
+    // Write seven bits at a time, setting the high bit on all but the last byte
+    while ( value >= 0x80 )
+        *p++ = (unsigned char) ( value | 0x80 ),
+        value >>= 7;
+
+    // Write the last byte
+    *p++ = (unsigned char) value;
+
+    // Success
+    return p;
+}
+
+static int geometry_quantized_ring_next ( geometry_quantized_ring_reader *p_reader, geometry_quantized_point *p_point )
+{
+
+    // Initialized data
+    int64_t _value[2] = { 0 };
+
+    // Read the x and y differences
+    for (size_t i = 0; i < 2; i++)
+    {
+
+        // Initialized data
+        uint64_t u     = 0;
+        unsigned shift = 0;
+
+        // Read each byte of the varint
+        for (;;)
+        {
+
+            // Error check
+            if ( p_reader->p_data >= p_reader->p_end || shift > 35 ) return 0;
+
+            // Accumulate seven bits
+            u     |= (uint64_t) ( *p_reader->p_data & 0x7f ) << shift,
+            shift += 7;
+
+            // Last byte
+            if ( ( *p_reader->p_data++ & 0x80 ) == 0 ) break;
+        }
+
+        // Undo the zigzag encoding
+        _value[i] = GEOMETRY_ZIGZAG_DECODE(u);
+    }
+
+    // Apply the difference
+    _value[0] += p_reader->point.x,
+    _value[1] += p_reader->point.y;
+
+    // Error check
+    if ( _value[0] < -GEOMETRY_QUANTIZED_MAX || _value[0] > GEOMETRY_QUANTIZED_MAX ) return 0;
+    if ( _value[1] < -GEOMETRY_QUANTIZED_MAX || _value[1] > GEOMETRY_QUANTIZED_MAX ) return 0;
+
+    // Store the vertex
+    p_reader->point = (geometry_quantized_point) { (int32_t) _value[0], (int32_t) _value[1] },
+    *p_point        = p_reader->point;
+
+    // Success
+    return 1;
+}
+
+int geometry_quantized_polygon_destroy ( geometry_quantized_polygon *p_polygon )
+{
+
+    // Argument check
+    if ( p_polygon == (void *) 0 ) goto no_polygon;
+
+    // Free the encoded ring
+    if ( p_polygon->p_data ) p_polygon->p_data = GEOMETRY_REALLOC(p_polygon->p_data, 0);
+
+    // Clear the polygon
+    *p_polygon = (geometry_quantized_polygon) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,2342 @@
+/** !
+ * Relate
+ *
+ * @file relate.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <string.h>
+
+// Header
+#include <geometry/relate.h>
+#include <geometry/sweep.h>
+#include <geometry/prepared.h>
+#include <geometry/measure.h>
+
+// Structure declarations
+struct geometry_relate_operand_s;
+struct geometry_relate_cut_s;
+struct geometry_relate_piece_s;
+struct geometry_relate_state_s;
+
+// Type definitions
+typedef struct geometry_relate_operand_s geometry_relate_operand;
+typedef struct geometry_relate_cut_s     geometry_relate_cut;
+typedef struct geometry_relate_piece_s   geometry_relate_piece;
+typedef struct geometry_relate_state_s   geometry_relate_state;
+
+// Structure definitions
+// An operand is a list of edges. A point is an edge of no length. The
+// edges of a ring are stored with the inside of the operand on their
+// left, and each ring is prepared the first time a point is located in
+// it. The boundary of lines is sorted.
+struct geometry_relate_operand_s
+{
+    int                         dimension;
+    size_t                      quantity,
+                                boundary_quantity;
+    geometry_polygon           *p_rings;
+    geometry_envelope          *p_envelopes;
+    geometry_prepared_polygon **pp_prepared;
+    geometry_point             *p_boundary;
+    geometry_line_list          edges;
+    geometry_envelope           envelope;
+};
+
+// A point where an edge is cut. The position orders the cuts of an edge
+// from its start to its end. Edges of the second operand follow the
+// edges of the first.
+struct geometry_relate_cut_s
+{
+    size_t         edge;
+    double         position;
+    geometry_point point;
+};
+
+// A piece of an edge, stored from its lesser point to its greater point.
+// Forward is true if the piece runs the same way as its edge.
+struct geometry_relate_piece_s
+{
+    geometry_point a,
+                   b;
+    size_t         operand;
+    bool           forward;
+};
+
+// Entry [a][b] of the bound is the greatest entry [a][b] of the matrix
+// can be. The answer is -1 until the patterns are settled. Overlaps are
+// pairs of edges that lie on each other.
+struct geometry_relate_state_s
+{
+    geometry_relate_operand      operands[2];
+    geometry_relation            relation;
+    signed char                  bound[GEOMETRY_LOCATION_QUANTITY][GEOMETRY_LOCATION_QUANTITY];
+    const char *const           *pp_patterns;
+    size_t                       pattern_quantity,
+                                 contact_quantity;
+    int                          answer;
+    geometry_line_intersection  *p_intersections;
+    geometry_point              *p_contacts;
+    geometry_relate_cut         *p_cuts;
+    geometry_relate_piece       *p_pieces;
+    size_t                      *p_overlaps,
+                                 cut_capacity,
+                                 overlap_quantity,
+                                 overlap_capacity;
+};
+
+// Data
+// The patterns of the predicates
+static const char *const geometry_relate_equals_patterns[]        = { "T*F**FFF*" },
+                  *const geometry_relate_disjoint_patterns[]      = { "FF*FF****" },
+                  *const geometry_relate_touches_patterns[]       = { "FT*******", "F**T*****", "F***T****" },
+                  *const geometry_relate_contains_patterns[]      = { "T*****FF*" },
+                  *const geometry_relate_crosses_low_patterns[]   = { "T*T******" },
+                  *const geometry_relate_crosses_high_patterns[]  = { "T*****T**" },
+                  *const geometry_relate_overlaps_patterns[]      = { "T*T***T**" },
+                  *const geometry_relate_overlaps_line_patterns[] = { "1*T***T**" };
+
+// Forward declarations
+/** !
+ * @return < 0 if A is first, > 0 if B is first, else 0
+ */
+static int geometry_relate_point_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * @return < 0 if A is first, > 0 if B is first, else 0
+ */
+static int geometry_relate_cut_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * @return < 0 if A is first, > 0 if B is first, else 0
+ */
+static int geometry_relate_piece_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * Test if a point is on a line, including its endpoints
+ *
+ * @param p_line  the line
+ * @param p_point the point
+ *
+ * @return true if the point is on the line, else false
+ */
+static bool geometry_relate_on_line ( const geometry_line *p_line, geometry_point *p_point );
+
+/** !
+ * Test if a pattern is nine characters of "TF*012"
+ *
+ * @param pattern the pattern
+ *
+ * @return true if the pattern is valid, else false
+ */
+static bool geometry_relate_pattern_valid ( const char *pattern );
+
+/** !
+ * Test if a matrix matches a pattern
+ *
+ * @param p_relation the matrix
+ * @param bound      the bound of the matrix
+ * @param pattern    the pattern
+ * @param final      true if the matrix is complete
+ *
+ * @return 1 if the pattern matches, 0 if it does not, and -1 if the
+ *         matrix may still grow either way
+ */
+static int geometry_relate_pattern_test ( const geometry_relation *p_relation, signed char bound[GEOMETRY_LOCATION_QUANTITY][GEOMETRY_LOCATION_QUANTITY], const char *pattern, bool final );
+
+/** !
+ * Grow an entry of the matrix, and test the patterns
+ *
+ * @param p_relate  the relate
+ * @param a         the part of the first operand
+ * @param b         the part of the second operand
+ * @param dimension the dimension of their intersection
+ *
+ * @return true if the patterns are settled, else false
+ */
+static bool geometry_relate_set ( geometry_relate_state *p_relate, enum geometry_location_e a, enum geometry_location_e b, signed char dimension );
+
+/** !
+ * Construct an operand from a geometry
+ *
+ * @param p_operand  return
+ * @param p_geometry the geometry
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_relate_operand_construct ( geometry_relate_operand *p_operand, geometry *p_geometry );
+
+/** !
+ * Test if a point is inside of the area of an operand. Operands with no
+ * area contain nothing.
+ *
+ * @param p_operand the operand
+ * @param p_point   the point
+ * @param p_result  return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_relate_operand_contains ( geometry_relate_operand *p_operand, geometry_point *p_point, bool *p_result );
+
+/** !
+ * Locate a point on the edges of an operand
+ *
+ * @param p_operand the operand
+ * @param p_point   the point
+ *
+ * @return the location of the point
+ */
+static enum geometry_location_e geometry_relate_operand_edge_location ( geometry_relate_operand *p_operand, geometry_point *p_point );
+
+/** !
+ * Release the memory held by an operand
+ *
+ * @param p_operand the operand
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_relate_operand_destroy ( geometry_relate_operand *p_operand );
+
+/** !
+ * Find where the edges of two line lists meet, or where the edges of one
+ * line list meet each other
+ *
+ * @param p_relate   the relate
+ * @param p_a        a line list
+ * @param p_b        another line list, or null
+ * @param p_quantity return the quantity of intersections
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_relate_intersections ( geometry_relate_state *p_relate, geometry_line_list *p_a, geometry_line_list *p_b, size_t *p_quantity );
+
+/** !
+ * Find the points where two edges meet
+ *
+ * @param p_a            an edge
+ * @param p_b            another edge
+ * @param p_intersection the intersection of the edges
+ * @param p_points       return; must have room for four points
+ *
+ * @return the quantity of points
+ */
+static size_t geometry_relate_meet ( geometry_line *p_a, geometry_line *p_b, geometry_line_intersection *p_intersection, geometry_point *p_points );
+
+/** !
+ * Cut an edge at a point, unless the point is an endpoint of the edge
+ *
+ * @param p_relate       the relate
+ * @param edge           the index of the edge
+ * @param p_line         the edge
+ * @param p_point        the point
+ * @param p_cut_quantity the quantity of cuts
+ *
+ * @return void
+ */
+static void geometry_relate_cut_edge ( geometry_relate_state *p_relate, size_t edge, geometry_line *p_line, geometry_point *p_point, size_t *p_cut_quantity );
+
+/** !
+ * Store a pair of edges that may lie on each other
+ *
+ * @param p_relate the relate
+ * @param a        the index of an edge
+ * @param b        the index of another edge
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_relate_overlap ( geometry_relate_state *p_relate, size_t a, size_t b );
+
+/** !
+ * Find the cuts of an edge
+ *
+ * @param p_cuts   the cuts, sorted
+ * @param quantity the quantity of cuts
+ * @param edge     the index of the edge
+ * @param p_begin  return the index of the first cut of the edge
+ * @param p_end    return the index after the last cut of the edge
+ *
+ * @return void
+ */
+static void geometry_relate_cut_range ( const geometry_relate_cut *p_cuts, size_t quantity, size_t edge, size_t *p_begin, size_t *p_end );
+
+/** !
+ * Cut each edge at the cuts of the edges that lie on it. The point where
+ * a third edge crosses two edges that lie on each other is computed once
+ * for each, and rounding may place the two points apart. Sharing the cuts
+ * gives both edges the same pieces.
+ *
+ * @param p_relate       the relate
+ * @param p_cut_quantity the quantity of cuts, sorted
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_relate_share_cuts ( geometry_relate_state *p_relate, size_t *p_cut_quantity );
+
+/** !
+ * Find where the edges of the operands meet, locate each point where
+ * they meet in both operands, and cut the edges there
+ *
+ * @param p_relate       the relate
+ * @param p_cut_quantity return the quantity of cuts
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_relate_contacts ( geometry_relate_state *p_relate, size_t *p_cut_quantity );
+
+/** !
+ * Cut the edges of the operands into pieces, and locate each piece, and
+ * each side of each piece, in both operands
+ *
+ * @param p_relate     the relate
+ * @param cut_quantity the quantity of cuts
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_relate_pieces ( geometry_relate_state *p_relate, size_t cut_quantity );
+
+/** !
+ * Locate the points of each operand that meet no edge of the other
+ * operand. These are the points of a point list, and the boundary of
+ * lines.
+ *
+ * @param p_relate the relate
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_relate_points ( geometry_relate_state *p_relate );
+
+/** !
+ * Compute the matrix of two geometries, until the patterns are settled
+ *
+ * @param p_a              a geometry
+ * @param p_b              another geometry
+ * @param pp_patterns      the patterns, or null for the whole matrix
+ * @param pattern_quantity the quantity of patterns
+ * @param p_relation       return the matrix; may be null
+ * @param p_result         return true if any pattern matches; may be null
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_relate_run ( geometry *p_a, geometry *p_b, const char *const *pp_patterns, size_t pattern_quantity, geometry_relation *p_relation, bool *p_result );
+
+/** !
+ * Release the memory held by a relate
+ *
+ * @param p_relate the relate
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_relate_destroy ( geometry_relate_state *p_relate );
+
+/** !
+ * Test if two geometries match any of some patterns
+ *
+ * @param p_a              a geometry
+ * @param p_b              another geometry
+ * @param pp_patterns      the patterns
+ * @param pattern_quantity the quantity of patterns
+ * @param p_result         return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_relate_predicate ( geometry *p_a, geometry *p_b, const char *const *pp_patterns, size_t pattern_quantity, bool *p_result );
+
+/** !
+ * Get the dimension of a geometry
+ *
+ * @param p_geometry the geometry
+ *
+ * @return 0 for points, 1 for lines, 2 for areas, or -1 if the type is invalid
+ */
+static int geometry_relate_dimension ( geometry *p_geometry );
+
+/** !
+ * View a line or a line list as a line list. The line list refers to the
+ * lines of the geometry.
+ *
+ * @param p_geometry  the geometry
+ * @param p_line_list return
+ *
+ * @return true if the geometry is a line or a line list, else false
+ */
+static bool geometry_relate_line_list_view ( geometry *p_geometry, geometry_line_list *p_line_list );
+
+// Function definitions
+int geometry_relate ( geometry *p_a, geometry *p_b, geometry_relation *p_result )
+{
+
+    // Argument check
+    if ( p_a      == (void *) 0 ) goto no_a;
+    if ( p_b      == (void *) 0 ) goto no_b;
+    if ( p_result == (void *) 0 ) goto no_result;
+
+    // Compute the whole matrix
+    if ( geometry_relate_run(p_a, p_b, (void *) 0, 0, p_result, (void *) 0) == 0 ) goto failed_to_relate;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_relate:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to relate geometry in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_relate_pattern ( geometry *p_a, geometry *p_b, const char *pattern, bool *p_result )
+{
+
+    // Argument check
+    if ( p_a      == (void *) 0 ) goto no_a;
+    if ( p_b      == (void *) 0 ) goto no_b;
+    if ( pattern  == (void *) 0 ) goto no_pattern;
+    if ( p_result == (void *) 0 ) goto no_result;
+    if ( geometry_relate_pattern_valid(pattern) == false ) goto invalid_pattern;
+
+    // Compute the matrix until the pattern is settled
+    if ( geometry_relate_run(p_a, p_b, &pattern, 1, (void *) 0, p_result) == 0 ) goto failed_to_relate;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_pattern:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pattern\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            invalid_pattern:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"pattern\" must be nine characters of \"TF*012\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_relate:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to relate geometry in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_relation_matches ( geometry_relation *p_relation, const char *pattern, bool *p_result )
+{
+
+    // Argument check
+    if ( p_relation == (void *) 0 ) goto no_relation;
+    if ( pattern    == (void *) 0 ) goto no_pattern;
+    if ( p_result   == (void *) 0 ) goto no_result;
+    if ( geometry_relate_pattern_valid(pattern) == false ) goto invalid_pattern;
+
+    // Test the complete matrix
+    *p_result = ( geometry_relate_pattern_test(p_relation, p_relation->matrix, pattern, true) == 1 );
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_relation:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_relation\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_pattern:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pattern\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            invalid_pattern:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"pattern\" must be nine characters of \"TF*012\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_relate_equals ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Done
+    return geometry_relate_predicate(p_a, p_b, geometry_relate_equals_patterns, 1, p_result);
+}
+
+int geometry_relate_disjoint ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Done
+    return geometry_relate_predicate(p_a, p_b, geometry_relate_disjoint_patterns, 1, p_result);
+}
+
+int geometry_relate_intersects ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Argument check
+    if ( p_a      == (void *) 0 ) goto no_a;
+    if ( p_b      == (void *) 0 ) goto no_b;
+    if ( p_result == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    geometry_line_list a       = { 0 },
+                       b       = { 0 };
+    bool               overlap = false;
+
+    // Geometry that is not lines is related
+    if ( geometry_relate_line_list_view(p_a, &a) == false || geometry_relate_line_list_view(p_b, &b) == false )
+    {
+
+        // Test if the geometry is disjoint
+        if ( geometry_relate_predicate(p_a, p_b, geometry_relate_disjoint_patterns, 1, p_result) == 0 ) goto failed_to_relate;
+
+        // Geometry intersects if it is not disjoint
+        *p_result = !*p_result;
+
+        // Success
+        return 1;
+    }
+
+    // Geometry whose envelopes are apart do not intersect
+    if ( geometry_envelope_intersects(p_a, p_b, &overlap) == 0 ) goto failed_to_compare_envelopes;
+
+    // Sweep the lines
+    if ( overlap == false ) *p_result = false;
+    else if ( geometry_line_list_intersects(&a, &b, p_result) == 0 ) goto failed_to_sweep;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            failed_to_compare_envelopes:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to compare envelopes in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_sweep:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to sweep lines in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_relate:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to relate geometry in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_relate_touches ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Done
+    return geometry_relate_predicate(p_a, p_b, geometry_relate_touches_patterns, 3, p_result);
+}
+
+int geometry_relate_crosses ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Argument check
+    if ( p_a      == (void *) 0 ) goto no_a;
+    if ( p_b      == (void *) 0 ) goto no_b;
+    if ( p_result == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    geometry_line_list a         = { 0 },
+                       b         = { 0 };
+    bool               overlap   = false;
+    int                dimension = geometry_relate_dimension(p_a) - geometry_relate_dimension(p_b);
+
+    // Geometry that is not lines is related
+    if ( geometry_relate_line_list_view(p_a, &a) == false || geometry_relate_line_list_view(p_b, &b) == false )
+    {
+
+        // Geometry of the same dimension, other than lines, never crosses
+        if ( dimension == 0 ) { *p_result = false; return 1; }
+
+        // Test the interior of the lesser dimension against the exterior of the greater
+        if ( geometry_relate_predicate(p_a, p_b, ( dimension < 0 ) ? geometry_relate_crosses_low_patterns : geometry_relate_crosses_high_patterns, 1, p_result) == 0 ) goto failed_to_relate;
+
+        // Success
+        return 1;
+    }
+
+    // Geometry whose envelopes are apart do not cross
+    if ( geometry_envelope_intersects(p_a, p_b, &overlap) == 0 ) goto failed_to_compare_envelopes;
+
+    // Sweep the lines
+    if ( overlap == false ) *p_result = false;
+    else if ( geometry_line_list_crosses(&a, &b, p_result) == 0 ) goto failed_to_sweep;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            failed_to_compare_envelopes:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to compare envelopes in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_sweep:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to sweep lines in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_relate:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to relate geometry in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_relate_overlaps ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Argument check
+    if ( p_a      == (void *) 0 ) goto no_a;
+    if ( p_b      == (void *) 0 ) goto no_b;
+    if ( p_result == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    int dimension = geometry_relate_dimension(p_a);
+
+    // Only geometry of the same dimension overlaps
+    if ( dimension != geometry_relate_dimension(p_b) ) { *p_result = false; return 1; }
+
+    // Done
+    return geometry_relate_predicate(p_a, p_b, ( dimension == 1 ) ? geometry_relate_overlaps_line_patterns : geometry_relate_overlaps_patterns, 1, p_result);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_relate_contains ( geometry *p_a, geometry *p_b, bool *p_result )
+{
+
+    // Done
+    return geometry_relate_predicate(p_a, p_b, geometry_relate_contains_patterns, 1, p_result);
+}
+
+int geometry_point_polygon_locate ( geometry_point *p_point, geometry_polygon *p_polygon, enum geometry_location_e *p_result )
+{
+
+    // Argument check
+    if ( p_point   == (void *) 0 ) goto no_point;
+    if ( p_polygon == (void *) 0 ) goto no_polygon;
+    if ( p_result  == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    geometry_measure _measure = { 0 };
+    bool             inside   = false;
+
+    // Polygons with no area have no points, as in the operands of the engine
+    if ( p_polygon->quantity < 3 ) goto exterior;
+    geometry_polygon_measure(p_polygon, &_measure);
+    if ( _measure.area == 0 ) goto exterior;
+
+    // Points on an edge are on the boundary
+    for (size_t i = 0, j = p_polygon->quantity - 1; i < p_polygon->quantity; j = i++)
+    {
+
+        // Initialized data
+        geometry_point *p_i = &p_polygon->p_verticies[i],
+                       *p_j = &p_polygon->p_verticies[j];
+
+        // Skip edges whose envelope misses the point
+        if ( p_point->x < fmin(p_i->x, p_j->x) || p_point->x > fmax(p_i->x, p_j->x) ) continue;
+        if ( p_point->y < fmin(p_i->y, p_j->y) || p_point->y > fmax(p_i->y, p_j->y) ) continue;
+
+        // On the edge
+        if ( geometry_point_ccw(p_j, p_i, p_point) == 0 )
+        {
+
+            // Return the location to the caller
+            *p_result = GEOMETRY_LOCATION_BOUNDARY;
+
+            // Success
+            return 1;
+        }
+    }
+
+    // Other points are inside, or outside
+    geometry_point_in_polygon(p_point, p_polygon, &inside);
+
+    // Return the location to the caller
+    *p_result = ( inside ) ? GEOMETRY_LOCATION_INTERIOR : GEOMETRY_LOCATION_EXTERIOR;
+
+    // Success
+    return 1;
+
+    exterior:
+
+    // Return the location to the caller
+    *p_result = GEOMETRY_LOCATION_EXTERIOR;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_point\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_relate_point_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_point *p_point_a = p_a,
+                         *p_point_b = p_b;
+
+    // By x
+    if ( p_point_a->x != p_point_b->x ) return ( p_point_a->x > p_point_b->x ) ? 1 : -1;
+
+    // By y
+    return ( p_point_a->y > p_point_b->y ) - ( p_point_a->y < p_point_b->y );
+}
+
+static int geometry_relate_cut_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_relate_cut *p_cut_a = p_a,
+                              *p_cut_b = p_b;
+
+    // By edge
+    if ( p_cut_a->edge != p_cut_b->edge ) return ( p_cut_a->edge > p_cut_b->edge ) ? 1 : -1;
+
+    // By position
+    return ( p_cut_a->position > p_cut_b->position ) - ( p_cut_a->position < p_cut_b->position );
+}
+
+static int geometry_relate_piece_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_relate_piece *p_piece_a = p_a,
+                                *p_piece_b = p_b;
+    int                          ret       = 0;
+
+    // By points
+    if ( ( ret = geometry_relate_point_compare(&p_piece_a->a, &p_piece_b->a) ) ) return ret;
+    if ( ( ret = geometry_relate_point_compare(&p_piece_a->b, &p_piece_b->b) ) ) return ret;
+
+    // By operand
+    return ( p_piece_a->operand > p_piece_b->operand ) - ( p_piece_a->operand < p_piece_b->operand );
+}
+
+static bool geometry_relate_on_line ( const geometry_line *p_line, geometry_point *p_point )
+{
+
+    // Initialized data
+    geometry_point _a = { p_line->x0, p_line->y0 },
+                   _b = { p_line->x1, p_line->y1 };
+
+    // Inside of the envelope of the line
+    if ( p_point->x < fmin(_a.x, _b.x) || p_point->x > fmax(_a.x, _b.x) ) return false;
+    if ( p_point->y < fmin(_a.y, _b.y) || p_point->y > fmax(_a.y, _b.y) ) return false;
+
+    // On the line
+    return ( geometry_point_ccw(&_a, &_b, p_point) == 0 );
+}
+
+static bool geometry_relate_pattern_valid ( const char *pattern )
+{
+
+    // Each character
+    for (size_t i = 0; i < 9; i++)
+        if ( pattern[i] == '\0' || strchr("TtFf*012", pattern[i]) == (void *) 0 ) return false;
+
+    // Nine characters
+    return ( pattern[9] == '\0' );
+}
+
+static int geometry_relate_pattern_test ( const geometry_relation *p_relation, signed char bound[GEOMETRY_LOCATION_QUANTITY][GEOMETRY_LOCATION_QUANTITY], const char *pattern, bool final )
+{
+
+    // Initialized data
+    int ret = 1;
+
+    // Test each entry
+    for (size_t i = 0; i < 9; i++)
+    {
+
+        // Initialized data
+        signed char value   = p_relation->matrix[i / 3][i % 3];
+        bool        settled = final || value == bound[i / 3][i % 3];
+
+        // Strategy
+        switch ( pattern[i] )
+        {
+            case 'T':
+            case 't':
+
+                // Any intersection matches
+                if ( value != GEOMETRY_RELATE_FALSE ) break;
+                if ( settled ) return 0;
+                ret = -1;
+                break;
+
+            case 'F':
+            case 'f':
+
+                // Entries never shrink
+                if ( value != GEOMETRY_RELATE_FALSE ) return 0;
+                if ( settled == false ) ret = -1;
+                break;
+
+            case '*':
+                break;
+
+            default:
+
+                // Entries never shrink
+                if ( value > pattern[i] - '0' ) return 0;
+                if ( settled ) { if ( value != pattern[i] - '0' ) return 0; break; }
+                ret = -1;
+                break;
+        }
+    }
+
+    // Done
+    return ret;
+}
+
+static bool geometry_relate_set ( geometry_relate_state *p_relate, enum geometry_location_e a, enum geometry_location_e b, signed char dimension )
+{
+
+    // Initialized data
+    bool settled = true;
+
+    // Entries only grow
+    if ( dimension <= p_relate->relation.matrix[a][b] ) return ( p_relate->answer != -1 );
+
+    // Grow the entry
+    p_relate->relation.matrix[a][b] = dimension;
+
+    // The whole matrix is never settled early
+    if ( p_relate->pattern_quantity == 0 ) return false;
+
+    // Test each pattern
+    for (size_t i = 0; i < p_relate->pattern_quantity; i++)
+    {
+
+        // Initialized data
+        int match = geometry_relate_pattern_test(&p_relate->relation, p_relate->bound, p_relate->pp_patterns[i], false);
+
+        // Any pattern that matches settles the answer
+        if ( match == 1 ) { p_relate->answer = 1; return true; }
+
+        // A pattern that may still match keeps the answer open
+        if ( match == -1 ) settled = false;
+    }
+
+    // Every pattern is broken
+    if ( settled ) p_relate->answer = 0;
+
+    // Done
+    return settled;
+}
+
+static int geometry_relate_operand_construct ( geometry_relate_operand *p_operand, geometry *p_geometry )
+{
+
+    // Initialized data
+    size_t ring_quantity = 0,
+           edge_quantity = 0;
+
+    // Clear the operand
+    *p_operand = (geometry_relate_operand)
+    {
+        .dimension = geometry_relate_dimension(p_geometry),
+        .envelope  = { INFINITY, INFINITY, -INFINITY, -INFINITY }
+    };
+
+    // Strategy
+    switch ( p_geometry->type )
+    {
+        case GEOMETRY_POINT:
+        case GEOMETRY_POINT_LIST:
+        {
+
+            // Initialized data
+            size_t          quantity = ( p_geometry->type == GEOMETRY_POINT ) ? 1 : p_geometry->point_list.quantity;
+            geometry_point *p_points = ( p_geometry->type == GEOMETRY_POINT ) ? &p_geometry->point : p_geometry->point_list.p_points;
+
+            // Allocate memory for the edges
+            p_operand->edges.p_lines = GEOMETRY_REALLOC(0, sizeof(geometry_line) * ( quantity + 1 ));
+
+            // Error check
+            if ( p_operand->edges.p_lines == (void *) 0 ) goto no_mem;
+
+            // Store each point as an edge of no length
+            for (size_t i = 0; i < quantity; i++)
+                p_operand->edges.p_lines[p_operand->edges.quantity++] = (geometry_line) { p_points[i].x, p_points[i].y, p_points[i].x, p_points[i].y };
+
+            // Done
+            break;
+        }
+
+        case GEOMETRY_LINE:
+        case GEOMETRY_LINE_LIST:
+        {
+
+            // Initialized data
+            geometry_line_list _lines = { 0 };
+            size_t             ends   = 0;
+
+            // View the lines
+            geometry_relate_line_list_view(p_geometry, &_lines);
+
+            // Allocate memory for the edges, and for the endpoints
+            p_operand->edges.p_lines = GEOMETRY_REALLOC(0, sizeof(geometry_line) * ( _lines.quantity + 1 ));
+            p_operand->p_boundary    = GEOMETRY_REALLOC(0, sizeof(geometry_point) * ( 2 * _lines.quantity + 1 ));
+
+            // Error check
+            if ( p_operand->edges.p_lines == (void *) 0 || p_operand->p_boundary == (void *) 0 ) goto no_mem;
+
+            // Store each line with length, and its endpoints
+            for (size_t i = 0; i < _lines.quantity; i++)
+            {
+
+                // Initialized data
+                geometry_line *p_line = &_lines.p_lines[i];
+
+                // Skip lines with no length
+                if ( p_line->x0 == p_line->x1 && p_line->y0 == p_line->y1 ) continue;
+
+                // Store the line
+                p_operand->edges.p_lines[p_operand->edges.quantity++] = *p_line;
+
+                // Store the endpoints
+                p_operand->p_boundary[ends++] = (geometry_point) { p_line->x0, p_line->y0 },
+                p_operand->p_boundary[ends++] = (geometry_point) { p_line->x1, p_line->y1 };
+            }
+
+            // Gather equal endpoints
+            qsort(p_operand->p_boundary, ends, sizeof(geometry_point), geometry_relate_point_compare);
+
+            // Keep the endpoints that occur an odd quantity of times
+            for (size_t i = 0, j = 0; i < ends; i = j)
+            {
+
+                // Find the end of the run
+                for (j = i + 1; j < ends; j++)
+                    if ( geometry_relate_point_compare(&p_operand->p_boundary[j], &p_operand->p_boundary[i]) ) break;
+
+                // Keep the endpoint
+                if ( ( j - i ) % 2 ) p_operand->p_boundary[p_operand->boundary_quantity++] = p_operand->p_boundary[i];
+            }
+
+            // Done
+            break;
+        }
+
+        case GEOMETRY_TRIANGLE:
+        case GEOMETRY_POLYGON:
+        case GEOMETRY_POLYGON_LIST:
+
+            // Count the rings
+            ring_quantity = ( p_geometry->type == GEOMETRY_POLYGON_LIST ) ? p_geometry->polygon_list.quantity : 1;
+
+            // Allocate the rings, the envelopes and the prepared polygons in one block
+            p_operand->p_rings = GEOMETRY_REALLOC(0, ( sizeof(geometry_polygon) + sizeof(geometry_envelope) + sizeof(geometry_prepared_polygon *) ) * ( ring_quantity + 1 ));
+
+            // Error check
+            if ( p_operand->p_rings == (void *) 0 ) goto no_mem;
+
+            // Carve the block
+            p_operand->p_envelopes = (geometry_envelope *) ( p_operand->p_rings + ring_quantity + 1 );
+            p_operand->pp_prepared = (geometry_prepared_polygon **) ( p_operand->p_envelopes + ring_quantity + 1 );
+
+            // Store each ring with area
+            for (size_t i = 0; i < ring_quantity; i++)
+            {
+
+                // Initialized data
+                geometry_polygon   _ring      = { 0 };
+                geometry_measure   _measure   = { 0 };
+                geometry_envelope *p_envelope = &p_operand->p_envelopes[p_operand->quantity];
+
+                // Get the ring
+                if      ( p_geometry->type == GEOMETRY_TRIANGLE ) _ring = (geometry_polygon) { .quantity = 3, .p_verticies = &p_geometry->triangle.a };
+                else if ( p_geometry->type == GEOMETRY_POLYGON  ) _ring = p_geometry->polygon;
+                else geometry_polygon_list_polygon(&p_geometry->polygon_list, i, &_ring);
+
+                // Measure the ring
+                geometry_polygon_measure(&_ring, &_measure);
+
+                // Skip rings with no area
+                if ( _ring.quantity < 3 || _measure.area == 0 ) continue;
+
+                // Store the ring
+                p_operand->p_rings[p_operand->quantity]     = _ring,
+                p_operand->pp_prepared[p_operand->quantity] = (void *) 0,
+                *p_envelope                                 = (geometry_envelope) { INFINITY, INFINITY, -INFINITY, -INFINITY };
+
+                // Compute the envelope of the ring
+                for (size_t j = 0; j < _ring.quantity; j++)
+                    p_envelope->x_min = fmin(p_envelope->x_min, _ring.p_verticies[j].x),
+                    p_envelope->y_min = fmin(p_envelope->y_min, _ring.p_verticies[j].y),
+                    p_envelope->x_max = fmax(p_envelope->x_max, _ring.p_verticies[j].x),
+                    p_envelope->y_max = fmax(p_envelope->y_max, _ring.p_verticies[j].y);
+
+                // Count the edges
+                edge_quantity += _ring.quantity,
+                p_operand->quantity++;
+            }
+
+            // Allocate memory for the edges
+            p_operand->edges.p_lines = GEOMETRY_REALLOC(0, sizeof(geometry_line) * ( edge_quantity + 1 ));
+
+            // Error check
+            if ( p_operand->edges.p_lines == (void *) 0 ) goto no_mem;
+
+            // Store the edges of each ring with the inside of the operand on
+            // their left. A ring inside of an odd quantity of other rings is
+            // a hole, and turns the other way.
+            for (size_t i = 0; i < p_operand->quantity; i++)
+            {
+
+                // Initialized data
+                geometry_polygon *p_ring   = &p_operand->p_rings[i];
+                geometry_point   *p_first  = &p_ring->p_verticies[0];
+                geometry_measure  _measure = { 0 };
+                bool              hole     = false;
+
+                // Measure the ring
+                geometry_polygon_measure(p_ring, &_measure);
+
+                // Count the rings around this ring
+                for (size_t j = 0; j < p_operand->quantity; j++)
+                {
+
+                    // Initialized data
+                    bool inside = false;
+
+                    // Skip this ring, and rings whose envelope misses it
+                    if ( j == i ) continue;
+                    if ( p_first->x < p_operand->p_envelopes[j].x_min || p_first->x > p_operand->p_envelopes[j].x_max ) continue;
+                    if ( p_first->y < p_operand->p_envelopes[j].y_min || p_first->y > p_operand->p_envelopes[j].y_max ) continue;
+
+                    // Prepare the ring
+                    if ( p_operand->pp_prepared[j] == (void *) 0 && geometry_prepared_polygon_construct(&p_operand->pp_prepared[j], &p_operand->p_rings[j]) == 0 ) goto failed_to_prepare_ring;
+
+                    // Test the ring
+                    geometry_prepared_polygon_contains(p_operand->pp_prepared[j], p_first, &inside);
+
+                    // Count the ring
+                    if ( inside ) hole = !hole;
+                }
+
+                // Store the edges
+                for (size_t j = 0; j < p_ring->quantity; j++)
+                {
+
+                    // Initialized data
+                    geometry_point *p_a = &p_ring->p_verticies[j],
+                                   *p_b = &p_ring->p_verticies[( j + 1 ) % p_ring->quantity];
+
+                    // Skip edges with no length
+                    if ( p_a->x == p_b->x && p_a->y == p_b->y ) continue;
+
+                    // Turn the edge
+                    if ( ( _measure.area < 0 ) != hole )
+                    {
+                        geometry_point *p_t = p_a;
+                        p_a = p_b, p_b = p_t;
+                    }
+
+                    // Store the edge
+                    p_operand->edges.p_lines[p_operand->edges.quantity++] = (geometry_line) { p_a->x, p_a->y, p_b->x, p_b->y };
+                }
+            }
+
+            // Done
+            break;
+
+        case GEOMETRY_INVALID:
+        default:
+
+            // Error
+            goto invalid_geometry_type;
+    }
+
+    // Compute the envelope of the edges
+    for (size_t i = 0; i < p_operand->edges.quantity; i++)
+        p_operand->envelope.x_min = fmin(p_operand->envelope.x_min, fmin(p_operand->edges.p_lines[i].x0, p_operand->edges.p_lines[i].x1)),
+        p_operand->envelope.y_min = fmin(p_operand->envelope.y_min, fmin(p_operand->edges.p_lines[i].y0, p_operand->edges.p_lines[i].y1)),
+        p_operand->envelope.x_max = fmax(p_operand->envelope.x_max, fmax(p_operand->edges.p_lines[i].x0, p_operand->edges.p_lines[i].x1)),
+        p_operand->envelope.y_max = fmax(p_operand->envelope.y_max, fmax(p_operand->edges.p_lines[i].y0, p_operand->edges.p_lines[i].y1));
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            invalid_geometry_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_geometry\" is of invalid type in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_prepare_ring:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to prepare ring in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_relate_operand_contains ( geometry_relate_operand *p_operand, geometry_point *p_point, bool *p_result )
+{
+
+    // Initialized data
+    bool ret = false;
+
+    // Count the rings around the point
+    for (size_t i = 0; i < p_operand->quantity; i++)
+    {
+
+        // Initialized data
+        bool inside = false;
+
+        // Skip rings whose envelope misses the point
+        if ( p_point->x < p_operand->p_envelopes[i].x_min || p_point->x > p_operand->p_envelopes[i].x_max ) continue;
+        if ( p_point->y < p_operand->p_envelopes[i].y_min || p_point->y > p_operand->p_envelopes[i].y_max ) continue;
+
+        // Prepare the ring
+        if ( p_operand->pp_prepared[i] == (void *) 0 && geometry_prepared_polygon_construct(&p_operand->pp_prepared[i], &p_operand->p_rings[i]) == 0 ) goto failed_to_prepare_ring;
+
+        // Test the ring
+        geometry_prepared_polygon_contains(p_operand->pp_prepared[i], p_point, &inside);
+
+        // Count the ring
+        if ( inside ) ret = !ret;
+    }
+
+    // Return the result to the caller
+    *p_result = ret;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_prepare_ring:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to prepare ring in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static enum geometry_location_e geometry_relate_operand_edge_location ( geometry_relate_operand *p_operand, geometry_point *p_point )
+{
+
+    // Strategy
+    switch ( p_operand->dimension )
+    {
+        case 0:
+
+            // A point is its own interior
+            return GEOMETRY_LOCATION_INTERIOR;
+
+        case 1:
+
+            // The boundary of lines is some of their endpoints
+            if ( bsearch(p_point, p_operand->p_boundary, p_operand->boundary_quantity, sizeof(geometry_point), geometry_relate_point_compare) ) return GEOMETRY_LOCATION_BOUNDARY;
+
+            // Done
+            return GEOMETRY_LOCATION_INTERIOR;
+
+        default:
+
+            // The edges of an area are its boundary
+            return GEOMETRY_LOCATION_BOUNDARY;
+    }
+}
+
+static int geometry_relate_operand_destroy ( geometry_relate_operand *p_operand )
+{
+
+    // Release the prepared polygons
+    for (size_t i = 0; i < p_operand->quantity; i++)
+        if ( p_operand->pp_prepared[i] ) geometry_prepared_polygon_destroy(&p_operand->pp_prepared[i]);
+
+    // Release the rings, the envelopes and the prepared polygons
+    if ( p_operand->p_rings ) p_operand->p_rings = GEOMETRY_REALLOC(p_operand->p_rings, 0);
+
+    // Release the boundary
+    if ( p_operand->p_boundary ) p_operand->p_boundary = GEOMETRY_REALLOC(p_operand->p_boundary, 0);
+
+    // Release the edges
+    if ( p_operand->edges.p_lines ) p_operand->edges.p_lines = GEOMETRY_REALLOC(p_operand->edges.p_lines, 0);
+
+    // Clear the operand
+    *p_operand = (geometry_relate_operand) { 0 };
+
+    // Success
+    return 1;
+}
+
+static int geometry_relate_intersections ( geometry_relate_state *p_relate, geometry_line_list *p_a, geometry_line_list *p_b, size_t *p_quantity )
+{
+
+    // Initialized data
+    size_t capacity = p_a->quantity + ( ( p_b ) ? p_b->quantity : 0 ) + 1,
+           quantity = 0;
+
+    // Find where the edges meet
+    for (;;)
+    {
+
+        // Allocate memory for the intersections
+        p_relate->p_intersections = GEOMETRY_REALLOC(p_relate->p_intersections, sizeof(geometry_line_intersection) * capacity);
+
+        // Error check
+        if ( p_relate->p_intersections == (void *) 0 ) goto no_mem;
+
+        // Find the intersections
+        if ( geometry_line_list_intersections(p_a, p_b, p_relate->p_intersections, capacity, &quantity) == 0 ) goto failed_to_intersect;
+
+        // Done
+        if ( quantity <= capacity ) break;
+
+        // Grow
+        capacity = quantity;
+    }
+
+    // Return the quantity of intersections to the caller
+    *p_quantity = quantity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_intersect:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to intersect edges in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static size_t geometry_relate_meet ( geometry_line *p_a, geometry_line *p_b, geometry_line_intersection *p_intersection, geometry_point *p_points )
+{
+
+    // Initialized data
+    geometry_line *p_lines[2] = { p_a, p_b };
+    size_t         ret        = 0;
+
+    // A crossing meets at one point inside of both edges
+    if ( p_intersection->proper )
+    {
+        p_points[0] = p_intersection->point;
+        return 1;
+    }
+
+    // Any other contact meets at each endpoint of an edge on the other edge
+    for (size_t j = 0; j < 2; j++)
+    {
+
+        // Initialized data
+        geometry_point _ends[2] = { { p_lines[j]->x0, p_lines[j]->y0 }, { p_lines[j]->x1, p_lines[j]->y1 } };
+
+        // Test each endpoint
+        for (size_t k = 0; k < 2; k++)
+        {
+
+            // Skip endpoints off of the other edge
+            if ( geometry_relate_on_line(p_lines[1 - j], &_ends[k]) == false ) continue;
+
+            // Skip repeated points
+            for (size_t p = 0; p < ret; p++)
+                if ( geometry_relate_point_compare(&p_points[p], &_ends[k]) == 0 ) goto next_end;
+
+            // Store the point
+            p_points[ret++] = _ends[k];
+
+            next_end:;
+        }
+    }
+
+    // Done
+    return ret;
+}
+
+static void geometry_relate_cut_edge ( geometry_relate_state *p_relate, size_t edge, geometry_line *p_line, geometry_point *p_point, size_t *p_cut_quantity )
+{
+
+    // Skip the endpoints of the edge
+    if ( p_point->x == p_line->x0 && p_point->y == p_line->y0 ) return;
+    if ( p_point->x == p_line->x1 && p_point->y == p_line->y1 ) return;
+
+    // Store the cut
+    p_relate->p_cuts[(*p_cut_quantity)++] = (geometry_relate_cut)
+    {
+        .edge     = edge,
+        .position = ( p_point->x - p_line->x0 ) * ( p_line->x1 - p_line->x0 ) + ( p_point->y - p_line->y0 ) * ( p_line->y1 - p_line->y0 ),
+        .point    = *p_point
+    };
+
+    // Done
+    return;
+}
+
+static int geometry_relate_overlap ( geometry_relate_state *p_relate, size_t a, size_t b )
+{
+
+    // Grow
+    if ( p_relate->overlap_quantity == p_relate->overlap_capacity )
+    {
+
+        // Initialized data
+        size_t *p_overlaps = GEOMETRY_REALLOC(p_relate->p_overlaps, sizeof(size_t) * 2 * ( 2 * p_relate->overlap_capacity + 8 ));
+
+        // Error check
+        if ( p_overlaps == (void *) 0 ) goto no_mem;
+
+        // Store the overlaps
+        p_relate->p_overlaps       = p_overlaps,
+        p_relate->overlap_capacity = 2 * p_relate->overlap_capacity + 8;
+    }
+
+    // Store the pair
+    p_relate->p_overlaps[2 * p_relate->overlap_quantity]     = a,
+    p_relate->p_overlaps[2 * p_relate->overlap_quantity + 1] = b;
+
+    // Count the pair
+    p_relate->overlap_quantity++;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static void geometry_relate_cut_range ( const geometry_relate_cut *p_cuts, size_t quantity, size_t edge, size_t *p_begin, size_t *p_end )
+{
+
+    // Initialized data
+    size_t lo = 0,
+           hi = quantity;
+
+    // Find the first cut of the edge
+    while ( lo < hi )
+    {
+
+        // Initialized data
+        size_t middle = ( lo + hi ) / 2;
+
+        // Halve the range
+        if ( p_cuts[middle].edge < edge ) lo = middle + 1;
+        else                              hi = middle;
+    }
+
+    // Find the end of the cuts of the edge
+    for (hi = lo; hi < quantity && p_cuts[hi].edge == edge; hi++);
+
+    // Return the range to the caller
+    *p_begin = lo,
+    *p_end   = hi;
+
+    // Done
+    return;
+}
+
+static int geometry_relate_share_cuts ( geometry_relate_state *p_relate, size_t *p_cut_quantity )
+{
+
+    // Initialized data
+    geometry_relate_operand *p_operands = p_relate->operands;
+    size_t                   offset     = p_operands[0].edges.quantity,
+                             quantity   = *p_cut_quantity,
+                             added      = 1;
+
+    // Until no edge gains a cut
+    while ( added && p_relate->overlap_quantity )
+    {
+
+        // Nothing is added yet
+        added = 0;
+
+        // Each direction of each pair
+        for (size_t i = 0; i < 2 * p_relate->overlap_quantity; i++)
+        {
+
+            // Initialized data
+            size_t         from   = p_relate->p_overlaps[i],
+                           to     = p_relate->p_overlaps[i ^ 1],
+                           begin  = 0,
+                           end    = 0,
+                           lo     = 0,
+                           hi     = 0;
+            geometry_line *p_to   = ( to < offset ) ? &p_operands[0].edges.p_lines[to] : &p_operands[1].edges.p_lines[to - offset];
+            double         length = ( p_to->x1 - p_to->x0 ) * ( p_to->x1 - p_to->x0 ) + ( p_to->y1 - p_to->y0 ) * ( p_to->y1 - p_to->y0 );
+
+            // Find the cuts of each edge
+            geometry_relate_cut_range(p_relate->p_cuts, quantity, from, &begin, &end);
+            geometry_relate_cut_range(p_relate->p_cuts, quantity, to, &lo, &hi);
+
+            // Share each cut inside of the other edge
+            for (size_t j = begin; j < end; j++)
+            {
+
+                // Initialized data
+                geometry_point *p_point  = &p_relate->p_cuts[j].point;
+                double          position = ( p_point->x - p_to->x0 ) * ( p_to->x1 - p_to->x0 ) + ( p_point->y - p_to->y0 ) * ( p_to->y1 - p_to->y0 );
+                size_t          k        = 0;
+
+                // Skip cuts off of the other edge
+                if ( position <= 0 || position >= length ) continue;
+
+                // Skip cuts the other edge already has
+                for (k = lo; k < hi; k++)
+                    if ( geometry_relate_point_compare(&p_relate->p_cuts[k].point, p_point) == 0 ) break;
+                if ( k < hi ) continue;
+
+                // Grow
+                if ( *p_cut_quantity == p_relate->cut_capacity )
+                {
+
+                    // Initialized data
+                    geometry_relate_cut *p_cuts = GEOMETRY_REALLOC(p_relate->p_cuts, sizeof(geometry_relate_cut) * 2 * p_relate->cut_capacity);
+
+                    // Error check
+                    if ( p_cuts == (void *) 0 ) goto no_mem;
+
+                    // Store the cuts
+                    p_relate->p_cuts        = p_cuts,
+                    p_relate->cut_capacity *= 2;
+
+                    // The cut moved
+                    p_point = &p_relate->p_cuts[j].point;
+                }
+
+                // Share the cut
+                p_relate->p_cuts[(*p_cut_quantity)++] = (geometry_relate_cut) { .edge = to, .position = position, .point = *p_point };
+
+                // Count the cut
+                added++;
+            }
+        }
+
+        // Sort the cuts along each edge
+        qsort(p_relate->p_cuts, *p_cut_quantity, sizeof(geometry_relate_cut), geometry_relate_cut_compare);
+
+        // Include the shared cuts
+        quantity = *p_cut_quantity;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_relate_contacts ( geometry_relate_state *p_relate, size_t *p_cut_quantity )
+{
+
+    // Initialized data
+    geometry_relate_operand *p_operands       = p_relate->operands;
+    size_t                   quantity         = 0,
+                             contact_quantity = 0,
+                             cut_quantity     = 0,
+                             offset           = p_operands[0].edges.quantity;
+
+    // Find where the edges of the operands meet
+    if ( geometry_relate_intersections(p_relate, &p_operands[0].edges, &p_operands[1].edges, &quantity) == 0 ) goto failed_to_intersect;
+
+    // Each intersection meets at most four points, and cuts each edge at each
+    p_relate->p_contacts = GEOMETRY_REALLOC(0, sizeof(geometry_point)      * ( 4 * quantity + 1 ));
+    p_relate->p_cuts     = GEOMETRY_REALLOC(0, sizeof(geometry_relate_cut) * ( 8 * quantity + 1 )),
+    p_relate->cut_capacity = 8 * quantity + 1;
+
+    // Error check
+    if ( p_relate->p_contacts == (void *) 0 || p_relate->p_cuts == (void *) 0 ) goto no_mem;
+
+    // Locate each point where the edges meet
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        geometry_line  *p_lines[2] = { &p_operands[0].edges.p_lines[p_relate->p_intersections[i].a], &p_operands[1].edges.p_lines[p_relate->p_intersections[i].b] };
+        size_t          edges[2]   = { p_relate->p_intersections[i].a, offset + p_relate->p_intersections[i].b };
+        geometry_point  _points[4] = { 0 };
+        size_t          points     = geometry_relate_meet(p_lines[0], p_lines[1], &p_relate->p_intersections[i], _points);
+
+        // Store edges that lie on each other
+        if ( p_operands[0].dimension && p_operands[1].dimension && points == 2 && geometry_relate_overlap(p_relate, edges[0], edges[1]) == 0 ) goto no_mem;
+
+        // Locate each point
+        for (size_t p = 0; p < points; p++)
+        {
+
+            // Store the point
+            p_relate->p_contacts[contact_quantity++] = _points[p];
+
+            // Cut each edge with length at the point
+            for (size_t j = 0; j < 2; j++)
+                if ( p_operands[j].dimension ) geometry_relate_cut_edge(p_relate, edges[j], p_lines[j], &_points[p], &cut_quantity);
+
+            // The point is on the edges of both operands
+            if ( geometry_relate_set(p_relate, geometry_relate_operand_edge_location(&p_operands[0], &_points[p]), geometry_relate_operand_edge_location(&p_operands[1], &_points[p]), 0) ) goto done;
+        }
+    }
+
+    // Lines may cross, or overlap, themselves, and the rings of an area
+    // may share edges. Cut them where they do, so that their pieces match
+    // the pieces of the other operand.
+    for (size_t k = 0, base = 0; k < 2; base += p_operands[k].edges.quantity, k++)
+    {
+
+        // Skip points, and areas of one ring
+        if ( p_operands[k].dimension == 0 || ( p_operands[k].dimension == 2 && p_operands[k].quantity < 2 ) || p_operands[k].edges.quantity < 2 ) continue;
+
+        // Find where the lines meet each other
+        if ( geometry_relate_intersections(p_relate, &p_operands[k].edges, (void *) 0, &quantity) == 0 ) goto failed_to_intersect;
+
+        // Grow the cuts
+        p_relate->cut_capacity = cut_quantity + 8 * quantity + 1,
+        p_relate->p_cuts       = GEOMETRY_REALLOC(p_relate->p_cuts, sizeof(geometry_relate_cut) * p_relate->cut_capacity);
+
+        // Error check
+        if ( p_relate->p_cuts == (void *) 0 ) goto no_mem;
+
+        // Cut both lines at each point where they meet
+        for (size_t i = 0; i < quantity; i++)
+        {
+
+            // Initialized data
+            geometry_line  *p_a        = &p_operands[k].edges.p_lines[p_relate->p_intersections[i].a],
+                           *p_b        = &p_operands[k].edges.p_lines[p_relate->p_intersections[i].b];
+            geometry_point  _points[4] = { 0 };
+            size_t          points     = geometry_relate_meet(p_a, p_b, &p_relate->p_intersections[i], _points);
+
+            // Store lines that lie on each other
+            if ( points == 2 && geometry_relate_overlap(p_relate, base + p_relate->p_intersections[i].a, base + p_relate->p_intersections[i].b) == 0 ) goto no_mem;
+
+            // Cut the lines
+            for (size_t p = 0; p < points; p++)
+                geometry_relate_cut_edge(p_relate, base + p_relate->p_intersections[i].a, p_a, &_points[p], &cut_quantity),
+                geometry_relate_cut_edge(p_relate, base + p_relate->p_intersections[i].b, p_b, &_points[p], &cut_quantity);
+        }
+    }
+
+    // Sort the points, and drop repeated points
+    qsort(p_relate->p_contacts, contact_quantity, sizeof(geometry_point), geometry_relate_point_compare);
+    for (size_t i = 0; i < contact_quantity; i++)
+        if ( p_relate->contact_quantity == 0 || geometry_relate_point_compare(&p_relate->p_contacts[i], &p_relate->p_contacts[p_relate->contact_quantity - 1]) )
+            p_relate->p_contacts[p_relate->contact_quantity++] = p_relate->p_contacts[i];
+
+    // Sort the cuts along each edge
+    qsort(p_relate->p_cuts, cut_quantity, sizeof(geometry_relate_cut), geometry_relate_cut_compare);
+
+    // Edges that lie on each other share their cuts
+    if ( geometry_relate_share_cuts(p_relate, &cut_quantity) == 0 ) goto no_mem;
+
+    done:
+
+    // Return the quantity of cuts to the caller
+    *p_cut_quantity = cut_quantity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_intersect:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to intersect edges in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_relate_pieces ( geometry_relate_state *p_relate, size_t cut_quantity )
+{
+
+    // Initialized data
+    geometry_relate_operand *p_operands     = p_relate->operands;
+    size_t                   piece_quantity = 0,
+                             cut            = 0,
+                             offset         = 0;
+
+    // Allocate memory for the pieces
+    p_relate->p_pieces = GEOMETRY_REALLOC(0, sizeof(geometry_relate_piece) * ( p_operands[0].edges.quantity + p_operands[1].edges.quantity + cut_quantity + 1 ));
+
+    // Error check
+    if ( p_relate->p_pieces == (void *) 0 ) goto no_mem;
+
+    // Cut the edges of each operand with length
+    for (size_t k = 0; k < 2; offset += p_operands[k].edges.quantity, k++)
+    {
+
+        // Skip points
+        if ( p_operands[k].dimension == 0 ) continue;
+
+        // Cut each edge
+        for (size_t i = 0; i < p_operands[k].edges.quantity; i++)
+        {
+
+            // Initialized data
+            geometry_line  *p_line = &p_operands[k].edges.p_lines[i];
+            geometry_point  _start = { p_line->x0, p_line->y0 },
+                            _end   = { p_line->x1, p_line->y1 };
+
+            // Store a piece ending at each cut, and a piece ending at the end of the edge
+            for (;;)
+            {
+
+                // Initialized data
+                bool           last  = ( cut == cut_quantity || p_relate->p_cuts[cut].edge != offset + i );
+                geometry_point _stop = ( last ) ? _end : p_relate->p_cuts[cut++].point;
+
+                // Skip pieces with no length
+                if ( geometry_relate_point_compare(&_start, &_stop) == 0 ) { if ( last ) break; continue; }
+
+                // Store the piece from its lesser point
+                p_relate->p_pieces[piece_quantity++] = ( geometry_relate_point_compare(&_start, &_stop) < 0 ) ?
+                    (geometry_relate_piece) { .a = _start, .b = _stop , .operand = k, .forward = true  } :
+                    (geometry_relate_piece) { .a = _stop , .b = _start, .operand = k, .forward = false };
+
+                // Next piece
+                _start = _stop;
+
+                // Done
+                if ( last ) break;
+            }
+        }
+    }
+
+    // Gather equal pieces
+    qsort(p_relate->p_pieces, piece_quantity, sizeof(geometry_relate_piece), geometry_relate_piece_compare);
+
+    // Locate each group of equal pieces
+    for (size_t i = 0, j = 0; i < piece_quantity; i = j)
+    {
+
+        // Initialized data
+        geometry_relate_piece    *p_piece  = &p_relate->p_pieces[i];
+        geometry_point            _middle  = { ( p_piece->a.x + p_piece->b.x ) / 2, ( p_piece->a.y + p_piece->b.y ) / 2 };
+        enum geometry_location_e  piece[2] = { GEOMETRY_LOCATION_EXTERIOR, GEOMETRY_LOCATION_EXTERIOR },
+                                  left[2]  = { GEOMETRY_LOCATION_EXTERIOR, GEOMETRY_LOCATION_EXTERIOR },
+                                  right[2] = { GEOMETRY_LOCATION_EXTERIOR, GEOMETRY_LOCATION_EXTERIOR };
+
+        // Find the end of the group
+        for (j = i + 1; j < piece_quantity; j++)
+            if ( geometry_relate_point_compare(&p_relate->p_pieces[j].a, &p_piece->a) || geometry_relate_point_compare(&p_relate->p_pieces[j].b, &p_piece->b) ) break;
+
+        // Locate the group in each operand
+        for (size_t k = 0; k < 2; k++)
+        {
+
+            // Initialized data
+            size_t count   = 0;
+            bool   forward = false,
+                   inside  = false;
+
+            // Count the pieces of the operand in the group
+            for (size_t g = i; g < j; g++)
+                if ( p_relate->p_pieces[g].operand == k )
+                    forward = ( count++ ) ? forward : p_relate->p_pieces[g].forward;
+
+            // Pieces of lines are inside of the lines, and have no sides
+            if ( p_operands[k].dimension < 2 )
+            {
+                if ( count ) piece[k] = GEOMETRY_LOCATION_INTERIOR;
+                continue;
+            }
+
+            // An edge of an area has its inside on the left
+            if ( count % 2 )
+            {
+                piece[k] = GEOMETRY_LOCATION_BOUNDARY,
+                left[k]  = ( forward ) ? GEOMETRY_LOCATION_INTERIOR : GEOMETRY_LOCATION_EXTERIOR,
+                right[k] = ( forward ) ? GEOMETRY_LOCATION_EXTERIOR : GEOMETRY_LOCATION_INTERIOR;
+                continue;
+            }
+
+            // Pieces that cancel out are located just beside the group
+            else if ( count )
+            {
+
+                // Initialized data
+                geometry_point _beside =
+                {
+                    _middle.x - ( p_piece->b.y - p_piece->a.y ) * 0x1p-20,
+                    _middle.y + ( p_piece->b.x - p_piece->a.x ) * 0x1p-20
+                };
+
+                // Locate the point beside the group
+                if ( geometry_relate_operand_contains(&p_operands[k], &_beside, &inside) == 0 ) goto failed_to_locate_point;
+            }
+
+            // Pieces off of the operand are wholly inside, or wholly outside
+            else if ( geometry_relate_operand_contains(&p_operands[k], &_middle, &inside) == 0 ) goto failed_to_locate_point;
+
+            // Store the location
+            piece[k] = left[k] = right[k] = ( inside ) ? GEOMETRY_LOCATION_INTERIOR : GEOMETRY_LOCATION_EXTERIOR;
+        }
+
+        // The piece is a line in both operands
+        if ( geometry_relate_set(p_relate, piece[0], piece[1], 1) ) break;
+
+        // Lines have no sides
+        if ( p_operands[0].dimension < 2 && p_operands[1].dimension < 2 ) continue;
+
+        // Each side of the piece is an area in both operands
+        if ( geometry_relate_set(p_relate, left[0] , left[1] , 2) ) break;
+        if ( geometry_relate_set(p_relate, right[0], right[1], 2) ) break;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_locate_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to locate point in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_relate_points ( geometry_relate_state *p_relate )
+{
+
+    // Initialized data
+    geometry_relate_operand *p_operands = p_relate->operands;
+
+    // Locate the points of each operand in the other operand
+    for (size_t k = 0; k < 2; k++)
+    {
+
+        // Initialized data
+        geometry_relate_operand  *p_other  = &p_operands[1 - k];
+        enum geometry_location_e  part     = ( p_operands[k].dimension == 0 ) ? GEOMETRY_LOCATION_INTERIOR : GEOMETRY_LOCATION_BOUNDARY;
+        size_t                    quantity = ( p_operands[k].dimension == 0 ) ? p_operands[k].edges.quantity : p_operands[k].boundary_quantity;
+
+        // Only points, and the boundary of lines
+        if ( p_operands[k].dimension == 2 ) continue;
+
+        // Locate each point
+        for (size_t i = 0; i < quantity; i++)
+        {
+
+            // Initialized data
+            geometry_point           _point   = ( p_operands[k].dimension == 0 ) ? (geometry_point) { p_operands[k].edges.p_lines[i].x0, p_operands[k].edges.p_lines[i].y0 } : p_operands[k].p_boundary[i];
+            enum geometry_location_e location = GEOMETRY_LOCATION_EXTERIOR;
+            bool                     inside   = false;
+
+            // Points on the edges of the other operand are already located
+            if ( bsearch(&_point, p_relate->p_contacts, p_relate->contact_quantity, sizeof(geometry_point), geometry_relate_point_compare) ) continue;
+
+            // Points off of the edges of the other operand are inside of its area, or outside of it
+            if ( geometry_relate_operand_contains(p_other, &_point, &inside) == 0 ) goto failed_to_locate_point;
+            if ( inside ) location = GEOMETRY_LOCATION_INTERIOR;
+
+            // The point is a point in both operands
+            if ( geometry_relate_set(p_relate, ( k == 0 ) ? part : location, ( k == 0 ) ? location : part, 0) ) return 1;
+        }
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_locate_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to locate point in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_relate_run ( geometry *p_a, geometry *p_b, const char *const *pp_patterns, size_t pattern_quantity, geometry_relation *p_relation, bool *p_result )
+{
+
+    // Initialized data
+    geometry_relate_state _relate      = { 0 };
+    size_t          cut_quantity = 0;
+    signed char     parts[2][GEOMETRY_LOCATION_QUANTITY];
+
+    // Construct the operands
+    if ( geometry_relate_operand_construct(&_relate.operands[0], p_a) == 0 ) goto failed_to_construct_operand;
+    if ( geometry_relate_operand_construct(&_relate.operands[1], p_b) == 0 ) goto failed_to_construct_operand;
+
+    // Compute the dimension of each part of each operand
+    for (size_t k = 0; k < 2; k++)
+    {
+
+        // Initialized data
+        geometry_relate_operand *p_operand = &_relate.operands[k];
+        bool                     empty     = ( p_operand->edges.quantity == 0 );
+
+        // Store the dimension of each part
+        parts[k][GEOMETRY_LOCATION_INTERIOR] = ( empty ) ? GEOMETRY_RELATE_FALSE : (signed char) p_operand->dimension,
+        parts[k][GEOMETRY_LOCATION_BOUNDARY] = ( empty || p_operand->dimension == 0 ) ? GEOMETRY_RELATE_FALSE : ( p_operand->dimension == 2 ) ? 1 : ( p_operand->boundary_quantity ) ? 0 : GEOMETRY_RELATE_FALSE,
+        parts[k][GEOMETRY_LOCATION_EXTERIOR] = 2;
+    }
+
+    // Clear the matrix, and bound each entry by the lesser dimension of its parts
+    for (size_t a = 0; a < GEOMETRY_LOCATION_QUANTITY; a++)
+        for (size_t b = 0; b < GEOMETRY_LOCATION_QUANTITY; b++)
+            _relate.relation.matrix[a][b] = GEOMETRY_RELATE_FALSE,
+            _relate.bound[a][b]           = ( parts[0][a] < parts[1][b] ) ? parts[0][a] : parts[1][b];
+
+    // Store the patterns
+    _relate.pp_patterns      = pp_patterns,
+    _relate.pattern_quantity = pattern_quantity,
+    _relate.answer           = -1;
+
+    // The exteriors always meet
+    if ( geometry_relate_set(&_relate, GEOMETRY_LOCATION_EXTERIOR, GEOMETRY_LOCATION_EXTERIOR, 2) ) goto done;
+
+    // Operands that are empty, or apart, only meet the exterior of each other
+    if ( _relate.operands[0].edges.quantity == 0 || _relate.operands[1].edges.quantity == 0 ||
+         _relate.operands[0].envelope.x_max < _relate.operands[1].envelope.x_min || _relate.operands[1].envelope.x_max < _relate.operands[0].envelope.x_min ||
+         _relate.operands[0].envelope.y_max < _relate.operands[1].envelope.y_min || _relate.operands[1].envelope.y_max < _relate.operands[0].envelope.y_min )
+    {
+
+        // Each part of each operand is in the exterior of the other
+        for (size_t p = 0; p < GEOMETRY_LOCATION_EXTERIOR; p++)
+        {
+            if ( parts[0][p] != GEOMETRY_RELATE_FALSE && geometry_relate_set(&_relate, p, GEOMETRY_LOCATION_EXTERIOR, parts[0][p]) ) goto done;
+            if ( parts[1][p] != GEOMETRY_RELATE_FALSE && geometry_relate_set(&_relate, GEOMETRY_LOCATION_EXTERIOR, p, parts[1][p]) ) goto done;
+        }
+    }
+
+    // Locate where the operands meet, each piece of their edges, and their other points
+    else
+    {
+        if ( geometry_relate_contacts(&_relate, &cut_quantity) == 0 ) goto failed_to_relate;
+        if ( _relate.answer != -1 ) goto done;
+        if ( geometry_relate_pieces(&_relate, cut_quantity) == 0 ) goto failed_to_relate;
+        if ( _relate.answer != -1 ) goto done;
+        if ( geometry_relate_points(&_relate) == 0 ) goto failed_to_relate;
+    }
+
+    done:
+
+    // Test the complete matrix
+    if ( _relate.answer == -1 )
+    {
+        _relate.answer = 0;
+        for (size_t i = 0; i < pattern_quantity; i++)
+            if ( geometry_relate_pattern_test(&_relate.relation, _relate.bound, pp_patterns[i], true) == 1 ) _relate.answer = 1;
+    }
+
+    // Return the results to the caller
+    if ( p_relation ) *p_relation = _relate.relation;
+    if ( p_result   ) *p_result   = ( _relate.answer == 1 );
+
+    // Clean up
+    geometry_relate_destroy(&_relate);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_construct_operand:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to construct operand in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_relate_destroy(&_relate);
+
+                // Error
+                return 0;
+
+            failed_to_relate:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to relate operands in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_relate_destroy(&_relate);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_relate_destroy ( geometry_relate_state *p_relate )
+{
+
+    // Release the operands
+    geometry_relate_operand_destroy(&p_relate->operands[0]);
+    geometry_relate_operand_destroy(&p_relate->operands[1]);
+
+    // Release the intersections, the points, the cuts, the pieces and the overlaps
+    if ( p_relate->p_intersections ) p_relate->p_intersections = GEOMETRY_REALLOC(p_relate->p_intersections, 0);
+    if ( p_relate->p_contacts      ) p_relate->p_contacts      = GEOMETRY_REALLOC(p_relate->p_contacts, 0);
+    if ( p_relate->p_cuts          ) p_relate->p_cuts          = GEOMETRY_REALLOC(p_relate->p_cuts, 0);
+    if ( p_relate->p_pieces        ) p_relate->p_pieces        = GEOMETRY_REALLOC(p_relate->p_pieces, 0);
+    if ( p_relate->p_overlaps      ) p_relate->p_overlaps      = GEOMETRY_REALLOC(p_relate->p_overlaps, 0);
+
+    // Success
+    return 1;
+}
+
+static int geometry_relate_predicate ( geometry *p_a, geometry *p_b, const char *const *pp_patterns, size_t pattern_quantity, bool *p_result )
+{
+
+    // Argument check
+    if ( p_a      == (void *) 0 ) goto no_a;
+    if ( p_b      == (void *) 0 ) goto no_b;
+    if ( p_result == (void *) 0 ) goto no_result;
+
+    // Compute the matrix until the patterns are settled
+    if ( geometry_relate_run(p_a, p_b, pp_patterns, pattern_quantity, (void *) 0, p_result) == 0 ) goto failed_to_relate;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_b:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_b\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_relate:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to relate geometry in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_relate_dimension ( geometry *p_geometry )
+{
+
+    // Strategy
+    switch ( p_geometry->type )
+    {
+        case GEOMETRY_POINT:
+        case GEOMETRY_POINT_LIST:
+            return 0;
+
+        case GEOMETRY_LINE:
+        case GEOMETRY_LINE_LIST:
+            return 1;
+
+        case GEOMETRY_TRIANGLE:
+        case GEOMETRY_POLYGON:
+        case GEOMETRY_POLYGON_LIST:
+            return 2;
+
+        case GEOMETRY_INVALID:
+        default:
+            return -1;
+    }
+}
+
+static bool geometry_relate_line_list_view ( geometry *p_geometry, geometry_line_list *p_line_list )
+{
+
+    // Strategy
+    switch (p_geometry->type)
+    {
+
+        // One line
+        case GEOMETRY_LINE:
+
+            // Store the line list
+            *p_line_list = (geometry_line_list) { .quantity = 1, .p_lines = &p_geometry->line };
+
+            // Success
+            return true;
+
+        // Many lines
+        case GEOMETRY_LINE_LIST:
+
+            // Store the line list
+            *p_line_list = p_geometry->line_list;
+
+            // Success
+            return true;
+
+        default:
+
+            // Not lines
+            return false;
+    }
+}
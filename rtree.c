@@ -0,0 +1,791 @@
+/** !
+ * R-tree spatial index
+ *
+ * @file rtree.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <stdint.h>
+#include <string.h>
+
+// Header
+#include <geometry/rtree.h>
+#include <geometry/parallel.h>
+
+// Preprocessor definitions
+#define GEOMETRY_RTREE_STACK_SIZE ( ( GEOMETRY_RTREE_FANOUT - 1 ) * GEOMETRY_RTREE_HEIGHT_MAX + 1 )
+
+// Structure declarations
+struct geometry_rtree_nearest_s;
+struct geometry_rtree_tile_s;
+
+// Type definitions
+typedef struct geometry_rtree_nearest_s geometry_rtree_nearest_state;
+typedef struct geometry_rtree_tile_s    geometry_rtree_tile_state;
+
+// Structure definitions
+struct geometry_rtree_nearest_s
+{
+    geometry          *p_geometry;
+    geometry_envelope  envelope;
+    size_t             k,
+                       quantity,
+                      *p_results;
+    double            *p_distances;
+};
+
+// Slice i is p_elements from slice_size * i, up to the end of the elements
+struct geometry_rtree_tile_s
+{
+    char   *p_elements;
+    size_t  quantity,
+            size,
+            slice_size;
+};
+
+// Forward declarations
+/** !
+ * Compare the centers of two envelopes on the x axis
+ *
+ * @param p_a the first envelope
+ * @param p_b the second envelope
+ *
+ * @return -1, 0 or 1, as for qsort
+ */
+static int geometry_envelope_compare_x ( const void *p_a, const void *p_b );
+
+/** !
+ * Compare the centers of two envelopes on the y axis
+ *
+ * @param p_a the first envelope
+ * @param p_b the second envelope
+ *
+ * @return -1, 0 or 1, as for qsort
+ */
+static int geometry_envelope_compare_y ( const void *p_a, const void *p_b );
+
+/** !
+ * Sort-Tile-Recursive ordering. Sort by x, cut into vertical slices, and
+ * sort each slice by y, so each run of GEOMETRY_RTREE_FANOUT elements is
+ * spatially compact. Each element must begin with a geometry_envelope.
+ *
+ * @param p_elements the elements
+ * @param quantity   the quantity of elements
+ * @param size       the size of each element
+ *
+ * @return void
+ */
+static void geometry_rtree_tile ( void *p_elements, size_t quantity, size_t size );
+
+/** !
+ * Sort a chunk of the slices of a tiling by y
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first slice of the chunk
+ * @param last        one past the last slice of the chunk
+ * @param p_parameter the tiling
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_rtree_tile_slices ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Compute the envelopes of a chunk of geometry into items. Empty geometry
+ * gets an empty envelope.
+ *
+ * @param chunk       the index of the chunk
+ * @param first       the first geometry of the chunk
+ * @param last        one past the last geometry of the chunk
+ * @param p_parameter the tree
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_rtree_envelopes ( size_t chunk, size_t first, size_t last, void *p_parameter );
+
+/** !
+ * Test if two envelopes overlap
+ *
+ * @param p_a the first envelope
+ * @param p_b the second envelope
+ *
+ * @return true if the envelopes overlap, else false
+ */
+static bool geometry_envelope_overlaps ( const geometry_envelope *p_a, const geometry_envelope *p_b );
+
+/** !
+ * Compute the distance between two envelopes. This is a lower bound on
+ * the distance between any geometry they contain.
+ *
+ * @param p_a the first envelope
+ * @param p_b the second envelope
+ *
+ * @return the distance
+ */
+static double geometry_envelope_distance ( const geometry_envelope *p_a, const geometry_envelope *p_b );
+
+/** !
+ * Visit a node of a k nearest query, nearest children first
+ *
+ * @param p_rtree the R-tree
+ * @param node    the index of the node
+ * @param p_state the query
+ *
+ * @return void
+ */
+static void geometry_rtree_nearest_visit ( geometry_rtree *p_rtree, size_t node, geometry_rtree_nearest_state *p_state );
+
+// Function definitions
+int geometry_rtree_construct ( geometry_rtree **pp_rtree, geometry *p_geometries, size_t quantity )
+{
+
+    // Argument check
+    if ( pp_rtree     == (void *) 0 ) goto no_rtree;
+    if ( p_geometries == (void *) 0 ) goto no_geometries;
+
+    // Initialized data
+    geometry_rtree *p_rtree       = GEOMETRY_REALLOC(0, sizeof(geometry_rtree));
+    size_t          items         = 0,
+                    node_quantity = 0,
+                    start         = 0;
+    void           *p_block       = (void *) 0;
+
+    // Error check
+    if ( p_rtree == (void *) 0 ) goto no_mem;
+
+    // Count the nodes of each level
+    for (size_t level_quantity = quantity; level_quantity > 1 || node_quantity == 0; )
+    {
+
+        // One parent per group of children
+        level_quantity  = ( level_quantity + GEOMETRY_RTREE_FANOUT - 1 ) / GEOMETRY_RTREE_FANOUT,
+        node_quantity  += level_quantity;
+
+        // Empty tree
+        if ( level_quantity == 0 ) break;
+    }
+
+    // Allocate the nodes and the items in one block, with room to align
+    // the nodes to a cache line
+    p_block = GEOMETRY_REALLOC(0, 63 + sizeof(geometry_rtree_node) * node_quantity + sizeof(geometry_rtree_item) * quantity);
+
+    // Error check
+    if ( p_block == (void *) 0 ) goto no_mem;
+
+    // Store the tree
+    *p_rtree = (geometry_rtree)
+    {
+        .quantity      = 0,
+        .node_quantity = 0,
+        .p_geometries  = p_geometries,
+        .p_nodes       = (geometry_rtree_node *) ( ( (uintptr_t) p_block + 63 ) & ~(uintptr_t) 63 ),
+        .p_block       = p_block
+    };
+    p_rtree->p_items = (geometry_rtree_item *) &p_rtree->p_nodes[node_quantity];
+
+    // Store the envelope of each geometry
+    if ( geometry_parallel_for(quantity, GEOMETRY_RTREE_GRAIN, geometry_rtree_envelopes, p_rtree) == 0 ) goto failed_to_compute_envelope;
+
+    // Keep the items of the geometry that are not empty
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        geometry_envelope *p_envelope = &p_rtree->p_items[i].envelope;
+
+        // Empty geometry can not be found by any query
+        if ( !( p_envelope->x_min <= p_envelope->x_max && p_envelope->y_min <= p_envelope->y_max ) ) continue;
+
+        // Store the item
+        p_rtree->p_items[items++] = p_rtree->p_items[i];
+    }
+
+    // Store the quantity of items
+    p_rtree->quantity = items;
+
+    // Empty tree
+    if ( items == 0 ) goto done;
+
+    // Pack the items into leaves
+    geometry_rtree_tile(p_rtree->p_items, items, sizeof(geometry_rtree_item));
+    for (size_t i = 0; i < items; i += GEOMETRY_RTREE_FANOUT)
+    {
+
+        // Initialized data
+        geometry_rtree_node *p_node = &p_rtree->p_nodes[p_rtree->node_quantity++];
+        size_t               count  = ( items - i < GEOMETRY_RTREE_FANOUT ) ? items - i : GEOMETRY_RTREE_FANOUT;
+
+        // Store the leaf
+        *p_node = (geometry_rtree_node) { .envelope = p_rtree->p_items[i].envelope, .first = i, .quantity = count, .level = 0 };
+
+        // Grow the envelope around each item
+        for (size_t j = i + 1; j < i + count; j++)
+            p_node->envelope.x_min = fmin(p_node->envelope.x_min, p_rtree->p_items[j].envelope.x_min),
+            p_node->envelope.y_min = fmin(p_node->envelope.y_min, p_rtree->p_items[j].envelope.y_min),
+            p_node->envelope.x_max = fmax(p_node->envelope.x_max, p_rtree->p_items[j].envelope.x_max),
+            p_node->envelope.y_max = fmax(p_node->envelope.y_max, p_rtree->p_items[j].envelope.y_max);
+    }
+
+    // Pack each level into the level above it, until one root remains. The
+    // children of a level are ordered before their parents are built, so
+    // each parent covers a contiguous run of children.
+    for (size_t level = 1, end = p_rtree->node_quantity; end - start > 1; level++, start = end, end = p_rtree->node_quantity)
+    {
+
+        // Order the children
+        geometry_rtree_tile(&p_rtree->p_nodes[start], end - start, sizeof(geometry_rtree_node));
+
+        // Build the parents
+        for (size_t i = start; i < end; i += GEOMETRY_RTREE_FANOUT)
+        {
+
+            // Initialized data
+            geometry_rtree_node *p_node = &p_rtree->p_nodes[p_rtree->node_quantity++];
+            size_t               count  = ( end - i < GEOMETRY_RTREE_FANOUT ) ? end - i : GEOMETRY_RTREE_FANOUT;
+
+            // Store the parent
+            *p_node = (geometry_rtree_node) { .envelope = p_rtree->p_nodes[i].envelope, .first = i, .quantity = count, .level = level };
+
+            // Grow the envelope around each child
+            for (size_t j = i + 1; j < i + count; j++)
+                p_node->envelope.x_min = fmin(p_node->envelope.x_min, p_rtree->p_nodes[j].envelope.x_min),
+                p_node->envelope.y_min = fmin(p_node->envelope.y_min, p_rtree->p_nodes[j].envelope.y_min),
+                p_node->envelope.x_max = fmax(p_node->envelope.x_max, p_rtree->p_nodes[j].envelope.x_max),
+                p_node->envelope.y_max = fmax(p_node->envelope.y_max, p_rtree->p_nodes[j].envelope.y_max);
+        }
+    }
+
+    done:
+
+    // Return a pointer to the caller
+    *pp_rtree = p_rtree;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_rtree:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_rtree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_geometries:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometries\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            failed_to_compute_envelope:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to compute envelope in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the tree
+                p_block = GEOMETRY_REALLOC(p_block, 0);
+                p_rtree = GEOMETRY_REALLOC(p_rtree, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the tree
+                if ( p_rtree ) p_rtree = GEOMETRY_REALLOC(p_rtree, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_rtree_query_envelope ( geometry_rtree *p_rtree, geometry_envelope *p_envelope, size_t *p_results, size_t capacity, size_t *p_quantity )
+{
+
+    // Argument check
+    if ( p_rtree    == (void *) 0 ) goto no_rtree;
+    if ( p_envelope == (void *) 0 ) goto no_envelope;
+    if ( p_results  == (void *) 0 && capacity ) goto no_results;
+    if ( p_quantity == (void *) 0 ) goto no_quantity;
+
+    // Initialized data
+    size_t _stack[GEOMETRY_RTREE_STACK_SIZE];
+    size_t top      = 0,
+           quantity = 0;
+
+    // Start at the root
+    if ( p_rtree->node_quantity && geometry_envelope_overlaps(&p_rtree->p_nodes[p_rtree->node_quantity - 1].envelope, p_envelope) )
+        _stack[top++] = p_rtree->node_quantity - 1;
+
+    // Walk every overlapping node
+    while ( top )
+    {
+
+        // Initialized data
+        geometry_rtree_node *p_node = &p_rtree->p_nodes[_stack[--top]];
+
+        // Leaf
+        if ( p_node->level == 0 )
+        {
+
+            // Store each overlapping item
+            for (size_t i = p_node->first; i < p_node->first + p_node->quantity; i++)
+            {
+
+                // Skip items outside of the envelope
+                if ( geometry_envelope_overlaps(&p_rtree->p_items[i].envelope, p_envelope) == false ) continue;
+
+                // Store the result
+                if ( quantity < capacity ) p_results[quantity] = p_rtree->p_items[i].index;
+
+                // Count the result
+                quantity++;
+            }
+
+            // Next
+            continue;
+        }
+
+        // Descend into each overlapping child
+        for (size_t i = p_node->first; i < p_node->first + p_node->quantity; i++)
+            if ( geometry_envelope_overlaps(&p_rtree->p_nodes[i].envelope, p_envelope) )
+                _stack[top++] = i;
+    }
+
+    // Return the quantity to the caller
+    *p_quantity = quantity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_rtree:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_rtree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_envelope:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_envelope\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_quantity:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_rtree_query_intersects ( geometry_rtree *p_rtree, geometry *p_geometry, size_t *p_results, size_t capacity, size_t *p_quantity )
+{
+
+    // Argument check
+    if ( p_rtree    == (void *) 0 ) goto no_rtree;
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+
+    // Initialized data
+    geometry_envelope _envelope = { 0 };
+
+    // Compute the envelope of the geometry
+    if ( geometry_envelope_get(p_geometry, &_envelope) == 0 ) goto failed_to_compute_envelope;
+
+    // Success
+    return geometry_rtree_query_envelope(p_rtree, &_envelope, p_results, capacity, p_quantity);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_rtree:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_rtree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            failed_to_compute_envelope:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to compute envelope in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_rtree_nearest ( geometry_rtree *p_rtree, geometry *p_geometry, size_t k, size_t *p_results, double *p_distances, size_t *p_quantity )
+{
+
+    // Argument check
+    if ( p_rtree     == (void *) 0 ) goto no_rtree;
+    if ( p_geometry  == (void *) 0 ) goto no_geometry;
+    if ( p_results   == (void *) 0 ) goto no_results;
+    if ( p_distances == (void *) 0 ) goto no_distances;
+    if ( p_quantity  == (void *) 0 ) goto no_quantity;
+
+    // Initialized data
+    geometry_rtree_nearest_state _state =
+    {
+        .p_geometry  = p_geometry,
+        .k           = k,
+        .quantity    = 0,
+        .p_results   = p_results,
+        .p_distances = p_distances
+    };
+
+    // Compute the envelope of the geometry
+    if ( geometry_envelope_get(p_geometry, &_state.envelope) == 0 ) goto failed_to_compute_envelope;
+
+    // Search from the root
+    if ( k && p_rtree->node_quantity ) geometry_rtree_nearest_visit(p_rtree, p_rtree->node_quantity - 1, &_state);
+
+    // Return the quantity to the caller
+    *p_quantity = _state.quantity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_rtree:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_rtree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_distances:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_distances\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_quantity:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            failed_to_compute_envelope:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to compute envelope in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_envelope_compare_x ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_envelope *p_ea = p_a,
+                            *p_eb = p_b;
+    double                   a    = p_ea->x_min + p_ea->x_max,
+                             b    = p_eb->x_min + p_eb->x_max;
+
+    // Success
+    return ( a > b ) - ( a < b );
+}
+
+static int geometry_envelope_compare_y ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_envelope *p_ea = p_a,
+                            *p_eb = p_b;
+    double                   a    = p_ea->y_min + p_ea->y_max,
+                             b    = p_eb->y_min + p_eb->y_max;
+
+    // Success
+    return ( a > b ) - ( a < b );
+}
+
+static void geometry_rtree_tile ( void *p_elements, size_t quantity, size_t size )
+{
+
+    // Initialized data
+    size_t leaves      = ( quantity + GEOMETRY_RTREE_FANOUT - 1 ) / GEOMETRY_RTREE_FANOUT,
+           slices      = (size_t) ceil(sqrt((double) leaves)),
+           slice_size  = slices * GEOMETRY_RTREE_FANOUT;
+    geometry_rtree_tile_state _tile = { .p_elements = p_elements, .quantity = quantity, .size = size, .slice_size = slice_size };
+
+    // Sort by x
+    qsort(p_elements, quantity, size, geometry_envelope_compare_x);
+
+    // Sort each slice by y
+    geometry_parallel_for(( quantity + slice_size - 1 ) / slice_size, GEOMETRY_RTREE_GRAIN / slice_size + 1, geometry_rtree_tile_slices, &_tile);
+
+    // Done
+    return;
+}
+
+static int geometry_rtree_tile_slices ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_rtree_tile_state *p_tile = p_parameter;
+
+    // Unused
+    (void) chunk;
+
+    // Sort each slice by y
+    for (size_t i = first * p_tile->slice_size; i < p_tile->quantity && i < last * p_tile->slice_size; i += p_tile->slice_size)
+        qsort(p_tile->p_elements + i * p_tile->size, ( p_tile->quantity - i < p_tile->slice_size ) ? p_tile->quantity - i : p_tile->slice_size, p_tile->size, geometry_envelope_compare_y);
+
+    // Success
+    return 1;
+}
+
+static int geometry_rtree_envelopes ( size_t chunk, size_t first, size_t last, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_rtree *p_rtree = p_parameter;
+
+    // Unused
+    (void) chunk;
+
+    // Compute the envelope of each geometry
+    for (size_t i = first; i < last; i++)
+    {
+
+        // Store the index
+        p_rtree->p_items[i].index = i;
+
+        // Compute the envelope
+        if ( geometry_envelope_get(&p_rtree->p_geometries[i], &p_rtree->p_items[i].envelope) == 0 ) return 0;
+    }
+
+    // Success
+    return 1;
+}
+
+static bool geometry_envelope_overlaps ( const geometry_envelope *p_a, const geometry_envelope *p_b )
+{
+
+    // Success
+    return p_a->x_min <= p_b->x_max && p_b->x_min <= p_a->x_max &&
+           p_a->y_min <= p_b->y_max && p_b->y_min <= p_a->y_max;
+}
+
+static double geometry_envelope_distance ( const geometry_envelope *p_a, const geometry_envelope *p_b )
+{
+
+    // Initialized data
+    double dx = fmax(0, fmax(p_a->x_min - p_b->x_max, p_b->x_min - p_a->x_max)),
+           dy = fmax(0, fmax(p_a->y_min - p_b->y_max, p_b->y_min - p_a->y_max));
+
+    // Success
+    return sqrt(dx * dx + dy * dy);
+}
+
+static void geometry_rtree_nearest_visit ( geometry_rtree *p_rtree, size_t node, geometry_rtree_nearest_state *p_state )
+{
+
+    // Initialized data
+    geometry_rtree_node *p_node = &p_rtree->p_nodes[node];
+    size_t               _order[GEOMETRY_RTREE_FANOUT];
+    double               _bound[GEOMETRY_RTREE_FANOUT];
+
+    // Leaf
+    if ( p_node->level == 0 )
+    {
+
+        // Refine each item
+        for (size_t i = p_node->first; i < p_node->first + p_node->quantity; i++)
+        {
+
+            // Initialized data
+            geometry_rtree_item *p_item   = &p_rtree->p_items[i];
+            geometry            *p_other  = &p_rtree->p_geometries[p_item->index];
+            double               distance = geometry_envelope_distance(&p_item->envelope, &p_state->envelope);
+            size_t               j        = 0;
+
+            // Prune by envelope
+            if ( p_state->quantity == p_state->k && distance >= p_state->p_distances[p_state->k - 1] ) continue;
+
+            // Refine with the exact distance, and skip pairs it does not support
+            if ( geometry_distance(p_state->p_geometry, p_other, &distance) == 0 ) continue;
+
+            // Prune by distance
+            if ( p_state->quantity == p_state->k && distance >= p_state->p_distances[p_state->k - 1] ) continue;
+
+            // Insert the item, keeping the results sorted
+            j = ( p_state->quantity < p_state->k ) ? p_state->quantity++ : p_state->k - 1;
+            for (; j > 0 && p_state->p_distances[j - 1] > distance; j--)
+                p_state->p_distances[j] = p_state->p_distances[j - 1],
+                p_state->p_results[j]   = p_state->p_results[j - 1];
+
+            // Store the item
+            p_state->p_distances[j] = distance,
+            p_state->p_results[j]   = p_item->index;
+        }
+
+        // Done
+        return;
+    }
+
+    // Order the children by the distance to their envelopes
+    for (size_t i = 0; i < p_node->quantity; i++)
+    {
+
+        // Initialized data
+        double bound = geometry_envelope_distance(&p_rtree->p_nodes[p_node->first + i].envelope, &p_state->envelope);
+        size_t j     = i;
+
+        // Insert the child
+        for (; j > 0 && _bound[j - 1] > bound; j--)
+            _bound[j] = _bound[j - 1],
+            _order[j] = _order[j - 1];
+
+        // Store the child
+        _bound[j] = bound,
+        _order[j] = p_node->first + i;
+    }
+
+    // Visit the children, nearest first, until the rest are too far
+    for (size_t i = 0; i < p_node->quantity; i++)
+    {
+
+        // Prune the remaining children
+        if ( p_state->quantity == p_state->k && _bound[i] >= p_state->p_distances[p_state->k - 1] ) break;
+
+        // Visit the child
+        geometry_rtree_nearest_visit(p_rtree, _order[i], p_state);
+    }
+
+    // Done
+    return;
+}
+
+int geometry_rtree_destroy ( geometry_rtree **pp_rtree )
+{
+
+    // Argument check
+    if ( pp_rtree == (void *) 0 ) goto no_rtree;
+
+    // Initialized data
+    geometry_rtree *p_rtree = *pp_rtree;
+
+    // Error check
+    if ( p_rtree == (void *) 0 ) goto pointer_to_null_pointer;
+
+    // No more pointer for caller
+    *pp_rtree = (void *) 0;
+
+    // Free the nodes and items
+    p_rtree->p_block = GEOMETRY_REALLOC(p_rtree->p_block, 0);
+
+    // Free the tree
+    p_rtree = GEOMETRY_REALLOC(p_rtree, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_rtree:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_rtree\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            pointer_to_null_pointer:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"pp_rtree\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,1038 @@
+/** !
+ * Geometry binary serialization
+ *
+ * @file serialize.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <string.h>
+
+// geometry
+#include <geometry/serialize.h>
+#include <geometry/arena.h>
+
+// Structure declarations
+struct geometry_wkb_reader_s;
+
+// Type definitions
+typedef struct geometry_wkb_reader_s geometry_wkb_reader;
+
+// Structure definitions
+struct geometry_wkb_reader_s
+{
+    const unsigned char *p_cursor,
+                        *p_end;
+    bool                 swap;
+};
+
+// Forward declarations
+/** !
+ * Test the byte order of the host
+ *
+ * @param void
+ *
+ * @return true if the host is little endian, else false
+ */
+static bool geometry_wkb_host_is_little_endian ( void );
+
+/** !
+ * Write a WKB header, and a count if the type has one
+ *
+ * @param p_cursor the write cursor
+ * @param type     the WKB type
+ *
+ * @return the write cursor after the header
+ */
+static unsigned char *geometry_wkb_write_header ( unsigned char *p_cursor, uint32_t type );
+
+/** !
+ * Write a little endian 32 bit unsigned integer
+ *
+ * @param p_cursor the write cursor
+ * @param value    the value
+ *
+ * @return the write cursor after the value
+ */
+static unsigned char *geometry_wkb_write_u32 ( unsigned char *p_cursor, uint32_t value );
+
+/** !
+ * Write an array of points as little endian doubles
+ *
+ * @param p_cursor the write cursor
+ * @param p_points the points
+ * @param quantity the quantity of points
+ *
+ * @return the write cursor after the points
+ */
+static unsigned char *geometry_wkb_write_points ( unsigned char *p_cursor, const geometry_point *p_points, size_t quantity );
+
+/** !
+ * Read a WKB header. The byte order of the reader is updated to match.
+ *
+ * @param p_reader the reader
+ * @param p_type   return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_wkb_read_header ( geometry_wkb_reader *p_reader, uint32_t *p_type );
+
+/** !
+ * Read a 32 bit unsigned integer
+ *
+ * @param p_reader the reader
+ * @param p_value  return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_wkb_read_u32 ( geometry_wkb_reader *p_reader, uint32_t *p_value );
+
+/** !
+ * Read an array of points. When the byte order matches the host, this is a memcpy.
+ *
+ * @param p_reader the reader
+ * @param p_points return
+ * @param quantity the quantity of points
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_wkb_read_points ( geometry_wkb_reader *p_reader, geometry_point *p_points, size_t quantity );
+
+// Function definitions
+static bool geometry_wkb_host_is_little_endian ( void )
+{
+
+    // Initialized data
+    const uint16_t one = 1;
+
+    // Success
+    return *(const unsigned char *) &one == 1;
+}
+
+static unsigned char *geometry_wkb_write_u32 ( unsigned char *p_cursor, uint32_t value )
+{
+
+    // Store each byte, least significant first
+    p_cursor[0] = (unsigned char) ( value       ),
+    p_cursor[1] = (unsigned char) ( value >>  8 ),
+    p_cursor[2] = (unsigned char) ( value >> 16 ),
+    p_cursor[3] = (unsigned char) ( value >> 24 );
+
+    // Success
+    return p_cursor + 4;
+}
+
+static unsigned char *geometry_wkb_write_header ( unsigned char *p_cursor, uint32_t type )
+{
+
+    // Little endian
+    *p_cursor++ = 1;
+
+    // Success
+    return geometry_wkb_write_u32(p_cursor, type);
+}
+
+static unsigned char *geometry_wkb_write_points ( unsigned char *p_cursor, const geometry_point *p_points, size_t quantity )
+{
+
+    // Fast path
+    if ( geometry_wkb_host_is_little_endian() )
+
+        // Copy the points
+        memcpy(p_cursor, p_points, sizeof(geometry_point) * quantity);
+
+    // Big endian host
+    else
+    {
+
+        // Iterate over each coordinate
+        for (size_t i = 0; i < quantity * 2; i++)
+        {
+
+            // Initialized data
+            uint64_t bits = 0;
+
+            // Store the bits of the coordinate
+            memcpy(&bits, &((const double *) p_points)[i], sizeof(double));
+
+            // Store each byte, least significant first
+            for (size_t j = 0; j < 8; j++)
+                p_cursor[i * 8 + j] = (unsigned char) ( bits >> ( 8 * j ) );
+        }
+    }
+
+    // Success
+    return p_cursor + sizeof(geometry_point) * quantity;
+}
+
+static int geometry_wkb_read_u32 ( geometry_wkb_reader *p_reader, uint32_t *p_value )
+{
+
+    // Initialized data
+    const unsigned char *p = p_reader->p_cursor;
+
+    // Bounds check
+    if ( p_reader->p_end - p < 4 ) return 0;
+
+    // Store the value
+    *p_value = ( p_reader->swap == geometry_wkb_host_is_little_endian() )
+             ? ( (uint32_t) p[0] << 24 ) | ( (uint32_t) p[1] << 16 ) | ( (uint32_t) p[2] << 8 ) | (uint32_t) p[3]
+             : ( (uint32_t) p[3] << 24 ) | ( (uint32_t) p[2] << 16 ) | ( (uint32_t) p[1] << 8 ) | (uint32_t) p[0];
+
+    // Advance the cursor
+    p_reader->p_cursor += 4;
+
+    // Success
+    return 1;
+}
+
+static int geometry_wkb_read_header ( geometry_wkb_reader *p_reader, uint32_t *p_type )
+{
+
+    // Bounds check
+    if ( p_reader->p_end - p_reader->p_cursor < 5 ) return 0;
+
+    // Byte order check
+    if ( *p_reader->p_cursor > 1 ) return 0;
+
+    // Store the byte order. 0 is big endian, 1 is little endian.
+    p_reader->swap = ( *p_reader->p_cursor == 1 ) != geometry_wkb_host_is_little_endian();
+
+    // Advance the cursor
+    p_reader->p_cursor++;
+
+    // Success
+    return geometry_wkb_read_u32(p_reader, p_type);
+}
+
+static int geometry_wkb_read_points ( geometry_wkb_reader *p_reader, geometry_point *p_points, size_t quantity )
+{
+
+    // Bounds check
+    if ( (size_t) ( p_reader->p_end - p_reader->p_cursor ) / sizeof(geometry_point) < quantity ) return 0;
+
+    // Copy the points
+    memcpy(p_points, p_reader->p_cursor, sizeof(geometry_point) * quantity);
+
+    // Swap the byte order of each coordinate
+    if ( p_reader->swap )
+    {
+
+        // Iterate over each coordinate
+        for (size_t i = 0; i < quantity * 2; i++)
+        {
+
+            // Initialized data
+            unsigned char *p = (unsigned char *) &((double *) p_points)[i];
+
+            // Reverse the bytes
+            for (size_t j = 0; j < 4; j++)
+            {
+
+                // Initialized data
+                unsigned char t = p[j];
+
+                // Swap
+                p[j]     = p[7 - j],
+                p[7 - j] = t;
+            }
+        }
+    }
+
+    // Advance the cursor
+    p_reader->p_cursor += sizeof(geometry_point) * quantity;
+
+    // Success
+    return 1;
+}
+
+int geometry_serialize_size ( geometry *p_geometry, size_t *p_size )
+{
+
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_size     == (void *) 0 ) goto no_size;
+
+    // Initialized data
+    size_t size = 0;
+
+    // Strategy
+    switch ( p_geometry->type )
+    {
+        case GEOMETRY_POINT:
+
+            // Header, x, y
+            size = 5 + 16;
+
+            // Done
+            break;
+
+        case GEOMETRY_POINT_LIST:
+
+            // Header, count, points
+            size = 9 + 21 * p_geometry->point_list.quantity;
+
+            // Done
+            break;
+
+        case GEOMETRY_LINE:
+
+            // Header, count, 2 points
+            size = 9 + 32;
+
+            // Done
+            break;
+
+        case GEOMETRY_LINE_LIST:
+
+            // Header, count, line strings
+            size = 9 + 41 * p_geometry->line_list.quantity;
+
+            // Done
+            break;
+
+        case GEOMETRY_TRIANGLE:
+
+            // Header, ring count, point count, 3 points and the closing point
+            size = 9 + 4 + 16 * 4;
+
+            // Done
+            break;
+
+        case GEOMETRY_POLYGON:
+
+            // Header, ring count, point count, closed ring
+            size = 9 + ( ( p_geometry->polygon.quantity ) ? 4 + 16 * ( p_geometry->polygon.quantity + 1 ) : 0 );
+
+            // Done
+            break;
+
+        case GEOMETRY_POLYGON_LIST:
+
+            // Header, count, polygons
+            size = 9 + 29 * p_geometry->polygon_list.quantity + 16 * p_geometry->polygon_list.vertex_quantity;
+
+            // Done
+            break;
+
+        default:
+
+            // Error
+            goto unsupported_type;
+    }
+
+    // Return the size to the caller
+    *p_size = size;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_size:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_size\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            unsupported_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_geometry\" is of a type with no WKB encoding in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_serialize ( geometry *p_geometry, void *p_buffer )
+{
+
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_buffer   == (void *) 0 ) goto no_buffer;
+
+    // Initialized data
+    unsigned char *p = p_buffer;
+
+    // Strategy
+    switch ( p_geometry->type )
+    {
+        case GEOMETRY_POINT:
+
+            // Write the point
+            p = geometry_wkb_write_header(p, GEOMETRY_WKB_POINT);
+            p = geometry_wkb_write_points(p, &p_geometry->point, 1);
+
+            // Done
+            break;
+
+        case GEOMETRY_POINT_LIST:
+
+            // Write the header
+            p = geometry_wkb_write_header(p, GEOMETRY_WKB_MULTIPOINT);
+            p = geometry_wkb_write_u32(p, (uint32_t) p_geometry->point_list.quantity);
+
+            // Write each point
+            for (size_t i = 0; i < p_geometry->point_list.quantity; i++)
+                p = geometry_wkb_write_header(p, GEOMETRY_WKB_POINT),
+                p = geometry_wkb_write_points(p, &p_geometry->point_list.p_points[i], 1);
+
+            // Done
+            break;
+
+        case GEOMETRY_LINE:
+
+            // Write the line
+            p = geometry_wkb_write_header(p, GEOMETRY_WKB_LINESTRING);
+            p = geometry_wkb_write_u32(p, 2);
+            p = geometry_wkb_write_points(p, (const geometry_point *) &p_geometry->line, 2);
+
+            // Done
+            break;
+
+        case GEOMETRY_LINE_LIST:
+
+            // Write the header
+            p = geometry_wkb_write_header(p, GEOMETRY_WKB_MULTILINESTRING);
+            p = geometry_wkb_write_u32(p, (uint32_t) p_geometry->line_list.quantity);
+
+            // Write each line
+            for (size_t i = 0; i < p_geometry->line_list.quantity; i++)
+                p = geometry_wkb_write_header(p, GEOMETRY_WKB_LINESTRING),
+                p = geometry_wkb_write_u32(p, 2),
+                p = geometry_wkb_write_points(p, (const geometry_point *) &p_geometry->line_list.p_lines[i], 2);
+
+            // Done
+            break;
+
+        case GEOMETRY_TRIANGLE:
+
+            // Write the header
+            p = geometry_wkb_write_header(p, GEOMETRY_WKB_TRIANGLE);
+            p = geometry_wkb_write_u32(p, 1);
+
+            // Write the ring, closing it with the first vertex
+            p = geometry_wkb_write_u32(p, 4);
+            p = geometry_wkb_write_points(p, (const geometry_point *) &p_geometry->triangle, 3);
+            p = geometry_wkb_write_points(p, &p_geometry->triangle.a, 1);
+
+            // Done
+            break;
+
+        case GEOMETRY_POLYGON:
+
+            // Write the header
+            p = geometry_wkb_write_header(p, GEOMETRY_WKB_POLYGON);
+            p = geometry_wkb_write_u32(p, ( p_geometry->polygon.quantity ) ? 1 : 0);
+
+            // Write the ring, closing it with the first vertex
+            if ( p_geometry->polygon.quantity )
+                p = geometry_wkb_write_u32(p, (uint32_t) p_geometry->polygon.quantity + 1),
+                p = geometry_wkb_write_points(p, p_geometry->polygon.p_verticies, p_geometry->polygon.quantity),
+                p = geometry_wkb_write_points(p, p_geometry->polygon.p_verticies, 1);
+
+            // Done
+            break;
+
+        case GEOMETRY_POLYGON_LIST:
+        {
+
+            // Initialized data
+            const size_t         *p_offsets   = p_geometry->polygon_list.p_offsets;
+            const geometry_point *p_verticies = p_geometry->polygon_list.p_verticies;
+
+            // Write the header
+            p = geometry_wkb_write_header(p, GEOMETRY_WKB_MULTIPOLYGON);
+            p = geometry_wkb_write_u32(p, (uint32_t) p_geometry->polygon_list.quantity);
+
+            // Write each polygon, closing each ring with its first vertex
+            for (size_t i = 0; i < p_geometry->polygon_list.quantity; i++)
+                p = geometry_wkb_write_header(p, GEOMETRY_WKB_POLYGON),
+                p = geometry_wkb_write_u32(p, 1),
+                p = geometry_wkb_write_u32(p, (uint32_t) ( p_offsets[i + 1] - p_offsets[i] + 1 )),
+                p = geometry_wkb_write_points(p, &p_verticies[p_offsets[i]], p_offsets[i + 1] - p_offsets[i]),
+                p = geometry_wkb_write_points(p, &p_verticies[p_offsets[i]], 1);
+
+            // Done
+            break;
+        }
+
+        default:
+
+            // Error
+            goto unsupported_type;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_buffer:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_buffer\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            unsupported_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_geometry\" is of a type with no WKB encoding in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_deserialize ( geometry *p_geometry, const void *p_buffer, size_t size, size_t *p_read, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_buffer   == (void *) 0 ) goto no_buffer;
+
+    // Initialized data
+    geometry_wkb_reader _reader = { .p_cursor = p_buffer, .p_end = (const unsigned char *) p_buffer + size, .swap = false };
+    geometry            _result = { 0 };
+    uint32_t            type    = 0,
+                        count   = 0;
+    void               *p_data  = (void *) 0;
+
+    // Read the header
+    if ( geometry_wkb_read_header(&_reader, &type) == 0 ) goto truncated;
+
+    // Strategy
+    switch ( type )
+    {
+        case GEOMETRY_WKB_POINT:
+
+            // Store the type
+            _result.type = GEOMETRY_POINT;
+
+            // Read the point
+            if ( geometry_wkb_read_points(&_reader, &_result.point, 1) == 0 ) goto truncated;
+
+            // Done
+            break;
+
+        case GEOMETRY_WKB_LINESTRING:
+        {
+
+            // Initialized data
+            geometry_point _previous = { 0 };
+
+            // Read the count
+            if ( geometry_wkb_read_u32(&_reader, &count) == 0 ) goto truncated;
+
+            // Error check
+            if ( count < 2 ) goto not_a_line;
+
+            // Read the first point
+            if ( geometry_wkb_read_points(&_reader, &_previous, 1) == 0 ) goto truncated;
+
+            // A single segment is a line
+            if ( count == 2 )
+            {
+
+                // Initialized data
+                geometry_point _next = { 0 };
+
+                // Read the second point
+                if ( geometry_wkb_read_points(&_reader, &_next, 1) == 0 ) goto truncated;
+
+                // Store the line
+                _result.type = GEOMETRY_LINE,
+                _result.line = (geometry_line) { _previous.x, _previous.y, _next.x, _next.y };
+
+                // Done
+                break;
+            }
+
+            // Bounds check
+            if ( (size_t) ( _reader.p_end - _reader.p_cursor ) / sizeof(geometry_point) < count - 1 ) goto truncated;
+
+            // Allocate the segments
+            p_data = geometry_allocate(p_arena, sizeof(geometry_line) * ( count - 1 ));
+
+            // Error check
+            if ( p_data == (void *) 0 ) goto no_mem;
+
+            // Store the line list
+            _result.type      = GEOMETRY_LINE_LIST,
+            _result.line_list = (geometry_line_list) { .quantity = count - 1, .p_lines = p_data };
+
+            // Read each segment
+            for (size_t i = 0; i < count - 1; i++)
+            {
+
+                // Initialized data
+                geometry_point _next = { 0 };
+
+                // Read the next point
+                geometry_wkb_read_points(&_reader, &_next, 1);
+
+                // Store the segment
+                _result.line_list.p_lines[i] = (geometry_line) { _previous.x, _previous.y, _next.x, _next.y };
+
+                // Advance
+                _previous = _next;
+            }
+
+            // Done
+            break;
+        }
+
+        case GEOMETRY_WKB_POLYGON:
+        {
+
+            // Initialized data
+            uint32_t rings = 0;
+
+            // Read the ring count
+            if ( geometry_wkb_read_u32(&_reader, &rings) == 0 ) goto truncated;
+
+            // Store the type
+            _result.type = GEOMETRY_POLYGON;
+
+            // Empty polygon
+            if ( rings == 0 ) break;
+
+            // Holes are not representable
+            if ( rings != 1 ) goto unsupported_type;
+
+            // Read the count
+            if ( geometry_wkb_read_u32(&_reader, &count) == 0 ) goto truncated;
+
+            // Bounds check
+            if ( (size_t) ( _reader.p_end - _reader.p_cursor ) / sizeof(geometry_point) < count ) goto truncated;
+
+            // Allocate the verticies
+            p_data = geometry_allocate(p_arena, sizeof(geometry_point) * ( count ? count : 1 ));
+
+            // Error check
+            if ( p_data == (void *) 0 ) goto no_mem;
+
+            // Read the ring
+            geometry_wkb_read_points(&_reader, p_data, count);
+
+            // Drop the closing vertex
+            if ( count > 1 && memcmp(p_data, &((geometry_point *) p_data)[count - 1], sizeof(geometry_point)) == 0 ) count--;
+
+            // Error check
+            if ( count < 3 ) goto not_a_polygon;
+
+            // Store the polygon
+            _result.polygon = (geometry_polygon) { .quantity = count, .p_verticies = p_data };
+
+            // Done
+            break;
+        }
+
+        case GEOMETRY_WKB_TRIANGLE:
+        {
+
+            // Initialized data
+            uint32_t       rings         = 0;
+            geometry_point _verticies[4] = { 0 };
+
+            // Read the ring count
+            if ( geometry_wkb_read_u32(&_reader, &rings) == 0 ) goto truncated;
+
+            // An empty triangle is not representable
+            if ( rings != 1 ) goto unsupported_type;
+
+            // Read the count
+            if ( geometry_wkb_read_u32(&_reader, &count) == 0 ) goto truncated;
+
+            // Error check
+            if ( count < 3 || count > 4 ) goto not_a_triangle;
+
+            // Read the ring
+            if ( geometry_wkb_read_points(&_reader, _verticies, count) == 0 ) goto truncated;
+
+            // The fourth vertex must close the ring
+            if ( count == 4 && memcmp(&_verticies[0], &_verticies[3], sizeof(geometry_point)) != 0 ) goto not_a_triangle;
+
+            // Store the triangle
+            _result.type     = GEOMETRY_TRIANGLE,
+            _result.triangle = (geometry_triangle) { _verticies[0], _verticies[1], _verticies[2] };
+
+            // Done
+            break;
+        }
+
+        case GEOMETRY_WKB_MULTIPOINT:
+
+            // Read the count
+            if ( geometry_wkb_read_u32(&_reader, &count) == 0 ) goto truncated;
+
+            // Bounds check
+            if ( (size_t) ( _reader.p_end - _reader.p_cursor ) / 21 < count ) goto truncated;
+
+            // Allocate the points
+            p_data = geometry_allocate(p_arena, sizeof(geometry_point) * ( count ? count : 1 ));
+
+            // Error check
+            if ( p_data == (void *) 0 ) goto no_mem;
+
+            // Store the point list
+            _result.type       = GEOMETRY_POINT_LIST,
+            _result.point_list = (geometry_point_list) { .quantity = count, .p_points = p_data };
+
+            // Read each point
+            for (size_t i = 0; i < count; i++)
+            {
+
+                // Initialized data
+                uint32_t i_type = 0;
+
+                // Read the header
+                if ( geometry_wkb_read_header(&_reader, &i_type) == 0 ) goto truncated;
+
+                // Type check
+                if ( i_type != GEOMETRY_WKB_POINT ) goto wrong_part_type;
+
+                // Read the point
+                if ( geometry_wkb_read_points(&_reader, &_result.point_list.p_points[i], 1) == 0 ) goto truncated;
+            }
+
+            // Done
+            break;
+
+        case GEOMETRY_WKB_MULTILINESTRING:
+        {
+
+            // Initialized data
+            geometry_wkb_reader _scan     = { 0 };
+            size_t              segments  = 0,
+                                written   = 0;
+
+            // Read the count
+            if ( geometry_wkb_read_u32(&_reader, &count) == 0 ) goto truncated;
+
+            // Count the segments
+            _scan = _reader;
+            for (size_t i = 0; i < count; i++)
+            {
+
+                // Initialized data
+                uint32_t i_type  = 0,
+                         i_count = 0;
+
+                // Read the header
+                if ( geometry_wkb_read_header(&_scan, &i_type) == 0 ) goto truncated;
+
+                // Type check
+                if ( i_type != GEOMETRY_WKB_LINESTRING ) goto wrong_part_type;
+
+                // Read the count
+                if ( geometry_wkb_read_u32(&_scan, &i_count) == 0 ) goto truncated;
+
+                // Error check
+                if ( i_count < 2 ) goto not_a_line;
+
+                // Bounds check
+                if ( (size_t) ( _scan.p_end - _scan.p_cursor ) / sizeof(geometry_point) < i_count ) goto truncated;
+
+                // Skip the points
+                _scan.p_cursor += sizeof(geometry_point) * i_count;
+
+                // Accumulate
+                segments += i_count - 1;
+            }
+
+            // Allocate the segments
+            p_data = geometry_allocate(p_arena, sizeof(geometry_line) * ( segments ? segments : 1 ));
+
+            // Error check
+            if ( p_data == (void *) 0 ) goto no_mem;
+
+            // Store the line list
+            _result.type      = GEOMETRY_LINE_LIST,
+            _result.line_list = (geometry_line_list) { .quantity = segments, .p_lines = p_data };
+
+            // Read each line string
+            for (size_t i = 0; i < count; i++)
+            {
+
+                // Initialized data
+                uint32_t       i_type    = 0,
+                               i_count   = 0;
+                geometry_point _previous = { 0 };
+
+                // Read the header and the count
+                geometry_wkb_read_header(&_reader, &i_type);
+                geometry_wkb_read_u32(&_reader, &i_count);
+
+                // Read the first point
+                geometry_wkb_read_points(&_reader, &_previous, 1);
+
+                // Read each segment
+                for (size_t j = 1; j < i_count; j++)
+                {
+
+                    // Initialized data
+                    geometry_point _next = { 0 };
+
+                    // Read the next point
+                    geometry_wkb_read_points(&_reader, &_next, 1);
+
+                    // Store the segment
+                    _result.line_list.p_lines[written++] = (geometry_line) { _previous.x, _previous.y, _next.x, _next.y };
+
+                    // Advance
+                    _previous = _next;
+                }
+            }
+
+            // Done
+            break;
+        }
+
+        case GEOMETRY_WKB_MULTIPOLYGON:
+        {
+
+            // Initialized data
+            geometry_wkb_reader  _scan       = { 0 };
+            size_t               verticies   = 0;
+            size_t              *p_offsets   = (void *) 0;
+            geometry_point      *p_verticies = (void *) 0;
+
+            // Read the count
+            if ( geometry_wkb_read_u32(&_reader, &count) == 0 ) goto truncated;
+
+            // Count the verticies
+            _scan = _reader;
+            for (size_t i = 0; i < count; i++)
+            {
+
+                // Initialized data
+                uint32_t i_type  = 0,
+                         i_rings = 0,
+                         i_count = 0;
+
+                // Read the header
+                if ( geometry_wkb_read_header(&_scan, &i_type) == 0 ) goto truncated;
+
+                // Type check
+                if ( i_type != GEOMETRY_WKB_POLYGON ) goto wrong_part_type;
+
+                // Read the ring count
+                if ( geometry_wkb_read_u32(&_scan, &i_rings) == 0 ) goto truncated;
+
+                // Holes are not representable
+                if ( i_rings != 1 ) goto unsupported_type;
+
+                // Read the count
+                if ( geometry_wkb_read_u32(&_scan, &i_count) == 0 ) goto truncated;
+
+                // Bounds check
+                if ( (size_t) ( _scan.p_end - _scan.p_cursor ) / sizeof(geometry_point) < i_count ) goto truncated;
+
+                // Skip the points
+                _scan.p_cursor += sizeof(geometry_point) * i_count;
+
+                // Accumulate
+                verticies += i_count;
+            }
+
+            // Allocate the offsets and the verticies in one block
+            p_offsets = geometry_allocate(p_arena, sizeof(size_t) * ( count + 1 ) + sizeof(geometry_point) * verticies);
+
+            // Error check
+            if ( p_offsets == (void *) 0 ) goto no_mem;
+
+            // The verticies follow the offsets
+            p_data      = p_offsets;
+            p_verticies = (geometry_point *) &p_offsets[count + 1];
+
+            // Read each polygon straight into the packed buffer
+            p_offsets[0] = 0;
+            for (size_t i = 0; i < count; i++)
+            {
+
+                // Initialized data
+                uint32_t        i_type   = 0,
+                                i_rings  = 0,
+                                i_count  = 0;
+                geometry_point *p_ring   = &p_verticies[p_offsets[i]];
+
+                // Read the header, ring count, and point count
+                geometry_wkb_read_header(&_reader, &i_type);
+                geometry_wkb_read_u32(&_reader, &i_rings);
+                geometry_wkb_read_u32(&_reader, &i_count);
+
+                // Read the ring
+                geometry_wkb_read_points(&_reader, p_ring, i_count);
+
+                // Drop the closing vertex
+                if ( i_count > 1 && memcmp(p_ring, &p_ring[i_count - 1], sizeof(geometry_point)) == 0 ) i_count--;
+
+                // Error check
+                if ( i_count < 3 ) goto not_a_polygon;
+
+                // Store the end of the ring
+                p_offsets[i + 1] = p_offsets[i] + i_count;
+            }
+
+            // Store the polygon list
+            _result.type         = GEOMETRY_POLYGON_LIST,
+            _result.polygon_list = (geometry_polygon_list)
+            {
+                .quantity        = count,
+                .vertex_quantity = p_offsets[count],
+                .p_offsets       = p_offsets,
+                .p_verticies     = p_verticies
+            };
+
+            // Done
+            break;
+        }
+
+        default:
+
+            // Error
+            goto unsupported_type;
+    }
+
+    // Return the geometry to the caller
+    *p_geometry = _result;
+
+    // Return the quantity of bytes read to the caller
+    if ( p_read ) *p_read = (size_t) ( _reader.p_cursor - (const unsigned char *) p_buffer );
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_buffer:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_buffer\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // WKB errors
+        {
+            truncated:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_buffer\" is truncated or malformed in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the geometry
+                goto release;
+
+            unsupported_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_buffer\" contains an unsupported WKB type in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the geometry
+                goto release;
+
+            wrong_part_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_buffer\" contains a multi geometry with a part of the wrong type in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the geometry
+                goto release;
+        }
+
+        // Geometry errors
+        {
+            not_a_line:
+                #ifndef NDEBUG
+                    log_error("[geometry] Line string must have at least 2 points in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the geometry
+                goto release;
+
+            not_a_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Polygon must have at least 3 points in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the geometry
+                goto release;
+
+            not_a_triangle:
+                #ifndef NDEBUG
+                    log_error("[geometry] Triangle must have 3 points, and may only repeat the first to close its ring in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the geometry
+                goto release;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        release:
+
+            // Release heap memory
+            if ( p_arena == (void *) 0 && p_data ) p_data = GEOMETRY_REALLOC(p_data, 0);
+
+            // Error
+            return 0;
+    }
+}
@@ -0,0 +1,1539 @@
+/** !
+ * Simplification
+ *
+ * @file simplify.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <math.h>
+#include <string.h>
+
+// Header
+#include <geometry/simplify.h>
+#include <geometry/arena.h>
+#include <geometry/sweep.h>
+
+// Structure declarations
+struct geometry_simplify_extraction_s;
+
+// Type definitions
+typedef struct geometry_simplify_extraction_s geometry_simplify_extraction;
+
+// Structure definitions
+// The verticies put back into the chains, so that no chain crosses itself,
+// are stored in order in p_forced. The lines and intersections of a chain
+// are found in p_lines and p_intersections.
+struct geometry_simplify_extraction_s
+{
+    geometry_simplification    *p_simplification;
+    double                      tolerance;
+    size_t                     *p_forced,
+                                forced_quantity,
+                                capacity;
+    geometry_line              *p_lines;
+    geometry_line_intersection *p_intersections;
+};
+
+// Forward declarations
+/** !
+ * Allocate a ranking. Every vertex has no importance and no children.
+ *
+ * @param quantity       the quantity of verticies
+ * @param chain_quantity the quantity of chains
+ * @param ring           true if the ranking is of a polygon
+ *
+ * @return the ranking on success, else null
+ */
+static geometry_simplification *geometry_simplify_create ( size_t quantity, size_t chain_quantity, bool ring );
+
+/** !
+ * Rank the verticies of each chain of a ranking
+ *
+ * @param p_simplification the ranking
+ * @param method           the method
+ * @param pinned           a vertex to keep at every tolerance, or GEOMETRY_SIMPLIFY_NONE
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_simplify_rank ( geometry_simplification *p_simplification, enum geometry_simplify_e method, size_t pinned );
+
+/** !
+ * Rank the verticies of a chain by Douglas Peucker
+ *
+ * @param p_simplification the ranking
+ * @param first            the first vertex of the chain
+ * @param last             the last vertex of the chain
+ * @param p_stack          room for 3 size_t for each vertex of the ranking
+ *
+ * @return void
+ */
+static void geometry_simplify_douglas_peucker ( geometry_simplification *p_simplification, size_t first, size_t last, size_t *p_stack );
+
+/** !
+ * Rank the verticies of a chain by Visvalingam Whyatt
+ *
+ * @param p_simplification the ranking
+ * @param first            the first vertex of the chain
+ * @param last             the last vertex of the chain
+ * @param p_work           room for 5 size_t for each vertex of the ranking
+ *
+ * @return void
+ */
+static void geometry_simplify_visvalingam_whyatt ( geometry_simplification *p_simplification, size_t first, size_t last, size_t *p_work );
+
+/** !
+ * Move an item of a heap up or down, until the heap is in order again
+ *
+ * @param p_keys      the key of each item
+ * @param p_heap      the heap
+ * @param p_positions the position of each item in the heap
+ * @param quantity    the quantity of items in the heap
+ * @param i           the position of the item
+ *
+ * @return void
+ */
+static void geometry_simplify_sift ( const double *p_keys, size_t *p_heap, size_t *p_positions, size_t quantity, size_t i );
+
+/** !
+ * Compute the distance from a point to a line segment
+ *
+ * @param p_a the start of the segment
+ * @param p_b the end of the segment
+ * @param p_p the point
+ *
+ * @return the distance
+ */
+static double geometry_simplify_distance ( const geometry_point *p_a, const geometry_point *p_b, const geometry_point *p_p );
+
+/** !
+ * Compute the area of a triangle
+ *
+ * @param p_a a vertex of the triangle
+ * @param p_b the next vertex of the triangle
+ * @param p_c the last vertex of the triangle
+ *
+ * @return the area
+ */
+static double geometry_simplify_area ( const geometry_point *p_a, const geometry_point *p_b, const geometry_point *p_c );
+
+/** !
+ * Extract the kept verticies of each chain of a ranking
+ *
+ * @param p_simplification the ranking
+ * @param tolerance        the tolerance
+ * @param p_kept           return the kept verticies of each chain, one chain
+ *                         after another; room for each vertex of the ranking
+ * @param p_counts         return the quantity of kept verticies of each chain
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_simplify_extract ( geometry_simplification *p_simplification, double tolerance, size_t *p_kept, size_t *p_counts );
+
+/** !
+ * Extract the kept verticies of a chain, putting verticies back until the
+ * chain does not cross itself
+ *
+ * @param p_extraction the extraction
+ * @param first        the first vertex of the chain
+ * @param last         the last vertex of the chain
+ * @param p_kept       return the kept verticies
+ * @param p_quantity   return the quantity of kept verticies
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_simplify_chain ( geometry_simplify_extraction *p_extraction, size_t first, size_t last, size_t *p_kept, size_t *p_quantity );
+
+/** !
+ * Extract the kept verticies of a chain, in order. Only the kept verticies,
+ * and the children of the kept verticies, are visited.
+ *
+ * @param p_extraction the extraction
+ * @param first        the first vertex of the chain
+ * @param last         the last vertex of the chain
+ * @param p_kept       return the kept verticies
+ *
+ * @return the quantity of kept verticies
+ */
+static size_t geometry_simplify_walk ( geometry_simplify_extraction *p_extraction, size_t first, size_t last, size_t *p_kept );
+
+/** !
+ * Test if a vertex is kept
+ *
+ * @param p_extraction the extraction
+ * @param v            the vertex
+ *
+ * @return true if the vertex is kept, else false
+ */
+static bool geometry_simplify_kept ( geometry_simplify_extraction *p_extraction, size_t v );
+
+/** !
+ * Put back the best ranked vertex removed from between two kept verticies
+ *
+ * @param p_extraction the extraction
+ * @param u            a kept vertex
+ * @param w            the next kept vertex
+ *
+ * @return the quantity of verticies put back; 1 or 0
+ */
+static size_t geometry_simplify_force ( geometry_simplify_extraction *p_extraction, size_t u, size_t w );
+
+/** !
+ * Test if two lines of a simplified chain meet where they should not.
+ * Lines that follow each other share a vertex, and only meet wrongly if
+ * one folds back over the other.
+ *
+ * @param p_points the verticies of the ranking
+ * @param p_kept   the kept verticies of the chain
+ * @param quantity the quantity of kept verticies
+ * @param a        a line
+ * @param b        a later line
+ *
+ * @return true if the lines meet wrongly, else false
+ */
+static bool geometry_simplify_meets ( geometry_point *p_points, const size_t *p_kept, size_t quantity, size_t a, size_t b );
+
+// Function definitions
+int geometry_simplification_polygon_construct ( geometry_simplification **pp_simplification, geometry_polygon *p_polygon, enum geometry_simplify_e method )
+{
+
+    // Argument check
+    if ( pp_simplification == (void *) 0 ) goto no_simplification;
+    if ( p_polygon         == (void *) 0 ) goto no_polygon;
+    if ( p_polygon->quantity && p_polygon->p_verticies == (void *) 0 ) goto no_verticies;
+    if ( method >= GEOMETRY_SIMPLIFY_QUANTITY ) goto invalid_method;
+
+    // Initialized data
+    geometry_simplification *p_simplification = (void *) 0;
+    size_t                   n                = p_polygon->quantity,
+                             pinned           = GEOMETRY_SIMPLIFY_NONE;
+    double                   farthest         = -1;
+
+    // Allocate the ranking. The ring ends with its first vertex again.
+    p_simplification = geometry_simplify_create(( n ) ? n + 1 : 0, ( n ) ? 1 : 0, true);
+
+    // Error check
+    if ( p_simplification == (void *) 0 ) goto no_mem;
+
+    // Store the ring
+    if ( n )
+    {
+
+        // Copy the verticies
+        memcpy(p_simplification->p_points, p_polygon->p_verticies, sizeof(geometry_point) * n);
+
+        // Close the ring
+        p_simplification->p_points[n] = p_simplification->p_points[0];
+
+        // Store the chain
+        p_simplification->p_offsets[0] = 0,
+        p_simplification->p_offsets[1] = n + 1;
+    }
+
+    // Pin the farthest vertex from the first vertex
+    for (size_t i = 1; i < n; i++)
+    {
+
+        // Initialized data
+        double dx = p_polygon->p_verticies[i].x - p_polygon->p_verticies[0].x,
+               dy = p_polygon->p_verticies[i].y - p_polygon->p_verticies[0].y;
+
+        // Keep the farther vertex
+        if ( dx * dx + dy * dy > farthest ) farthest = dx * dx + dy * dy, pinned = i;
+    }
+
+    // Rank the verticies
+    if ( geometry_simplify_rank(p_simplification, method, pinned) == 0 ) goto failed_to_rank;
+
+    // Return a pointer to the caller
+    *pp_simplification = p_simplification;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_simplification:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_simplification\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_verticies:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_polygon\" has no verticies in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            invalid_method:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"method\" must be less than GEOMETRY_SIMPLIFY_QUANTITY in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_rank:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to rank verticies in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                p_simplification = GEOMETRY_REALLOC(p_simplification, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_simplification_line_list_construct ( geometry_simplification **pp_simplification, geometry_line_list *p_line_list, enum geometry_simplify_e method )
+{
+
+    // Argument check
+    if ( pp_simplification == (void *) 0 ) goto no_simplification;
+    if ( p_line_list       == (void *) 0 ) goto no_line_list;
+    if ( p_line_list->quantity && p_line_list->p_lines == (void *) 0 ) goto no_lines;
+    if ( method >= GEOMETRY_SIMPLIFY_QUANTITY ) goto invalid_method;
+
+    // Initialized data
+    geometry_simplification *p_simplification = (void *) 0;
+    geometry_line           *p_lines          = p_line_list->p_lines;
+    size_t                   lines            = p_line_list->quantity,
+                             chains           = 0,
+                             k                = 0,
+                             c                = 0;
+
+    // Count the chains. A line starts a chain unless it starts where the
+    // line before it ends.
+    for (size_t i = 0; i < lines; i++)
+        if ( i == 0 || p_lines[i].x0 != p_lines[i - 1].x1 || p_lines[i].y0 != p_lines[i - 1].y1 ) chains++;
+
+    // Allocate the ranking. Each chain has one more vertex than lines.
+    p_simplification = geometry_simplify_create(lines + chains, chains, false);
+
+    // Error check
+    if ( p_simplification == (void *) 0 ) goto no_mem;
+
+    // Store the chains
+    for (size_t i = 0; i < lines; i++)
+    {
+
+        // Start a chain
+        if ( i == 0 || p_lines[i].x0 != p_lines[i - 1].x1 || p_lines[i].y0 != p_lines[i - 1].y1 )
+            p_simplification->p_offsets[c++] = k,
+            p_simplification->p_points[k++]  = (geometry_point) { .x = p_lines[i].x0, .y = p_lines[i].y0 };
+
+        // Store the end of the line
+        p_simplification->p_points[k++] = (geometry_point) { .x = p_lines[i].x1, .y = p_lines[i].y1 };
+    }
+
+    // The last chain ends with the last vertex
+    p_simplification->p_offsets[chains] = k;
+
+    // Rank the verticies
+    if ( geometry_simplify_rank(p_simplification, method, GEOMETRY_SIMPLIFY_NONE) == 0 ) goto failed_to_rank;
+
+    // Return a pointer to the caller
+    *pp_simplification = p_simplification;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_simplification:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_simplification\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_line_list:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_line_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_lines:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_line_list\" has no lines in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            invalid_method:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"method\" must be less than GEOMETRY_SIMPLIFY_QUANTITY in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_rank:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to rank verticies in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                p_simplification = GEOMETRY_REALLOC(p_simplification, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_simplification_polygon ( geometry_simplification *p_simplification, double tolerance, geometry_polygon *p_result, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_simplification       == (void *) 0 ) goto no_simplification;
+    if ( p_result               == (void *) 0 ) goto no_result;
+    if ( p_simplification->ring == false      ) goto not_a_polygon;
+
+    // Initialized data
+    geometry_point *p_verticies = (void *) 0;
+    size_t         *p_kept      = (void *) 0,
+                    quantity    = 0;
+
+    // Empty polygon
+    if ( p_simplification->quantity == 0 )
+    {
+
+        // Store an empty polygon
+        *p_result = (geometry_polygon) { .quantity = 0, .p_verticies = (void *) 0 };
+
+        // Success
+        return 1;
+    }
+
+    // Allocate the kept verticies. The count of the chain follows them.
+    p_kept = GEOMETRY_REALLOC(0, sizeof(size_t) * ( p_simplification->quantity + 1 ));
+
+    // Error check
+    if ( p_kept == (void *) 0 ) goto no_mem;
+
+    // Extract the kept verticies
+    if ( geometry_simplify_extract(p_simplification, tolerance, p_kept, p_kept + p_simplification->quantity) == 0 ) goto failed_to_extract;
+
+    // The ring ends with its first vertex again
+    quantity = p_kept[p_simplification->quantity] - 1;
+
+    // Allocate the verticies
+    p_verticies = geometry_allocate(p_arena, sizeof(geometry_point) * quantity);
+
+    // Error check
+    if ( p_verticies == (void *) 0 ) goto no_mem;
+
+    // Copy the verticies
+    for (size_t i = 0; i < quantity; i++)
+        p_verticies[i] = p_simplification->p_points[p_kept[i]];
+
+    // Return the polygon to the caller
+    *p_result = (geometry_polygon) { .quantity = quantity, .p_verticies = p_verticies };
+
+    // Clean up
+    p_kept = GEOMETRY_REALLOC(p_kept, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_simplification:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_simplification\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_a_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_simplification\" is not the ranking of a polygon in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_extract:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to extract verticies in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                p_kept = GEOMETRY_REALLOC(p_kept, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( p_kept ) p_kept = GEOMETRY_REALLOC(p_kept, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_simplification_line_list ( geometry_simplification *p_simplification, double tolerance, geometry_line_list *p_result, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_simplification == (void *) 0 ) goto no_simplification;
+    if ( p_result         == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    geometry_line *p_lines  = (void *) 0;
+    size_t        *p_kept   = (void *) 0,
+                  *p_counts = (void *) 0,
+                   quantity = 0,
+                   k        = 0;
+
+    // Empty line list
+    if ( p_simplification->quantity == 0 )
+    {
+
+        // Store an empty line list
+        *p_result = (geometry_line_list) { .quantity = 0, .p_lines = (void *) 0 };
+
+        // Success
+        return 1;
+    }
+
+    // Allocate the kept verticies. The count of each chain follows them.
+    p_kept = GEOMETRY_REALLOC(0, sizeof(size_t) * ( p_simplification->quantity + p_simplification->chain_quantity ));
+
+    // Error check
+    if ( p_kept == (void *) 0 ) goto no_mem;
+
+    // Store the counts
+    p_counts = p_kept + p_simplification->quantity;
+
+    // Extract the kept verticies
+    if ( geometry_simplify_extract(p_simplification, tolerance, p_kept, p_counts) == 0 ) goto failed_to_extract;
+
+    // Each chain has one less line than kept verticies
+    for (size_t c = 0; c < p_simplification->chain_quantity; c++)
+        quantity += p_counts[c] - 1;
+
+    // Allocate the lines
+    p_lines = geometry_allocate(p_arena, sizeof(geometry_line) * quantity);
+
+    // Error check
+    if ( quantity && p_lines == (void *) 0 ) goto no_mem;
+
+    // Store the lines of each chain
+    for (size_t c = 0, l = 0; c < p_simplification->chain_quantity; k += p_counts[c++])
+        for (size_t i = 0; i + 1 < p_counts[c]; i++)
+        {
+
+            // Initialized data
+            geometry_point a = p_simplification->p_points[p_kept[k + i]],
+                           b = p_simplification->p_points[p_kept[k + i + 1]];
+
+            // Store the line
+            p_lines[l++] = (geometry_line) { .x0 = a.x, .y0 = a.y, .x1 = b.x, .y1 = b.y };
+        }
+
+    // Return the line list to the caller
+    *p_result = (geometry_line_list) { .quantity = quantity, .p_lines = p_lines };
+
+    // Clean up
+    p_kept = GEOMETRY_REALLOC(p_kept, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_simplification:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_simplification\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_extract:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to extract verticies in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                p_kept = GEOMETRY_REALLOC(p_kept, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( p_kept ) p_kept = GEOMETRY_REALLOC(p_kept, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_polygon_simplify ( geometry_polygon *p_polygon, enum geometry_simplify_e method, double tolerance, geometry_polygon *p_result, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_polygon == (void *) 0 ) goto no_polygon;
+    if ( p_result  == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    geometry_simplification *p_simplification = (void *) 0;
+
+    // Rank the verticies
+    if ( geometry_simplification_polygon_construct(&p_simplification, p_polygon, method) == 0 ) goto failed_to_rank;
+
+    // Extract the polygon
+    if ( geometry_simplification_polygon(p_simplification, tolerance, p_result, p_arena) == 0 ) goto failed_to_extract;
+
+    // Clean up
+    geometry_simplification_destroy(&p_simplification);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_rank:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to rank verticies in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_extract:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to extract verticies in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_simplification_destroy(&p_simplification);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_line_list_simplify ( geometry_line_list *p_line_list, enum geometry_simplify_e method, double tolerance, geometry_line_list *p_result, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_line_list == (void *) 0 ) goto no_line_list;
+    if ( p_result    == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    geometry_simplification *p_simplification = (void *) 0;
+
+    // Rank the verticies
+    if ( geometry_simplification_line_list_construct(&p_simplification, p_line_list, method) == 0 ) goto failed_to_rank;
+
+    // Extract the line list
+    if ( geometry_simplification_line_list(p_simplification, tolerance, p_result, p_arena) == 0 ) goto failed_to_extract;
+
+    // Clean up
+    geometry_simplification_destroy(&p_simplification);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_line_list:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_line_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_rank:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to rank verticies in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_extract:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to extract verticies in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_simplification_destroy(&p_simplification);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_simplification_destroy ( geometry_simplification **pp_simplification )
+{
+
+    // Argument check
+    if ( pp_simplification == (void *) 0 ) goto no_simplification;
+
+    // Initialized data
+    geometry_simplification *p_simplification = *pp_simplification;
+
+    // Error check
+    if ( p_simplification == (void *) 0 ) goto pointer_to_null_pointer;
+
+    // No more pointer for caller
+    *pp_simplification = (void *) 0;
+
+    // Free the ranking. The verticies and the tree live in the same block.
+    p_simplification = GEOMETRY_REALLOC(p_simplification, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_simplification:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_simplification\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            pointer_to_null_pointer:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"pp_simplification\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static geometry_simplification *geometry_simplify_create ( size_t quantity, size_t chain_quantity, bool ring )
+{
+
+    // Initialized data
+    geometry_simplification *p_simplification = GEOMETRY_REALLOC(0, sizeof(geometry_simplification) + sizeof(geometry_point) * quantity + sizeof(double) * quantity + sizeof(size_t) * ( chain_quantity + 1 + 3 * quantity ));
+
+    // Error check
+    if ( p_simplification == (void *) 0 ) return (void *) 0;
+
+    // Populate the ranking
+    *p_simplification = (geometry_simplification)
+    {
+        .quantity       = quantity,
+        .chain_quantity = chain_quantity,
+        .ring           = ring,
+        .p_points       = (geometry_point *) ( p_simplification + 1 ),
+        .p_importance   = (double *) ( (geometry_point *) ( p_simplification + 1 ) + quantity ),
+        .p_offsets      = (size_t *) ( (double *) ( (geometry_point *) ( p_simplification + 1 ) + quantity ) + quantity )
+    };
+
+    // Store the tree
+    p_simplification->p_left  = p_simplification->p_offsets + chain_quantity + 1,
+    p_simplification->p_right = p_simplification->p_left + quantity,
+    p_simplification->p_end   = p_simplification->p_right + quantity;
+
+    // No vertex has importance, or children
+    for (size_t i = 0; i < quantity; i++)
+        p_simplification->p_importance[i] = 0,
+        p_simplification->p_left[i]       = GEOMETRY_SIMPLIFY_NONE,
+        p_simplification->p_right[i]      = GEOMETRY_SIMPLIFY_NONE,
+        p_simplification->p_end[i]        = GEOMETRY_SIMPLIFY_NONE;
+
+    // An empty ranking has no chains
+    p_simplification->p_offsets[0] = 0;
+
+    // Success
+    return p_simplification;
+}
+
+static int geometry_simplify_rank ( geometry_simplification *p_simplification, enum geometry_simplify_e method, size_t pinned )
+{
+
+    // Initialized data
+    size_t *p_work = (void *) 0;
+
+    // Empty ranking
+    if ( p_simplification->quantity == 0 ) return 1;
+
+    // Allocate memory for the work
+    p_work = GEOMETRY_REALLOC(0, sizeof(size_t) * 5 * p_simplification->quantity);
+
+    // Error check
+    if ( p_work == (void *) 0 ) goto no_mem;
+
+    // The pinned vertex is never removed
+    if ( pinned != GEOMETRY_SIMPLIFY_NONE ) p_simplification->p_importance[pinned] = INFINITY;
+
+    // Rank each chain
+    for (size_t c = 0; c < p_simplification->chain_quantity; c++)
+    {
+
+        // Initialized data
+        size_t first = p_simplification->p_offsets[c],
+               last  = p_simplification->p_offsets[c + 1] - 1;
+
+        // The ends of the chain are never removed
+        p_simplification->p_importance[first] = INFINITY,
+        p_simplification->p_importance[last]  = INFINITY;
+
+        // Rank the chain
+        if ( method == GEOMETRY_SIMPLIFY_DOUGLAS_PEUCKER )
+            geometry_simplify_douglas_peucker(p_simplification, first, last, p_work);
+        else
+            geometry_simplify_visvalingam_whyatt(p_simplification, first, last, p_work);
+    }
+
+    // The pinned vertex is removed last, so the first verticies removed
+    // from either side of it rank above every other vertex. Keep the better
+    // of the two, so that a ring keeps three verticies.
+    if ( pinned != GEOMETRY_SIMPLIFY_NONE )
+    {
+
+        // Initialized data
+        size_t left  = p_simplification->p_left[pinned],
+               right = p_simplification->p_right[pinned],
+               best  = left;
+
+        // Choose the better child
+        if ( best == GEOMETRY_SIMPLIFY_NONE || ( right != GEOMETRY_SIMPLIFY_NONE && p_simplification->p_importance[right] > p_simplification->p_importance[left] ) ) best = right;
+
+        // Keep it
+        if ( best != GEOMETRY_SIMPLIFY_NONE ) p_simplification->p_importance[best] = INFINITY;
+    }
+
+    // Clean up
+    p_work = GEOMETRY_REALLOC(p_work, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static void geometry_simplify_douglas_peucker ( geometry_simplification *p_simplification, size_t first, size_t last, size_t *p_stack )
+{
+
+    // Initialized data
+    geometry_point *p_points     = p_simplification->p_points;
+    double         *p_importance = p_simplification->p_importance;
+    size_t          top          = 0;
+
+    // The chain is the right side of its first vertex
+    p_simplification->p_end[first] = last;
+
+    // Push the chain. Each span is its first vertex, its last vertex, and
+    // the vertex that was kept to make it.
+    p_stack[top++] = first,
+    p_stack[top++] = last,
+    p_stack[top++] = first;
+
+    // Split spans until they are empty
+    while ( top )
+    {
+
+        // Initialized data
+        size_t parent   = p_stack[--top],
+               hi       = p_stack[--top],
+               lo       = p_stack[--top],
+               best     = lo + 1;
+        double distance = -INFINITY;
+
+        // Empty span
+        if ( hi - lo < 2 ) continue;
+
+        // Find the farthest vertex from the line across the span. Pinned
+        // verticies are infinitely far.
+        for (size_t i = lo + 1; i < hi; i++)
+        {
+
+            // Initialized data
+            double d = ( p_importance[i] == INFINITY ) ? INFINITY : geometry_simplify_distance(&p_points[lo], &p_points[hi], &p_points[i]);
+
+            // Keep the farther vertex
+            if ( d > distance ) distance = d, best = i;
+        }
+
+        // A vertex never ranks above the vertex that was kept before it
+        p_importance[best] = ( distance < p_importance[parent] ) ? distance : p_importance[parent];
+
+        // Store the vertex in the tree
+        p_simplification->p_end[best] = hi;
+        if ( parent == lo ) p_simplification->p_right[lo] = best;
+        else                p_simplification->p_left[hi]  = best;
+
+        // Push the spans on either side of the vertex
+        p_stack[top++] = lo,   p_stack[top++] = best, p_stack[top++] = best;
+        p_stack[top++] = best, p_stack[top++] = hi,   p_stack[top++] = best;
+    }
+
+    // Done
+    return;
+}
+
+static void geometry_simplify_visvalingam_whyatt ( geometry_simplification *p_simplification, size_t first, size_t last, size_t *p_work )
+{
+
+    // Initialized data
+    geometry_point *p_points      = p_simplification->p_points;
+    double         *p_importance  = p_simplification->p_importance,
+                    largest       = 0;
+    size_t          quantity      = p_simplification->quantity,
+                   *p_previous    = p_work,
+                   *p_next        = p_work + quantity,
+                   *p_heap        = p_work + 2 * quantity,
+                   *p_positions   = p_work + 3 * quantity,
+                   *p_order       = p_work + 4 * quantity,
+                    heap_quantity = 0,
+                    removed       = 0;
+
+    // The chain is the right side of its first vertex
+    p_simplification->p_end[first] = last;
+
+    // Link the verticies. The ends of the chain are removed after everything.
+    for (size_t i = first; i <= last; i++)
+        p_previous[i] = i - 1,
+        p_next[i]     = i + 1,
+        p_order[i]    = SIZE_MAX;
+
+    // Key each vertex by the area of the triangle it makes with its
+    // neighbours. Pinned verticies keep an infinite key.
+    for (size_t i = first + 1; i < last; i++)
+    {
+
+        // Compute the key
+        if ( p_importance[i] != INFINITY ) p_importance[i] = geometry_simplify_area(&p_points[i - 1], &p_points[i], &p_points[i + 1]);
+
+        // Add the vertex to the heap
+        p_heap[heap_quantity] = i,
+        p_positions[i]        = heap_quantity++;
+        geometry_simplify_sift(p_importance, p_heap, p_positions, heap_quantity, heap_quantity - 1);
+    }
+
+    // Remove the vertex with the smallest triangle, until none are left
+    while ( heap_quantity )
+    {
+
+        // Initialized data
+        size_t v  = p_heap[0],
+               lo = p_previous[v],
+               hi = p_next[v];
+
+        // Remove the vertex from the heap
+        p_heap[0]              = p_heap[--heap_quantity],
+        p_positions[p_heap[0]] = 0;
+        if ( heap_quantity ) geometry_simplify_sift(p_importance, p_heap, p_positions, heap_quantity, 0);
+
+        // A vertex never ranks below the verticies removed before it
+        if ( p_importance[v] < largest ) p_importance[v] = largest;
+        largest = p_importance[v];
+
+        // Store the order and the end of the vertex
+        p_order[v]                 = removed++,
+        p_simplification->p_end[v] = hi;
+
+        // Unlink the vertex
+        p_next[lo]     = hi,
+        p_previous[hi] = lo;
+
+        // Update the neighbours
+        if ( lo != first && p_importance[lo] != INFINITY )
+            p_importance[lo] = geometry_simplify_area(&p_points[p_previous[lo]], &p_points[lo], &p_points[hi]),
+            geometry_simplify_sift(p_importance, p_heap, p_positions, heap_quantity, p_positions[lo]);
+
+        if ( hi != last && p_importance[hi] != INFINITY )
+            p_importance[hi] = geometry_simplify_area(&p_points[lo], &p_points[hi], &p_points[p_next[hi]]),
+            geometry_simplify_sift(p_importance, p_heap, p_positions, heap_quantity, p_positions[hi]);
+    }
+
+    // Build the tree. Putting the verticies back in the reverse order, each
+    // vertex splits the span between its neighbours, which was made by
+    // whichever neighbour was put back last, so that neighbour is the parent.
+    for (size_t v = first + 1; v < last; v++)
+    {
+
+        // Initialized data
+        size_t lo = p_previous[v],
+               hi = p_simplification->p_end[v];
+
+        // Store the vertex in the tree
+        if ( p_order[lo] <= p_order[hi] ) p_simplification->p_right[lo] = v;
+        else                              p_simplification->p_left[hi]  = v;
+    }
+
+    // Done
+    return;
+}
+
+static void geometry_simplify_sift ( const double *p_keys, size_t *p_heap, size_t *p_positions, size_t quantity, size_t i )
+{
+
+    // Initialized data
+    size_t item = p_heap[i];
+
+    // Move up, while the parent is after the item
+    while ( i )
+    {
+
+        // Initialized data
+        size_t parent = ( i - 1 ) / 2,
+               other  = p_heap[parent];
+
+        // Done
+        if ( p_keys[other] < p_keys[item] || ( p_keys[other] == p_keys[item] && other < item ) ) break;
+
+        // Move the parent down
+        p_heap[i]          = other,
+        p_positions[other] = i,
+        i                  = parent;
+    }
+
+    // Move down, while a child is before the item
+    for (;;)
+    {
+
+        // Initialized data
+        size_t child = 2 * i + 1,
+               other = 0;
+
+        // No children
+        if ( child >= quantity ) break;
+
+        // Choose the lesser child
+        if ( child + 1 < quantity && ( p_keys[p_heap[child + 1]] < p_keys[p_heap[child]] || ( p_keys[p_heap[child + 1]] == p_keys[p_heap[child]] && p_heap[child + 1] < p_heap[child] ) ) ) child++;
+
+        // Done
+        other = p_heap[child];
+        if ( p_keys[item] < p_keys[other] || ( p_keys[item] == p_keys[other] && item < other ) ) break;
+
+        // Move the child up
+        p_heap[i]          = other,
+        p_positions[other] = i,
+        i                  = child;
+    }
+
+    // Store the item
+    p_heap[i]         = item,
+    p_positions[item] = i;
+
+    // Done
+    return;
+}
+
+static double geometry_simplify_distance ( const geometry_point *p_a, const geometry_point *p_b, const geometry_point *p_p )
+{
+
+    // Initialized data
+    double dx     = p_b->x - p_a->x,
+           dy     = p_b->y - p_a->y,
+           px     = p_p->x - p_a->x,
+           py     = p_p->y - p_a->y,
+           length = dx * dx + dy * dy,
+           t      = 0;
+
+    // Project the point onto the segment
+    if ( length > 0 )
+    {
+
+        // Compute the projection
+        t = ( px * dx + py * dy ) / length;
+
+        // Clamp to the segment
+        if ( t < 0 ) t = 0;
+        if ( t > 1 ) t = 1;
+    }
+
+    // Compute the offset from the nearest point
+    px -= t * dx,
+    py -= t * dy;
+
+    // Success
+    return sqrt(px * px + py * py);
+}
+
+static double geometry_simplify_area ( const geometry_point *p_a, const geometry_point *p_b, const geometry_point *p_c )
+{
+
+    // Success
+    return fabs(( p_b->x - p_a->x ) * ( p_c->y - p_a->y ) - ( p_c->x - p_a->x ) * ( p_b->y - p_a->y )) / 2;
+}
+
+static int geometry_simplify_extract ( geometry_simplification *p_simplification, double tolerance, size_t *p_kept, size_t *p_counts )
+{
+
+    // Initialized data
+    geometry_simplify_extraction _extraction =
+    {
+        .p_simplification = p_simplification,
+        .tolerance        = tolerance,
+        .p_forced         = (void *) 0,
+        .forced_quantity  = 0,
+        .capacity         = p_simplification->quantity + 1,
+        .p_lines          = (void *) 0,
+        .p_intersections  = (void *) 0
+    };
+    size_t k = 0;
+
+    // Allocate the forced verticies. The lines follow them.
+    _extraction.p_forced = GEOMETRY_REALLOC(0, ( sizeof(size_t) + sizeof(geometry_line) ) * p_simplification->quantity);
+
+    // Error check
+    if ( _extraction.p_forced == (void *) 0 ) goto no_mem;
+
+    // Store the lines
+    _extraction.p_lines = (geometry_line *) ( _extraction.p_forced + p_simplification->quantity );
+
+    // Allocate the intersections
+    _extraction.p_intersections = GEOMETRY_REALLOC(0, sizeof(geometry_line_intersection) * _extraction.capacity);
+
+    // Error check
+    if ( _extraction.p_intersections == (void *) 0 ) goto no_mem;
+
+    // Extract each chain
+    for (size_t c = 0; c < p_simplification->chain_quantity; k += p_counts[c++])
+        if ( geometry_simplify_chain(&_extraction, p_simplification->p_offsets[c], p_simplification->p_offsets[c + 1] - 1, p_kept + k, &p_counts[c]) == 0 ) goto failed_to_extract;
+
+    // Clean up
+    _extraction.p_forced        = GEOMETRY_REALLOC(_extraction.p_forced, 0),
+    _extraction.p_intersections = GEOMETRY_REALLOC(_extraction.p_intersections, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_extract:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to extract a chain in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                _extraction.p_forced        = GEOMETRY_REALLOC(_extraction.p_forced, 0),
+                _extraction.p_intersections = GEOMETRY_REALLOC(_extraction.p_intersections, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                if ( _extraction.p_forced ) _extraction.p_forced = GEOMETRY_REALLOC(_extraction.p_forced, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_simplify_chain ( geometry_simplify_extraction *p_extraction, size_t first, size_t last, size_t *p_kept, size_t *p_quantity )
+{
+
+    // Initialized data
+    geometry_point *p_points = p_extraction->p_simplification->p_points;
+    size_t          k        = 0;
+
+    // Extract the chain, and put verticies back until it does not cross itself
+    for (;;)
+    {
+
+        // Initialized data
+        geometry_line_list lines    = { .quantity = 0, .p_lines = p_extraction->p_lines };
+        size_t             quantity = 0,
+                           added    = 0;
+
+        // Extract the kept verticies
+        k = geometry_simplify_walk(p_extraction, first, last, p_kept);
+
+        // One line can not cross itself
+        if ( k < 3 ) break;
+
+        // Store the lines
+        for (size_t i = 0; i + 1 < k; i++)
+            lines.p_lines[lines.quantity++] = (geometry_line)
+            {
+                .x0 = p_points[p_kept[i]].x,     .y0 = p_points[p_kept[i]].y,
+                .x1 = p_points[p_kept[i + 1]].x, .y1 = p_points[p_kept[i + 1]].y
+            };
+
+        // Find where the lines meet
+        for (;;)
+        {
+
+            // Find the intersections
+            if ( geometry_line_list_intersections(&lines, (void *) 0, p_extraction->p_intersections, p_extraction->capacity, &quantity) == 0 ) goto failed_to_intersect;
+
+            // Done
+            if ( quantity <= p_extraction->capacity ) break;
+
+            // Initialized data
+            geometry_line_intersection *p_intersections = GEOMETRY_REALLOC(p_extraction->p_intersections, sizeof(geometry_line_intersection) * quantity);
+
+            // Error check
+            if ( p_intersections == (void *) 0 ) goto no_mem;
+
+            // Grow
+            p_extraction->p_intersections = p_intersections,
+            p_extraction->capacity        = quantity;
+        }
+
+        // Put back a vertex on each side of each wrong meeting
+        for (size_t i = 0; i < quantity; i++)
+        {
+
+            // Initialized data
+            size_t a = p_extraction->p_intersections[i].a,
+                   b = p_extraction->p_intersections[i].b;
+
+            // Skip lines that meet rightly
+            if ( geometry_simplify_meets(p_points, p_kept, k, a, b) == false ) continue;
+
+            // Put back verticies
+            added += geometry_simplify_force(p_extraction, p_kept[a], p_kept[a + 1]);
+            added += geometry_simplify_force(p_extraction, p_kept[b], p_kept[b + 1]);
+        }
+
+        // Done. Meetings with nothing left to put back are in the input.
+        if ( added == 0 ) break;
+    }
+
+    // Return the quantity to the caller
+    *p_quantity = k;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_intersect:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to intersect lines in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static size_t geometry_simplify_walk ( geometry_simplify_extraction *p_extraction, size_t first, size_t last, size_t *p_kept )
+{
+
+    // Initialized data
+    geometry_simplification *p_simplification = p_extraction->p_simplification;
+    size_t                   k                = 0,
+                             v                = first;
+
+    // Keep the first vertex
+    p_kept[k++] = first;
+
+    // Step to the next kept vertex, until the last vertex
+    while ( v != last )
+    {
+
+        // Initialized data
+        size_t c = p_simplification->p_right[v];
+
+        // The next kept vertex is the first kept vertex of the right side,
+        // or else the end of this vertex
+        if ( c != GEOMETRY_SIMPLIFY_NONE && geometry_simplify_kept(p_extraction, c) )
+        {
+
+            // Go left while kept
+            while ( p_simplification->p_left[c] != GEOMETRY_SIMPLIFY_NONE && geometry_simplify_kept(p_extraction, p_simplification->p_left[c]) )
+                c = p_simplification->p_left[c];
+
+            // Step
+            v = c;
+        }
+        else
+            v = p_simplification->p_end[v];
+
+        // Keep the vertex
+        p_kept[k++] = v;
+    }
+
+    // Success
+    return k;
+}
+
+static bool geometry_simplify_kept ( geometry_simplify_extraction *p_extraction, size_t v )
+{
+
+    // Initialized data
+    size_t lo = 0,
+           hi = p_extraction->forced_quantity;
+
+    // Important verticies are kept
+    if ( p_extraction->p_simplification->p_importance[v] > p_extraction->tolerance ) return true;
+
+    // Search the forced verticies
+    while ( lo < hi )
+    {
+
+        // Initialized data
+        size_t mid = lo + ( hi - lo ) / 2;
+
+        // Halve the range
+        if ( p_extraction->p_forced[mid] < v ) lo = mid + 1;
+        else                                   hi = mid;
+    }
+
+    // Success
+    return lo < p_extraction->forced_quantity && p_extraction->p_forced[lo] == v;
+}
+
+static size_t geometry_simplify_force ( geometry_simplify_extraction *p_extraction, size_t u, size_t w )
+{
+
+    // Initialized data
+    geometry_simplification *p_simplification = p_extraction->p_simplification;
+    size_t                   v                = 0,
+                             lo               = 0,
+                             hi               = p_extraction->forced_quantity;
+
+    // Nothing was removed
+    if ( w - u < 2 ) return 0;
+
+    // The removed verticies are the right side of u if w is the end of u,
+    // or else the left side of w
+    v = ( w == p_simplification->p_end[u] ) ? p_simplification->p_right[u] : p_simplification->p_left[w];
+
+    // Nothing to put back
+    if ( v == GEOMETRY_SIMPLIFY_NONE ) return 0;
+
+    // Find where the vertex goes
+    while ( lo < hi )
+    {
+
+        // Initialized data
+        size_t mid = lo + ( hi - lo ) / 2;
+
+        // Halve the range
+        if ( p_extraction->p_forced[mid] < v ) lo = mid + 1;
+        else                                   hi = mid;
+    }
+
+    // Already put back
+    if ( lo < p_extraction->forced_quantity && p_extraction->p_forced[lo] == v ) return 0;
+
+    // Insert the vertex
+    memmove(&p_extraction->p_forced[lo + 1], &p_extraction->p_forced[lo], sizeof(size_t) * ( p_extraction->forced_quantity - lo ));
+    p_extraction->p_forced[lo] = v;
+    p_extraction->forced_quantity++;
+
+    // Success
+    return 1;
+}
+
+static bool geometry_simplify_meets ( geometry_point *p_points, const size_t *p_kept, size_t quantity, size_t a, size_t b )
+{
+
+    // Initialized data
+    geometry_point *p_first = &p_points[p_kept[0]],
+                   *p_last  = &p_points[p_kept[quantity - 1]],
+                   *p_p     = (void *) 0,
+                   *p_q     = (void *) 0,
+                   *p_r     = (void *) 0;
+
+    // Lines that follow each other share a vertex
+    if ( b == a + 1 )
+        p_p = &p_points[p_kept[a]],
+        p_q = &p_points[p_kept[b]],
+        p_r = &p_points[p_kept[b + 1]];
+
+    // So do the first and last lines of a closed chain
+    else if ( a == 0 && b == quantity - 2 && p_first->x == p_last->x && p_first->y == p_last->y )
+        p_p = &p_points[p_kept[1]],
+        p_q = p_first,
+        p_r = &p_points[p_kept[b]];
+
+    // Other lines should not meet at all
+    else
+        return true;
+
+    // The lines fold if they leave the shared vertex the same way
+    if ( geometry_point_ccw(p_p, p_q, p_r) != 0 ) return false;
+
+    // Success
+    return ( p_p->x - p_q->x ) * ( p_r->x - p_q->x ) + ( p_p->y - p_q->y ) * ( p_r->y - p_q->y ) > 0;
+}
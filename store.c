@@ -0,0 +1,705 @@
+/** !
+ * Memory mapped geometry store
+ *
+ * @file store.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <string.h>
+
+// Platform dependent includes
+#ifdef _WIN64
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+// geometry
+#include <geometry/store.h>
+
+// Preprocessor definitions
+#define GEOMETRY_STORE_BYTE_ORDER 0x01020304
+
+// Forward declarations
+/** !
+ * Compute the size of the payload of a geometry in a store
+ *
+ * @param p_geometry the geometry
+ * @param p_size     return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_store_payload_size ( geometry *p_geometry, size_t *p_size );
+
+/** !
+ * Write the payload of a geometry to a store file
+ *
+ * @param p_file     the store file
+ * @param p_geometry the geometry
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_store_payload_write ( FILE *p_file, geometry *p_geometry );
+
+// Function definitions
+static int geometry_store_payload_size ( geometry *p_geometry, size_t *p_size )
+{
+
+    // Strategy
+    switch ( p_geometry->type )
+    {
+        case GEOMETRY_POINT:
+            *p_size = sizeof(geometry_point);
+            return 1;
+
+        case GEOMETRY_POINT_LIST:
+            *p_size = sizeof(geometry_point) * p_geometry->point_list.quantity;
+            return 1;
+
+        case GEOMETRY_LINE:
+            *p_size = sizeof(geometry_line);
+            return 1;
+
+        case GEOMETRY_LINE_LIST:
+            *p_size = sizeof(geometry_line) * p_geometry->line_list.quantity;
+            return 1;
+
+        case GEOMETRY_TRIANGLE:
+            *p_size = sizeof(geometry_triangle);
+            return 1;
+
+        case GEOMETRY_POLYGON:
+            *p_size = sizeof(geometry_point) * p_geometry->polygon.quantity;
+            return 1;
+
+        case GEOMETRY_POLYGON_LIST:
+            *p_size = sizeof(uint64_t) * ( p_geometry->polygon_list.quantity + 1 ) + sizeof(geometry_point) * p_geometry->polygon_list.vertex_quantity;
+            return 1;
+
+        default:
+
+            // Error
+            return 0;
+    }
+}
+
+static int geometry_store_payload_write ( FILE *p_file, geometry *p_geometry )
+{
+
+    // Strategy
+    switch ( p_geometry->type )
+    {
+        case GEOMETRY_POINT:
+            return fwrite(&p_geometry->point, sizeof(geometry_point), 1, p_file) == 1;
+
+        case GEOMETRY_POINT_LIST:
+            return fwrite(p_geometry->point_list.p_points, sizeof(geometry_point), p_geometry->point_list.quantity, p_file) == p_geometry->point_list.quantity;
+
+        case GEOMETRY_LINE:
+            return fwrite(&p_geometry->line, sizeof(geometry_line), 1, p_file) == 1;
+
+        case GEOMETRY_LINE_LIST:
+            return fwrite(p_geometry->line_list.p_lines, sizeof(geometry_line), p_geometry->line_list.quantity, p_file) == p_geometry->line_list.quantity;
+
+        case GEOMETRY_TRIANGLE:
+            return fwrite(&p_geometry->triangle, sizeof(geometry_triangle), 1, p_file) == 1;
+
+        case GEOMETRY_POLYGON:
+            return fwrite(p_geometry->polygon.p_verticies, sizeof(geometry_point), p_geometry->polygon.quantity, p_file) == p_geometry->polygon.quantity;
+
+        case GEOMETRY_POLYGON_LIST:
+        {
+
+            // Write the offsets as 64 bit integers
+            for (size_t i = 0; i <= p_geometry->polygon_list.quantity; i++)
+            {
+
+                // Initialized data
+                uint64_t offset = p_geometry->polygon_list.p_offsets[i];
+
+                // Write the offset
+                if ( fwrite(&offset, sizeof(uint64_t), 1, p_file) != 1 ) return 0;
+            }
+
+            // Write the verticies
+            return fwrite(p_geometry->polygon_list.p_verticies, sizeof(geometry_point), p_geometry->polygon_list.vertex_quantity, p_file) == p_geometry->polygon_list.vertex_quantity;
+        }
+
+        default:
+
+            // Error
+            return 0;
+    }
+}
+
+int geometry_store_write ( const char *path, geometry *p_geometries, size_t quantity )
+{
+
+    // Argument check
+    if ( path == (void *) 0 ) goto no_path;
+    if ( p_geometries == (void *) 0 && quantity ) goto no_geometries;
+
+    // Initialized data
+    FILE                  *p_file  = (void *) 0;
+    geometry_store_header  _header = { 0 };
+    uint64_t               offset  = sizeof(geometry_store_header) + sizeof(geometry_store_entry) * quantity;
+
+    // Open the file
+    p_file = fopen(path, "wb");
+
+    // Error check
+    if ( p_file == (void *) 0 ) goto failed_to_open_file;
+
+    // Populate the header
+    memcpy(_header.magic, GEOMETRY_STORE_MAGIC, sizeof(_header.magic));
+    _header.version          = GEOMETRY_STORE_VERSION,
+    _header.byte_order       = GEOMETRY_STORE_BYTE_ORDER,
+    _header.quantity         = quantity,
+    _header.directory_offset = sizeof(geometry_store_header);
+
+    // Compute the size of the file
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        size_t size = 0;
+
+        // Compute the size of the payload
+        if ( geometry_store_payload_size(&p_geometries[i], &size) == 0 ) goto unsupported_type;
+
+        // Accumulate
+        offset += size;
+    }
+
+    // Store the size of the file
+    _header.size = offset;
+
+    // Write the header
+    if ( fwrite(&_header, sizeof(geometry_store_header), 1, p_file) != 1 ) goto failed_to_write;
+
+    // Write the directory
+    offset = sizeof(geometry_store_header) + sizeof(geometry_store_entry) * quantity;
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        geometry             *p_geometry = &p_geometries[i];
+        geometry_store_entry  _entry     = { .type = p_geometry->type, .offset = offset };
+        size_t                size       = 0;
+
+        // Store the quantities
+        switch ( p_geometry->type )
+        {
+            case GEOMETRY_POINT_LIST:   _entry.quantity = p_geometry->point_list.quantity; break;
+            case GEOMETRY_LINE_LIST:    _entry.quantity = p_geometry->line_list.quantity;  break;
+            case GEOMETRY_POLYGON:      _entry.quantity = p_geometry->polygon.quantity;    break;
+            case GEOMETRY_POLYGON_LIST:
+                _entry.quantity        = p_geometry->polygon_list.quantity,
+                _entry.vertex_quantity = p_geometry->polygon_list.vertex_quantity;
+                break;
+            default:                    _entry.quantity = 1;                               break;
+        }
+
+        // Write the entry
+        if ( fwrite(&_entry, sizeof(geometry_store_entry), 1, p_file) != 1 ) goto failed_to_write;
+
+        // Advance past the payload. Every payload is a multiple of 8 bytes,
+        // so every payload stays aligned for its coordinates.
+        geometry_store_payload_size(p_geometry, &size);
+        offset += size;
+    }
+
+    // Write each payload
+    for (size_t i = 0; i < quantity; i++)
+        if ( geometry_store_payload_write(p_file, &p_geometries[i]) == 0 ) goto failed_to_write;
+
+    // Close the file
+    if ( fclose(p_file) != 0 ) goto failed_to_close_file;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_geometries:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometries\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            unsupported_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_geometries\" contains a geometry of unsupported type in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Close the file
+                fclose(p_file);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_open_file:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to open file \"%s\" in call to function \"%s\"\n", path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_write:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to write file \"%s\" in call to function \"%s\"\n", path, __FUNCTION__);
+                #endif
+
+                // Close the file
+                fclose(p_file);
+
+                // Error
+                return 0;
+
+            failed_to_close_file:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to close file \"%s\" in call to function \"%s\"\n", path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_store_open ( geometry_store **pp_store, const char *path )
+{
+
+    // Argument check
+    if ( pp_store == (void *) 0 ) goto no_store;
+    if ( path     == (void *) 0 ) goto no_path;
+
+    // Initialized data
+    geometry_store              *p_store  = (void *) 0;
+    const geometry_store_header *p_header = (void *) 0;
+    const unsigned char         *p_base   = (void *) 0;
+    size_t                       size     = 0;
+
+    // Views of polygon lists reinterpret the stored offsets as size_t
+    if ( sizeof(size_t) != sizeof(uint64_t) ) goto unsupported_platform;
+
+    // Allocate memory for the store
+    p_store = GEOMETRY_REALLOC(0, sizeof(geometry_store));
+
+    // Error check
+    if ( p_store == (void *) 0 ) goto no_mem;
+
+    // Initialize the store
+    *p_store = (geometry_store) { 0 };
+
+    // Map the file
+    #ifdef _WIN64
+    {
+
+        // Initialized data
+        LARGE_INTEGER _size = { 0 };
+
+        // Open the file
+        p_store->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+        // Error check
+        if ( p_store->file == INVALID_HANDLE_VALUE ) goto failed_to_open_file;
+
+        // Store the size of the file
+        if ( GetFileSizeEx(p_store->file, &_size) == 0 ) goto failed_to_map_file;
+        size = (size_t) _size.QuadPart;
+
+        // Error check
+        if ( size < sizeof(geometry_store_header) ) goto not_a_store;
+
+        // Map the file
+        p_store->mapping = CreateFileMappingA(p_store->file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+        // Error check
+        if ( p_store->mapping == NULL ) goto failed_to_map_file;
+
+        // Map a view of the file
+        p_base = MapViewOfFile(p_store->mapping, FILE_MAP_READ, 0, 0, 0);
+
+        // Error check
+        if ( p_base == NULL ) goto failed_to_map_file;
+    }
+    #else
+    {
+
+        // Initialized data
+        int         fd     = open(path, O_RDONLY);
+        struct stat _stat  = { 0 };
+        void       *p_map  = MAP_FAILED;
+
+        // Error check
+        if ( fd == -1 ) goto failed_to_open_file;
+
+        // Store the size of the file
+        if ( fstat(fd, &_stat) == -1 ) { close(fd); goto failed_to_map_file; }
+        size = (size_t) _stat.st_size;
+
+        // Error check
+        if ( size < sizeof(geometry_store_header) ) { close(fd); goto not_a_store; }
+
+        // Map the file. Pages are shared with every other process that maps it.
+        p_map = mmap((void *) 0, size, PROT_READ, MAP_SHARED, fd, 0);
+
+        // The mapping holds its own reference to the file
+        close(fd);
+
+        // Error check
+        if ( p_map == MAP_FAILED ) goto failed_to_map_file;
+
+        // Store the base of the mapping
+        p_base = p_map;
+    }
+    #endif
+
+    // Store the mapping
+    p_store->p_base = p_base,
+    p_store->size   = size;
+
+    // Validate the header
+    p_header = (const geometry_store_header *) p_base;
+    if ( memcmp(p_header->magic, GEOMETRY_STORE_MAGIC, sizeof(p_header->magic)) != 0 ) goto not_a_store;
+    if ( p_header->version                                  != GEOMETRY_STORE_VERSION    ) goto not_a_store;
+    if ( p_header->byte_order                               != GEOMETRY_STORE_BYTE_ORDER ) goto wrong_byte_order;
+    if ( p_header->size                                     != size                      ) goto not_a_store;
+    if ( p_header->directory_offset                         != sizeof(geometry_store_header) ) goto not_a_store;
+    if ( ( size - sizeof(geometry_store_header) ) / sizeof(geometry_store_entry) < p_header->quantity ) goto not_a_store;
+
+    // Store the directory
+    p_store->quantity    = (size_t) p_header->quantity,
+    p_store->p_directory = (const geometry_store_entry *) ( p_base + p_header->directory_offset );
+
+    // Validate the directory
+    for (size_t i = 0; i < p_store->quantity; i++)
+    {
+
+        // Initialized data
+        const geometry_store_entry *p_entry = &p_store->p_directory[i];
+        geometry                    _shape  = { .type = (enum geometry_type_e) p_entry->type };
+        size_t                      payload = 0;
+
+        // Quantities larger than the file can not be valid, and would overflow below
+        if ( p_entry->quantity > size || p_entry->vertex_quantity > size ) goto not_a_store;
+
+        // Populate the quantities, so the payload size can be computed
+        switch ( _shape.type )
+        {
+            case GEOMETRY_POINT_LIST: _shape.point_list.quantity = (size_t) p_entry->quantity; break;
+            case GEOMETRY_LINE_LIST:  _shape.line_list.quantity  = (size_t) p_entry->quantity; break;
+            case GEOMETRY_POLYGON:    _shape.polygon.quantity    = (size_t) p_entry->quantity; break;
+            case GEOMETRY_POLYGON_LIST:
+                _shape.polygon_list.quantity        = (size_t) p_entry->quantity,
+                _shape.polygon_list.vertex_quantity = (size_t) p_entry->vertex_quantity;
+                break;
+            default: break;
+        }
+
+        // Compute the size of the payload
+        if ( geometry_store_payload_size(&_shape, &payload) == 0 ) goto not_a_store;
+
+        // Bounds check
+        if ( p_entry->offset % sizeof(double) != 0 || p_entry->offset > size || size - p_entry->offset < payload ) goto not_a_store;
+    }
+
+    // Return a pointer to the caller
+    *pp_store = p_store;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_store:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_store\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Store errors
+        {
+            unsupported_platform:
+                #ifndef NDEBUG
+                    log_error("[geometry] Stores require a 64 bit size_t in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            not_a_store:
+                #ifndef NDEBUG
+                    log_error("[geometry] File \"%s\" is not a valid geometry store in call to function \"%s\"\n", path, __FUNCTION__);
+                #endif
+
+                // Release the store
+                goto release;
+
+            wrong_byte_order:
+                #ifndef NDEBUG
+                    log_error("[geometry] File \"%s\" was written on a host of different byte order in call to function \"%s\"\n", path, __FUNCTION__);
+                #endif
+
+                // Release the store
+                goto release;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_open_file:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to open file \"%s\" in call to function \"%s\"\n", path, __FUNCTION__);
+                #endif
+
+                // Release the store
+                goto release;
+
+            failed_to_map_file:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to map file \"%s\" in call to function \"%s\"\n", path, __FUNCTION__);
+                #endif
+
+                // Release the store
+                goto release;
+        }
+
+        release:
+
+            // Unmap the file
+            #ifdef _WIN64
+                if ( p_base )                                                    UnmapViewOfFile(p_base);
+                if ( p_store->mapping )                                          CloseHandle(p_store->mapping);
+                if ( p_store->file && p_store->file != INVALID_HANDLE_VALUE )    CloseHandle(p_store->file);
+            #else
+                if ( p_base ) munmap((void *) p_base, size);
+            #endif
+
+            // Release the store
+            p_store = GEOMETRY_REALLOC(p_store, 0);
+
+            // Error
+            return 0;
+    }
+}
+
+int geometry_store_get ( geometry_store *p_store, size_t index, geometry *p_geometry )
+{
+
+    // Argument check
+    if ( p_store    ==       (void *) 0 ) goto no_store;
+    if ( p_geometry ==       (void *) 0 ) goto no_geometry;
+    if ( index      >= p_store->quantity ) goto out_of_bounds;
+
+    // Initialized data
+    const geometry_store_entry *p_entry = &p_store->p_directory[index];
+    const void                 *p_data  = p_store->p_base + p_entry->offset;
+    geometry                    _view   = { .type = (enum geometry_type_e) p_entry->type };
+
+    // Strategy
+    switch ( _view.type )
+    {
+        case GEOMETRY_POINT:
+            _view.point = *(const geometry_point *) p_data;
+            break;
+
+        case GEOMETRY_POINT_LIST:
+            _view.point_list = (geometry_point_list) { .quantity = (size_t) p_entry->quantity, .p_points = (geometry_point *) p_data };
+            break;
+
+        case GEOMETRY_LINE:
+            _view.line = *(const geometry_line *) p_data;
+            break;
+
+        case GEOMETRY_LINE_LIST:
+            _view.line_list = (geometry_line_list) { .quantity = (size_t) p_entry->quantity, .p_lines = (geometry_line *) p_data };
+            break;
+
+        case GEOMETRY_TRIANGLE:
+            _view.triangle = *(const geometry_triangle *) p_data;
+            break;
+
+        case GEOMETRY_POLYGON:
+            _view.polygon = (geometry_polygon) { .quantity = (size_t) p_entry->quantity, .p_verticies = (geometry_point *) p_data };
+            break;
+
+        case GEOMETRY_POLYGON_LIST:
+        {
+
+            // Initialized data
+            size_t *p_offsets = (size_t *) p_data;
+
+            // Store the view. The verticies follow the offsets.
+            _view.polygon_list = (geometry_polygon_list)
+            {
+                .quantity        = (size_t) p_entry->quantity,
+                .vertex_quantity = (size_t) p_entry->vertex_quantity,
+                .p_offsets       = p_offsets,
+                .p_verticies     = (geometry_point *) &p_offsets[p_entry->quantity + 1]
+            };
+
+            // The ring offsets must span the verticies
+            if ( p_offsets[0] != 0 || p_offsets[p_entry->quantity] != p_entry->vertex_quantity ) goto corrupt_entry;
+
+            // Each ring must end at or after it starts, inside of the verticies
+            for (size_t i = 0; i < p_entry->quantity; i++)
+                if ( p_offsets[i] > p_offsets[i + 1] || p_offsets[i + 1] > p_entry->vertex_quantity ) goto corrupt_entry;
+
+            // Done
+            break;
+        }
+
+        default:
+
+            // Error
+            goto corrupt_entry;
+    }
+
+    // Return the view to the caller
+    *p_geometry = _view;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_store:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_store\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            out_of_bounds:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"index\" is out of bounds in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Store errors
+        {
+            corrupt_entry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Entry %zu of the store is corrupt in call to function \"%s\"\n", index, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_store_close ( geometry_store **pp_store )
+{
+
+    // Argument check
+    if ( pp_store  == (void *) 0 ) goto no_store;
+    if ( *pp_store == (void *) 0 ) goto pointer_to_null_pointer;
+
+    // Initialized data
+    geometry_store *p_store = *pp_store;
+
+    // No more pointer for caller
+    *pp_store = (void *) 0;
+
+    // Unmap the file
+    #ifdef _WIN64
+        UnmapViewOfFile(p_store->p_base);
+        CloseHandle(p_store->mapping);
+        CloseHandle(p_store->file);
+    #else
+        munmap((void *) p_store->p_base, p_store->size);
+    #endif
+
+    // Release the store
+    p_store = GEOMETRY_REALLOC(p_store, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_store:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pp_store\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            pointer_to_null_pointer:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"pp_store\" points to null pointer in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,1454 @@
+/** !
+ * Streaming geometry loaders
+ *
+ * @file stream.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <string.h>
+
+// geometry
+#include <geometry/stream.h>
+#include <geometry/arena.h>
+
+// Preprocessor definitions
+#define GEOMETRY_JSON_TOKEN_LENGTH_MAX 64
+
+// Structure declarations
+struct geometry_json_reader_s;
+struct geometry_vertex_buffer_s;
+struct geometry_index_buffer_s;
+struct geometry_coordinates_s;
+
+// Type definitions
+typedef struct geometry_json_reader_s   geometry_json_reader;
+typedef struct geometry_vertex_buffer_s geometry_vertex_buffer;
+typedef struct geometry_index_buffer_s  geometry_index_buffer;
+typedef struct geometry_coordinates_s   geometry_coordinates;
+
+// Structure definitions
+struct geometry_json_reader_s
+{
+    const char *p_text;
+    size_t      length,
+                position,
+                offset;
+    FILE       *p_file;
+    char       *p_chunk;
+};
+
+struct geometry_vertex_buffer_s
+{
+    size_t          quantity,
+                    capacity;
+    geometry_point *p_points;
+};
+
+struct geometry_index_buffer_s
+{
+    size_t  quantity,
+            capacity;
+    size_t *p_indices;
+};
+
+// The coordinates of a GeoJSON geometry. The end of each ring (or line
+// string) is an index into the verticies, and the end of each part is an
+// index into the rings.
+struct geometry_coordinates_s
+{
+    size_t                 depth;
+    geometry_vertex_buffer verticies;
+    geometry_index_buffer  rings,
+                           parts;
+};
+
+// Forward declarations
+/** !
+ * Get the next character of the json text without consuming it
+ *
+ * @param p_reader the reader
+ *
+ * @return the next character, or -1 at the end of the text
+ */
+static int geometry_json_peek ( geometry_json_reader *p_reader );
+
+/** !
+ * Skip whitespace, then get the next character without consuming it
+ *
+ * @param p_reader the reader
+ *
+ * @return the next character, or -1 at the end of the text
+ */
+static int geometry_json_peek_token ( geometry_json_reader *p_reader );
+
+/** !
+ * Skip whitespace, then consume a character if it matches
+ *
+ * @param p_reader the reader
+ * @param c        the character
+ *
+ * @return 1 if the character was consumed, else 0
+ */
+static int geometry_json_accept ( geometry_json_reader *p_reader, char c );
+
+/** !
+ * Read a json number
+ *
+ * @param p_reader the reader
+ * @param p_number return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_json_read_number ( geometry_json_reader *p_reader, double *p_number );
+
+/** !
+ * Read a json string. Strings longer than the buffer are truncated.
+ *
+ * @param p_reader the reader
+ * @param p_string return
+ * @param size     the size of the string buffer
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_json_read_string ( geometry_json_reader *p_reader, char *p_string, size_t size );
+
+/** !
+ * Skip over any json value
+ *
+ * @param p_reader the reader
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_json_skip_value ( geometry_json_reader *p_reader );
+
+/** !
+ * Read a vertex, as either { "x" : x, "y" : y } or [ x, y ]
+ *
+ * @param p_reader the reader
+ * @param p_point  return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_json_read_vertex ( geometry_json_reader *p_reader, geometry_point *p_point );
+
+/** !
+ * Append a point to a vertex buffer, growing it if needed
+ *
+ * @param p_buffer the vertex buffer
+ * @param point    the point
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_vertex_buffer_push ( geometry_vertex_buffer *p_buffer, geometry_point point );
+
+/** !
+ * Append an index to an index buffer, growing it if needed
+ *
+ * @param p_buffer the index buffer
+ * @param index    the index
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_index_buffer_push ( geometry_index_buffer *p_buffer, size_t index );
+
+/** !
+ * Read the nested arrays of a GeoJSON "coordinates" member
+ *
+ * @param p_reader      the reader
+ * @param p_coordinates the coordinates
+ * @param p_depth       return the nesting depth; 1 for a position, 0 for an empty array
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_json_read_coordinates ( geometry_json_reader *p_reader, geometry_coordinates *p_coordinates, size_t *p_depth );
+
+/** !
+ * Construct a geometry from GeoJSON coordinates
+ *
+ * @param p_coordinates the coordinates
+ * @param p_type        the GeoJSON geometry type
+ * @param p_arena       the arena
+ * @param p_geometry    return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_coordinates_build ( geometry_coordinates *p_coordinates, const char *p_type, geometry_arena *p_arena, geometry *p_geometry );
+
+/** !
+ * Read a GeoJSON geometry object
+ *
+ * @param p_reader      the reader
+ * @param p_coordinates scratch space for the coordinates
+ * @param p_arena       the arena
+ * @param p_geometry    return
+ * @param p_empty       return true if the geometry is null or empty
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_json_read_geometry ( geometry_json_reader *p_reader, geometry_coordinates *p_coordinates, geometry_arena *p_arena, geometry *p_geometry, bool *p_empty );
+
+/** !
+ * Read a GeoJSON feature object
+ *
+ * @param p_reader      the reader
+ * @param p_coordinates scratch space for the coordinates
+ * @param p_arena       the arena
+ * @param p_geometry    return
+ * @param p_empty       return true if the feature has no geometry
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_json_read_feature ( geometry_json_reader *p_reader, geometry_coordinates *p_coordinates, geometry_arena *p_arena, geometry *p_geometry, bool *p_empty );
+
+/** !
+ * Read a GeoJSON feature collection, passing its geometry to a callback
+ * in batches
+ *
+ * @param p_reader    the reader
+ * @param batch_size  the maximum quantity of geometry in each batch
+ * @param pfn_batch   the callback
+ * @param p_parameter a parameter for the callback
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_feature_collection_read ( geometry_json_reader *p_reader, size_t batch_size, fn_geometry_batch pfn_batch, void *p_parameter );
+
+// Function definitions
+static int geometry_json_peek ( geometry_json_reader *p_reader )
+{
+
+    // End of chunk
+    if ( p_reader->position >= p_reader->length )
+    {
+
+        // End of text
+        if ( p_reader->p_file == (void *) 0 ) return -1;
+
+        // Tokens are consumed as they are read, so the next chunk
+        // can overwrite the last one
+        p_reader->offset   += p_reader->length,
+        p_reader->position  = 0,
+        p_reader->length    = fread(p_reader->p_chunk, 1, GEOMETRY_STREAM_CHUNK_SIZE, p_reader->p_file);
+
+        // End of file
+        if ( p_reader->length == 0 ) return -1;
+    }
+
+    // Success
+    return (unsigned char) p_reader->p_text[p_reader->position];
+}
+
+static int geometry_json_peek_token ( geometry_json_reader *p_reader )
+{
+
+    // Initialized data
+    int c = geometry_json_peek(p_reader);
+
+    // Skip whitespace
+    while ( c == ' ' || c == '\t' || c == '\n' || c == '\r' )
+        p_reader->position++,
+        c = geometry_json_peek(p_reader);
+
+    // Success
+    return c;
+}
+
+static int geometry_json_accept ( geometry_json_reader *p_reader, char c )
+{
+
+    // Mismatch
+    if ( geometry_json_peek_token(p_reader) != (unsigned char) c ) return 0;
+
+    // Consume
+    p_reader->position++;
+
+    // Success
+    return 1;
+}
+
+static int geometry_json_read_number ( geometry_json_reader *p_reader, double *p_number )
+{
+
+    // Initialized data
+    char   _token[GEOMETRY_JSON_TOKEN_LENGTH_MAX] = { 0 };
+    char  *p_end  = (void *) 0;
+    size_t length = 0;
+    int    c      = geometry_json_peek_token(p_reader);
+
+    // Copy the characters of the number
+    while ( ( c >= '0' && c <= '9' ) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E' )
+    {
+
+        // Error check
+        if ( length == sizeof(_token) - 1 ) return 0;
+
+        // Store the character
+        _token[length++] = (char) c;
+
+        // Next
+        p_reader->position++,
+        c = geometry_json_peek(p_reader);
+    }
+
+    // Error check
+    if ( length == 0 ) return 0;
+
+    // Parse the number
+    *p_number = strtod(_token, &p_end);
+
+    // Success
+    return p_end == &_token[length];
+}
+
+static int geometry_json_read_string ( geometry_json_reader *p_reader, char *p_string, size_t size )
+{
+
+    // Initialized data
+    size_t length = 0;
+    int    c      = 0;
+
+    // Opening quote
+    if ( geometry_json_accept(p_reader, '"') == 0 ) return 0;
+
+    // Copy until the closing quote
+    while ( ( c = geometry_json_peek(p_reader) ) != '"' )
+    {
+
+        // Error check
+        if ( c == -1 ) return 0;
+
+        // Escape sequence. Only the escaped character is kept.
+        if ( c == '\\' )
+        {
+
+            // Consume the backslash
+            p_reader->position++;
+
+            // Error check
+            if ( ( c = geometry_json_peek(p_reader) ) == -1 ) return 0;
+        }
+
+        // Store the character
+        if ( length + 1 < size ) p_string[length++] = (char) c;
+
+        // Next
+        p_reader->position++;
+    }
+
+    // Consume the closing quote
+    p_reader->position++;
+
+    // Terminate the string
+    if ( size ) p_string[length] = '\0';
+
+    // Success
+    return 1;
+}
+
+static int geometry_json_skip_value ( geometry_json_reader *p_reader )
+{
+
+    // Initialized data
+    size_t depth = 0;
+
+    do
+    {
+
+        // Initialized data
+        int c = geometry_json_peek_token(p_reader);
+
+        // Strategy
+        switch ( c )
+        {
+            case -1:
+
+                // Error
+                return 0;
+
+            case '"':
+
+                // Skip the string
+                if ( geometry_json_read_string(p_reader, (void *) 0, 0) == 0 ) return 0;
+
+                // Done
+                break;
+
+            case '{':
+            case '[':
+
+                // Descend
+                depth++,
+                p_reader->position++;
+
+                // Done
+                break;
+
+            case '}':
+            case ']':
+
+                // Error check
+                if ( depth == 0 ) return 0;
+
+                // Ascend
+                depth--,
+                p_reader->position++;
+
+                // Done
+                break;
+
+            case ',':
+            case ':':
+
+                // Separators only occur inside a container
+                if ( depth == 0 ) return 0;
+
+                // Consume
+                p_reader->position++;
+
+                // Done
+                break;
+
+            default:
+            {
+
+                // Initialized data
+                size_t consumed = 0;
+
+                // Numbers, true, false and null
+                while ( ( c >= '0' && c <= '9' ) || ( c >= 'a' && c <= 'z' ) || c == '-' || c == '+' || c == '.' || c == 'E' )
+                    p_reader->position++,
+                    consumed++,
+                    c = geometry_json_peek(p_reader);
+
+                // Unrecognized characters are never consumed
+                if ( consumed == 0 ) return 0;
+
+                // Done
+                break;
+            }
+        }
+    } while ( depth );
+
+    // Success
+    return 1;
+}
+
+static int geometry_json_read_vertex ( geometry_json_reader *p_reader, geometry_point *p_point )
+{
+
+    // Array vertex
+    if ( geometry_json_accept(p_reader, '[') )
+    {
+
+        // Read x and y
+        if ( geometry_json_read_number(p_reader, &p_point->x) == 0 ) return 0;
+        if ( geometry_json_accept(p_reader, ',')              == 0 ) return 0;
+        if ( geometry_json_read_number(p_reader, &p_point->y) == 0 ) return 0;
+
+        // Skip any further coordinates
+        while ( geometry_json_accept(p_reader, ',') )
+            if ( geometry_json_skip_value(p_reader) == 0 ) return 0;
+
+        // Success
+        return geometry_json_accept(p_reader, ']');
+    }
+
+    // Object vertex
+    if ( geometry_json_accept(p_reader, '{') )
+    {
+
+        // Initialized data
+        bool has_x = false,
+             has_y = false;
+
+        // Empty object
+        if ( geometry_json_accept(p_reader, '}') ) return 0;
+
+        // Iterate over each property
+        do
+        {
+
+            // Initialized data
+            char _key[GEOMETRY_JSON_TOKEN_LENGTH_MAX] = { 0 };
+
+            // Read the key
+            if ( geometry_json_read_string(p_reader, _key, sizeof(_key)) == 0 ) return 0;
+            if ( geometry_json_accept(p_reader, ':')                     == 0 ) return 0;
+
+            // Read x
+            if ( strcmp(_key, "x") == 0 )
+            {
+                if ( geometry_json_read_number(p_reader, &p_point->x) == 0 ) return 0;
+                has_x = true;
+            }
+
+            // Read y
+            else if ( strcmp(_key, "y") == 0 )
+            {
+                if ( geometry_json_read_number(p_reader, &p_point->y) == 0 ) return 0;
+                has_y = true;
+            }
+
+            // Skip any other property
+            else if ( geometry_json_skip_value(p_reader) == 0 ) return 0;
+
+        } while ( geometry_json_accept(p_reader, ',') );
+
+        // Success
+        return geometry_json_accept(p_reader, '}') && has_x && has_y;
+    }
+
+    // Error
+    return 0;
+}
+
+static int geometry_vertex_buffer_push ( geometry_vertex_buffer *p_buffer, geometry_point point )
+{
+
+    // Grow the buffer
+    if ( p_buffer->quantity == p_buffer->capacity )
+    {
+
+        // Initialized data
+        size_t          capacity = ( p_buffer->capacity ) ? p_buffer->capacity * 2 : 64;
+        geometry_point *p_points = GEOMETRY_REALLOC(p_buffer->p_points, sizeof(geometry_point) * capacity);
+
+        // Error check
+        if ( p_points == (void *) 0 ) return 0;
+
+        // Store the larger buffer
+        p_buffer->p_points = p_points,
+        p_buffer->capacity = capacity;
+    }
+
+    // Store the point
+    p_buffer->p_points[p_buffer->quantity++] = point;
+
+    // Success
+    return 1;
+}
+
+static int geometry_index_buffer_push ( geometry_index_buffer *p_buffer, size_t index )
+{
+
+    // Grow the buffer
+    if ( p_buffer->quantity == p_buffer->capacity )
+    {
+
+        // Initialized data
+        size_t  capacity  = ( p_buffer->capacity ) ? p_buffer->capacity * 2 : 16;
+        size_t *p_indices = GEOMETRY_REALLOC(p_buffer->p_indices, sizeof(size_t) * capacity);
+
+        // Error check
+        if ( p_indices == (void *) 0 ) return 0;
+
+        // Store the larger buffer
+        p_buffer->p_indices = p_indices,
+        p_buffer->capacity  = capacity;
+    }
+
+    // Store the index
+    p_buffer->p_indices[p_buffer->quantity++] = index;
+
+    // Success
+    return 1;
+}
+
+static int geometry_json_read_coordinates ( geometry_json_reader *p_reader, geometry_coordinates *p_coordinates, size_t *p_depth )
+{
+
+    // Initialized data
+    size_t depth = 0;
+
+    // Open the array
+    if ( geometry_json_accept(p_reader, '[') == 0 ) return 0;
+
+    // Empty array
+    if ( geometry_json_accept(p_reader, ']') )
+    {
+
+        // Store the depth
+        *p_depth = 0;
+
+        // Success
+        return 1;
+    }
+
+    // Position
+    if ( geometry_json_peek_token(p_reader) != '[' )
+    {
+
+        // Initialized data
+        geometry_point _point = { 0 };
+
+        // Read x and y
+        if ( geometry_json_read_number(p_reader, &_point.x) == 0 ) return 0;
+        if ( geometry_json_accept(p_reader, ',')            == 0 ) return 0;
+        if ( geometry_json_read_number(p_reader, &_point.y) == 0 ) return 0;
+
+        // Skip any further coordinates
+        while ( geometry_json_accept(p_reader, ',') )
+            if ( geometry_json_skip_value(p_reader) == 0 ) return 0;
+
+        // Close the array
+        if ( geometry_json_accept(p_reader, ']') == 0 ) return 0;
+
+        // Store the position
+        if ( geometry_vertex_buffer_push(&p_coordinates->verticies, _point) == 0 ) return 0;
+
+        // Store the depth
+        *p_depth = 1;
+
+        // Success
+        return 1;
+    }
+
+    // Array of arrays
+    do
+    {
+
+        // Initialized data
+        size_t child_depth = 0;
+
+        // Read the child
+        if ( geometry_json_read_coordinates(p_reader, p_coordinates, &child_depth) == 0 ) return 0;
+
+        // Every child must be a non empty array of the same depth
+        if ( child_depth == 0 ) return 0;
+        if ( depth && child_depth != depth ) return 0;
+
+        // Store the depth
+        depth = child_depth;
+
+    } while ( geometry_json_accept(p_reader, ',') );
+
+    // Close the array
+    if ( geometry_json_accept(p_reader, ']') == 0 ) return 0;
+
+    // The deepest GeoJSON geometry is a MultiPolygon
+    if ( ++depth > 4 ) return 0;
+
+    // Store the end of a ring
+    if ( depth == 2 )
+        if ( geometry_index_buffer_push(&p_coordinates->rings, p_coordinates->verticies.quantity) == 0 ) return 0;
+
+    // Store the end of a part
+    if ( depth == 3 )
+        if ( geometry_index_buffer_push(&p_coordinates->parts, p_coordinates->rings.quantity) == 0 ) return 0;
+
+    // Store the depth
+    *p_depth = depth;
+
+    // Success
+    return 1;
+}
+
+static int geometry_coordinates_build ( geometry_coordinates *p_coordinates, const char *p_type, geometry_arena *p_arena, geometry *p_geometry )
+{
+
+    // Initialized data
+    size_t          depth       = p_coordinates->depth;
+    size_t          quantity    = p_coordinates->verticies.quantity;
+    geometry_point *p_verticies = p_coordinates->verticies.p_points;
+    size_t         *p_rings     = p_coordinates->rings.p_indices;
+
+    // Point
+    if ( strcmp(p_type, "Point") == 0 )
+    {
+
+        // Error check
+        if ( depth != 1 ) return 0;
+
+        // Store the point
+        *p_geometry = (geometry) { .type = GEOMETRY_POINT, .point = p_verticies[0] };
+
+        // Success
+        return 1;
+    }
+
+    // MultiPoint
+    if ( strcmp(p_type, "MultiPoint") == 0 )
+    {
+
+        // Initialized data
+        geometry_point *p_points = (void *) 0;
+
+        // Error check
+        if ( depth != 2 ) return 0;
+
+        // Allocate the points
+        p_points = geometry_allocate(p_arena, sizeof(geometry_point) * quantity);
+
+        // Error check
+        if ( p_points == (void *) 0 ) return 0;
+
+        // Copy the points
+        memcpy(p_points, p_verticies, sizeof(geometry_point) * quantity);
+
+        // Store the point list
+        *p_geometry = (geometry)
+        {
+            .type       = GEOMETRY_POINT_LIST,
+            .point_list = { .quantity = quantity, .p_points = p_points }
+        };
+
+        // Success
+        return 1;
+    }
+
+    // LineString and MultiLineString
+    if ( strcmp(p_type, "LineString") == 0 || strcmp(p_type, "MultiLineString") == 0 )
+    {
+
+        // Initialized data
+        bool           multi    = ( p_type[0] == 'M' );
+        size_t         segments = 0,
+                       written  = 0;
+        geometry_line *p_lines  = (void *) 0;
+
+        // Error check
+        if ( depth != ( multi ? 3 : 2 ) ) return 0;
+
+        // Count the segments
+        for (size_t i = 0, start = 0; i < p_coordinates->rings.quantity; start = p_rings[i], i++)
+        {
+
+            // Error check
+            if ( p_rings[i] - start < 2 ) return 0;
+
+            // Accumulate
+            segments += p_rings[i] - start - 1;
+        }
+
+        // A single segment is a line
+        if ( multi == false && segments == 1 )
+        {
+
+            // Store the line
+            *p_geometry = (geometry)
+            {
+                .type = GEOMETRY_LINE,
+                .line = { p_verticies[0].x, p_verticies[0].y, p_verticies[1].x, p_verticies[1].y }
+            };
+
+            // Success
+            return 1;
+        }
+
+        // Allocate the lines
+        p_lines = geometry_allocate(p_arena, sizeof(geometry_line) * segments);
+
+        // Error check
+        if ( p_lines == (void *) 0 ) return 0;
+
+        // Store each segment
+        for (size_t i = 0, start = 0; i < p_coordinates->rings.quantity; start = p_rings[i], i++)
+            for (size_t j = start + 1; j < p_rings[i]; j++)
+                p_lines[written++] = (geometry_line) { p_verticies[j - 1].x, p_verticies[j - 1].y, p_verticies[j].x, p_verticies[j].y };
+
+        // Store the line list
+        *p_geometry = (geometry)
+        {
+            .type      = GEOMETRY_LINE_LIST,
+            .line_list = { .quantity = segments, .p_lines = p_lines }
+        };
+
+        // Success
+        return 1;
+    }
+
+    // Polygon and MultiPolygon
+    if ( strcmp(p_type, "Polygon") == 0 || strcmp(p_type, "MultiPolygon") == 0 )
+    {
+
+        // Initialized data
+        bool            multi           = ( p_type[0] == 'M' );
+        size_t          polygons        = p_coordinates->parts.quantity,
+                        vertex_quantity = 0;
+        size_t         *p_offsets       = (void *) 0;
+        geometry_point *p_result        = (void *) 0;
+
+        // Error check
+        if ( depth != ( multi ? 4 : 3 ) ) return 0;
+
+        // Holes are not supported, so each polygon is exactly one ring
+        if ( p_coordinates->rings.quantity != polygons ) return 0;
+
+        // Count the verticies. GeoJSON rings repeat the first vertex at the
+        // end, and this library closes rings implicitly.
+        for (size_t i = 0, start = 0; i < polygons; start = p_rings[i], i++)
+        {
+
+            // Initialized data
+            size_t count = p_rings[i] - start;
+
+            // Drop the closing vertex
+            if ( count > 1 && p_verticies[start].x == p_verticies[p_rings[i] - 1].x && p_verticies[start].y == p_verticies[p_rings[i] - 1].y ) count--;
+
+            // Error check
+            if ( count < 3 ) return 0;
+
+            // Accumulate
+            vertex_quantity += count;
+        }
+
+        // Polygon
+        if ( multi == false )
+        {
+
+            // Allocate the verticies
+            p_result = geometry_allocate(p_arena, sizeof(geometry_point) * vertex_quantity);
+
+            // Error check
+            if ( p_result == (void *) 0 ) return 0;
+
+            // Copy the verticies
+            memcpy(p_result, p_verticies, sizeof(geometry_point) * vertex_quantity);
+
+            // Store the polygon
+            *p_geometry = (geometry)
+            {
+                .type    = GEOMETRY_POLYGON,
+                .polygon = { .quantity = vertex_quantity, .p_verticies = p_result }
+            };
+
+            // Success
+            return 1;
+        }
+
+        // Allocate the offsets and the verticies in one block
+        p_offsets = geometry_allocate(p_arena, sizeof(size_t) * ( polygons + 1 ) + sizeof(geometry_point) * vertex_quantity);
+
+        // Error check
+        if ( p_offsets == (void *) 0 ) return 0;
+
+        // The verticies follow the offsets
+        p_result = (geometry_point *) &p_offsets[polygons + 1];
+
+        // Pack each ring
+        p_offsets[0] = 0;
+        for (size_t i = 0, start = 0; i < polygons; start = p_rings[i], i++)
+        {
+
+            // Initialized data
+            size_t count = p_rings[i] - start;
+
+            // Drop the closing vertex
+            if ( p_verticies[start].x == p_verticies[p_rings[i] - 1].x && p_verticies[start].y == p_verticies[p_rings[i] - 1].y ) count--;
+
+            // Copy the ring
+            memcpy(&p_result[p_offsets[i]], &p_verticies[start], sizeof(geometry_point) * count);
+
+            // Store the end of the polygon
+            p_offsets[i + 1] = p_offsets[i] + count;
+        }
+
+        // Store the polygon list
+        *p_geometry = (geometry)
+        {
+            .type         = GEOMETRY_POLYGON_LIST,
+            .polygon_list =
+            {
+                .quantity        = polygons,
+                .vertex_quantity = vertex_quantity,
+                .p_offsets       = p_offsets,
+                .p_verticies     = p_result
+            }
+        };
+
+        // Success
+        return 1;
+    }
+
+    // Unsupported type
+    return 0;
+}
+
+static int geometry_json_read_geometry ( geometry_json_reader *p_reader, geometry_coordinates *p_coordinates, geometry_arena *p_arena, geometry *p_geometry, bool *p_empty )
+{
+
+    // Initialized data
+    char _type[GEOMETRY_JSON_TOKEN_LENGTH_MAX] = { 0 };
+    bool has_coordinates = false;
+
+    // Null geometry
+    if ( geometry_json_peek_token(p_reader) == 'n' )
+    {
+
+        // Skip the null
+        if ( geometry_json_skip_value(p_reader) == 0 ) return 0;
+
+        // Store the result
+        *p_empty = true;
+
+        // Success
+        return 1;
+    }
+
+    // Open the object
+    if ( geometry_json_accept(p_reader, '{') == 0 ) return 0;
+
+    // Reuse the coordinate buffers
+    p_coordinates->depth              = 0,
+    p_coordinates->verticies.quantity = 0,
+    p_coordinates->rings.quantity     = 0,
+    p_coordinates->parts.quantity     = 0;
+
+    // Iterate over each property
+    if ( geometry_json_accept(p_reader, '}') == 0 )
+    {
+        do
+        {
+
+            // Initialized data
+            char _key[GEOMETRY_JSON_TOKEN_LENGTH_MAX] = { 0 };
+
+            // Read the key
+            if ( geometry_json_read_string(p_reader, _key, sizeof(_key)) == 0 ) return 0;
+            if ( geometry_json_accept(p_reader, ':')                     == 0 ) return 0;
+
+            // Read the type
+            if ( strcmp(_key, "type") == 0 )
+            {
+                if ( geometry_json_read_string(p_reader, _type, sizeof(_type)) == 0 ) return 0;
+            }
+
+            // Read the coordinates
+            else if ( strcmp(_key, "coordinates") == 0 )
+            {
+                if ( geometry_json_read_coordinates(p_reader, p_coordinates, &p_coordinates->depth) == 0 ) return 0;
+                has_coordinates = true;
+            }
+
+            // Skip any other property
+            else if ( geometry_json_skip_value(p_reader) == 0 ) return 0;
+
+        } while ( geometry_json_accept(p_reader, ',') );
+
+        // Close the object
+        if ( geometry_json_accept(p_reader, '}') == 0 ) return 0;
+    }
+
+    // Error check
+    if ( has_coordinates == false ) return 0;
+
+    // Empty geometry
+    if ( p_coordinates->depth == 0 )
+    {
+
+        // Store the result
+        *p_empty = true;
+
+        // Success
+        return 1;
+    }
+
+    // Store the result
+    *p_empty = false;
+
+    // Success
+    return geometry_coordinates_build(p_coordinates, _type, p_arena, p_geometry);
+}
+
+static int geometry_json_read_feature ( geometry_json_reader *p_reader, geometry_coordinates *p_coordinates, geometry_arena *p_arena, geometry *p_geometry, bool *p_empty )
+{
+
+    // Features without a geometry member are empty
+    *p_empty = true;
+
+    // Open the object
+    if ( geometry_json_accept(p_reader, '{') == 0 ) return 0;
+
+    // Empty feature
+    if ( geometry_json_accept(p_reader, '}') ) return 1;
+
+    // Iterate over each property
+    do
+    {
+
+        // Initialized data
+        char _key[GEOMETRY_JSON_TOKEN_LENGTH_MAX] = { 0 };
+
+        // Read the key
+        if ( geometry_json_read_string(p_reader, _key, sizeof(_key)) == 0 ) return 0;
+        if ( geometry_json_accept(p_reader, ':')                     == 0 ) return 0;
+
+        // Read the geometry
+        if ( strcmp(_key, "geometry") == 0 )
+        {
+            if ( geometry_json_read_geometry(p_reader, p_coordinates, p_arena, p_geometry, p_empty) == 0 ) return 0;
+        }
+
+        // Skip the properties, and anything else
+        else if ( geometry_json_skip_value(p_reader) == 0 ) return 0;
+
+    } while ( geometry_json_accept(p_reader, ',') );
+
+    // Success
+    return geometry_json_accept(p_reader, '}');
+}
+
+static int geometry_feature_collection_read ( geometry_json_reader *p_reader, size_t batch_size, fn_geometry_batch pfn_batch, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_coordinates  _coordinates = { 0 };
+    geometry_arena       *p_arena      = (void *) 0;
+    geometry             *p_batch      = (void *) 0;
+    size_t                quantity     = 0;
+    bool                  has_features = false,
+                          result       = false;
+
+    // Allocate the batch
+    p_batch = GEOMETRY_REALLOC(0, sizeof(geometry) * batch_size);
+
+    // Error check
+    if ( p_batch == (void *) 0 ) goto no_mem;
+
+    // Construct an arena for the coordinates of each batch
+    if ( geometry_arena_create(&p_arena, 0) == 0 ) goto failed_to_create_arena;
+
+    // Open the feature collection
+    if ( geometry_json_accept(p_reader, '{') == 0 ) goto wrong_type;
+
+    // Iterate over each property
+    if ( geometry_json_accept(p_reader, '}') == 0 )
+    {
+        do
+        {
+
+            // Initialized data
+            char _key[GEOMETRY_JSON_TOKEN_LENGTH_MAX] = { 0 };
+
+            // Read the key
+            if ( geometry_json_read_string(p_reader, _key, sizeof(_key)) == 0 ) goto failed_to_parse;
+            if ( geometry_json_accept(p_reader, ':')                     == 0 ) goto failed_to_parse;
+
+            // Skip anything other than the features
+            if ( strcmp(_key, "features") != 0 )
+            {
+                if ( geometry_json_skip_value(p_reader) == 0 ) goto failed_to_parse;
+                continue;
+            }
+
+            // Open the features
+            if ( geometry_json_accept(p_reader, '[') == 0 ) goto failed_to_parse;
+
+            // Iterate over each feature
+            if ( geometry_json_accept(p_reader, ']') == 0 )
+            {
+                do
+                {
+
+                    // Initialized data
+                    bool empty = true;
+
+                    // Read the feature
+                    if ( geometry_json_read_feature(p_reader, &_coordinates, p_arena, &p_batch[quantity], &empty) == 0 ) goto failed_to_load_feature;
+
+                    // Skip features without geometry
+                    if ( empty ) continue;
+
+                    // Wait for a full batch
+                    if ( ++quantity < batch_size ) continue;
+
+                    // Deliver the batch
+                    if ( pfn_batch(p_batch, quantity, p_parameter) == 0 ) goto stop;
+
+                    // Reuse the batch, and the memory of its coordinates
+                    geometry_arena_reset(p_arena);
+                    quantity = 0;
+
+                } while ( geometry_json_accept(p_reader, ',') );
+
+                // Close the features
+                if ( geometry_json_accept(p_reader, ']') == 0 ) goto failed_to_parse;
+            }
+
+            // Store the result
+            has_features = true;
+
+        } while ( geometry_json_accept(p_reader, ',') );
+
+        // Close the feature collection
+        if ( geometry_json_accept(p_reader, '}') == 0 ) goto failed_to_parse;
+    }
+
+    // Error check
+    if ( has_features == false ) goto no_features;
+
+    // Deliver the last batch
+    if ( quantity ) pfn_batch(p_batch, quantity, p_parameter);
+
+    stop:
+
+    // Store the result
+    result = true;
+
+    // Clean up
+    release:
+
+    // Release the coordinate buffers
+    if ( _coordinates.verticies.p_points ) _coordinates.verticies.p_points = GEOMETRY_REALLOC(_coordinates.verticies.p_points, 0);
+    if ( _coordinates.rings.p_indices    ) _coordinates.rings.p_indices    = GEOMETRY_REALLOC(_coordinates.rings.p_indices, 0);
+    if ( _coordinates.parts.p_indices    ) _coordinates.parts.p_indices    = GEOMETRY_REALLOC(_coordinates.parts.p_indices, 0);
+
+    // Release the arena and the batch
+    if ( p_arena ) geometry_arena_destroy(&p_arena);
+    if ( p_batch ) p_batch = GEOMETRY_REALLOC(p_batch, 0);
+
+    // Done
+    return result;
+
+    // Error handling
+    {
+
+        // JSON errors
+        {
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Feature collection must be a json object in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                goto release;
+
+            failed_to_parse:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to parse json at offset %zu in call to function \"%s\"\n", p_reader->offset + p_reader->position, __FUNCTION__);
+                #endif
+
+                // Error
+                goto release;
+
+            no_features:
+                #ifndef NDEBUG
+                    log_error("[geometry] Feature collection has no \"features\" property in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                goto release;
+        }
+
+        // Geometry errors
+        {
+            failed_to_load_feature:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to load feature at offset %zu in call to function \"%s\"\n", p_reader->offset + p_reader->position, __FUNCTION__);
+                #endif
+
+                // Error
+                goto release;
+
+            failed_to_create_arena:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to construct arena in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                goto release;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                goto release;
+        }
+    }
+}
+
+int geometry_polygon_load_as_json_text ( geometry *p_geometry, const char *p_text, size_t length, geometry_arena *p_arena )
+{
+
+    // Argument check
+    if ( p_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_text     == (void *) 0 ) goto no_text;
+
+    // Initialized data
+    geometry_json_reader    _reader     = { .p_text = p_text, .length = length, .position = 0 };
+    geometry_vertex_buffer  _buffer     = { 0 };
+    geometry_point         *p_verticies = (void *) 0;
+
+    // Type check
+    if ( geometry_json_accept(&_reader, '[') == 0 ) goto wrong_type;
+
+    // Read each vertex straight into the vertex buffer
+    if ( geometry_json_accept(&_reader, ']') == 0 )
+    {
+        do
+        {
+
+            // Initialized data
+            geometry_point _point = { 0 };
+
+            // Read the vertex
+            if ( geometry_json_read_vertex(&_reader, &_point) == 0 ) goto failed_to_load_point;
+
+            // Store the vertex
+            if ( geometry_vertex_buffer_push(&_buffer, _point) == 0 ) goto no_mem;
+
+        } while ( geometry_json_accept(&_reader, ',') );
+
+        // Close the array
+        if ( geometry_json_accept(&_reader, ']') == 0 ) goto failed_to_load_point;
+    }
+
+    // Only whitespace may follow the array
+    if ( geometry_json_peek_token(&_reader) != -1 ) goto trailing_text;
+
+    // Error check
+    if ( _buffer.quantity < 3 ) goto not_a_polygon;
+
+    // Move the verticies into the arena
+    if ( p_arena )
+    {
+
+        // Allocate the verticies
+        p_verticies = geometry_allocate(p_arena, sizeof(geometry_point) * _buffer.quantity);
+
+        // Error check
+        if ( p_verticies == (void *) 0 ) goto no_mem;
+
+        // Copy the verticies
+        memcpy(p_verticies, _buffer.p_points, sizeof(geometry_point) * _buffer.quantity);
+
+        // Release the vertex buffer
+        _buffer.p_points = GEOMETRY_REALLOC(_buffer.p_points, 0);
+    }
+
+    // Keep the vertex buffer, trimmed to size
+    else
+    {
+
+        // Shrink the buffer
+        p_verticies = GEOMETRY_REALLOC(_buffer.p_points, sizeof(geometry_point) * _buffer.quantity);
+
+        // Shrinking may fail; the original buffer is still valid
+        if ( p_verticies == (void *) 0 ) p_verticies = _buffer.p_points;
+    }
+
+    // Store the polygon
+    *p_geometry = (geometry)
+    {
+        .type    = GEOMETRY_POLYGON,
+        .polygon =
+        {
+            .quantity    = _buffer.quantity,
+            .p_verticies = p_verticies
+        }
+    };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_text:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_text\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // JSON errors
+        {
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_text\" must be a json array in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            trailing_text:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"p_text\" has text after the json array at offset %zu in call to function \"%s\"\n", _reader.offset + _reader.position, __FUNCTION__);
+                #endif
+
+                // Release the vertex buffer
+                if ( _buffer.p_points ) _buffer.p_points = GEOMETRY_REALLOC(_buffer.p_points, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Geometry errors
+        {
+            failed_to_load_point:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to load vertex %zu at offset %zu in call to function \"%s\"\n", _buffer.quantity, _reader.offset + _reader.position, __FUNCTION__);
+                #endif
+
+                // Release the vertex buffer
+                if ( _buffer.p_points ) _buffer.p_points = GEOMETRY_REALLOC(_buffer.p_points, 0);
+
+                // Error
+                return 0;
+
+            not_a_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Polygon must have at least 3 points in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the vertex buffer
+                if ( _buffer.p_points ) _buffer.p_points = GEOMETRY_REALLOC(_buffer.p_points, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the vertex buffer
+                if ( _buffer.p_points ) _buffer.p_points = GEOMETRY_REALLOC(_buffer.p_points, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_feature_collection_load_as_json_text ( const char *p_text, size_t length, size_t batch_size, fn_geometry_batch pfn_batch, void *p_parameter )
+{
+
+    // Argument check
+    if ( p_text     == (void *) 0 ) goto no_text;
+    if ( batch_size ==          0 ) goto no_batch_size;
+    if ( pfn_batch  == (void *) 0 ) goto no_batch;
+
+    // Initialized data
+    geometry_json_reader _reader = { .p_text = p_text, .length = length };
+
+    // Success
+    return geometry_feature_collection_read(&_reader, batch_size, pfn_batch, p_parameter);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_text:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_text\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_batch_size:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"batch_size\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_batch:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pfn_batch\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_feature_collection_load_as_json_file ( FILE *p_file, size_t batch_size, fn_geometry_batch pfn_batch, void *p_parameter )
+{
+
+    // Argument check
+    if ( p_file     == (void *) 0 ) goto no_file;
+    if ( batch_size ==          0 ) goto no_batch_size;
+    if ( pfn_batch  == (void *) 0 ) goto no_batch;
+
+    // Initialized data
+    geometry_json_reader _reader = { 0 };
+    int                  result  = 0;
+
+    // Allocate a chunk
+    _reader.p_chunk = GEOMETRY_REALLOC(0, GEOMETRY_STREAM_CHUNK_SIZE);
+
+    // Error check
+    if ( _reader.p_chunk == (void *) 0 ) goto no_mem;
+
+    // The first peek fills the chunk
+    _reader.p_text = _reader.p_chunk,
+    _reader.p_file = p_file;
+
+    // Read the feature collection
+    result = geometry_feature_collection_read(&_reader, batch_size, pfn_batch, p_parameter);
+
+    // Release the chunk
+    _reader.p_chunk = GEOMETRY_REALLOC(_reader.p_chunk, 0);
+
+    // Done
+    return result;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_file:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_file\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_batch_size:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"batch_size\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_batch:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pfn_batch\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,1066 @@
+/** !
+ * Plane sweep
+ *
+ * @file sweep.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <string.h>
+
+// Header
+#include <geometry/sweep.h>
+#include <geometry/treap.h>
+
+// Structure declarations
+struct geometry_sweep_segment_s;
+struct geometry_sweep_endpoint_s;
+struct geometry_sweep_crossing_s;
+struct geometry_sweep_s;
+
+// Type definitions
+typedef struct geometry_sweep_segment_s  geometry_sweep_segment;
+typedef struct geometry_sweep_endpoint_s geometry_sweep_endpoint;
+typedef struct geometry_sweep_crossing_s geometry_sweep_crossing;
+typedef struct geometry_sweep_s          geometry_sweep;
+
+// Structure definitions
+// p0 is left of p1, or below p1 if the segment is vertical
+struct geometry_sweep_segment_s
+{
+    geometry_point p0,
+                   p1;
+    size_t         index;
+    bool           blue;
+};
+
+struct geometry_sweep_endpoint_s
+{
+    geometry_point point;
+    size_t         segment;
+    bool           end;
+};
+
+struct geometry_sweep_crossing_s
+{
+    geometry_point point;
+    size_t         a,
+                   b;
+};
+
+// Segments are red if they are from the first line list, and blue if
+// they are from the second. Stamps mark the segments that end at the
+// current point.
+struct geometry_sweep_s
+{
+    geometry_sweep_segment     *p_segments;
+    geometry_sweep_endpoint    *p_endpoints;
+    geometry_sweep_crossing    *p_crossings;
+    geometry_line_intersection *p_results;
+    size_t                     *p_group,
+                               *p_stamps;
+    size_t                      quantity,
+                                crossing_quantity,
+                                crossing_capacity,
+                                result_quantity,
+                                result_capacity,
+                                stamp;
+    geometry_treap              status;
+    geometry_point              point;
+    bool                        red_blue,
+                                proper_only,
+                                first_only,
+                                done,
+                                failed;
+};
+
+// Forward declarations
+/** !
+ * Sweep two line lists, or one line list
+ *
+ * @param p_sweep     the sweep, with red_blue, proper_only and first_only set
+ * @param p_a         a line list
+ * @param p_b         another line list, or null
+ *
+ * @sa geometry_sweep_release
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_sweep_run ( geometry_sweep *p_sweep, geometry_line_list *p_a, geometry_line_list *p_b );
+
+/** !
+ * Release the memory held by a sweep
+ *
+ * @param p_sweep the sweep
+ *
+ * @return void
+ */
+static void geometry_sweep_release ( geometry_sweep *p_sweep );
+
+/** !
+ * Process the endpoints at a point. Segments that end at the point are
+ * removed, segments that start at the point are inserted, and segments
+ * that pass through the point are reinserted in their order after it.
+ * Every pair of these segments meets at the point.
+ *
+ * @param p_sweep the sweep
+ * @param first   the first endpoint at the point
+ * @param last    one past the last endpoint at the point
+ *
+ * @return void
+ */
+static void geometry_sweep_endpoints ( geometry_sweep *p_sweep, size_t first, size_t last );
+
+/** !
+ * Process a crossing. The segments exchange places, and each is tested
+ * against its new neighbour.
+ *
+ * @param p_sweep    the sweep
+ * @param p_crossing the crossing
+ *
+ * @return void
+ */
+static void geometry_sweep_crossing_process ( geometry_sweep *p_sweep, geometry_sweep_crossing *p_crossing );
+
+/** !
+ * Test two neighbouring segments, and schedule their crossing if they
+ * cross ahead of the sweep
+ *
+ * @param p_sweep the sweep
+ * @param a       the lower segment, or GEOMETRY_TREAP_NONE
+ * @param b       the upper segment, or GEOMETRY_TREAP_NONE
+ *
+ * @return void
+ */
+static void geometry_sweep_check ( geometry_sweep *p_sweep, size_t a, size_t b );
+
+/** !
+ * Record that two segments meet
+ *
+ * @param p_sweep the sweep
+ * @param a       a segment
+ * @param b       another segment
+ * @param point   where they meet
+ * @param proper  true if neither segment ends at the point, and they are not colinear
+ *
+ * @return void
+ */
+static void geometry_sweep_report ( geometry_sweep *p_sweep, size_t a, size_t b, geometry_point point, bool proper );
+
+/** !
+ * Push a crossing onto the crossing heap
+ *
+ * @param p_sweep  the sweep
+ * @param crossing the crossing
+ *
+ * @return void
+ */
+static void geometry_sweep_push ( geometry_sweep *p_sweep, geometry_sweep_crossing crossing );
+
+/** !
+ * Pop the leftmost crossing from the crossing heap
+ *
+ * @param p_sweep the sweep
+ *
+ * @return the crossing
+ */
+static geometry_sweep_crossing geometry_sweep_pop ( geometry_sweep *p_sweep );
+
+/** !
+ * Compare two points in sweep order, by x and then by y
+ *
+ * @param p_a a point
+ * @param p_b another point
+ *
+ * @return < 0 if A is first, > 0 if B is first, else 0
+ */
+static int geometry_sweep_point_compare ( const geometry_point *p_a, const geometry_point *p_b );
+
+/** !
+ * qsort comparator for endpoints in sweep order
+ *
+ * @param p_a an endpoint
+ * @param p_b another endpoint
+ *
+ * @return < 0 if A is first, > 0 if B is first, else 0
+ */
+static int geometry_sweep_endpoint_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * qsort comparator for intersections by a, then by b
+ *
+ * @param p_a an intersection
+ * @param p_b another intersection
+ *
+ * @return < 0 if A is first, > 0 if B is first, else 0
+ */
+static int geometry_sweep_result_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * Order a segment that passes through the sweep point against a segment
+ * in the status, just after the sweep point
+ *
+ * @param a           the segment being inserted
+ * @param b           a segment in the status
+ * @param p_parameter the sweep
+ *
+ * @return < 0 if A is below B, else > 0
+ */
+static int geometry_sweep_compare ( size_t a, size_t b, void *p_parameter );
+
+/** !
+ * Locate the sweep point against a segment in the status
+ *
+ * @param item        the segment
+ * @param p_parameter the sweep
+ *
+ * @return > 0 if the point is above the segment, < 0 if below, 0 if on it
+ */
+static int geometry_sweep_locate ( size_t item, void *p_parameter );
+
+// Function definitions
+int geometry_line_list_intersections ( geometry_line_list *p_a, geometry_line_list *p_b, geometry_line_intersection *p_results, size_t capacity, size_t *p_quantity )
+{
+
+    // Argument check
+    if ( p_a        == (void *) 0 ) goto no_a;
+    if ( p_quantity == (void *) 0 ) goto no_quantity;
+    if ( capacity && p_results == (void *) 0 ) goto no_results;
+
+    // Initialized data
+    geometry_sweep _sweep = { .red_blue = ( p_b != (void *) 0 ) };
+
+    // Sweep
+    if ( geometry_sweep_run(&_sweep, p_a, p_b) == 0 ) goto failed_to_sweep;
+
+    // Store the results
+    if ( _sweep.result_quantity )
+        memcpy(p_results, _sweep.p_results, sizeof(geometry_line_intersection) * ( ( _sweep.result_quantity < capacity ) ? _sweep.result_quantity : capacity ));
+
+    // Return the quantity to the caller
+    *p_quantity = _sweep.result_quantity;
+
+    // Clean up
+    geometry_sweep_release(&_sweep);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_quantity:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_results:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_results\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_sweep:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to sweep line lists in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_line_list_intersects ( geometry_line_list *p_a, geometry_line_list *p_b, bool *p_result )
+{
+
+    // Argument check
+    if ( p_a      == (void *) 0 ) goto no_a;
+    if ( p_result == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    geometry_sweep _sweep = { .red_blue = ( p_b != (void *) 0 ), .first_only = true };
+
+    // Sweep until the first intersection
+    if ( geometry_sweep_run(&_sweep, p_a, p_b) == 0 ) goto failed_to_sweep;
+
+    // Return the result to the caller
+    *p_result = ( _sweep.result_quantity > 0 );
+
+    // Clean up
+    geometry_sweep_release(&_sweep);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_sweep:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to sweep line lists in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_line_list_crosses ( geometry_line_list *p_a, geometry_line_list *p_b, bool *p_result )
+{
+
+    // Argument check
+    if ( p_a      == (void *) 0 ) goto no_a;
+    if ( p_result == (void *) 0 ) goto no_result;
+
+    // Initialized data
+    geometry_sweep _sweep = { .red_blue = ( p_b != (void *) 0 ), .proper_only = true, .first_only = true };
+
+    // Sweep until the first crossing
+    if ( geometry_sweep_run(&_sweep, p_a, p_b) == 0 ) goto failed_to_sweep;
+
+    // Return the result to the caller
+    *p_result = ( _sweep.result_quantity > 0 );
+
+    // Clean up
+    geometry_sweep_release(&_sweep);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_a:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_a\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_sweep:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to sweep line lists in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static int geometry_sweep_run ( geometry_sweep *p_sweep, geometry_line_list *p_a, geometry_line_list *p_b )
+{
+
+    // Argument check
+    if ( p_a->quantity && p_a->p_lines == (void *) 0 ) goto no_lines;
+    if ( p_b && p_b->quantity && p_b->p_lines == (void *) 0 ) goto no_lines;
+
+    // Initialized data
+    size_t  a_quantity = p_a->quantity,
+            quantity   = a_quantity + ( ( p_b ) ? p_b->quantity : 0 ),
+            e          = 0;
+    void   *p_block    = (void *) 0;
+
+    // Nothing to sweep
+    if ( quantity == 0 ) return 1;
+
+    // Allocate the segments, the endpoints, the group, and the stamps
+    p_block = GEOMETRY_REALLOC(0, ( sizeof(geometry_sweep_segment) + 2 * sizeof(geometry_sweep_endpoint) + 2 * sizeof(size_t) ) * quantity);
+
+    // Error check
+    if ( p_block == (void *) 0 ) goto no_mem;
+
+    // Store the arrays
+    p_sweep->quantity    = quantity,
+    p_sweep->p_segments  = p_block,
+    p_sweep->p_endpoints = (geometry_sweep_endpoint *) ( p_sweep->p_segments + quantity ),
+    p_sweep->p_group     = (size_t *) ( p_sweep->p_endpoints + 2 * quantity ),
+    p_sweep->p_stamps    = p_sweep->p_group + quantity;
+
+    // Construct the status
+    if ( geometry_treap_construct(&p_sweep->status, quantity) == 0 ) goto failed_to_construct_treap;
+
+    // Store the segments, left endpoint first, and their endpoints
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        geometry_line  *p_line = ( i < a_quantity ) ? &p_a->p_lines[i] : &p_b->p_lines[i - a_quantity];
+        geometry_point  p0     = { .x = p_line->x0, .y = p_line->y0 },
+                        p1     = { .x = p_line->x1, .y = p_line->y1 };
+        bool            flip   = geometry_sweep_point_compare(&p1, &p0) < 0;
+
+        // Store the segment
+        p_sweep->p_segments[i] = (geometry_sweep_segment)
+        {
+            .p0    = ( flip ) ? p1 : p0,
+            .p1    = ( flip ) ? p0 : p1,
+            .index = ( i < a_quantity ) ? i : i - a_quantity,
+            .blue  = ( i >= a_quantity )
+        };
+
+        // Store the endpoints
+        p_sweep->p_endpoints[2 * i]     = (geometry_sweep_endpoint) { .point = p_sweep->p_segments[i].p0, .segment = i, .end = false },
+        p_sweep->p_endpoints[2 * i + 1] = (geometry_sweep_endpoint) { .point = p_sweep->p_segments[i].p1, .segment = i, .end = true  };
+
+        // Clear the stamp
+        p_sweep->p_stamps[i] = 0;
+    }
+
+    // Sort the endpoints in sweep order
+    qsort(p_sweep->p_endpoints, 2 * quantity, sizeof(geometry_sweep_endpoint), geometry_sweep_endpoint_compare);
+
+    // Sweep. At a point with both, crossings are processed before endpoints.
+    while ( p_sweep->done == false )
+    {
+
+        // Crossing
+        if ( p_sweep->crossing_quantity && ( e == 2 * quantity || geometry_sweep_point_compare(&p_sweep->p_crossings[0].point, &p_sweep->p_endpoints[e].point) <= 0 ) )
+        {
+
+            // Initialized data
+            geometry_sweep_crossing _crossing = geometry_sweep_pop(p_sweep);
+
+            // Process the crossing
+            geometry_sweep_crossing_process(p_sweep, &_crossing);
+        }
+
+        // Endpoints
+        else if ( e < 2 * quantity )
+        {
+
+            // Initialized data
+            size_t first = e;
+
+            // Find the endpoints at this point
+            while ( e < 2 * quantity && geometry_sweep_point_compare(&p_sweep->p_endpoints[first].point, &p_sweep->p_endpoints[e].point) == 0 ) e++;
+
+            // Process the endpoints
+            geometry_sweep_endpoints(p_sweep, first, e);
+        }
+
+        // Done
+        else break;
+    }
+
+    // Error check
+    if ( p_sweep->failed ) goto failed_to_sweep;
+
+    // Each pair may meet at more than one event, so sort the pairs and keep the first of each
+    if ( p_sweep->first_only == false && p_sweep->result_quantity )
+    {
+
+        // Initialized data
+        size_t j = 0;
+
+        // Sort
+        qsort(p_sweep->p_results, p_sweep->result_quantity, sizeof(geometry_line_intersection), geometry_sweep_result_compare);
+
+        // Keep one of each pair
+        for (size_t i = 0; i < p_sweep->result_quantity; i++)
+            if ( j == 0 || p_sweep->p_results[i].a != p_sweep->p_results[j - 1].a || p_sweep->p_results[i].b != p_sweep->p_results[j - 1].b )
+                p_sweep->p_results[j++] = p_sweep->p_results[i];
+
+        // Store the quantity
+        p_sweep->result_quantity = j;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_lines:
+                #ifndef NDEBUG
+                    log_error("[geometry] Line list has no lines in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_construct_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to construct treap in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_sweep_release(p_sweep);
+
+                // Error
+                return 0;
+
+            failed_to_sweep:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to sweep in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                geometry_sweep_release(p_sweep);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static void geometry_sweep_release ( geometry_sweep *p_sweep )
+{
+
+    // Free the status
+    if ( p_sweep->status.p_nodes ) geometry_treap_destroy(&p_sweep->status);
+
+    // Free the crossings
+    if ( p_sweep->p_crossings ) p_sweep->p_crossings = GEOMETRY_REALLOC(p_sweep->p_crossings, 0);
+
+    // Free the results
+    if ( p_sweep->p_results ) p_sweep->p_results = GEOMETRY_REALLOC(p_sweep->p_results, 0);
+
+    // Free the segments. The endpoints, group and stamps live in the same block.
+    if ( p_sweep->p_segments ) p_sweep->p_segments = GEOMETRY_REALLOC(p_sweep->p_segments, 0);
+
+    // Done
+    return;
+}
+
+static void geometry_sweep_endpoints ( geometry_sweep *p_sweep, size_t first, size_t last )
+{
+
+    // Initialized data
+    geometry_treap         *p_status   = &p_sweep->status;
+    geometry_sweep_segment *p_segments = p_sweep->p_segments;
+    size_t                 *p_group    = p_sweep->p_group,
+                            stamp      = ++p_sweep->stamp,
+                            begin      = GEOMETRY_TREAP_NONE,
+                            below      = GEOMETRY_TREAP_NONE,
+                            above      = GEOMETRY_TREAP_NONE,
+                            g          = 0,
+                            through    = 0,
+                            inserted   = 0;
+
+    // Move the sweep to the point
+    p_sweep->point = p_sweep->p_endpoints[first].point;
+
+    // Stamp the segments that end here
+    for (size_t i = first; i < last; i++)
+        if ( p_sweep->p_endpoints[i].end ) p_sweep->p_stamps[p_sweep->p_endpoints[i].segment] = stamp;
+
+    // Find the segments that pass through the point. They are adjacent in the status.
+    begin = geometry_treap_lower_bound(p_status, geometry_sweep_locate, p_sweep),
+    below = ( begin != GEOMETRY_TREAP_NONE ) ? geometry_treap_previous(p_status, begin) : geometry_treap_last(p_status);
+
+    // Collect them
+    for (above = begin; above != GEOMETRY_TREAP_NONE && geometry_sweep_locate(above, p_sweep) == 0; above = geometry_treap_next(p_status, above))
+        p_group[g++] = above;
+
+    // Remove them
+    for (size_t i = 0; i < g; i++)
+        geometry_treap_remove(p_status, p_group[i]);
+
+    // A segment that ends here must pass through here, but remove any
+    // that the search missed, without losing the neighbours
+    for (size_t i = first; i < last; i++)
+    {
+
+        // Initialized data
+        size_t s = p_sweep->p_endpoints[i].segment;
+
+        // Skip starts, and segments already removed
+        if ( p_sweep->p_endpoints[i].end == false || geometry_treap_contains(p_status, s) == false ) continue;
+
+        // Keep the neighbours
+        if ( s == below ) below = geometry_treap_previous(p_status, below);
+        if ( s == above ) above = geometry_treap_next(p_status, above);
+
+        // Remove the segment
+        geometry_treap_remove(p_status, s);
+
+        // It meets the others here
+        p_group[g++] = s;
+    }
+
+    // The segments that pass through the point
+    through = g;
+
+    // Collect the segments that start here
+    for (size_t i = first; i < last; i++)
+        if ( p_sweep->p_endpoints[i].end == false ) p_group[g++] = p_sweep->p_endpoints[i].segment;
+
+    // Every pair of segments here meets at the point. Two segments that
+    // pass through without ending here, and are not colinear, cross.
+    for (size_t i = 0; i < g && p_sweep->done == false; i++)
+        for (size_t j = i + 1; j < g && p_sweep->done == false; j++)
+        {
+
+            // Initialized data
+            size_t a      = p_group[i],
+                   b      = p_group[j];
+            bool   proper = j < through
+                         && p_sweep->p_stamps[a] != stamp
+                         && p_sweep->p_stamps[b] != stamp
+                         && geometry_point_ccw(&p_segments[a].p0, &p_segments[a].p1, &p_segments[b].p1) != 0;
+
+            // Report the pair
+            geometry_sweep_report(p_sweep, a, b, p_sweep->point, proper);
+        }
+
+    // Done
+    if ( p_sweep->done ) return;
+
+    // Insert the segments that continue past the point, in their order after it
+    for (size_t i = 0; i < g; i++)
+    {
+
+        // Skip segments that end here
+        if ( p_sweep->p_stamps[p_group[i]] == stamp ) continue;
+
+        // Insert the segment
+        if ( geometry_treap_insert(p_status, p_group[i], geometry_sweep_compare, p_sweep) == 0 ) goto failed_to_insert;
+
+        // Count the segment
+        inserted++;
+    }
+
+    // The old neighbours are now neighbours
+    if ( inserted == 0 )
+        geometry_sweep_check(p_sweep, below, above);
+
+    // The lowest and highest inserted segments have new neighbours
+    else
+    {
+
+        // Initialized data
+        size_t lowest  = ( below != GEOMETRY_TREAP_NONE ) ? geometry_treap_next(p_status, below)     : geometry_treap_first(p_status),
+               highest = ( above != GEOMETRY_TREAP_NONE ) ? geometry_treap_previous(p_status, above) : geometry_treap_last(p_status);
+
+        // Test the new neighbours
+        geometry_sweep_check(p_sweep, below, lowest);
+        geometry_sweep_check(p_sweep, highest, above);
+    }
+
+    // Done
+    return;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_insert:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to insert segment in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Stop the sweep
+                p_sweep->failed = true,
+                p_sweep->done   = true;
+
+                // Error
+                return;
+        }
+    }
+}
+
+static void geometry_sweep_crossing_process ( geometry_sweep *p_sweep, geometry_sweep_crossing *p_crossing )
+{
+
+    // Initialized data
+    geometry_treap *p_status = &p_sweep->status;
+    size_t          a        = p_crossing->a,
+                    b        = p_crossing->b;
+
+    // Move the sweep to the point
+    p_sweep->point = p_crossing->point;
+
+    // Skip crossings whose segments are no longer neighbours in this order
+    if ( geometry_treap_contains(p_status, a) == false || geometry_treap_next(p_status, a) != b ) return;
+
+    // Report the crossing
+    geometry_sweep_report(p_sweep, a, b, p_crossing->point, true);
+
+    // Exchange the segments
+    geometry_treap_swap(p_status, a, b);
+
+    // Test the new neighbours
+    geometry_sweep_check(p_sweep, geometry_treap_previous(p_status, b), b);
+    geometry_sweep_check(p_sweep, a, geometry_treap_next(p_status, a));
+
+    // Done
+    return;
+}
+
+static void geometry_sweep_check ( geometry_sweep *p_sweep, size_t a, size_t b )
+{
+
+    // No neighbour
+    if ( a == GEOMETRY_TREAP_NONE || b == GEOMETRY_TREAP_NONE ) return;
+
+    // Initialized data
+    geometry_sweep_segment *p_a = &p_sweep->p_segments[a],
+                           *p_b = &p_sweep->p_segments[b];
+    int                     o1  = geometry_point_ccw(&p_a->p0, &p_a->p1, &p_b->p0),
+                            o2  = geometry_point_ccw(&p_a->p0, &p_a->p1, &p_b->p1),
+                            o3  = geometry_point_ccw(&p_b->p0, &p_b->p1, &p_a->p0),
+                            o4  = geometry_point_ccw(&p_b->p0, &p_b->p1, &p_a->p1);
+    double                  ax  = p_a->p1.x - p_a->p0.x,
+                            ay  = p_a->p1.y - p_a->p0.y,
+                            bx  = p_b->p1.x - p_b->p0.x,
+                            by  = p_b->p1.y - p_b->p0.y,
+                            t   = 0;
+    geometry_point          q   = { 0 };
+
+    // Only a proper crossing, where the lower segment ends above the upper
+    // segment, swaps them. Contact at an endpoint is found at the endpoint.
+    if ( !( o1 * o2 < 0 && o3 * o4 < 0 && o4 > 0 ) ) return;
+
+    // Compute the crossing
+    t   = ( ( p_b->p0.x - p_a->p0.x ) * by - ( p_b->p0.y - p_a->p0.y ) * bx ) / ( ax * by - ay * bx ),
+    q.x = p_a->p0.x + t * ax,
+    q.y = p_a->p0.y + t * ay;
+
+    // The crossing is ahead of the sweep, unless rounding moved it behind
+    if ( geometry_sweep_point_compare(&q, &p_sweep->point) < 0 ) q = p_sweep->point;
+
+    // Schedule the crossing
+    geometry_sweep_push(p_sweep, (geometry_sweep_crossing) { .point = q, .a = a, .b = b });
+
+    // Done
+    return;
+}
+
+static void geometry_sweep_report ( geometry_sweep *p_sweep, size_t a, size_t b, geometry_point point, bool proper )
+{
+
+    // Initialized data
+    geometry_sweep_segment *p_a = &p_sweep->p_segments[a],
+                           *p_b = &p_sweep->p_segments[b];
+
+    // Skip pairs from the same line list
+    if ( p_sweep->red_blue && p_a->blue == p_b->blue ) return;
+
+    // Skip contact, if only crossings are wanted
+    if ( p_sweep->proper_only && proper == false ) return;
+
+    // Stop at the first result
+    if ( p_sweep->first_only )
+    {
+
+        // Store the quantity
+        p_sweep->result_quantity = 1,
+        p_sweep->done            = true;
+
+        // Done
+        return;
+    }
+
+    // Grow the results
+    if ( p_sweep->result_quantity == p_sweep->result_capacity )
+    {
+
+        // Initialized data
+        size_t                      capacity  = ( p_sweep->result_capacity ) ? p_sweep->result_capacity * 2 : 64;
+        geometry_line_intersection *p_results = GEOMETRY_REALLOC(p_sweep->p_results, sizeof(geometry_line_intersection) * capacity);
+
+        // Error check
+        if ( p_results == (void *) 0 ) goto no_mem;
+
+        // Store the results
+        p_sweep->p_results       = p_results,
+        p_sweep->result_capacity = capacity;
+    }
+
+    // The red segment is a. Without colors, the lower index is a.
+    if ( ( p_sweep->red_blue ) ? p_a->blue : ( p_a->index > p_b->index ) )
+    {
+
+        // Initialized data
+        geometry_sweep_segment *p_t = p_a;
+
+        // Exchange
+        p_a = p_b,
+        p_b = p_t;
+    }
+
+    // Store the result
+    p_sweep->p_results[p_sweep->result_quantity++] = (geometry_line_intersection)
+    {
+        .a      = p_a->index,
+        .b      = p_b->index,
+        .point  = point,
+        .proper = proper
+    };
+
+    // Done
+    return;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Stop the sweep
+                p_sweep->failed = true,
+                p_sweep->done   = true;
+
+                // Error
+                return;
+        }
+    }
+}
+
+static void geometry_sweep_push ( geometry_sweep *p_sweep, geometry_sweep_crossing crossing )
+{
+
+    // Initialized data
+    size_t i = p_sweep->crossing_quantity;
+
+    // Grow the heap
+    if ( p_sweep->crossing_quantity == p_sweep->crossing_capacity )
+    {
+
+        // Initialized data
+        size_t                   capacity    = ( p_sweep->crossing_capacity ) ? p_sweep->crossing_capacity * 2 : 64;
+        geometry_sweep_crossing *p_crossings = GEOMETRY_REALLOC(p_sweep->p_crossings, sizeof(geometry_sweep_crossing) * capacity);
+
+        // Error check
+        if ( p_crossings == (void *) 0 ) goto no_mem;
+
+        // Store the heap
+        p_sweep->p_crossings       = p_crossings,
+        p_sweep->crossing_capacity = capacity;
+    }
+
+    // Sift up
+    while ( i )
+    {
+
+        // Initialized data
+        size_t parent = ( i - 1 ) / 2;
+
+        // Done
+        if ( geometry_sweep_point_compare(&p_sweep->p_crossings[parent].point, &crossing.point) <= 0 ) break;
+
+        // Move the parent down
+        p_sweep->p_crossings[i] = p_sweep->p_crossings[parent],
+        i                       = parent;
+    }
+
+    // Store the crossing
+    p_sweep->p_crossings[i] = crossing;
+    p_sweep->crossing_quantity++;
+
+    // Done
+    return;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Stop the sweep
+                p_sweep->failed = true,
+                p_sweep->done   = true;
+
+                // Error
+                return;
+        }
+    }
+}
+
+static geometry_sweep_crossing geometry_sweep_pop ( geometry_sweep *p_sweep )
+{
+
+    // Initialized data
+    geometry_sweep_crossing *p_crossings = p_sweep->p_crossings,
+                             ret         = p_crossings[0],
+                             last        = p_crossings[--p_sweep->crossing_quantity];
+    size_t                   quantity    = p_sweep->crossing_quantity,
+                             i           = 0;
+
+    // Sift the last crossing down from the root
+    for (;;)
+    {
+
+        // Initialized data
+        size_t child = 2 * i + 1;
+
+        // Done
+        if ( child >= quantity ) break;
+
+        // Pick the leftmost child
+        if ( child + 1 < quantity && geometry_sweep_point_compare(&p_crossings[child + 1].point, &p_crossings[child].point) < 0 ) child++;
+
+        // Done
+        if ( geometry_sweep_point_compare(&last.point, &p_crossings[child].point) <= 0 ) break;
+
+        // Move the child up
+        p_crossings[i] = p_crossings[child],
+        i              = child;
+    }
+
+    // Store the last crossing
+    if ( quantity ) p_crossings[i] = last;
+
+    // Success
+    return ret;
+}
+
+static int geometry_sweep_point_compare ( const geometry_point *p_a, const geometry_point *p_b )
+{
+
+    // Compare x
+    if ( p_a->x < p_b->x ) return -1;
+    if ( p_a->x > p_b->x ) return  1;
+
+    // Compare y
+    if ( p_a->y < p_b->y ) return -1;
+    if ( p_a->y > p_b->y ) return  1;
+
+    // Equal
+    return 0;
+}
+
+static int geometry_sweep_endpoint_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_sweep_endpoint *p_x = p_a,
+                                  *p_y = p_b;
+    int                            ret = geometry_sweep_point_compare(&p_x->point, &p_y->point);
+
+    // Break ties by segment, so the order does not depend on qsort
+    if ( ret == 0 ) ret = ( p_x->segment > p_y->segment ) - ( p_x->segment < p_y->segment );
+
+    // Success
+    return ret;
+}
+
+static int geometry_sweep_result_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_line_intersection *p_x = p_a,
+                                     *p_y = p_b;
+
+    // Compare a
+    if ( p_x->a != p_y->a ) return ( p_x->a > p_y->a ) - ( p_x->a < p_y->a );
+
+    // Compare b
+    return ( p_x->b > p_y->b ) - ( p_x->b < p_y->b );
+}
+
+static int geometry_sweep_compare ( size_t a, size_t b, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_sweep         *p_sweep = p_parameter;
+    geometry_sweep_segment *p_a     = &p_sweep->p_segments[a],
+                           *p_b     = &p_sweep->p_segments[b];
+    int                     o       = geometry_point_ccw(&p_b->p0, &p_b->p1, &p_sweep->point);
+
+    // A passes through the point, so it is above B if the point is
+    if ( o ) return o;
+
+    // Both pass through the point. A is above B after the point if B's
+    // right endpoint is below A.
+    o = geometry_point_ccw(&p_a->p0, &p_a->p1, &p_b->p1);
+
+    // Not colinear
+    if ( o ) return -o;
+
+    // Colinear segments are ordered by index
+    return ( a < b ) ? -1 : 1;
+}
+
+static int geometry_sweep_locate ( size_t item, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_sweep         *p_sweep = p_parameter;
+    geometry_sweep_segment *p_item  = &p_sweep->p_segments[item];
+
+    // Success
+    return geometry_point_ccw(&p_item->p0, &p_item->p1, &p_sweep->point);
+}
@@ -0,0 +1,654 @@
+/** !
+ * Treap
+ *
+ * @file treap.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <geometry/treap.h>
+
+// Forward declarations
+/** !
+ * Rotate a node above its parent
+ *
+ * @param p_treap the treap
+ * @param node    the node
+ *
+ * @return void
+ */
+static void geometry_treap_rotate ( geometry_treap *p_treap, size_t node );
+
+/** !
+ * Compute the next priority of a treap
+ *
+ * @param p_treap the treap
+ *
+ * @return a pseudo random priority
+ */
+static uint64_t geometry_treap_priority ( geometry_treap *p_treap );
+
+// Function definitions
+int geometry_treap_construct ( geometry_treap *p_treap, size_t capacity )
+{
+
+    // Argument check
+    if ( p_treap == (void *) 0 ) goto no_treap;
+
+    // Initialized data
+    geometry_treap_node *p_nodes = (void *) 0;
+
+    // Allocate the nodes. The positions follow them.
+    if ( capacity )
+    {
+
+        // Allocate
+        p_nodes = GEOMETRY_REALLOC(0, ( sizeof(geometry_treap_node) + sizeof(size_t) ) * capacity);
+
+        // Error check
+        if ( p_nodes == (void *) 0 ) goto no_mem;
+    }
+
+    // Populate the treap
+    *p_treap = (geometry_treap)
+    {
+        .capacity    = capacity,
+        .root        = GEOMETRY_TREAP_NONE,
+        .free        = ( capacity ) ? 0 : GEOMETRY_TREAP_NONE,
+        .seed        = 0x9E3779B97F4A7C15,
+        .p_nodes     = p_nodes,
+        .p_positions = ( capacity ) ? (size_t *) ( p_nodes + capacity ) : (void *) 0
+    };
+
+    // Link the free nodes, and clear the positions
+    for (size_t i = 0; i < capacity; i++)
+        p_treap->p_nodes[i].left = ( i + 1 < capacity ) ? i + 1 : GEOMETRY_TREAP_NONE,
+        p_treap->p_positions[i]  = GEOMETRY_TREAP_NONE;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_treap\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_treap_insert ( geometry_treap *p_treap, size_t item, fn_geometry_treap_compare pfn_compare, void *p_parameter )
+{
+
+    // Argument check
+    if ( p_treap     == (void *) 0 ) goto no_treap;
+    if ( pfn_compare == (void *) 0 ) goto no_compare;
+    if ( item >= p_treap->capacity ) goto item_out_of_range;
+    if ( p_treap->p_positions[item] != GEOMETRY_TREAP_NONE ) goto item_in_treap;
+
+    // Initialized data
+    geometry_treap_node *p_nodes = p_treap->p_nodes;
+    size_t               node    = p_treap->free,
+                         parent  = GEOMETRY_TREAP_NONE,
+                         current = p_treap->root;
+    bool                 left    = false;
+
+    // Take a node from the free list
+    p_treap->free = p_nodes[node].left;
+
+    // Populate the node
+    p_nodes[node] = (geometry_treap_node)
+    {
+        .item     = item,
+        .left     = GEOMETRY_TREAP_NONE,
+        .right    = GEOMETRY_TREAP_NONE,
+        .parent   = GEOMETRY_TREAP_NONE,
+        .priority = geometry_treap_priority(p_treap)
+    };
+
+    // Store the position
+    p_treap->p_positions[item] = node;
+
+    // Find the leaf where the item belongs
+    while ( current != GEOMETRY_TREAP_NONE )
+    {
+
+        // Descend
+        parent  = current,
+        left    = pfn_compare(item, p_nodes[current].item, p_parameter) < 0,
+        current = ( left ) ? p_nodes[current].left : p_nodes[current].right;
+    }
+
+    // Attach the node
+    p_nodes[node].parent = parent;
+
+    // Empty treap
+    if ( parent == GEOMETRY_TREAP_NONE ) p_treap->root = node;
+
+    // Left child
+    else if ( left ) p_nodes[parent].left = node;
+
+    // Right child
+    else p_nodes[parent].right = node;
+
+    // Rotate the node up until its priority is in order
+    while ( p_nodes[node].parent != GEOMETRY_TREAP_NONE && p_nodes[node].priority < p_nodes[p_nodes[node].parent].priority )
+        geometry_treap_rotate(p_treap, node);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_treap\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_compare:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pfn_compare\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            item_out_of_range:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"item\" is out of range in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            item_in_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"item\" is already in the treap in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_treap_remove ( geometry_treap *p_treap, size_t item )
+{
+
+    // Argument check
+    if ( p_treap == (void *) 0 ) goto no_treap;
+    if ( geometry_treap_contains(p_treap, item) == false ) goto item_not_in_treap;
+
+    // Initialized data
+    geometry_treap_node *p_nodes = p_treap->p_nodes;
+    size_t               node    = p_treap->p_positions[item],
+                         child   = GEOMETRY_TREAP_NONE,
+                         parent  = GEOMETRY_TREAP_NONE;
+
+    // Rotate the node down until it has at most one child
+    while ( p_nodes[node].left != GEOMETRY_TREAP_NONE && p_nodes[node].right != GEOMETRY_TREAP_NONE )
+    {
+
+        // Initialized data
+        size_t l = p_nodes[node].left,
+               r = p_nodes[node].right;
+
+        // Rotate the child with the lower priority above the node
+        geometry_treap_rotate(p_treap, ( p_nodes[l].priority < p_nodes[r].priority ) ? l : r);
+    }
+
+    // Splice the node out
+    child  = ( p_nodes[node].left != GEOMETRY_TREAP_NONE ) ? p_nodes[node].left : p_nodes[node].right,
+    parent = p_nodes[node].parent;
+
+    // Attach the child to the parent
+    if ( child != GEOMETRY_TREAP_NONE ) p_nodes[child].parent = parent;
+
+    // Root
+    if ( parent == GEOMETRY_TREAP_NONE ) p_treap->root = child;
+
+    // Left child
+    else if ( p_nodes[parent].left == node ) p_nodes[parent].left = child;
+
+    // Right child
+    else p_nodes[parent].right = child;
+
+    // Return the node to the free list
+    p_nodes[node].left = p_treap->free,
+    p_treap->free      = node;
+
+    // Clear the position
+    p_treap->p_positions[item] = GEOMETRY_TREAP_NONE;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_treap\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            item_not_in_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"item\" is not in the treap in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int geometry_treap_swap ( geometry_treap *p_treap, size_t a, size_t b )
+{
+
+    // Argument check
+    if ( p_treap == (void *) 0 ) goto no_treap;
+    if ( geometry_treap_contains(p_treap, a) == false ) goto item_not_in_treap;
+    if ( geometry_treap_contains(p_treap, b) == false ) goto item_not_in_treap;
+
+    // Initialized data
+    size_t node_a = p_treap->p_positions[a],
+           node_b = p_treap->p_positions[b];
+
+    // Exchange the items of the nodes
+    p_treap->p_nodes[node_a].item = b,
+    p_treap->p_nodes[node_b].item = a;
+
+    // Exchange the positions of the items
+    p_treap->p_positions[a] = node_b,
+    p_treap->p_positions[b] = node_a;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_treap\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            item_not_in_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Parameter \"item\" is not in the treap in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+bool geometry_treap_contains ( geometry_treap *p_treap, size_t item )
+{
+
+    // Argument check
+    if ( p_treap == (void *) 0 ) goto no_treap;
+
+    // Success
+    return item < p_treap->capacity && p_treap->p_positions[item] != GEOMETRY_TREAP_NONE;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_treap\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return false;
+        }
+    }
+}
+
+size_t geometry_treap_first ( geometry_treap *p_treap )
+{
+
+    // Argument check
+    if ( p_treap == (void *) 0 ) goto no_treap;
+
+    // Initialized data
+    size_t node = p_treap->root;
+
+    // Empty treap
+    if ( node == GEOMETRY_TREAP_NONE ) return GEOMETRY_TREAP_NONE;
+
+    // Descend to the leftmost node
+    while ( p_treap->p_nodes[node].left != GEOMETRY_TREAP_NONE )
+        node = p_treap->p_nodes[node].left;
+
+    // Success
+    return p_treap->p_nodes[node].item;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_treap\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return GEOMETRY_TREAP_NONE;
+        }
+    }
+}
+
+size_t geometry_treap_last ( geometry_treap *p_treap )
+{
+
+    // Argument check
+    if ( p_treap == (void *) 0 ) goto no_treap;
+
+    // Initialized data
+    size_t node = p_treap->root;
+
+    // Empty treap
+    if ( node == GEOMETRY_TREAP_NONE ) return GEOMETRY_TREAP_NONE;
+
+    // Descend to the rightmost node
+    while ( p_treap->p_nodes[node].right != GEOMETRY_TREAP_NONE )
+        node = p_treap->p_nodes[node].right;
+
+    // Success
+    return p_treap->p_nodes[node].item;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_treap\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return GEOMETRY_TREAP_NONE;
+        }
+    }
+}
+
+size_t geometry_treap_next ( geometry_treap *p_treap, size_t item )
+{
+
+    // Argument check
+    if ( p_treap == (void *) 0 ) goto no_treap;
+    if ( geometry_treap_contains(p_treap, item) == false ) return GEOMETRY_TREAP_NONE;
+
+    // Initialized data
+    geometry_treap_node *p_nodes = p_treap->p_nodes;
+    size_t               node    = p_treap->p_positions[item];
+
+    // The leftmost node of the right subtree
+    if ( p_nodes[node].right != GEOMETRY_TREAP_NONE )
+    {
+
+        // Descend
+        for (node = p_nodes[node].right; p_nodes[node].left != GEOMETRY_TREAP_NONE; node = p_nodes[node].left);
+
+        // Success
+        return p_nodes[node].item;
+    }
+
+    // The first ancestor this node is left of
+    while ( p_nodes[node].parent != GEOMETRY_TREAP_NONE && p_nodes[p_nodes[node].parent].right == node )
+        node = p_nodes[node].parent;
+
+    // Last item
+    if ( p_nodes[node].parent == GEOMETRY_TREAP_NONE ) return GEOMETRY_TREAP_NONE;
+
+    // Success
+    return p_nodes[p_nodes[node].parent].item;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_treap\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return GEOMETRY_TREAP_NONE;
+        }
+    }
+}
+
+size_t geometry_treap_previous ( geometry_treap *p_treap, size_t item )
+{
+
+    // Argument check
+    if ( p_treap == (void *) 0 ) goto no_treap;
+    if ( geometry_treap_contains(p_treap, item) == false ) return GEOMETRY_TREAP_NONE;
+
+    // Initialized data
+    geometry_treap_node *p_nodes = p_treap->p_nodes;
+    size_t               node    = p_treap->p_positions[item];
+
+    // The rightmost node of the left subtree
+    if ( p_nodes[node].left != GEOMETRY_TREAP_NONE )
+    {
+
+        // Descend
+        for (node = p_nodes[node].left; p_nodes[node].right != GEOMETRY_TREAP_NONE; node = p_nodes[node].right);
+
+        // Success
+        return p_nodes[node].item;
+    }
+
+    // The first ancestor this node is right of
+    while ( p_nodes[node].parent != GEOMETRY_TREAP_NONE && p_nodes[p_nodes[node].parent].left == node )
+        node = p_nodes[node].parent;
+
+    // First item
+    if ( p_nodes[node].parent == GEOMETRY_TREAP_NONE ) return GEOMETRY_TREAP_NONE;
+
+    // Success
+    return p_nodes[p_nodes[node].parent].item;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_treap\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return GEOMETRY_TREAP_NONE;
+        }
+    }
+}
+
+size_t geometry_treap_lower_bound ( geometry_treap *p_treap, fn_geometry_treap_locate pfn_locate, void *p_parameter )
+{
+
+    // Argument check
+    if ( p_treap    == (void *) 0 ) goto no_treap;
+    if ( pfn_locate == (void *) 0 ) goto no_locate;
+
+    // Initialized data
+    size_t node = p_treap->root,
+           ret  = GEOMETRY_TREAP_NONE;
+
+    // Descend
+    while ( node != GEOMETRY_TREAP_NONE )
+    {
+
+        // The key is after this item, so the bound is to the right
+        if ( pfn_locate(p_treap->p_nodes[node].item, p_parameter) > 0 ) node = p_treap->p_nodes[node].right;
+
+        // This item is a candidate, but there may be one to the left
+        else ret = p_treap->p_nodes[node].item, node = p_treap->p_nodes[node].left;
+    }
+
+    // Success
+    return ret;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_treap\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return GEOMETRY_TREAP_NONE;
+
+            no_locate:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"pfn_locate\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return GEOMETRY_TREAP_NONE;
+        }
+    }
+}
+
+int geometry_treap_destroy ( geometry_treap *p_treap )
+{
+
+    // Argument check
+    if ( p_treap == (void *) 0 ) goto no_treap;
+
+    // Free the nodes. The positions live in the same block.
+    if ( p_treap->p_nodes ) p_treap->p_nodes = GEOMETRY_REALLOC(p_treap->p_nodes, 0);
+
+    // Clear the treap
+    *p_treap = (geometry_treap) { 0 };
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_treap:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_treap\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static void geometry_treap_rotate ( geometry_treap *p_treap, size_t node )
+{
+
+    // Initialized data
+    geometry_treap_node *p_nodes     = p_treap->p_nodes;
+    size_t               parent      = p_nodes[node].parent,
+                         grandparent = p_nodes[parent].parent;
+
+    // Right rotation
+    if ( p_nodes[parent].left == node )
+    {
+
+        // The node's right subtree moves under the parent
+        p_nodes[parent].left = p_nodes[node].right;
+        if ( p_nodes[node].right != GEOMETRY_TREAP_NONE ) p_nodes[p_nodes[node].right].parent = parent;
+
+        // The parent moves under the node
+        p_nodes[node].right = parent;
+    }
+
+    // Left rotation
+    else
+    {
+
+        // The node's left subtree moves under the parent
+        p_nodes[parent].right = p_nodes[node].left;
+        if ( p_nodes[node].left != GEOMETRY_TREAP_NONE ) p_nodes[p_nodes[node].left].parent = parent;
+
+        // The parent moves under the node
+        p_nodes[node].left = parent;
+    }
+
+    // Relink the parents
+    p_nodes[parent].parent = node,
+    p_nodes[node].parent   = grandparent;
+
+    // Root
+    if ( grandparent == GEOMETRY_TREAP_NONE ) p_treap->root = node;
+
+    // Left child
+    else if ( p_nodes[grandparent].left == parent ) p_nodes[grandparent].left = node;
+
+    // Right child
+    else p_nodes[grandparent].right = node;
+
+    // Done
+    return;
+}
+
+static uint64_t geometry_treap_priority ( geometry_treap *p_treap )
+{
+
+    // Initialized data
+    uint64_t z = ( p_treap->seed += 0x9E3779B97F4A7C15 );
+
+    // Mix the bits of the counter
+    z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9,
+    z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EB;
+
+    // Success
+    return z ^ ( z >> 31 );
+}
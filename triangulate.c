@@ -0,0 +1,863 @@
+/** !
+ * Polygon triangulation
+ *
+ * @file triangulate.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <string.h>
+
+// Header
+#include <geometry/triangulate.h>
+
+// geometry
+#include <geometry/treap.h>
+
+// Enumeration definitions
+enum geometry_triangulation_vertex_e
+{
+    GEOMETRY_TRIANGULATION_REGULAR = 0,
+    GEOMETRY_TRIANGULATION_START   = 1,
+    GEOMETRY_TRIANGULATION_END     = 2,
+    GEOMETRY_TRIANGULATION_SPLIT   = 3,
+    GEOMETRY_TRIANGULATION_MERGE   = 4
+};
+
+// Structure declarations
+struct geometry_triangulation_s;
+struct geometry_triangulation_event_s;
+struct geometry_triangulation_slot_s;
+
+// Type definitions
+typedef struct geometry_triangulation_s       geometry_triangulation;
+typedef struct geometry_triangulation_event_s geometry_triangulation_event;
+typedef struct geometry_triangulation_slot_s  geometry_triangulation_slot;
+
+// Structure definitions
+// Verticies are visited counterclockwise. Position i is the vertex
+// p_verticies[i] of a counterclockwise polygon, and the vertex
+// p_verticies[quantity - 1 - i] of a clockwise polygon. Edge i runs from
+// position i to position i + 1.
+struct geometry_triangulation_s
+{
+    geometry_point *p_verticies;
+    size_t          quantity,
+                    triangle_quantity;
+    bool            reverse;
+    size_t         *p_indices;
+    geometry       *p_triangles;
+    geometry_point *p_point;
+};
+
+struct geometry_triangulation_event_s
+{
+    geometry_point point;
+    size_t         position;
+};
+
+// A directed edge of a piece, from source to target. Diagonals are
+// stored once in each direction. The slots of a vertex are sorted
+// counterclockwise, starting from the edge of the polygon that leaves it.
+struct geometry_triangulation_slot_s
+{
+    geometry_point *p_source,
+                   *p_reference,
+                   *p_target;
+    size_t          source,
+                    target,
+                    diagonal;
+};
+
+// Forward declarations
+/** !
+ * Get the vertex at a position
+ *
+ * @param p_triangulation the triangulation
+ * @param position        the position
+ *
+ * @return the vertex
+ */
+static geometry_point *geometry_triangulation_vertex ( const geometry_triangulation *p_triangulation, size_t position );
+
+/** !
+ * Test if a point is above another point. Points at the same height are
+ * ordered from left to right, as if the sweep line were tilted a little.
+ *
+ * @param p_a a point
+ * @param p_b another point
+ *
+ * @return true if a is above b, else false
+ */
+static bool geometry_triangulation_above ( const geometry_point *p_a, const geometry_point *p_b );
+
+/** !
+ * Order two events from the top down
+ *
+ * @param p_a an event
+ * @param p_b another event
+ *
+ * @return < 0 if a is above b, > 0 if b is above a, else 0
+ */
+static int geometry_triangulation_event_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * Order two slots by source, and counterclockwise around the source
+ *
+ * @param p_a a slot
+ * @param p_b another slot
+ *
+ * @return < 0 if a is before b, > 0 if b is before a, else 0
+ */
+static int geometry_triangulation_slot_compare ( const void *p_a, const void *p_b );
+
+/** !
+ * Locate the vertex at the sweep line relative to an edge of the status
+ *
+ * @param item        the edge
+ * @param p_parameter the triangulation
+ *
+ * @return > 0 if the vertex is right of the edge, else <= 0
+ */
+static int geometry_triangulation_edge_locate ( size_t item, void *p_parameter );
+
+/** !
+ * Order an edge that starts at the sweep line relative to an edge of the
+ * status
+ *
+ * @param a           the new edge
+ * @param b           an edge of the status
+ * @param p_parameter the triangulation
+ *
+ * @return < 0 if a is left of b, else > 0
+ */
+static int geometry_triangulation_edge_compare ( size_t a, size_t b, void *p_parameter );
+
+/** !
+ * Store a triangle counterclockwise
+ *
+ * @param p_triangulation the triangulation
+ * @param a               the position of a vertex
+ * @param b               the position of another vertex
+ * @param c               the position of the last vertex
+ *
+ * @return 1 on success, 0 if there is no room for the triangle
+ */
+static int geometry_triangulation_emit ( geometry_triangulation *p_triangulation, size_t a, size_t b, size_t c );
+
+/** !
+ * Triangulate a ring by clipping ears. The ring is consumed.
+ *
+ * @param p_triangulation the triangulation
+ * @param p_ring          the positions of the ring, counterclockwise
+ * @param quantity        the quantity of positions
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_triangulation_ears ( geometry_triangulation *p_triangulation, size_t *p_ring, size_t quantity );
+
+/** !
+ * Triangulate a y monotone ring
+ *
+ * @param p_triangulation the triangulation
+ * @param p_ring          the positions of the ring, counterclockwise
+ * @param quantity        the quantity of positions
+ * @param p_sorted        scratch for quantity positions
+ * @param p_left          scratch for quantity chain flags
+ * @param p_stack         scratch for quantity positions
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_triangulation_monotone ( geometry_triangulation *p_triangulation, const size_t *p_ring, size_t quantity, size_t *p_sorted, bool *p_left, size_t *p_stack );
+
+/** !
+ * Cut a polygon into y monotone pieces, and triangulate each piece
+ *
+ * @param p_triangulation the triangulation
+ *
+ * @return 1 on success, 0 on error
+ */
+static int geometry_triangulation_sweep ( geometry_triangulation *p_triangulation );
+
+// Function definitions
+int geometry_polygon_triangulate ( geometry_polygon *p_polygon, size_t *p_indices, geometry *p_triangles, size_t *p_quantity )
+{
+
+    // Argument check
+    if ( p_polygon  == (void *) 0 ) goto no_polygon;
+    if ( p_quantity == (void *) 0 ) goto no_quantity;
+    if ( p_polygon->quantity && p_polygon->p_verticies == (void *) 0 ) goto no_verticies;
+
+    // Initialized data
+    geometry_triangulation _triangulation =
+    {
+        .p_verticies       = p_polygon->p_verticies,
+        .quantity          = p_polygon->quantity,
+        .triangle_quantity = 0,
+        .reverse           = false,
+        .p_indices         = p_indices,
+        .p_triangles       = p_triangles,
+        .p_point           = (void *) 0
+    };
+    size_t quantity = p_polygon->quantity;
+    double area     = 0;
+
+    // Fewer than three verticies have no triangles
+    if ( quantity < 3 ) goto done;
+
+    // Compute twice the signed area
+    for (size_t i = 0, j = quantity - 1; i < quantity; j = i++)
+        area += ( p_polygon->p_verticies[j].x * p_polygon->p_verticies[i].y ) - ( p_polygon->p_verticies[i].x * p_polygon->p_verticies[j].y );
+
+    // Visit the verticies of a clockwise polygon backwards
+    _triangulation.reverse = ( area < 0 );
+
+    // Strategy
+    if ( quantity <= GEOMETRY_TRIANGULATE_EAR_LIMIT )
+    {
+
+        // Initialized data
+        size_t _ring[GEOMETRY_TRIANGULATE_EAR_LIMIT];
+
+        // Visit every position
+        for (size_t i = 0; i < quantity; i++) _ring[i] = i;
+
+        // Clip ears
+        if ( geometry_triangulation_ears(&_triangulation, _ring, quantity) == 0 ) goto failed_to_triangulate;
+    }
+    else if ( geometry_triangulation_sweep(&_triangulation) == 0 ) goto failed_to_triangulate;
+
+    // Every simple polygon has n - 2 triangles
+    if ( _triangulation.triangle_quantity != quantity - 2 ) goto failed_to_triangulate;
+
+    done:
+
+    // Return the quantity of triangles to the caller
+    *p_quantity = _triangulation.triangle_quantity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_polygon:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_quantity:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_quantity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_verticies:
+                #ifndef NDEBUG
+                    log_error("[geometry] Null pointer provided for parameter \"p_polygon->p_verticies\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // geometry errors
+        {
+            failed_to_triangulate:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to triangulate polygon in call to function \"%s\". Is the polygon simple?\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+static geometry_point *geometry_triangulation_vertex ( const geometry_triangulation *p_triangulation, size_t position )
+{
+
+    // Done
+    return &p_triangulation->p_verticies[( p_triangulation->reverse ) ? p_triangulation->quantity - 1 - position : position];
+}
+
+static bool geometry_triangulation_above ( const geometry_point *p_a, const geometry_point *p_b )
+{
+
+    // Done
+    return ( p_a->y > p_b->y ) || ( p_a->y == p_b->y && p_a->x < p_b->x );
+}
+
+static int geometry_triangulation_event_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_triangulation_event *p_event_a = p_a,
+                                       *p_event_b = p_b;
+
+    // Higher first
+    if ( geometry_triangulation_above(&p_event_a->point, &p_event_b->point) ) return -1;
+    if ( geometry_triangulation_above(&p_event_b->point, &p_event_a->point) ) return  1;
+
+    // Coincident verticies by position
+    return ( p_event_a->position > p_event_b->position ) - ( p_event_a->position < p_event_b->position );
+}
+
+static int geometry_triangulation_slot_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    const geometry_triangulation_slot *p_slot_a = p_a,
+                                      *p_slot_b = p_b;
+    int                                side_a   = 0,
+                                       side_b   = 0;
+
+    // By source
+    if ( p_slot_a->source != p_slot_b->source ) return ( p_slot_a->source > p_slot_b->source ) ? 1 : -1;
+
+    // Which half of the turn from the reference each slot is in
+    side_a = geometry_point_ccw(p_slot_a->p_source, p_slot_a->p_reference, p_slot_a->p_target);
+    side_b = geometry_point_ccw(p_slot_b->p_source, p_slot_b->p_reference, p_slot_b->p_target);
+
+    // Slots behind the reference start the second half
+    if ( side_a == 0 ) side_a = ( ( p_slot_a->p_target->x - p_slot_a->p_source->x ) * ( p_slot_a->p_reference->x - p_slot_a->p_source->x ) + ( p_slot_a->p_target->y - p_slot_a->p_source->y ) * ( p_slot_a->p_reference->y - p_slot_a->p_source->y ) < 0 ) ? -1 : 1;
+    if ( side_b == 0 ) side_b = ( ( p_slot_b->p_target->x - p_slot_b->p_source->x ) * ( p_slot_b->p_reference->x - p_slot_b->p_source->x ) + ( p_slot_b->p_target->y - p_slot_b->p_source->y ) * ( p_slot_b->p_reference->y - p_slot_b->p_source->y ) < 0 ) ? -1 : 1;
+
+    // The first half is before the second half
+    if ( side_a != side_b ) return ( side_a > side_b ) ? -1 : 1;
+
+    // The reference is the first slot of the first half
+    if ( p_slot_a->p_target == p_slot_a->p_reference ) return -1;
+    if ( p_slot_b->p_target == p_slot_b->p_reference ) return  1;
+
+    // Counterclockwise in the same half
+    return ( geometry_point_ccw(p_slot_a->p_source, p_slot_a->p_target, p_slot_b->p_target) > 0 ) ? -1 : 1;
+}
+
+static int geometry_triangulation_edge_locate ( size_t item, void *p_parameter )
+{
+
+    // Initialized data
+    geometry_triangulation *p_triangulation = p_parameter;
+    geometry_point         *p_a             = geometry_triangulation_vertex(p_triangulation, item),
+                           *p_b             = geometry_triangulation_vertex(p_triangulation, ( item + 1 ) % p_triangulation->quantity);
+
+    // Orient the edge downwards
+    if ( geometry_triangulation_above(p_b, p_a) )
+    {
+        geometry_point *p_t = p_a;
+        p_a = p_b, p_b = p_t;
+    }
+
+    // Looking down the edge, the right of the plane is on the left
+    return ( geometry_point_ccw(p_a, p_b, p_triangulation->p_point) > 0 ) ? 1 : -1;
+}
+
+static int geometry_triangulation_edge_compare ( size_t a, size_t b, void *p_parameter )
+{
+
+    // Unused
+    (void) a;
+
+    // The new edge starts at the vertex on the sweep line
+    return geometry_triangulation_edge_locate(b, p_parameter);
+}
+
+static int geometry_triangulation_emit ( geometry_triangulation *p_triangulation, size_t a, size_t b, size_t c )
+{
+
+    // Initialized data
+    size_t          i   = p_triangulation->triangle_quantity;
+    geometry_point *p_a = geometry_triangulation_vertex(p_triangulation, a),
+                   *p_b = geometry_triangulation_vertex(p_triangulation, b),
+                   *p_c = geometry_triangulation_vertex(p_triangulation, c);
+
+    // Error check
+    if ( i + 2 >= p_triangulation->quantity ) return 0;
+
+    // Turn the triangle counterclockwise
+    if ( geometry_point_ccw(p_a, p_b, p_c) < 0 )
+    {
+        size_t          t   = b;
+        geometry_point *p_t = p_b;
+
+        b = c, p_b = p_c;
+        c = t, p_c = p_t;
+    }
+
+    // Store the indices
+    if ( p_triangulation->p_indices )
+    {
+
+        // Map each position to its index
+        if ( p_triangulation->reverse )
+            a = p_triangulation->quantity - 1 - a,
+            b = p_triangulation->quantity - 1 - b,
+            c = p_triangulation->quantity - 1 - c;
+
+        // Store the indices
+        p_triangulation->p_indices[3 * i + 0] = a,
+        p_triangulation->p_indices[3 * i + 1] = b,
+        p_triangulation->p_indices[3 * i + 2] = c;
+    }
+
+    // Store the triangle
+    if ( p_triangulation->p_triangles )
+        p_triangulation->p_triangles[i] = (geometry)
+        {
+            .type     = GEOMETRY_TRIANGLE,
+            .triangle =
+            {
+                .a = *p_a,
+                .b = *p_b,
+                .c = *p_c
+            }
+        };
+
+    // Count the triangle
+    p_triangulation->triangle_quantity++;
+
+    // Success
+    return 1;
+}
+
+static int geometry_triangulation_ears ( geometry_triangulation *p_triangulation, size_t *p_ring, size_t quantity )
+{
+
+    // Clip an ear until a triangle is left
+    while ( quantity > 3 )
+    {
+
+        // Initialized data
+        size_t ear = 0;
+        bool   found = false;
+
+        // Find an ear
+        for (size_t i = 0; i < quantity && found == false; i++)
+        {
+
+            // Initialized data
+            geometry_point *p_a = geometry_triangulation_vertex(p_triangulation, p_ring[( i + quantity - 1 ) % quantity]),
+                           *p_b = geometry_triangulation_vertex(p_triangulation, p_ring[i]),
+                           *p_c = geometry_triangulation_vertex(p_triangulation, p_ring[( i + 1 ) % quantity]);
+
+            // Reflex verticies are not ears
+            if ( geometry_point_ccw(p_a, p_b, p_c) <= 0 ) continue;
+
+            // An ear holds no other vertex
+            found = true;
+            for (size_t j = ( i + 2 ) % quantity; j != ( i + quantity - 1 ) % quantity; j = ( j + 1 ) % quantity)
+            {
+
+                // Initialized data
+                geometry_point *p_p = geometry_triangulation_vertex(p_triangulation, p_ring[j]);
+
+                // The vertex is inside or on the triangle
+                if ( geometry_point_ccw(p_a, p_b, p_p) >= 0 &&
+                     geometry_point_ccw(p_b, p_c, p_p) >= 0 &&
+                     geometry_point_ccw(p_c, p_a, p_p) >= 0 ) { found = false; break; }
+            }
+
+            // Store the ear
+            if ( found ) ear = i;
+        }
+
+        // A degenerate ring has no ear. Clip any vertex to make progress.
+        if ( geometry_triangulation_emit(p_triangulation, p_ring[( ear + quantity - 1 ) % quantity], p_ring[ear], p_ring[( ear + 1 ) % quantity]) == 0 ) return 0;
+
+        // Remove the tip of the ear
+        memmove(&p_ring[ear], &p_ring[ear + 1], sizeof(size_t) * ( quantity - ear - 1 ));
+        quantity--;
+    }
+
+    // Store the last triangle
+    if ( quantity == 3 ) return geometry_triangulation_emit(p_triangulation, p_ring[0], p_ring[1], p_ring[2]);
+
+    // Success
+    return 1;
+}
+
+static int geometry_triangulation_monotone ( geometry_triangulation *p_triangulation, const size_t *p_ring, size_t quantity, size_t *p_sorted, bool *p_left, size_t *p_stack )
+{
+
+    // Initialized data
+    size_t top    = 0,
+           bottom = 0,
+           stack  = 0;
+
+    // Find the top and the bottom of the ring
+    for (size_t i = 1; i < quantity; i++)
+    {
+        if ( geometry_triangulation_above(geometry_triangulation_vertex(p_triangulation, p_ring[i]), geometry_triangulation_vertex(p_triangulation, p_ring[top])) ) top = i;
+        if ( geometry_triangulation_above(geometry_triangulation_vertex(p_triangulation, p_ring[bottom]), geometry_triangulation_vertex(p_triangulation, p_ring[i])) ) bottom = i;
+    }
+
+    // Merge the chains from the top down. Counterclockwise from the top is
+    // the left chain, which holds the bottom.
+    {
+
+        // Initialized data
+        size_t l  = ( top + 1 ) % quantity,
+               r  = ( top + quantity - 1 ) % quantity,
+               nl = ( bottom + quantity - top ) % quantity,
+               nr = quantity - 1 - nl;
+
+        // The top
+        p_sorted[0] = p_ring[top], p_left[0] = true;
+
+        // The chains
+        for (size_t i = 1; i < quantity; i++)
+        {
+            if ( nr == 0 || ( nl && geometry_triangulation_above(geometry_triangulation_vertex(p_triangulation, p_ring[l]), geometry_triangulation_vertex(p_triangulation, p_ring[r])) ) )
+                p_sorted[i] = p_ring[l], p_left[i] = true, l = ( l + 1 ) % quantity, nl--;
+            else
+                p_sorted[i] = p_ring[r], p_left[i] = false, r = ( r + quantity - 1 ) % quantity, nr--;
+        }
+    }
+
+    // Push the first two verticies
+    p_stack[stack++] = 0,
+    p_stack[stack++] = 1;
+
+    // Sweep the verticies between the top and the bottom
+    for (size_t j = 2; j + 1 < quantity; j++)
+    {
+
+        // The vertex is across from the stack, and sees all of it
+        if ( p_left[j] != p_left[p_stack[stack - 1]] )
+        {
+
+            // Fan out to the stack
+            for (size_t i = 0; i + 1 < stack; i++)
+                if ( geometry_triangulation_emit(p_triangulation, p_sorted[j], p_sorted[p_stack[i]], p_sorted[p_stack[i + 1]]) == 0 ) return 0;
+
+            // The stack is the last two verticies
+            stack = 0;
+            p_stack[stack++] = j - 1,
+            p_stack[stack++] = j;
+        }
+
+        // The vertex is on the same chain as the stack
+        else
+        {
+
+            // Initialized data
+            size_t last = p_stack[--stack];
+
+            // Cut off triangles while the diagonal is inside
+            while ( stack )
+            {
+
+                // Initialized data
+                int turn = geometry_point_ccw(geometry_triangulation_vertex(p_triangulation, p_sorted[j]), geometry_triangulation_vertex(p_triangulation, p_sorted[last]), geometry_triangulation_vertex(p_triangulation, p_sorted[p_stack[stack - 1]]));
+
+                // The diagonal is outside
+                if ( ( p_left[j] ) ? turn >= 0 : turn <= 0 ) break;
+
+                // Store the triangle
+                if ( geometry_triangulation_emit(p_triangulation, p_sorted[j], p_sorted[last], p_sorted[p_stack[stack - 1]]) == 0 ) return 0;
+
+                // Pop
+                last = p_stack[--stack];
+            }
+
+            // Push
+            p_stack[stack++] = last,
+            p_stack[stack++] = j;
+        }
+    }
+
+    // Fan out from the bottom
+    for (size_t i = 0; i + 1 < stack; i++)
+        if ( geometry_triangulation_emit(p_triangulation, p_sorted[quantity - 1], p_sorted[p_stack[i]], p_sorted[p_stack[i + 1]]) == 0 ) return 0;
+
+    // Success
+    return 1;
+}
+
+static int geometry_triangulation_sweep ( geometry_triangulation *p_triangulation )
+{
+
+    // Initialized data
+    size_t                        quantity          = p_triangulation->quantity,
+                                  diagonal_quantity = 0,
+                                  slot_quantity     = 0;
+    geometry_treap                _status           = { 0 };
+    geometry_triangulation_event *p_events          = (void *) 0;
+    geometry_triangulation_slot  *p_slots           = (void *) 0;
+    size_t                       *p_helpers         = (void *) 0,
+                                 *p_diagonals       = (void *) 0,
+                                 *p_offsets         = (void *) 0,
+                                 *p_twins           = (void *) 0,
+                                 *p_ring            = (void *) 0,
+                                 *p_sorted          = (void *) 0,
+                                 *p_stack           = (void *) 0;
+    unsigned char                *p_types           = (void *) 0;
+    bool                         *p_used            = (void *) 0,
+                                 *p_left            = (void *) 0;
+    void                         *p_block           = (void *) 0;
+
+    // Allocate memory. Each vertex adds at most two diagonals, and each
+    // diagonal has a slot in each direction.
+    p_block = GEOMETRY_REALLOC(0,
+        sizeof(geometry_triangulation_event) * quantity +
+        sizeof(geometry_triangulation_slot)  * quantity * 5 +
+        sizeof(size_t)                       * ( quantity * 13 + 1 ) +
+        sizeof(bool)                         * quantity * 6 +
+        sizeof(unsigned char)                * quantity
+    );
+
+    // Error check
+    if ( p_block == (void *) 0 ) goto no_mem;
+
+    // Carve the block
+    p_events    = p_block,
+    p_slots     = (geometry_triangulation_slot *) ( p_events + quantity ),
+    p_helpers   = (size_t *) ( p_slots + quantity * 5 ),
+    p_diagonals = p_helpers   + quantity,
+    p_twins     = p_diagonals + quantity * 4,
+    p_ring      = p_twins     + quantity * 4,
+    p_sorted    = p_ring      + quantity,
+    p_stack     = p_sorted    + quantity,
+    p_offsets   = p_stack     + quantity,
+    p_used      = (bool *) ( p_offsets + quantity + 1 ),
+    p_left      = p_used + quantity * 5,
+    p_types     = (unsigned char *) ( p_left + quantity );
+
+    // Construct the status
+    if ( geometry_treap_construct(&_status, quantity) == 0 ) goto failed_to_construct_status;
+
+    // Classify each vertex, and order the verticies from the top down
+    for (size_t i = 0; i < quantity; i++)
+    {
+
+        // Initialized data
+        geometry_point *p_previous = geometry_triangulation_vertex(p_triangulation, ( i + quantity - 1 ) % quantity),
+                       *p_vertex   = geometry_triangulation_vertex(p_triangulation, i),
+                       *p_next     = geometry_triangulation_vertex(p_triangulation, ( i + 1 ) % quantity);
+        bool            previous   = geometry_triangulation_above(p_previous, p_vertex),
+                        next       = geometry_triangulation_above(p_next, p_vertex);
+        bool            convex     = ( geometry_point_ccw(p_previous, p_vertex, p_next) > 0 );
+
+        // Both neighbours are below
+        if      ( previous == false && next == false ) p_types[i] = ( convex ) ? GEOMETRY_TRIANGULATION_START : GEOMETRY_TRIANGULATION_SPLIT;
+
+        // Both neighbours are above
+        else if ( previous && next ) p_types[i] = ( convex ) ? GEOMETRY_TRIANGULATION_END : GEOMETRY_TRIANGULATION_MERGE;
+
+        // One neighbour is above, and the other is below
+        else p_types[i] = GEOMETRY_TRIANGULATION_REGULAR;
+
+        // Store the event
+        p_events[i] = (geometry_triangulation_event) { .point = *p_vertex, .position = i };
+    }
+
+    // Sort the events
+    qsort(p_events, quantity, sizeof(geometry_triangulation_event), geometry_triangulation_event_compare);
+
+    // Sweep from the top down. The status holds the edges with the inside
+    // of the polygon on their right, ordered left to right, and the helper
+    // of an edge is the lowest vertex above the sweep line that sees it.
+    // Any vertex that ends a chain below a helper that is a merge vertex
+    // gets a diagonal to it.
+    for (size_t e = 0; e < quantity; e++)
+    {
+
+        // Initialized data
+        size_t i        = p_events[e].position,
+               previous = ( i + quantity - 1 ) % quantity,
+               left     = GEOMETRY_TREAP_NONE;
+        bool   down     = false;
+
+        // Move the sweep line to the vertex
+        p_triangulation->p_point = geometry_triangulation_vertex(p_triangulation, i);
+
+        // A regular vertex on the way down has the inside of the polygon on its right
+        down = geometry_triangulation_above(geometry_triangulation_vertex(p_triangulation, previous), p_triangulation->p_point);
+
+        // Close the edge that ends here
+        if ( p_types[i] == GEOMETRY_TRIANGULATION_END   ||
+             p_types[i] == GEOMETRY_TRIANGULATION_MERGE ||
+             ( p_types[i] == GEOMETRY_TRIANGULATION_REGULAR && down ) )
+        {
+
+            // Connect to a merge vertex above
+            if ( p_types[p_helpers[previous]] == GEOMETRY_TRIANGULATION_MERGE )
+                p_diagonals[2 * diagonal_quantity + 0] = i,
+                p_diagonals[2 * diagonal_quantity + 1] = p_helpers[previous],
+                diagonal_quantity++;
+
+            // Remove the edge
+            if ( geometry_treap_remove(&_status, previous) == 0 ) goto failed_to_update_status;
+        }
+
+        // Find the edge left of the vertex, if the inside of the polygon is
+        // on the left of the vertex
+        if ( p_types[i] == GEOMETRY_TRIANGULATION_SPLIT ||
+             p_types[i] == GEOMETRY_TRIANGULATION_MERGE ||
+             ( p_types[i] == GEOMETRY_TRIANGULATION_REGULAR && down == false ) )
+        {
+
+            // Initialized data
+            size_t right = geometry_treap_lower_bound(&_status, geometry_triangulation_edge_locate, p_triangulation);
+
+            // The edge left of the first edge right of the vertex
+            left = ( right == GEOMETRY_TREAP_NONE ) ? geometry_treap_last(&_status) : geometry_treap_previous(&_status, right);
+
+            // Error check
+            if ( left == GEOMETRY_TREAP_NONE ) goto failed_to_update_status;
+
+            // Connect a split vertex to the helper, and any vertex to a
+            // merge vertex above
+            if ( p_types[i] == GEOMETRY_TRIANGULATION_SPLIT || p_types[p_helpers[left]] == GEOMETRY_TRIANGULATION_MERGE )
+                p_diagonals[2 * diagonal_quantity + 0] = i,
+                p_diagonals[2 * diagonal_quantity + 1] = p_helpers[left],
+                diagonal_quantity++;
+
+            // This vertex is the new helper
+            p_helpers[left] = i;
+        }
+
+        // Open the edge that starts here
+        if ( p_types[i] == GEOMETRY_TRIANGULATION_START ||
+             p_types[i] == GEOMETRY_TRIANGULATION_SPLIT ||
+             ( p_types[i] == GEOMETRY_TRIANGULATION_REGULAR && down ) )
+        {
+
+            // Insert the edge
+            if ( geometry_treap_insert(&_status, i, geometry_triangulation_edge_compare, p_triangulation) == 0 ) goto failed_to_update_status;
+
+            // This vertex is the helper
+            p_helpers[i] = i;
+        }
+    }
+
+    // Store a slot for each edge of the polygon, and for each direction of
+    // each diagonal
+    for (size_t i = 0; i < quantity; i++)
+        p_slots[slot_quantity++] = (geometry_triangulation_slot)
+        {
+            .p_source    = geometry_triangulation_vertex(p_triangulation, i),
+            .p_reference = geometry_triangulation_vertex(p_triangulation, ( i + 1 ) % quantity),
+            .p_target    = geometry_triangulation_vertex(p_triangulation, ( i + 1 ) % quantity),
+            .source      = i,
+            .target      = ( i + 1 ) % quantity,
+            .diagonal    = GEOMETRY_TREAP_NONE
+        };
+
+    for (size_t d = 0; d < diagonal_quantity; d++)
+        for (size_t s = 0; s < 2; s++)
+            p_slots[slot_quantity++] = (geometry_triangulation_slot)
+            {
+                .p_source    = geometry_triangulation_vertex(p_triangulation, p_diagonals[2 * d + s]),
+                .p_reference = geometry_triangulation_vertex(p_triangulation, ( p_diagonals[2 * d + s] + 1 ) % quantity),
+                .p_target    = geometry_triangulation_vertex(p_triangulation, p_diagonals[2 * d + 1 - s]),
+                .source      = p_diagonals[2 * d + s],
+                .target      = p_diagonals[2 * d + 1 - s],
+                .diagonal    = 2 * d + s
+            };
+
+    // Sort the slots around each vertex
+    qsort(p_slots, slot_quantity, sizeof(geometry_triangulation_slot), geometry_triangulation_slot_compare);
+
+    // Compute where the slots of each vertex start, and where each
+    // direction of each diagonal went
+    memset(p_offsets, 0, sizeof(size_t) * ( quantity + 1 ));
+    for (size_t s = 0; s < slot_quantity; s++)
+    {
+        p_offsets[p_slots[s].source + 1]++;
+        if ( p_slots[s].diagonal != GEOMETRY_TREAP_NONE ) p_twins[p_slots[s].diagonal] = s;
+        p_used[s] = false;
+    }
+    for (size_t i = 0; i < quantity; i++) p_offsets[i + 1] += p_offsets[i];
+
+    // Walk the boundary of each piece. The inside of a piece is on the left
+    // of its slots, so the slot after a slot is the one just clockwise of
+    // the way back.
+    for (size_t s = 0; s < slot_quantity; s++)
+    {
+
+        // Initialized data
+        size_t length = 0,
+               slot   = s;
+
+        // Skip walked slots
+        if ( p_used[s] ) continue;
+
+        // Walk the piece
+        do
+        {
+
+            // Error check
+            if ( length == quantity ) goto failed_to_walk_piece;
+
+            // Store the vertex
+            p_used[slot]     = true;
+            p_ring[length++] = p_slots[slot].source;
+
+            // The edge of the polygon into a vertex is clockwise of all of its slots
+            if ( p_slots[slot].diagonal == GEOMETRY_TREAP_NONE ) slot = p_offsets[p_slots[slot].target + 1] - 1;
+
+            // A diagonal into a vertex is clockwise of the slot before its twin
+            else slot = p_twins[p_slots[slot].diagonal ^ 1] - 1;
+
+        } while ( slot != s );
+
+        // Triangulate the piece
+        if ( geometry_triangulation_monotone(p_triangulation, p_ring, length, p_sorted, p_left, p_stack) == 0 ) goto failed_to_walk_piece;
+    }
+
+    // Clean up
+    geometry_treap_destroy(&_status);
+    p_block = GEOMETRY_REALLOC(p_block, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // geometry errors
+        {
+            failed_to_construct_status:
+                #ifndef NDEBUG
+                    log_error("[geometry] Failed to construct sweep status in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Clean up
+                p_block = GEOMETRY_REALLOC(p_block, 0);
+
+                // Error
+                return 0;
+
+            failed_to_update_status:
+            failed_to_walk_piece:
+
+                // Clean up
+                geometry_treap_destroy(&_status);
+                p_block = GEOMETRY_REALLOC(p_block, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}